@@ -6,11 +6,14 @@
 
 #include <al.h>
 #include <SDL_audio.h>
+#include <SDL_error.h>
 #include <SDL_stdinc.h>
 
 #include <exception>
 #include <filesystem>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace LouiEriksson::Engine {
 	
@@ -189,6 +192,66 @@ namespace LouiEriksson::Engine::Audio {
 		/** @brief Duration of the clip in seconds. */
 		scalar_t m_Duration;
 		
+		/**
+		 * @struct Decoded
+		 * @brief The samples of a sound file, decoded by Decode() but not yet buffered by OpenAL.
+		 */
+		struct Decoded final {
+			
+			friend AudioClip;
+			
+		private:
+			
+			SDL_AudioSpec m_Specification;
+			
+			Uint8* m_Data;
+			Uint32 m_Length;
+			
+		public:
+			
+			Decoded() noexcept :
+				m_Specification(),
+				m_Data(nullptr),
+				m_Length(0U) {}
+			
+			Decoded(Decoded&& _other) noexcept :
+				m_Specification(_other.m_Specification),
+				m_Data  (std::exchange(_other.m_Data,   nullptr)),
+				m_Length(std::exchange(_other.m_Length, 0U     )) {}
+			
+			Decoded             (const Decoded& _other) = delete;
+			Decoded& operator = (const Decoded& _other) = delete;
+			Decoded& operator =      (Decoded&& _other) = delete;
+			
+			~Decoded() {
+				if (m_Data != nullptr) { SDL_FreeWAV(m_Data); }
+			}
+			
+			/** @brief Size of the samples in bytes. */
+			[[nodiscard]] constexpr const Uint32& Length() const noexcept { return m_Length; }
+		};
+		
+		/**
+		 * @brief Decodes a WAV file.
+		 *
+		 * @note Makes no OpenAL calls, so may be called from any thread.
+		 *
+		 * @param[in] _path The path to the WAV file.
+		 * @return The decoded samples, ready to construct an AudioClip.
+		 * @throws std::runtime_error If the file could not be decoded.
+		 */
+		static Decoded Decode(const std::filesystem::path& _path) {
+			
+			Decoded result;
+			
+			// Load the audio data into a c-style byte array using SDL.
+			if (SDL_LoadWAV(_path.c_str(), &result.m_Specification, &result.m_Data, &result.m_Length) == nullptr) {
+				throw std::runtime_error("Failed to decode \"" + _path.string() + "\": " + SDL_GetError());
+			}
+			
+			return result;
+		}
+		
 		/**
 		 * @class AudioClip
 		 * @brief Represents an audio clip.
@@ -198,7 +261,14 @@ namespace LouiEriksson::Engine::Audio {
 		 * @note The AudioClip class assumes that the audio file is in a supported format. Positional audio will not work for sound files loaded in stereo.
 		 */
 		explicit AudioClip(const std::filesystem::path& _path) :
-			m_Format({}),
+			AudioClip(Decode(_path)) {}
+		
+		/**
+		 * @brief Creates an audio clip from samples decoded by Decode(), taking ownership of them.
+		 * @note Must be called on the thread which owns the OpenAL context.
+		 */
+		explicit AudioClip(Decoded&& _decoded) :
+			m_Format(_decoded.m_Specification),
 			m_Samples(),
 			m_ALBuffer(static_cast<ALuint>(AL_NONE))
 		{
@@ -206,13 +276,11 @@ namespace LouiEriksson::Engine::Audio {
 			alGenBuffers(1, &m_ALBuffer);
 		
 			{
-				SDL_AudioSpec spec;
+				const auto& spec = _decoded.m_Specification;
 				
-				// Load the audio data into a c-style byte array using SDL.
-				SDL_LoadWAV(_path.c_str(), &spec, &m_Samples.m_Data, &m_Samples.m_Length);
+				m_Samples.m_Data   = std::exchange(_decoded.m_Data,   nullptr);
+				m_Samples.m_Length = std::exchange(_decoded.m_Length, 0U     );
 				
-				m_Format.m_Specification = spec;
-	
 				// Compute the duration of the audio file by performing the following operation:
 				m_Duration = static_cast<scalar_t>(m_Samples.m_Length) /	                           // Sample Count
 						     static_cast<scalar_t>(spec.freq)          /	                           // Sample Rate
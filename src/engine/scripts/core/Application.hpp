@@ -12,12 +12,14 @@
 #include "../physics/Physics.hpp"
 #include "../ui/GUI.hpp"
 #include "Debug.hpp"
+#include "Profiler.hpp"
 #include "Resources.hpp"
 #include "SDL_scancode.h"
 #include "Settings.hpp"
 #include "Time.hpp"
 #include "Types.hpp"
 #include "utils/Hashmap.hpp"
+#include "utils/JobSystem.hpp"
 #include "utils/Random.hpp"
 #include "utils/Utils.hpp"
 #include "Window.hpp"
@@ -80,7 +82,10 @@ namespace LouiEriksson::Engine {
 		 * @see Physics::Physics::Dispose()
 		 * @see Input::Input::Dispose()
 		 * @see Audio::Sound::Dispose()
+		 * @see Threading::JobSystem::Dispose()
 		 * @see Networking::Requests::Dispose()
+		 * @see Settings::Dispose()
+		 * @see Resources::Dispose()
 		 * @see SDL_Quit()
 		 * @see Debug::Flush()
 		 *
@@ -110,7 +115,9 @@ namespace LouiEriksson::Engine {
 				   Physics:: Physics::Dispose();
 				     Input::   Input::Dispose();
 				     Audio::   Sound::Dispose();
+				Threading::JobSystem::Dispose();
 				Networking::Requests::Dispose();
+				            Settings::Dispose();
 				           Resources::Dispose();
 						   
 			    try {
@@ -270,6 +277,7 @@ namespace LouiEriksson::Engine {
 					(void)SDL_CaptureMouse(SDL_TRUE);
 					
 					               Random::Init(0U); // Use a constant seed (like '0') for deterministic behaviour.
+					 Threading::JobSystem::Init();
 					     Audio::    Sound::Init();
 					            Resources::Init();
 					             Settings::Init();
@@ -294,6 +302,10 @@ namespace LouiEriksson::Engine {
 							// Get the beginning of the frame for timing purposes.
 							const auto frame_start = std::chrono::high_resolution_clock::now();
 							
+							Profiler::Frame();
+							
+							PROFILE_ZONE("Frame");
+							
 							if (s_ReloadScene) {
 								s_ReloadScene = false;
 								LoadScene("levels/engine_test.scene");
@@ -314,10 +326,11 @@ namespace LouiEriksson::Engine {
 							}
 							
 							/* INPUT */
-							Input::Input::Tick();
-							
-							// Handle events:
 							{
+								PROFILE_ZONE("Input");
+								
+								Input::Input::Tick();
+								
 								// Process window resize event:
 								if (const auto items = Input::Input::Event::Get(SDL_WINDOWEVENT)) {
 									
@@ -343,44 +356,66 @@ namespace LouiEriksson::Engine {
 								if (Input::Input::Event::Get(SDL_QUIT)) {
 									Application::Quit();
 								}
+								
+								// Use the '~' key (on ANSI keyboard layouts or '`' key on UK layout) to enter debug mode.
+								if (Input::Input::Key::GetDown(SDL_SCANCODE_GRAVE)) {
+									UI::GUI::s_DrawDebugWindows = !UI::GUI::s_DrawDebugWindows;
+								}
+								
+								/* UPDATE CURSOR STATE */
+								Input::Cursor::Update();
 							}
 							
-							// Use the '~' key (on ANSI keyboard layouts or '`' key on UK layout) to enter debug mode.
-							if (Input::Input::Key::GetDown(SDL_SCANCODE_GRAVE)) {
-								UI::GUI::s_DrawDebugWindows = !UI::GUI::s_DrawDebugWindows;
+							/* STREAMING */
+							{
+								PROFILE_ZONE("Streaming");
+								
+								// Upload assets which have been loaded asynchronously.
+								Resources::Update();
 							}
 							
-							/* UPDATE CURSOR STATE */
-							Input::Cursor::Update();
-							
 							/* FIXED UPDATE */
-							
-							// Runs as many times as needed to restore the physics step below zero.
-							while (physics_step >= 0.0) {
-								
-								// Tick the physics engine.
-								Physics::Physics::Tick(Time::FixedDeltaTime<btScalar>());
-								
-								// Tick the scene's fixed update.
-								s_Scene->FixedTick();
+							{
+								PROFILE_ZONE("Fixed Update");
 								
-								// Subtract delta time from the physics step.
-								physics_step -= Time::FixedUnscaledDeltaTime<tick_t>();
+								// Runs as many times as needed to restore the physics step below zero.
+								while (physics_step >= 0.0) {
+									
+									// Tick the physics engine.
+									Physics::Physics::Tick(Time::FixedDeltaTime<btScalar>());
+									
+									// Tick the scene's fixed update.
+									s_Scene->FixedTick();
+									
+									// Subtract delta time from the physics step.
+									physics_step -= Time::FixedUnscaledDeltaTime<tick_t>();
+								}
 							}
 							
 							/* UPDATE */
-							s_Scene->Tick(renderFlags);
-							
-							// Reset render flags after rendering.
-							renderFlags = Graphics::Camera::RenderFlags::NONE;
+							{
+								PROFILE_ZONE("Update");
+								
+								s_Scene->Tick(renderFlags);
+								
+								// Reset render flags after rendering.
+								renderFlags = Graphics::Camera::RenderFlags::NONE;
+							}
 							
 							/* GUI UPDATE */
-							UI::GUI::OnGUI(s_MainWindow);
+							{
+								PROFILE_ZONE("GUI");
+								
+								UI::GUI::OnGUI(s_MainWindow);
+							}
 							
 							/* UPDATE WINDOWS */
-							const auto& windows = Window::s_Windows.Values();
-							for (const auto& window : windows) {
-								window->Update();
+							{
+								PROFILE_ZONE("Window Swap");
+								
+								for (const auto& kvp : Window::s_Windows.View()) {
+									kvp.second->Update();
+								}
 							}
 							
 							/* UPDATE TIMERS */
@@ -0,0 +1,92 @@
+#ifndef FINALYEARPROJECT_ASSETHANDLE_HPP
+#define FINALYEARPROJECT_ASSETHANDLE_HPP
+
+#include <memory>
+#include <utility>
+
+namespace LouiEriksson::Engine {
+	
+	class Resources;
+	
+	/**
+	 * @class AssetHandle
+	 * @brief Handle to an asset which is being loaded asynchronously.
+	 *
+	 * @details Until the asset is ready, the handle refers to a placeholder asset. Once the asset is ready, the handle refers to it,
+	 *          or to the "error" asset if it failed to load. Every copy of a handle observes the same request.
+	 *
+	 * @tparam T The type of the asset.
+	 *
+	 * @note Not thread-safe. Handles are fulfilled on the main thread, by Resources::Update().
+	 * @see Resources::GetAsync()
+	 */
+	template<typename T>
+	class AssetHandle final {
+		
+		friend Resources;
+	
+	public:
+		
+		/**
+		 * @enum Status
+		 * @brief Progress of the request.
+		 */
+		enum Status : unsigned char {
+			Pending, /**< @brief The asset is being decoded, or is waiting to be uploaded. */
+			  Ready, /**< @brief The asset has loaded. */
+			 Failed  /**< @brief The asset is missing, or could not be loaded. */
+		};
+	
+	private:
+		
+		struct State final {
+			
+			Status m_Status;
+			
+			/** @brief The asset, or (while pending) the placeholder. */
+			std::shared_ptr<T> m_Item;
+		};
+		
+		std::shared_ptr<State> m_State;
+		
+		AssetHandle(const Status& _status, std::shared_ptr<T> _item) :
+			m_State(std::make_shared<State>(State { _status, std::move(_item) })) {}
+		
+		/** @brief Completes the request. Invoked by Resources. */
+		void Fulfil(const Status& _status, std::shared_ptr<T> _item) const {
+			
+			m_State->m_Status = _status;
+			m_State->m_Item   = std::move(_item);
+		}
+	
+	public:
+		
+		/** @brief Constructs a handle which refers to no request. */
+		AssetHandle() noexcept = default;
+		
+		/** @brief Returns true if the handle refers to a request. */
+		[[nodiscard]] bool Valid() const noexcept { return m_State != nullptr; }
+		
+		/** @brief Returns the progress of the request, or Failed if the handle refers to no request. */
+		[[nodiscard]] Status GetStatus() const noexcept {
+			return m_State != nullptr ? m_State->m_Status : Failed;
+		}
+		
+		/** @brief Returns true if the request is still in progress. */
+		[[nodiscard]] bool IsPending() const noexcept { return GetStatus() == Pending; }
+		
+		/** @brief Returns true if the asset has loaded. */
+		[[nodiscard]] bool IsReady() const noexcept { return GetStatus() == Ready; }
+		
+		/**
+		 * @brief Returns the asset if it is ready, otherwise the placeholder (or "error") asset.
+		 * @note May be null if there is no placeholder for the type of asset.
+		 */
+		[[nodiscard]] std::shared_ptr<T> Get() const noexcept {
+			return m_State != nullptr ? m_State->m_Item : nullptr;
+		}
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_ASSETHANDLE_HPP
@@ -0,0 +1,133 @@
+#ifndef FINALYEARPROJECT_ASSETID_HPP
+#define FINALYEARPROJECT_ASSETID_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string_view>
+
+namespace LouiEriksson::Engine {
+	
+	class Resources;
+	
+	/**
+	 * @class AssetId
+	 * @brief Identifier of an asset, formed from the 64-bit FNV-1a hash of its name.
+	 *
+	 * @details Identifiers of literal names are computed at compile time using the "_asset" suffix, so that no string is hashed at runtime:
+	 * @code
+	 * auto material = Resources::Get<Graphics::Material>("side"_asset);
+	 * @endcode
+	 *
+	 * @see AssetRef
+	 */
+	class AssetId final {
+	
+	private:
+		
+		uint64_t m_Hash;
+	
+	public:
+		
+		/** @brief Constructs an identifier which refers to no asset. */
+		constexpr AssetId() noexcept :
+			m_Hash(0U) {}
+		
+		/** @brief Constructs the identifier of the asset with the given name. */
+		constexpr explicit AssetId(const std::string_view& _name) noexcept :
+			m_Hash(Hash(_name)) {}
+		
+		/**
+		 * @brief Computes the 64-bit FNV-1a hash of a name.
+		 *
+		 * @param[in] _name The name to hash.
+		 * @return The hash of the name.
+		 */
+		[[nodiscard]] static constexpr uint64_t Hash(const std::string_view& _name) noexcept {
+			
+			uint64_t result = 0xCBF29CE484222325ULL;
+			
+			for (const auto& c : _name) {
+				result = (result ^ static_cast<uint8_t>(c)) * 0x100000001B3ULL;
+			}
+			
+			return result;
+		}
+		
+		/** @brief Returns the hash of the name of the asset. */
+		[[nodiscard]] constexpr const uint64_t& Value() const noexcept { return m_Hash; }
+		
+		/** @brief Returns true if the identifier refers to an asset. */
+		[[nodiscard]] constexpr bool Valid() const noexcept { return m_Hash != 0U; }
+		
+		[[nodiscard]] constexpr bool operator == (const AssetId& _other) const noexcept { return m_Hash == _other.m_Hash; }
+		[[nodiscard]] constexpr bool operator != (const AssetId& _other) const noexcept { return m_Hash != _other.m_Hash; }
+	};
+	
+	/**
+	 * @class AssetRef
+	 * @brief Cached reference to an asset of a specific type.
+	 *
+	 * @details The identifier is resolved to the slot of the asset on first use, after which the asset is retrieved by indexing an array.
+	 *          Slots are never reused by a different asset, so references may be cached indefinitely (e.g. as statics). If the assets are
+	 *          re-indexed, the asset is replaced within its slot and the reference observes the replacement.
+	 *
+	 * @tparam T The type of the asset.
+	 *
+	 * @note Not thread-safe. Assets are retrieved on the main thread.
+	 * @see Resources::Get()
+	 */
+	template<typename T>
+	class AssetRef final {
+		
+		friend Resources;
+	
+	private:
+		
+		static constexpr size_t s_Unresolved { std::numeric_limits<size_t>::max() };
+		
+		AssetId m_Id;
+		
+		/** @brief Slot of the asset within its bucket, or s_Unresolved if it has not yet been resolved. */
+		mutable size_t m_Slot;
+	
+	public:
+		
+		/** @brief Constructs a reference which refers to no asset. */
+		constexpr AssetRef() noexcept :
+			m_Id(),
+			m_Slot(s_Unresolved) {}
+		
+		/** @brief Constructs a reference to the asset with the given identifier. */
+		constexpr AssetRef(const AssetId& _id) noexcept : // NOLINT(*-explicit-constructor)
+			m_Id(_id),
+			m_Slot(s_Unresolved) {}
+		
+		/** @brief Returns the identifier of the asset. */
+		[[nodiscard]] constexpr const AssetId& Id() const noexcept { return m_Id; }
+	};
+	
+	/**
+	 * @brief Returns the identifier of the asset with the given name.
+	 * @see AssetId
+	 */
+	[[nodiscard]] constexpr AssetId operator ""_asset(const char* _name, const size_t _length) noexcept {
+		return AssetId(std::string_view(_name, _length));
+	}
+
+} // LouiEriksson::Engine
+
+namespace std {
+	
+	template<>
+	struct hash<LouiEriksson::Engine::AssetId> {
+		
+		size_t operator()(const LouiEriksson::Engine::AssetId& _id) const noexcept {
+			return static_cast<size_t>(_id.Value());
+		}
+	};
+
+} // std
+
+#endif //FINALYEARPROJECT_ASSETID_HPP
@@ -0,0 +1,680 @@
+#ifndef FINALYEARPROJECT_ASSETIMPORTER_HPP
+#define FINALYEARPROJECT_ASSETIMPORTER_HPP
+
+#include "../graphics/Mesh.hpp"
+#include "../graphics/Texture.hpp"
+#include "../graphics/textures/BlockCompression.hpp"
+#include "CookedAsset.hpp"
+#include "Debug.hpp"
+#include "Types.hpp"
+#include "utils/Utils.hpp"
+
+#ifndef STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_STATIC
+#include "stb_image.h" // STB IMAGE
+#endif
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @class AssetImporter
+	 * @brief Decodes source assets into the data of their cooked form.
+	 *
+	 * @details Used by Resources when an asset has no up-to-date cooked file, and offline by fyp_cook to produce one.
+	 *          Makes no OpenGL calls, so may be called from any thread.
+	 *
+	 * @see CookedAsset
+	 */
+	class AssetImporter final {
+	
+	public:
+		
+		/**
+		 * @struct Image
+		 * @brief Pixels of an image file, decoded using stb_image.
+		 */
+		struct Image final {
+			
+			int m_Width;
+			int m_Height;
+			int m_Channels;
+			
+			/** @brief Type of each channel (GL_FLOAT or GL_UNSIGNED_BYTE). */
+			GLenum m_Type;
+			
+			std::unique_ptr<void, void(*)(void*)> m_Data;
+			
+			/**
+			 * @param[in] _path The path to the image file. HDR and EXR files are decoded as floats.
+			 * @param[in] _channels The number of channels to decode.
+			 * @throws std::runtime_error If the image could not be decoded.
+			 */
+			Image(const std::filesystem::path& _path, const int& _channels) :
+				m_Width(-1),
+				m_Height(-1),
+				m_Channels(_channels),
+				m_Type(GL_NONE),
+				m_Data(nullptr, stbi_image_free)
+			{
+				if (strcmp(_path.extension().string().c_str(), ".hdr") == 0 ||
+				    strcmp(_path.extension().string().c_str(), ".exr") == 0
+				) {
+					m_Type = GL_FLOAT;
+					m_Data.reset(stbi_loadf(_path.string().c_str(), &m_Width, &m_Height, nullptr, _channels));
+				}
+				else {
+					m_Type = GL_UNSIGNED_BYTE;
+					m_Data.reset(stbi_load(_path.string().c_str(), &m_Width, &m_Height, nullptr, _channels));
+				}
+				
+				if (m_Data == nullptr) {
+					throw std::runtime_error("Failed loading texture data!");
+				}
+			}
+			
+			/** @brief Returns the size of the pixels in bytes. */
+			[[nodiscard]] size_t Size() const noexcept {
+				
+				return static_cast<size_t>(m_Width) * static_cast<size_t>(m_Height) * static_cast<size_t>(m_Channels) *
+					(m_Type == GL_FLOAT ? sizeof(float) : sizeof(unsigned char));
+			}
+		};
+	
+	private:
+		
+		/**
+		 * @brief Averages each 2x2 block of texels of a mip level to produce the next.
+		 *
+		 * @details Odd dimensions are handled by clamping to the edge of the source level.
+		 *          Colour channels of sRGB textures are averaged in linear space.
+		 */
+		template<typename T>
+		static void Downsample(const T* _source, const size_t& _width, const size_t& _height, T* _destination, const size_t& _channels, const bool& _sRGB) {
+			
+			const auto width  = std::max<size_t>(_width  / 2U, 1U);
+			const auto height = std::max<size_t>(_height / 2U, 1U);
+			
+			// Lookup table converting 8-bit sRGB values to linear values.
+			static const auto s_Linear = [] {
+				
+				std::array<float, 256U> result {};
+				
+				for (size_t i = 0U; i < result.size(); ++i) {
+					
+					const auto c = static_cast<float>(i) / 255.0F;
+					
+					result[i] = c <= 0.04045F ? c / 12.92F : std::pow((c + 0.055F) / 1.055F, 2.4F);
+				}
+				
+				return result;
+			}();
+			
+			for (size_t y = 0U; y < height; ++y) {
+				
+				const auto y0 = std::min(y * 2U,        _height - 1U);
+				const auto y1 = std::min((y * 2U) + 1U, _height - 1U);
+				
+				for (size_t x = 0U; x < width; ++x) {
+					
+					const auto x0 = std::min(x * 2U,        _width - 1U);
+					const auto x1 = std::min((x * 2U) + 1U, _width - 1U);
+					
+					const std::array<const T*, 4U> texels {
+						_source + (((y0 * _width) + x0) * _channels),
+						_source + (((y0 * _width) + x1) * _channels),
+						_source + (((y1 * _width) + x0) * _channels),
+						_source + (((y1 * _width) + x1) * _channels)
+					};
+					
+					auto* const output = _destination + (((y * width) + x) * _channels);
+					
+					for (size_t c = 0U; c < _channels; ++c) {
+						
+						if constexpr (std::is_floating_point_v<T>) {
+							output[c] = (texels[0U][c] + texels[1U][c] + texels[2U][c] + texels[3U][c]) * static_cast<T>(0.25);
+						}
+						else if (_sRGB && c < 3U) {
+							
+							const auto linear = (s_Linear[texels[0U][c]] + s_Linear[texels[1U][c]] + s_Linear[texels[2U][c]] + s_Linear[texels[3U][c]]) * 0.25F;
+							
+							const auto encoded = linear <= 0.0031308F ? linear * 12.92F : (1.055F * std::pow(linear, 1.0F / 2.4F)) - 0.055F;
+							
+							output[c] = static_cast<T>(std::clamp(std::lround(encoded * 255.0F), 0L, 255L));
+						}
+						else {
+							output[c] = static_cast<T>((static_cast<unsigned>(texels[0U][c]) + texels[1U][c] + texels[2U][c] + texels[3U][c] + 2U) / 4U);
+						}
+					}
+				}
+			}
+		}
+	
+	public:
+		
+		 AssetImporter()                            = delete;
+		 AssetImporter(const AssetImporter& _other) = delete;
+		~AssetImporter()                            = delete;
+		
+		AssetImporter& operator = (const AssetImporter& _other) = delete;
+		
+		/** @brief Returns true if the given pixel format is sRGB-encoded. */
+		static constexpr bool IsSRGB(const GLenum& _pixelFormat) noexcept {
+			
+			return _pixelFormat == GL_SRGB       || _pixelFormat == GL_SRGB8 ||
+			       _pixelFormat == GL_SRGB_ALPHA || _pixelFormat == GL_SRGB8_ALPHA8;
+		}
+		
+		/** @brief Returns the pixel format of a texture, based on its path. */
+		static GLenum TextureFormat(const std::filesystem::path& _path) {
+			
+			GLenum result = GL_SRGB;
+			
+			if (_path.has_extension()) {
+				
+				     if (_path.extension() == ".hdr") { result = GL_RGBA32F; }
+				else if (_path.extension() == ".exr") { result = GL_RGBA32F; }
+				else if (_path.has_parent_path()) {
+					
+					if (_path.parent_path().string().find("linear") != 0U) {
+						result = GL_RGBA32F;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Decodes an image file into a Texture without mip levels.
+		 *
+		 * @param[in] _path The path to the image file.
+		 * @param[in] _pixelFormat The internal format of the Texture.
+		 * @throws std::runtime_error If the image could not be decoded.
+		 * @see GenerateMips()
+		 */
+		static CookedAsset::TextureData ImportTexture(const std::filesystem::path& _path, const GLenum& _pixelFormat) {
+			
+			int channels;
+			GLenum texture_format;
+			
+			Graphics::Texture::GetFormatData(_pixelFormat, texture_format, channels);
+			
+			const auto image = std::make_shared<const Image>(_path, channels);
+			
+			CookedAsset::TextureData result;
+			result.m_PixelFormat   = _pixelFormat;
+			result.m_TextureFormat = texture_format;
+			result.m_Type          = image->m_Type;
+			result.m_Channels      = static_cast<uint32_t>(channels);
+			result.m_Levels        = { { static_cast<uint32_t>(image->m_Width), static_cast<uint32_t>(image->m_Height), 0U, image->Size() } };
+			result.m_Pixels        = static_cast<const char*>(image->m_Data.get());
+			result.m_Size          = image->Size();
+			result.m_Owner         = image;
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Replaces the mip levels of a Texture with a full mip chain generated from its first level.
+		 * @see Downsample()
+		 */
+		static void GenerateMips(CookedAsset::TextureData& _texture) {
+			
+			if (_texture.m_Levels.empty()) {
+				throw std::runtime_error("Texture has no pixels!");
+			}
+			
+			const auto stride = static_cast<size_t>(_texture.m_Channels) * (_texture.m_Type == GL_FLOAT ? sizeof(float) : sizeof(unsigned char));
+			
+			const auto sRGB = IsSRGB(_texture.m_PixelFormat);
+			
+			/* LAYOUT */
+			std::vector<CookedAsset::TextureData::Level> levels { _texture.m_Levels.front() };
+			levels.front().m_Offset = 0U;
+			
+			while (levels.back().m_Width > 1U || levels.back().m_Height > 1U) {
+				
+				const auto& previous = levels.back();
+				
+				const auto width  = std::max(previous.m_Width  / 2U, 1U);
+				const auto height = std::max(previous.m_Height / 2U, 1U);
+				
+				levels.push_back({ width, height, previous.m_Offset + previous.m_Size, static_cast<uint64_t>(width) * height * stride });
+			}
+			
+			auto pixels = std::make_shared<std::vector<char>>(static_cast<size_t>(levels.back().m_Offset + levels.back().m_Size));
+			
+			std::memcpy(pixels->data(), _texture.m_Pixels + _texture.m_Levels.front().m_Offset, static_cast<size_t>(levels.front().m_Size));
+			
+			/* DOWNSAMPLE */
+			for (size_t i = 1U; i < levels.size(); ++i) {
+				
+				const auto& source      = levels[i - 1U];
+				const auto& destination = levels[i];
+				
+				if (_texture.m_Type == GL_FLOAT) {
+					
+					Downsample(
+						reinterpret_cast<const float*>(pixels->data() + source.m_Offset), source.m_Width, source.m_Height,
+						reinterpret_cast<float*>(pixels->data() + destination.m_Offset),
+						_texture.m_Channels,
+						false
+					);
+				}
+				else {
+					
+					Downsample(
+						reinterpret_cast<const unsigned char*>(pixels->data() + source.m_Offset), source.m_Width, source.m_Height,
+						reinterpret_cast<unsigned char*>(pixels->data() + destination.m_Offset),
+						_texture.m_Channels,
+						sRGB
+					);
+				}
+			}
+			
+			_texture.m_Levels = std::move(levels);
+			_texture.m_Pixels = pixels->data();
+			_texture.m_Size   = pixels->size();
+			_texture.m_Owner  = std::move(pixels);
+		}
+		
+		/**
+		 * @brief Selects the block-compressed format of a Texture, based on its path and the pixels of its first level.
+		 *
+		 * @details Float Textures are encoded as BC6H. Normal maps (identified by name) are encoded as BC5, from which the shaders
+		 *          reconstruct the z component. Opaque greyscale Textures are encoded as BC4, other opaque Textures as BC1, and the
+		 *          remainder as BC3. sRGB Textures are never encoded as BC4, which has no sRGB variant.
+		 */
+		static Graphics::BlockCompression::Format CompressionOf(const std::filesystem::path& _path, const CookedAsset::TextureData& _texture) {
+			
+			using Graphics::BlockCompression;
+			
+			if (_texture.m_Levels.empty()) {
+				throw std::runtime_error("Texture has no pixels!");
+			}
+			
+			auto name = _path.stem().string();
+			
+			std::transform(name.begin(), name.end(), name.begin(), [](const unsigned char& _c) { return static_cast<char>(std::tolower(_c)); });
+			
+			BlockCompression::Format result;
+			
+			if (_texture.m_Type == GL_FLOAT) {
+				result = BlockCompression::BC6H;
+			}
+			else if (_texture.m_Channels == 2U || name.find("normal") != std::string::npos || name.find("_nor") != std::string::npos) {
+				result = BlockCompression::BC5;
+			}
+			else {
+				
+				const auto& level    = _texture.m_Levels.front();
+				const auto  channels = static_cast<size_t>(_texture.m_Channels);
+				
+				const auto* pixels = reinterpret_cast<const unsigned char*>(_texture.m_Pixels + level.m_Offset);
+				
+				auto grey   = true;
+				auto opaque = true;
+				
+				for (size_t i = 0U; i < level.m_Size && (grey || opaque); i += channels) {
+					
+					if (channels >= 3U) {
+						grey = grey && pixels[i] == pixels[i + 1U] && pixels[i] == pixels[i + 2U];
+					}
+					
+					if (channels == 4U) {
+						opaque = opaque && pixels[i + 3U] == 255U;
+					}
+				}
+				
+				     if (!opaque)                                 { result = BlockCompression::BC3; }
+				else if (grey && !IsSRGB(_texture.m_PixelFormat)) { result = BlockCompression::BC4; }
+				else                                              { result = BlockCompression::BC1; }
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the internal format (GLenum) of a Texture encoded as the given block-compressed format.
+		 */
+		static GLenum CompressedFormat(const Graphics::BlockCompression::Format& _format, const GLenum& _pixelFormat) {
+			
+			using Graphics::BlockCompression;
+			
+			GLenum result;
+			
+			switch (_format) {
+				case BlockCompression::BC1:  { result = IsSRGB(_pixelFormat) ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;  break; }
+				case BlockCompression::BC3:  { result = IsSRGB(_pixelFormat) ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break; }
+				case BlockCompression::BC4:  { result = GL_COMPRESSED_RED_RGTC1;              break; }
+				case BlockCompression::BC5:  { result = GL_COMPRESSED_RG_RGTC2;               break; }
+				case BlockCompression::BC6H: { result = GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT; break; }
+				default: {
+					throw std::runtime_error("Not implemented!");
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a level of an uncompressed Texture as the input of BlockCompression.
+		 */
+		static Graphics::BlockCompression::Surface SurfaceOf(const CookedAsset::TextureData& _texture, const size_t& _level) {
+			
+			const auto& level = _texture.m_Levels.at(_level);
+			
+			return {
+				_texture.m_Pixels + level.m_Offset,
+				level.m_Width,
+				level.m_Height,
+				_texture.m_Channels,
+				_texture.m_Type == GL_FLOAT
+			};
+		}
+		
+		/**
+		 * @brief Replaces the pixels of every level of a Texture with their block-compressed encoding.
+		 *
+		 * @param[in,out] _texture The Texture, which must not already be compressed.
+		 * @param[in] _format The format to encode into (see CompressionOf()).
+		 *
+		 * @see BlockCompression
+		 */
+		static void Compress(CookedAsset::TextureData& _texture, const Graphics::BlockCompression::Format& _format) {
+			
+			using Graphics::BlockCompression;
+			
+			if (_texture.m_Compression != 0U) {
+				throw std::runtime_error("Texture is already compressed!");
+			}
+			
+			/* LAYOUT */
+			std::vector<CookedAsset::TextureData::Level> levels;
+			levels.reserve(_texture.m_Levels.size());
+			
+			uint64_t offset = 0U;
+			
+			for (const auto& level : _texture.m_Levels) {
+				
+				levels.push_back({ level.m_Width, level.m_Height, offset, BlockCompression::Size(_format, level.m_Width, level.m_Height) });
+				
+				offset += levels.back().m_Size;
+			}
+			
+			auto pixels = std::make_shared<std::vector<char>>(static_cast<size_t>(offset));
+			
+			/* ENCODE */
+			for (size_t i = 0U; i < levels.size(); ++i) {
+				BlockCompression::Encode(_format, SurfaceOf(_texture, i), pixels->data() + levels[i].m_Offset);
+			}
+			
+			_texture.m_Compression = CompressedFormat(_format, _texture.m_PixelFormat);
+			_texture.m_Levels      = std::move(levels);
+			_texture.m_Pixels      = pixels->data();
+			_texture.m_Size        = pixels->size();
+			_texture.m_Owner       = std::move(pixels);
+		}
+		
+		/**
+		 * @brief Imports the first mesh of a model file, computing its tangents if the file does not provide them.
+		 * @throws std::runtime_error If the file contains no meshes.
+		 */
+		static CookedAsset::MeshData ImportMesh(const std::filesystem::path& _path) {
+			
+			CookedAsset::MeshData result;
+			
+			/*
+			 * Implementation derived from Mesh.cpp and Mesh.h
+			 * provided with OBJLoader_v3 project in GACP labs.
+			 *
+			 * I added tangent calculations to the code derived from an implementation by Learn OpenGL:
+	         * de Vries, J. (n.d.). LearnOpenGL - Normal Mapping. [online] learnopengl.com. Available at: https://learnopengl.com/Advanced-Lighting/Normal-Mapping [Accessed 15 Dec. 2023].
+			 */
+			
+			Assimp::Importer importer;
+			const auto* const scene = importer.ReadFile(_path,
+					aiProcess_Triangulate | aiProcess_ImproveCacheLocality |
+					aiProcess_RemoveRedundantMaterials | aiProcess_OptimizeMeshes);
+			
+			assert(scene != nullptr &&
+				"No scene!");
+			
+			assert((scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) == 0u &&
+				"Incomplete!");
+			
+			assert(scene->mRootNode != nullptr &&
+				"No root node!");
+			
+			assert(scene->HasMeshes() &&
+				"No meshes!");
+			
+			if (scene == nullptr || scene->mNumMeshes == 0U) {
+				throw std::runtime_error("No meshes!");
+			}
+			
+			const auto* const mesh = scene->mMeshes[0U];
+			
+			assert(mesh->HasPositions() && "Mesh has no vertices!");
+			assert(mesh->HasNormals()   && "Mesh has no normals!" );
+			
+			Debug::Assert(
+					mesh->mNumVertices <= std::numeric_limits<uint32_t>::max(), "Vertex count exceeds the 32-bit limit and will be truncated. ",
+					Warning, true
+			);
+			
+			/* VERTEX DATA */
+			
+			// Get vertices, normals, and texture coordinates:
+			result.m_Vertices.reserve(mesh->mNumVertices);
+			 result.m_Normals.reserve(mesh->mNumVertices);
+			     result.m_UVs.reserve(mesh->mNumVertices);
+			
+			for (size_t j = 0U; j < mesh->mNumVertices; ++j) {
+				
+				const auto vert = mesh->mVertices[j];
+				const auto norm = mesh->mNormals [j];
+				const auto   uv = mesh->mTextureCoords[0U][j];
+				
+				result.m_Vertices.emplace_back(vert.x, vert.y, vert.z);
+				 result.m_Normals.emplace_back(norm.x, norm.y, norm.z);
+				     result.m_UVs.emplace_back(  uv.x,   uv.y        );
+			}
+			
+			/* INDEX DATA */
+			
+			const auto* const faces = mesh->mFaces;
+			
+			result.m_Indices.reserve(mesh->mNumVertices);
+			
+			for (size_t j = 0U; j < mesh->mNumFaces; ++j) {
+				for (size_t k = 0U; k < faces[j].mNumIndices; ++k) {
+					result.m_Indices.emplace_back(faces[j].mIndices[k]);
+				}
+			}
+			
+			/* TANGENTS */
+			
+			// Get tangents if they exist, otherwise compute them.
+			if (mesh->HasTangentsAndBitangents()) {
+				
+				result.m_Tangents[0U].reserve(mesh->mNumVertices);
+				result.m_Tangents[1U].reserve(mesh->mNumVertices);
+				
+				for (size_t j = 0U; j < mesh->mNumVertices; ++j) {
+					
+					const auto  tan =   mesh->mTangents[j];
+					const auto btan = mesh->mBitangents[j];
+					
+					result.m_Tangents[0U].emplace_back( tan.x,  tan.y,  tan.z);
+					result.m_Tangents[1U].emplace_back(btan.x, btan.y, btan.z);
+				}
+			}
+			else {
+				result.m_Tangents = Graphics::Mesh::GenerateTangents(result.m_Vertices, result.m_UVs, result.m_Indices);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Parses an MTL file.
+		 * @note Loads no Textures.
+		 */
+		static CookedAsset::MaterialData ImportMaterial(const std::filesystem::path& _path) {
+			
+			using MaterialData = CookedAsset::MaterialData;
+			
+			MaterialData result;
+			
+			std::fstream fs;
+			fs.open(_path, std::ios::in);
+			
+			if (fs.is_open()) {
+				
+				std::string line;
+				
+				while (std::getline(fs, line)) {
+					
+					auto subStrings = Utils::Split(line, ' ');
+					
+					if (!subStrings.empty()) {
+						
+						const auto& key = subStrings.at(0U);
+						
+						if (key == "Ka") {
+							Debug::Log("Ambient color loading not implemented... ", Warning, true);
+						}
+						else if (key == "Kd") {
+							
+							auto r = Utils::Parse<float>(subStrings.at(1U));
+							auto g = Utils::Parse<float>(subStrings.at(2U));
+							auto b = Utils::Parse<float>(subStrings.at(3U));
+							
+							result.m_AlbedoColor = { r, g, b, 1.0 };
+							
+							if (subStrings.size() > 4U) {
+								result.m_AlbedoColor.value().a = Utils::Parse<float>(subStrings.at(4U));
+							}
+						}
+						else if (key == "d" || key == "Tr") {
+							result.m_AlbedoColor.value().a = static_cast<float>(1.0 - std::clamp(Utils::Parse<double>(subStrings.at(1U)), 0.0, 1.0));
+						}
+						else if (key == "Ks") {
+							Debug::Log("Specular color loading not implemented... ", Warning, true);
+						}
+						else if (key == "illum") {
+							Debug::Log("Support for different lighting models is not implemented... ", Warning, true);
+						}
+						else if (key == "Ao") {
+							result.m_AO = Utils::Parse<float>(subStrings.at(1U));
+						}
+						else if (key == "Ns") {
+							result.m_Roughness = static_cast<float>(1.0 - (std::atan(Utils::Parse<float>(subStrings.at(1U))) / (M_PI / 2.0)));
+						}
+						else if (key == "Ke") {
+							
+							result.m_EmissionColor = {
+									Utils::Parse<float>(subStrings.at(1U)),
+									Utils::Parse<float>(subStrings.at(2U)),
+									Utils::Parse<float>(subStrings.at(3U))
+							};
+						}
+						else if (key == "Ni") {
+							Debug::Log("Optical density loading not implemented... ", Warning, true);
+						}
+						else if (key == "map_Kd") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::Albedo] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else if (key == "map_Ks") {
+							Debug::Log("Specular map loading not implemented... ", Warning, true);
+						}
+						else if (key == "map_Tr" || key == "map_d") {
+							Debug::Log("Transparency map loading not implemented... ", Warning, true);
+						}
+						else if (key == "bump" || key == "map_bump" || key == "bm") {
+							Debug::Log("Bump map loading not implemented... ", Warning, true);
+						}
+						else if (key == "disp") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::Displacement] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else if (key == "map_Pr") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::Roughness] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else if (key == "map_Pm") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::Metallic] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else if (key == "map_Ke") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::Emission] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else if (key == "norm") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::Normal] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else if (key == "map_Ao") {
+							
+							if (subStrings.size() >= 2U) {
+								result.m_Textures[MaterialData::AO] = std::filesystem::path(subStrings.at(1U)).stem().string();
+							}
+						}
+						else {
+							Debug::Log("Unknown MTL key \"" + std::string(key.data()) + "\" ", Warning, true);
+						}
+					}
+				}
+				
+				fs.close();
+			}
+			else {
+				throw std::runtime_error("Couldn't open filestream.");
+			}
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_ASSETIMPORTER_HPP
@@ -0,0 +1,521 @@
+#ifndef FINALYEARPROJECT_ASSETMANIFEST_HPP
+#define FINALYEARPROJECT_ASSETMANIFEST_HPP
+
+#include "Debug.hpp"
+#include "File.hpp"
+#include "utils/Hashmap.hpp"
+#include "utils/JobSystem.hpp"
+
+#include <json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @class AssetManifest
+	 * @brief Persistent index of the files beneath a directory.
+	 *
+	 * @details The type, size, modification time and content hash of each file are recorded and cached on disk.
+	 *          On subsequent runs the cache is validated incrementally: directories whose modification time is unchanged
+	 *          are not listed again, and only the files within them are checked for modification. Stale directories are
+	 *          rescanned, and modified files rehashed, in parallel using the JobSystem.
+	 */
+	class AssetManifest final {
+	
+	public:
+		
+		/**
+		 * @struct Entry
+		 * @brief A file recorded in the manifest.
+		 */
+		struct Entry final {
+			
+			std::filesystem::path m_Path;
+			
+			/** @brief Type of the file, as determined by the classifier. Empty if the type is unknown. */
+			std::string m_Type;
+			
+			/** @brief Size of the file, in bytes. */
+			uintmax_t m_Size;
+			
+			/** @brief Last write time of the file, in ticks of std::filesystem::file_time_type. */
+			int64_t m_Time;
+			
+			/** @brief FNV-1a hash of the contents of the file. Zero if the type is unknown. */
+			uint64_t m_Hash;
+		};
+		
+		/**
+		 * @struct Statistics
+		 * @brief Summary of the work performed by Refresh().
+		 */
+		struct Statistics final {
+			
+			/** @brief True if no valid cached manifest was found. */
+			bool m_Cold;
+			
+			size_t m_Directories; /**< @brief Number of directories in the manifest.          */
+			size_t m_Rescanned;   /**< @brief Number of directories which had to be listed.   */
+			size_t m_Files;       /**< @brief Number of files in the manifest.                */
+			size_t m_Hashed;      /**< @brief Number of files which had to be (re)hashed.     */
+			
+			std::chrono::nanoseconds m_Duration;
+		};
+		
+		/**
+		 * @brief Returns the type of a file, or an empty string if it is not an asset.
+		 * @note Only files with a type are hashed. Every file is reclassified on each refresh, so the cache never
+		 *       outlives changes to the classifier.
+		 */
+		using classifier_t = std::function<std::string(const std::filesystem::path&)>;
+	
+	private:
+		
+		/** @brief Version of the cache format. Caches of other versions are discarded. */
+		static constexpr int s_Version = 1;
+		
+		struct Directory final {
+			
+			int64_t m_Time;
+			
+			std::vector<std::filesystem::path> m_Subdirectories;
+			
+			std::vector<Entry> m_Files;
+			
+			/** @brief True if the directory had to be listed, rather than being validated against the cache. */
+			bool m_Rescanned;
+			
+			/** @brief True if the record differs from the cached record. */
+			bool m_Modified;
+			
+			/** @brief True if the directory no longer exists. */
+			bool m_Removed;
+		};
+		
+		std::vector<Entry> m_Entries;
+		
+		Statistics m_Statistics;
+		
+		AssetManifest() noexcept :
+			m_Statistics() {}
+		
+		static int64_t Time(const std::filesystem::file_time_type& _time) noexcept {
+			return static_cast<int64_t>(_time.time_since_epoch().count());
+		}
+		
+		/**
+		 * @brief Validates a directory against its cached record, or lists it if the record is stale or missing.
+		 *
+		 * @param[in] _path Path to the directory.
+		 * @param[in] _cached Cached record of the directory, or nullptr if there is none.
+		 * @param[in] _classify Function determining the type of each file.
+		 * @return An up-to-date record of the directory. Files whose hash is zero require hashing.
+		 *
+		 * @note The file system may change while scanning. A directory which cannot be read is reported as removed,
+		 *       and files which cannot be queried are skipped. Either also updates the modification time of the
+		 *       parent directory, so the next refresh lists it again.
+		 */
+		static Directory Scan(const std::filesystem::path& _path, const Directory* _cached, const classifier_t& _classify) {
+			
+			Directory result { 0, {}, {}, false, _cached == nullptr, false };
+			
+			std::error_code ec;
+			
+			if (const auto time = std::filesystem::last_write_time(_path, ec); !ec) {
+				result.m_Time = Time(time);
+			}
+			else {
+				result.m_Removed = true;
+				
+				return result;
+			}
+			
+			if (_cached != nullptr && _cached->m_Time == result.m_Time) {
+				
+				/*
+				 * The entries of the directory are unchanged, as adding, removing or renaming an entry updates the
+				 * modification time of the directory. Only the contents of the files themselves may have changed.
+				 */
+				result.m_Subdirectories = _cached->m_Subdirectories;
+				result.m_Files.reserve(_cached->m_Files.size());
+				
+				for (auto file : _cached->m_Files) {
+					
+					const auto size = std::filesystem::file_size(file.m_Path, ec);
+					const auto time = std::filesystem::last_write_time(file.m_Path, ec);
+					
+					if (ec) {
+						result.m_Rescanned = true;
+						
+						break;
+					}
+					
+					if (auto type = _classify(file.m_Path); file.m_Type != type) {
+						file.m_Type = std::move(type);
+						file.m_Hash = 0U;
+						
+						result.m_Modified = true;
+					}
+					
+					if (file.m_Size != size || file.m_Time != Time(time)) {
+						file.m_Size = size;
+						file.m_Time = Time(time);
+						file.m_Hash = 0U;
+						
+						result.m_Modified = true;
+					}
+					
+					result.m_Files.emplace_back(std::move(file));
+				}
+			}
+			else {
+				result.m_Rescanned = true;
+			}
+			
+			if (result.m_Rescanned) {
+				
+				result.m_Modified = true;
+				
+				result.m_Subdirectories.clear();
+				result.m_Files.clear();
+				
+				// Retain the hashes of unmodified files.
+				Hashmap<std::string, Entry> previous;
+				
+				if (_cached != nullptr) {
+					
+					for (const auto& file : _cached->m_Files) {
+						previous.Assign(file.m_Path.generic_string(), file);
+					}
+				}
+				
+				std::filesystem::directory_iterator iterator(_path, ec);
+				
+				for (; !ec && iterator != std::filesystem::directory_iterator(); iterator.increment(ec)) {
+					
+					const auto& item = *iterator;
+					
+					// Use the cached type of the entry rather than querying the file system again.
+					if (item.is_directory(ec)) {
+						result.m_Subdirectories.emplace_back(item.path());
+					}
+					else if (item.is_regular_file(ec)) {
+						
+						const auto size = item.file_size(ec);
+						const auto time = item.last_write_time(ec);
+						
+						if (ec) {
+							ec.clear();
+							
+							continue;
+						}
+						
+						Entry file { item.path(), _classify(item.path()), size, Time(time), 0U };
+						
+						if (const auto existing = previous.Get(file.m_Path.generic_string())) {
+							
+							if (existing->m_Type == file.m_Type &&
+							    existing->m_Size == file.m_Size &&
+							    existing->m_Time == file.m_Time
+							) {
+								file.m_Hash = existing->m_Hash;
+							}
+						}
+						
+						result.m_Files.emplace_back(std::move(file));
+					}
+					
+					ec.clear();
+				}
+				
+				if (ec) {
+					result.m_Removed = true;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Loads a cached manifest.
+		 *
+		 * @param[in] _root Root directory of the manifest.
+		 * @param[in] _cache Path to the cached manifest.
+		 * @return The cached record of each directory, or an empty Hashmap if the cache is missing, invalid or outdated.
+		 */
+		static Hashmap<std::string, Directory> Load(const std::filesystem::path& _root, const std::filesystem::path& _cache) {
+			
+			Hashmap<std::string, Directory> result;
+			
+			try {
+				
+				if (exists(_cache)) {
+					
+					const auto json = nlohmann::json::parse(File::Map(_cache).View());
+					
+					if (json.at("version").get<int>() == s_Version && json.at("root").get<std::string>() == _root.generic_string()) {
+						
+						for (const auto& directory : json.at("directories")) {
+							
+							Directory item { directory.at("time").get<int64_t>(), {}, {}, false, false, false };
+							
+							for (const auto& subdirectory : directory.at("subdirectories")) {
+								item.m_Subdirectories.emplace_back(subdirectory.get<std::string>());
+							}
+							
+							for (const auto& file : directory.at("files")) {
+								
+								item.m_Files.push_back({
+									file.at("path").get<std::string>(),
+									file.at("type").get<std::string>(),
+									file.at("size").get<uintmax_t>(),
+									file.at("time").get<int64_t>(),
+									file.at("hash").get<uint64_t>()
+								});
+							}
+							
+							result.Assign(directory.at("path").get<std::string>(), std::move(item));
+						}
+					}
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Discarding invalid asset manifest \"" + _cache.string() + "\".", Warning);
+				Debug::Log(e);
+				
+				result.Clear();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Writes a manifest to disk.
+		 *
+		 * @param[in] _root Root directory of the manifest.
+		 * @param[in] _cache Path to write the manifest to.
+		 * @param[in] _directories The record of each directory.
+		 */
+		static void Save(const std::filesystem::path& _root, const std::filesystem::path& _cache, const std::vector<std::pair<std::filesystem::path, Directory>>& _directories) {
+			
+			try {
+				
+				nlohmann::json directories = nlohmann::json::array();
+				
+				for (const auto& [path, directory] : _directories) {
+					
+					nlohmann::json subdirectories = nlohmann::json::array();
+					
+					for (const auto& subdirectory : directory.m_Subdirectories) {
+						subdirectories.push_back(subdirectory.generic_string());
+					}
+					
+					nlohmann::json files = nlohmann::json::array();
+					
+					for (const auto& file : directory.m_Files) {
+						
+						files.push_back({
+							{ "path", file.m_Path.generic_string() },
+							{ "type", file.m_Type },
+							{ "size", file.m_Size },
+							{ "time", file.m_Time },
+							{ "hash", file.m_Hash }
+						});
+					}
+					
+					directories.push_back({
+						{ "path",           path.generic_string()      },
+						{ "time",           directory.m_Time           },
+						{ "subdirectories", std::move(subdirectories)  },
+						{ "files",          std::move(files)           }
+					});
+				}
+				
+				if (_cache.has_parent_path()) {
+					std::filesystem::create_directories(_cache.parent_path());
+				}
+				
+				std::ofstream file(_cache, std::ios::out | std::ios::trunc);
+				
+				if (!file.is_open()) {
+					throw std::runtime_error("Failed to open \"" + _cache.string() + "\"!");
+				}
+				
+				file << nlohmann::json {
+					{ "version",     s_Version              },
+					{ "root",        _root.generic_string() },
+					{ "directories", std::move(directories) }
+				}.dump();
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Failed to write asset manifest \"" + _cache.string() + "\".", Warning);
+				Debug::Log(e);
+			}
+		}
+	
+	public:
+		
+		/**
+		 * @brief Computes the FNV-1a hash of some data.
+		 *
+		 * @param[in] _data The data to hash.
+		 * @return The 64-bit hash of the data.
+		 */
+		static constexpr uint64_t Hash(const std::string_view& _data) noexcept {
+			
+			uint64_t result = 0xCBF29CE484222325ULL;
+			
+			for (const auto& c : _data) {
+				result = (result ^ static_cast<uint8_t>(c)) * 0x100000001B3ULL;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Indexes the files beneath a directory, using and then updating the cached manifest.
+		 *
+		 * @param[in] _root The directory to index.
+		 * @param[in] _cache Path to the cached manifest. It is created if it does not exist.
+		 * @param[in] _classify Function determining the type of each file.
+		 * @return An up-to-date manifest of the directory.
+		 */
+		static AssetManifest Refresh(const std::filesystem::path& _root, const std::filesystem::path& _cache, const classifier_t& _classify) {
+			
+			const auto start = std::chrono::steady_clock::now();
+			
+			AssetManifest result;
+			
+			const auto cached = Load(_root, _cache);
+			
+			result.m_Statistics.m_Cold = cached.empty();
+			
+			std::vector<std::pair<std::filesystem::path, Directory>> directories;
+			
+			if (exists(_root)) {
+				
+				// Visit the directory tree a level at a time, validating each directory of a level in parallel:
+				std::vector<std::filesystem::path> level { _root };
+				
+				while (!level.empty()) {
+					
+					std::vector<Threading::JobSystem::Task<Directory>> tasks;
+					tasks.reserve(level.size());
+					
+					for (const auto& path : level) {
+						
+						const auto existing = cached.Get(path.generic_string());
+						
+						const auto* const record = existing ? &(*existing) : nullptr;
+						
+						tasks.emplace_back(Threading::JobSystem::Async([path, record, &_classify]() {
+							return Scan(path, record, _classify);
+						}, Threading::JobSystem::Gameplay));
+					}
+					
+					std::vector<std::filesystem::path> next;
+					
+					for (size_t i = 0U; i < tasks.size(); ++i) {
+						
+						auto directory = tasks[i].get();
+						
+						// Directories deleted since their parent was listed are dropped from the manifest.
+						if (directory.m_Removed) {
+							continue;
+						}
+						
+						next.insert(next.end(), directory.m_Subdirectories.begin(), directory.m_Subdirectories.end());
+						
+						directories.emplace_back(std::move(level[i]), std::move(directory));
+					}
+					
+					level = std::move(next);
+				}
+				
+				// Hash new and modified files in parallel:
+				std::vector<Threading::JobSystem::Handle> jobs;
+				
+				bool modified = cached.size() != directories.size();
+				
+				for (auto& [path, directory] : directories) {
+					
+					result.m_Statistics.m_Rescanned += directory.m_Rescanned ? 1U : 0U;
+					
+					modified |= directory.m_Modified;
+					
+					for (auto& file : directory.m_Files) {
+						
+						if (file.m_Hash == 0U && !file.m_Type.empty()) {
+							
+							jobs.emplace_back(Threading::JobSystem::Schedule([&file]() {
+								
+								try {
+									file.m_Hash = Hash(File::Map(file.m_Path, File::Sequential).View());
+								}
+								catch (const std::exception& e) {
+									Debug::Log(e);
+								}
+								
+							}, Threading::JobSystem::Gameplay));
+						}
+					}
+				}
+				
+				for (const auto& job : jobs) {
+					Threading::JobSystem::Wait(job);
+				}
+				
+				result.m_Statistics.m_Hashed = jobs.size();
+				
+				// Only write the cache if something has changed.
+				if (modified || result.m_Statistics.m_Hashed > 0U) {
+					Save(_root, _cache, directories);
+				}
+			}
+			else {
+				Debug::Log("Directory \"" + _root.string() + "\" does not exist.", Warning);
+			}
+			
+			for (auto& [path, directory] : directories) {
+				
+				for (auto& file : directory.m_Files) {
+					result.m_Entries.emplace_back(std::move(file));
+				}
+			}
+			
+			std::sort(result.m_Entries.begin(), result.m_Entries.end(), [](const Entry& _a, const Entry& _b) {
+				return _a.m_Path < _b.m_Path;
+			});
+			
+			result.m_Statistics.m_Directories = directories.size();
+			result.m_Statistics.m_Files       = result.m_Entries.size();
+			result.m_Statistics.m_Duration    = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+			
+			return result;
+		}
+		
+		/** @brief Returns every file in the manifest, in order of path. */
+		[[nodiscard]] constexpr const std::vector<Entry>& Entries() const noexcept { return m_Entries; }
+		
+		/** @brief Returns a summary of the work performed to produce the manifest. */
+		[[nodiscard]] constexpr const Statistics& GetStatistics() const noexcept { return m_Statistics; }
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_ASSETMANIFEST_HPP
@@ -0,0 +1,742 @@
+#ifndef FINALYEARPROJECT_COOKEDASSET_HPP
+#define FINALYEARPROJECT_COOKEDASSET_HPP
+
+#include "Debug.hpp"
+#include "File.hpp"
+#include "Types.hpp"
+
+#include "../graphics/textures/BlockCompression.hpp"
+
+#include <GL/glew.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @class CookedAsset
+	 * @brief Engine-native binary formats of assets, which are produced offline by fyp_cook.
+	 *
+	 * @details A cooked file consists of a header followed by the data of a single asset, laid out as arrays aligned to s_Alignment bytes.
+	 *          The header records the hash of the contents of the source file (see AssetManifest::Hash()), so that a cooked file
+	 *          which no longer matches its source is ignored. Integers and floats are stored in the byte order of the machine that
+	 *          wrote the file, which is checked on load.
+	 *
+	 *          Cooked files are stored beneath "cooked/", mirroring "assets/", with s_Extension appended to the name of the source file.
+	 *          Changes to the layout of the files must increment s_Version.
+	 *
+	 * @see AssetImporter, Resources
+	 */
+	class CookedAsset final {
+	
+	public:
+		
+		/** @brief Stable identifiers of the kinds of cooked file. Values must never change. */
+		enum Kind : uint32_t {
+			Mesh     = 1U, /**< @brief [u32 count] * 6, [vec3 vertex] * n, [vec3 normal] * n, [vec2 uv] * n, [vec3 tangent] * n, [vec3 bitangent] * n, [u32 index] * n */
+			Texture  = 2U, /**< @brief [u32 pixel format, texture format, type, channels, levels, compression], [Level] * n, [pixels]                             */
+			Material = 3U  /**< @brief [u32 present], [vec4 albedo], [vec3 emission], [f32 ao, displacement, normal, roughness], [u32 offset] * 8, [char]...      */
+		};
+		
+		/**
+		 * @struct MeshData
+		 * @brief Vertex data of a Mesh, with its tangents already computed.
+		 */
+		struct MeshData final {
+			
+			std::vector<vec3> m_Vertices;
+			std::vector<vec3> m_Normals;
+			std::vector<vec2> m_UVs;
+			
+			/** @brief Tangents and bitangents of the Mesh. */
+			std::array<std::vector<vec3>, 2U> m_Tangents;
+			
+			std::vector<uint32_t> m_Indices;
+			
+			/** @brief Returns the size of the vertex data in bytes. */
+			[[nodiscard]] size_t Size() const noexcept {
+				
+				return ((m_Vertices.size() + m_Normals.size() + m_Tangents[0U].size() + m_Tangents[1U].size()) * sizeof(vec3)) +
+				        (m_UVs.size() * sizeof(vec2)) + (m_Indices.size() * sizeof(uint32_t));
+			}
+		};
+		
+		/**
+		 * @struct TextureData
+		 * @brief Pixels of a Texture and its mip levels, in the format in which they are uploaded.
+		 */
+		struct TextureData final {
+			
+			struct Level final {
+				
+				uint32_t m_Width;
+				uint32_t m_Height;
+				
+				/** @brief Offset of the pixels of the level from m_Pixels. */
+				uint64_t m_Offset;
+				uint64_t m_Size;
+			};
+			
+			uint32_t   m_PixelFormat; /**< @brief Internal format of the Texture (GLenum). */
+			uint32_t m_TextureFormat; /**< @brief Format of the pixels (GLenum).           */
+			uint32_t          m_Type; /**< @brief Type of each channel (GLenum).           */
+			uint32_t      m_Channels;
+			
+			/** @brief Block-compressed format of the pixels (GLenum), or zero if they are uncompressed. */
+			uint32_t m_Compression = 0U;
+			
+			/** @brief Mip levels of the Texture, from largest to smallest. */
+			std::vector<Level> m_Levels;
+			
+			const char* m_Pixels = nullptr;
+			
+			size_t m_Size = 0U;
+			
+			/** @brief Owner of the pixels. For a cooked file, this is the mapping of the file, so the pixels are never copied. */
+			std::shared_ptr<const void> m_Owner;
+		};
+		
+		/**
+		 * @struct MaterialData
+		 * @brief Parameters of a Material, which refers to its Textures by name.
+		 */
+		struct MaterialData final {
+			
+			enum Slot : unsigned char {
+				Albedo,
+				AO,
+				Displacement,
+				Emission,
+				Metallic,
+				Normal,
+				Roughness
+			};
+			
+			/** @brief Names of the Textures used by the slots of a Material which does not specify them. */
+			inline static const std::array<std::string, 7U> s_Defaults {
+				"white", "white", "black", "white", "black", "normal", "black"
+			};
+			
+			/** @brief Names of the Textures of the Material, indexed by Slot. */
+			std::array<std::string, 7U> m_Textures { s_Defaults };
+			
+			std::optional<vec4>   m_AlbedoColor;
+			std::optional<vec3> m_EmissionColor;
+			
+			std::optional<scalar_t> m_AO;
+			std::optional<scalar_t> m_Displacement;
+			std::optional<scalar_t> m_Normal;
+			std::optional<scalar_t> m_Roughness;
+		};
+		
+		/** @brief Extension appended to the name of the source file of a cooked file. */
+		inline static const std::string s_Extension { ".fypc" };
+	
+	private:
+		
+		static constexpr std::array<char, 8U> s_Magic { 'F', 'Y', 'P', 'C', 'O', 'O', 'K', '\0' };
+		
+		static constexpr uint32_t s_Version = 2U;
+		
+		/** @brief Written as-is, so reads back differently on a machine of the opposite byte order. */
+		static constexpr uint32_t s_ByteOrder = 0x01020304U;
+		
+		static constexpr size_t s_Alignment = 16U;
+		
+		/** @brief Largest width or height of a level of a cooked Texture, well beyond that supported by any GPU. */
+		static constexpr uint32_t s_MaxExtent = 65536U;
+		
+		struct Header final {
+			
+			std::array<char, 8U> m_Magic;
+			
+			uint32_t m_Version;
+			uint32_t m_ByteOrder;
+			uint32_t m_Kind;
+			uint32_t m_Reserved;
+			
+			/** @brief Hash of the contents of the source file. */
+			uint64_t m_Source;
+		};
+		
+		static_assert(sizeof(Header) == 32U && sizeof(Header) % s_Alignment == 0U && std::is_trivially_copyable_v<Header>, "Unexpected layout of CookedAsset::Header.");
+		static_assert(sizeof(TextureData::Level) == 24U && std::is_trivially_copyable_v<TextureData::Level>, "Unexpected layout of CookedAsset::TextureData::Level.");
+		
+		static_assert(sizeof(vec2) == 8U && sizeof(vec3) == 12U && sizeof(vec4) == 16U, "Unexpected layout of glm vectors.");
+		
+		/**
+		 * @class Reader
+		 * @brief Reads the values and arrays of a cooked file in the order in which they were written.
+		 */
+		class Reader final {
+			
+			std::string_view m_Data;
+			
+			size_t m_Offset;
+		
+		public:
+			
+			explicit Reader(const std::string_view& _data) noexcept :
+				m_Data(_data),
+				m_Offset(sizeof(Header)) {}
+			
+			template <typename T>
+			[[nodiscard]] T Get() {
+				
+				static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+				
+				T result;
+				std::memcpy(&result, Span(sizeof(T), false), sizeof(T));
+				
+				return result;
+			}
+			
+			/** @brief Copies an array out of the file in bulk. */
+			template <typename T>
+			void GetArray(const size_t& _count, std::vector<T>& _values) {
+				
+				static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+				
+				if (_count > m_Data.size() / sizeof(T)) {
+					throw std::runtime_error("Truncated cooked asset.");
+				}
+				
+				const auto* const data = Span(sizeof(T) * _count, true);
+				
+				_values.resize(_count);
+				
+				if (_count > 0U) {
+					std::memcpy(_values.data(), data, sizeof(T) * _count);
+				}
+			}
+			
+			/**
+			 * @brief Returns a pointer to the next bytes of the file, and advances past them.
+			 * @param[in] _size The number of bytes.
+			 * @param[in] _align Whether the bytes begin at the next multiple of s_Alignment.
+			 */
+			const char* Span(const size_t& _size, const bool& _align) {
+				
+				const auto offset = _align ? Align(m_Offset) : m_Offset;
+				
+				if (offset > m_Data.size() || _size > m_Data.size() - offset) {
+					throw std::runtime_error("Truncated cooked asset.");
+				}
+				
+				m_Offset = offset + _size;
+				
+				return m_Data.data() + offset;
+			}
+		};
+		
+		static constexpr size_t Align(const size_t& _offset) noexcept {
+			return (_offset + (s_Alignment - 1U)) & ~(s_Alignment - 1U);
+		}
+		
+		template <typename T>
+		static void Put(std::vector<char>& _data, const T& _value) {
+			
+			static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+			
+			const auto offset = _data.size();
+			
+			_data.resize(offset + sizeof(T));
+			std::memcpy(_data.data() + offset, &_value, sizeof(T));
+		}
+		
+		/** @brief Appends an array, aligned to s_Alignment. */
+		template <typename T>
+		static void PutArray(std::vector<char>& _data, const T* _values, const size_t& _count) {
+			
+			static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+			
+			const auto offset = Align(_data.size());
+			
+			_data.resize(offset + (sizeof(T) * _count));
+			
+			if (_count > 0U) {
+				std::memcpy(_data.data() + offset, _values, sizeof(T) * _count);
+			}
+		}
+		
+		template <typename T>
+		static void PutArray(std::vector<char>& _data, const std::vector<T>& _values) {
+			PutArray(_data, _values.data(), _values.size());
+		}
+		
+		/**
+		 * @brief Maps a cooked file, and validates its header.
+		 *
+		 * @param[in] _path The path to the cooked file.
+		 * @param[in] _kind The expected kind of the file.
+		 * @param[out] _source Hash of the contents of the source file.
+		 * @return A mapping of the file.
+		 * @throws std::runtime_error If the file is not a valid cooked file of the current version and given kind.
+		 */
+		static std::shared_ptr<const File::Mapping> Open(const std::filesystem::path& _path, const Kind& _kind, uint64_t& _source) {
+			
+			auto result = std::make_shared<const File::Mapping>(File::Map(_path, File::Sequential));
+			
+			const auto data = result->View();
+			
+			Header header {};
+			
+			if (data.size() < sizeof(Header)) {
+				throw std::runtime_error("Truncated cooked asset.");
+			}
+			
+			std::memcpy(&header, data.data(), sizeof(Header));
+			
+			if (header.m_Magic     != s_Magic    ) { throw std::runtime_error("Not a cooked asset."); }
+			if (header.m_ByteOrder != s_ByteOrder) { throw std::runtime_error("Cooked asset has a different byte order."); }
+			if (header.m_Version   != s_Version  ) { throw std::runtime_error("Unsupported cooked asset version (" + std::to_string(header.m_Version) + ")."); }
+			if (header.m_Kind      != _kind      ) { throw std::runtime_error("Cooked asset is of a different kind."); }
+			
+			_source = header.m_Source;
+			
+			return result;
+		}
+		
+		static void Read(Reader& _reader, [[maybe_unused]] const std::shared_ptr<const File::Mapping>& _mapping, MeshData& _output) {
+			
+			std::array<uint32_t, 6U> counts {};
+			
+			for (auto& count : counts) {
+				count = _reader.Get<uint32_t>();
+			}
+			
+			_reader.GetArray(counts[0U], _output.m_Vertices    );
+			_reader.GetArray(counts[1U], _output.m_Normals     );
+			_reader.GetArray(counts[2U], _output.m_UVs         );
+			_reader.GetArray(counts[3U], _output.m_Tangents[0U]);
+			_reader.GetArray(counts[4U], _output.m_Tangents[1U]);
+			_reader.GetArray(counts[5U], _output.m_Indices     );
+			
+			for (const auto& index : _output.m_Indices) {
+				
+				if (index >= _output.m_Vertices.size()) {
+					throw std::runtime_error("Invalid index in cooked mesh.");
+				}
+			}
+		}
+		
+		/**
+		 * @brief Returns the block-compressed format of a cooked Texture.
+		 * @throws std::runtime_error If the format is not one produced by fyp_cook.
+		 */
+		static Graphics::BlockCompression::Format BlockFormat(const uint32_t& _compression) {
+			
+			using Graphics::BlockCompression;
+			
+			BlockCompression::Format result;
+			
+			switch (_compression) {
+				case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+				case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:       { result = BlockCompression::BC1;  break; }
+				case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+				case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT: { result = BlockCompression::BC3;  break; }
+				case GL_COMPRESSED_RED_RGTC1:                { result = BlockCompression::BC4;  break; }
+				case GL_COMPRESSED_RG_RGTC2:                 { result = BlockCompression::BC5;  break; }
+				case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:  { result = BlockCompression::BC6H; break; }
+				default: {
+					throw std::runtime_error("Invalid compression in cooked texture.");
+				}
+			}
+			
+			return result;
+		}
+		
+		static void Read(Reader& _reader, const std::shared_ptr<const File::Mapping>& _mapping, TextureData& _output) {
+			
+			_output.m_PixelFormat   = _reader.Get<uint32_t>();
+			_output.m_TextureFormat = _reader.Get<uint32_t>();
+			_output.m_Type          = _reader.Get<uint32_t>();
+			_output.m_Channels      = _reader.Get<uint32_t>();
+			
+			const auto levels = _reader.Get<uint32_t>();
+			
+			_output.m_Compression = _reader.Get<uint32_t>();
+			
+			if (_output.m_Type != GL_UNSIGNED_BYTE && _output.m_Type != GL_FLOAT) {
+				throw std::runtime_error("Invalid type in cooked texture.");
+			}
+			
+			if (_output.m_Channels < 1U || _output.m_Channels > 4U) {
+				throw std::runtime_error("Invalid channel count in cooked texture.");
+			}
+			
+			std::optional<Graphics::BlockCompression::Format> format;
+			
+			if (_output.m_Compression != 0U) {
+				
+				format = BlockFormat(_output.m_Compression);
+				
+				// As with BlockCompression::Encode(), only float pixels are encoded as BC6H.
+				if ((*format == Graphics::BlockCompression::BC6H) != (_output.m_Type == GL_FLOAT)) {
+					throw std::runtime_error("Invalid compression in cooked texture.");
+				}
+			}
+			
+			_reader.GetArray(levels, _output.m_Levels);
+			
+			if (_output.m_Levels.empty()) {
+				throw std::runtime_error("Cooked texture has no levels.");
+			}
+			
+			const auto size = _reader.Get<uint64_t>();
+			
+			// Reference the pixels in the mapping, rather than copying them.
+			_output.m_Pixels = _reader.Span(static_cast<size_t>(size), true);
+			_output.m_Size   = static_cast<size_t>(size);
+			_output.m_Owner  = _mapping;
+			
+			const auto texel = static_cast<uint64_t>(_output.m_Channels) * (_output.m_Type == GL_FLOAT ? sizeof(float) : sizeof(unsigned char));
+			
+			for (const auto& level : _output.m_Levels) {
+				
+				// Bound the dimensions, so that the expected size of the level cannot overflow.
+				if (level.m_Width  < 1U || level.m_Width  > s_MaxExtent ||
+				    level.m_Height < 1U || level.m_Height > s_MaxExtent) {
+					throw std::runtime_error("Invalid level in cooked texture.");
+				}
+				
+				const auto expected = format.has_value() ?
+					static_cast<uint64_t>(Graphics::BlockCompression::Size(*format, level.m_Width, level.m_Height)) :
+					static_cast<uint64_t>(level.m_Width) * level.m_Height * texel;
+				
+				if (level.m_Size != expected || level.m_Offset > _output.m_Size || level.m_Size > _output.m_Size - level.m_Offset) {
+					throw std::runtime_error("Invalid level in cooked texture.");
+				}
+			}
+		}
+		
+		static void Read(Reader& _reader, [[maybe_unused]] const std::shared_ptr<const File::Mapping>& _mapping, MaterialData& _output) {
+			
+			const auto present = _reader.Get<uint32_t>();
+			
+			const auto   albedo = _reader.Get<vec4>();
+			const auto emission = _reader.Get<vec3>();
+			
+			std::array<scalar_t, 4U> values {};
+			
+			for (auto& value : values) {
+				value = _reader.Get<scalar_t>();
+			}
+			
+			if ((present & (1U << 0U)) != 0U) { _output.m_AlbedoColor   = albedo;     }
+			if ((present & (1U << 1U)) != 0U) { _output.m_EmissionColor = emission;   }
+			if ((present & (1U << 2U)) != 0U) { _output.m_AO            = values[0U]; }
+			if ((present & (1U << 3U)) != 0U) { _output.m_Displacement  = values[1U]; }
+			if ((present & (1U << 4U)) != 0U) { _output.m_Normal        = values[2U]; }
+			if ((present & (1U << 5U)) != 0U) { _output.m_Roughness     = values[3U]; }
+			
+			std::vector<uint32_t> offsets;
+			_reader.GetArray(_output.m_Textures.size() + 1U, offsets);
+			
+			const auto* const characters = _reader.Span(offsets.back(), true);
+			
+			for (size_t i = 0U; i < _output.m_Textures.size(); ++i) {
+				
+				if (offsets[i] > offsets[i + 1U]) {
+					throw std::runtime_error("Invalid string table in cooked material.");
+				}
+				
+				_output.m_Textures[i].assign(characters + offsets[i], offsets[i + 1U] - offsets[i]);
+			}
+		}
+		
+		/**
+		 * @brief Writes a cooked file.
+		 *
+		 * @param[in] _path The path to the cooked file. Its directory is created if it does not exist.
+		 * @param[in] _kind The kind of the file.
+		 * @param[in] _source Hash of the contents of the source file.
+		 * @param[in] _body The data of the asset.
+		 * @param[in] _tail (Optional) Bulk data written after the body, aligned to s_Alignment.
+		 * @param[in] _tailSize Size of the bulk data in bytes.
+		 *
+		 * @note The file is written to a temporary file which then replaces it, so an interrupted write never leaves a truncated file behind.
+		 */
+		static void Write(const std::filesystem::path& _path, const Kind& _kind, const uint64_t& _source, std::vector<char>& _body, const char* _tail = nullptr, const size_t& _tailSize = 0U) {
+			
+			// The header is a multiple of s_Alignment in size, so prepending it preserves the alignment of the body.
+			std::vector<char> header;
+			Put(header, Header { s_Magic, s_Version, s_ByteOrder, _kind, 0U, _source });
+			
+			_body.insert(_body.begin(), header.begin(), header.end());
+			
+			if (_tailSize > 0U) {
+				_body.resize(Align(_body.size()));
+			}
+			
+			if (_path.has_parent_path()) {
+				std::filesystem::create_directories(_path.parent_path());
+			}
+			
+			auto temporary = _path;
+			temporary += ".tmp";
+			
+			{
+				std::ofstream stream(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+				
+				stream.write(_body.data(), static_cast<std::streamsize>(_body.size()));
+				
+				if (_tailSize > 0U) {
+					stream.write(_tail, static_cast<std::streamsize>(_tailSize));
+				}
+				
+				if (!stream) {
+					throw std::runtime_error("Failed to write cooked asset \"" + _path.string() + "\".");
+				}
+			}
+			
+			std::filesystem::rename(temporary, _path);
+		}
+	
+	public:
+		
+		 CookedAsset()                          = delete;
+		 CookedAsset(const CookedAsset& _other) = delete;
+		~CookedAsset()                          = delete;
+		
+		CookedAsset& operator = (const CookedAsset& _other) = delete;
+		
+		/** @brief Returns the kind of cooked file a source file is cooked into, if it is cooked at all. */
+		[[nodiscard]] static std::optional<Kind> KindOf(const std::filesystem::path& _source) {
+			
+			std::optional<Kind> result;
+			
+			const auto extension = _source.extension();
+			
+			     if (extension == ".obj") { result = Mesh;     }
+			else if (extension == ".mtl") { result = Material; }
+			else if (extension == ".jpg" || extension == ".png" || extension == ".tif" || extension == ".hdr" || extension == ".exr") {
+				result = Texture;
+			}
+			
+			return result;
+		}
+		
+		/** @brief Returns the kind of cooked file in which assets of the given type are stored. */
+		template <typename T>
+		[[nodiscard]] static constexpr Kind KindOf() noexcept {
+			
+			Kind result {};
+			
+			     if constexpr (std::is_same_v<T,     MeshData>) { result = Mesh;     }
+			else if constexpr (std::is_same_v<T,  TextureData>) { result = Texture;  }
+			else if constexpr (std::is_same_v<T, MaterialData>) { result = Material; }
+			else {
+				static_assert([]{ return false; }(), "Not implemented!");
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the path of the cooked file of a source file.
+		 *
+		 * @param[in] _source The path to the source file.
+		 * @param[in] _assets The directory containing the source files.
+		 * @param[in] _cooked The directory containing the cooked files.
+		 * @return The path of the cooked file, or an empty path if the source file is not beneath _assets.
+		 */
+		[[nodiscard]] static std::filesystem::path PathOf(const std::filesystem::path& _source, const std::filesystem::path& _assets = "assets", const std::filesystem::path& _cooked = "cooked") {
+			
+			std::filesystem::path result;
+			
+			const auto relative = _source.lexically_relative(_assets);
+			
+			if (!relative.empty() && *relative.begin() != "..") {
+				
+				result = _cooked / relative;
+				result += s_Extension;
+			}
+			
+			return result;
+		}
+		
+		/** @brief Returns the hash of the source file of a cooked file, or zero if the file is not a valid cooked file of the current version. */
+		[[nodiscard]] static uint64_t SourceOf(const std::filesystem::path& _path) {
+			
+			Header header {};
+			
+			std::ifstream stream(_path, std::ios::in | std::ios::binary);
+			
+			const auto valid = stream.read(reinterpret_cast<char*>(&header), sizeof(Header)) &&
+				header.m_Magic     == s_Magic     &&
+				header.m_ByteOrder == s_ByteOrder &&
+				header.m_Version   == s_Version;
+			
+			return valid ? header.m_Source : 0U;
+		}
+		
+		/**
+		 * @brief Reads a cooked file.
+		 *
+		 * @param[in] _path The path to the cooked file.
+		 * @param[out] _source Hash of the contents of the source file.
+		 * @throws std::runtime_error If the file is not a valid cooked file of the current version and expected kind.
+		 */
+		template <typename T>
+		[[nodiscard]] static T Read(const std::filesystem::path& _path, uint64_t& _source) {
+			
+			T result;
+			
+			const auto mapping = Open(_path, KindOf<T>(), _source);
+			
+			Reader reader(mapping->View());
+			Read(reader, mapping, result);
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Loads the cooked form of a source asset, if it is up to date.
+		 *
+		 * @param[in] _source The path to the source file.
+		 * @param[in] _hash Hash of the contents of the source file. If zero, the cooked file is not used.
+		 * @return The asset, or std::nullopt if it has no valid cooked file which matches its source.
+		 *
+		 * @note Thread-safe.
+		 */
+		template <typename T>
+		[[nodiscard]] static std::optional<T> Load(const std::filesystem::path& _source, const uint64_t& _hash) noexcept {
+			
+			std::optional<T> result;
+			
+			try {
+				
+				const auto path = PathOf(_source);
+				
+				if (_hash != 0U && !path.empty() && exists(path)) {
+					
+					uint64_t source = 0U;
+					
+					const auto mapping = Open(path, KindOf<T>(), source);
+					
+					if (source == _hash) {
+						
+						Reader reader(mapping->View());
+						Read(reader, mapping, result.emplace());
+					}
+					else {
+						Debug::Log("Cooked asset \"" + path.string() + "\" is out of date. Loading the source asset instead.", Warning);
+					}
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e, Warning);
+				
+				result.reset();
+			}
+			
+			return result;
+		}
+		
+		/** @brief Writes a cooked Mesh. */
+		static void Write(const std::filesystem::path& _path, const uint64_t& _source, const MeshData& _data) {
+			
+			std::vector<char> body;
+			body.reserve(_data.Size() + (s_Alignment * 8U));
+			
+			for (const auto& count : {
+				_data.m_Vertices.size(),
+				_data.m_Normals.size(),
+				_data.m_UVs.size(),
+				_data.m_Tangents[0U].size(),
+				_data.m_Tangents[1U].size(),
+				_data.m_Indices.size()
+			}) {
+				Put(body, static_cast<uint32_t>(count));
+			}
+			
+			PutArray(body, _data.m_Vertices    );
+			PutArray(body, _data.m_Normals     );
+			PutArray(body, _data.m_UVs         );
+			PutArray(body, _data.m_Tangents[0U]);
+			PutArray(body, _data.m_Tangents[1U]);
+			PutArray(body, _data.m_Indices     );
+			
+			Write(_path, Mesh, _source, body);
+		}
+		
+		/** @brief Writes a cooked Texture. */
+		static void Write(const std::filesystem::path& _path, const uint64_t& _source, const TextureData& _data) {
+			
+			std::vector<char> body;
+			
+			Put(body, _data.m_PixelFormat);
+			Put(body, _data.m_TextureFormat);
+			Put(body, _data.m_Type);
+			Put(body, _data.m_Channels);
+			Put(body, static_cast<uint32_t>(_data.m_Levels.size()));
+			Put(body, _data.m_Compression);
+			
+			PutArray(body, _data.m_Levels);
+			
+			Put(body, static_cast<uint64_t>(_data.m_Size));
+			
+			// The pixels may be large, so are written directly rather than copied into the body.
+			Write(_path, Texture, _source, body, _data.m_Pixels, _data.m_Size);
+		}
+		
+		/** @brief Writes a cooked Material. */
+		static void Write(const std::filesystem::path& _path, const uint64_t& _source, const MaterialData& _data) {
+			
+			std::vector<char> body;
+			
+			Put(body,
+				(_data.m_AlbedoColor  .has_value() ? 1U << 0U : 0U) |
+				(_data.m_EmissionColor.has_value() ? 1U << 1U : 0U) |
+				(_data.m_AO           .has_value() ? 1U << 2U : 0U) |
+				(_data.m_Displacement .has_value() ? 1U << 3U : 0U) |
+				(_data.m_Normal       .has_value() ? 1U << 4U : 0U) |
+				(_data.m_Roughness    .has_value() ? 1U << 5U : 0U)
+			);
+			
+			Put(body, _data.m_AlbedoColor  .value_or(vec4(0.0)));
+			Put(body, _data.m_EmissionColor.value_or(vec3(0.0)));
+			Put(body, _data.m_AO           .value_or(static_cast<scalar_t>(0.0)));
+			Put(body, _data.m_Displacement .value_or(static_cast<scalar_t>(0.0)));
+			Put(body, _data.m_Normal       .value_or(static_cast<scalar_t>(0.0)));
+			Put(body, _data.m_Roughness    .value_or(static_cast<scalar_t>(0.0)));
+			
+			std::vector<uint32_t> offsets;
+			offsets.reserve(_data.m_Textures.size() + 1U);
+			
+			std::string characters;
+			
+			for (const auto& item : _data.m_Textures) {
+				offsets.emplace_back(static_cast<uint32_t>(characters.size()));
+				
+				characters.append(item);
+			}
+			
+			offsets.emplace_back(static_cast<uint32_t>(characters.size()));
+			
+			PutArray(body, offsets);
+			PutArray(body, characters.data(), characters.size());
+			
+			Write(_path, Material, _source, body);
+		}
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_COOKEDASSET_HPP
@@ -16,16 +16,26 @@
 #pragma ide diagnostic ignored "performance-avoid-endl"
 #endif
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <csignal>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -124,6 +134,30 @@
 
 #pragma endregion Debugging assertions and traps
 
+/**
+ * @def FYP_LOG_LEVEL
+ * @brief Bitmask of the LogType values which are compiled in. Logs of any other type are discarded.
+ *
+ * @note Defaults to every type in Debug builds, and every type except Trace in Release builds.
+ */
+#ifndef FYP_LOG_LEVEL
+	#if !defined(NDEBUG) || _DEBUG
+		#define FYP_LOG_LEVEL 0x3FU
+	#else
+		#define FYP_LOG_LEVEL 0x3EU
+	#endif
+#endif
+
+/**
+ * @def FYP_LOG
+ * @brief Logs a message, removing the call (including evaluation of the message) entirely if the type is not compiled in.
+ *
+ * @param[in] _message The message to be logged.
+ * @param[in] _type The LogType of the message. Must be a constant expression.
+ * @param[in] ... (Optional) Whether the message should be displayed inline.
+ */
+#define FYP_LOG(_message, _type, ...) do { if constexpr (Debug::Enabled(_type)) { Debug::Log((_message), (_type), ##__VA_ARGS__); } } while (false)
+
 namespace {
 	
 	/**
@@ -504,6 +538,9 @@ namespace {
 	 * The Debug class is a utility class that provides various methods for debugging and logging purposes.
 	 * It includes methods for performing assertions, triggering breakpoints, flushing the log output,
 	 * and logging messages with different log types.
+	 *
+	 * Logs are pushed into a lock-free ring buffer and written to the console by a background thread,
+	 * so that logging does not stall the render loop or streaming workers. Critical logs are flushed synchronously.
 	 */
 	struct Debug final {
 	
@@ -524,6 +561,421 @@ namespace {
 		/** Metadata about the previous log. */
 		inline static Meta s_LastLog = { 0U, -1U, false };
 		
+		/**
+		 * @brief A log waiting to be written.
+		 *
+		 * @note Records are reused, so the capacity of their strings persists between logs.
+		 */
+		struct Record final {
+			
+			std::atomic<size_t> m_Sequence;
+			
+			std::time_t m_Timestamp;
+			     size_t m_ThreadID;
+			    LogType m_Type;
+			       bool m_Inline;
+			
+			std::string              m_Message;
+			std::vector<std::string> m_Trace;
+		};
+		
+		/**
+		 * @brief Bounded multi-producer, single-consumer ring buffer of records, drained by a writer thread.
+		 */
+		struct Backend final {
+			
+			static constexpr size_t s_Capacity = 4096U; // Must be a power of two.
+			
+			/** @brief Maximum number of identical logs written to the console per s_RepeatWindow. */
+			static constexpr size_t s_RepeatLimit = 8U;
+			
+			static constexpr std::chrono::seconds s_RepeatWindow { 1 };
+			
+			std::array<Record, s_Capacity> m_Records;
+			
+			std::atomic<size_t> m_Head;    // Next sequence to be claimed by a producer.
+			             size_t m_Tail;    // Next sequence to be consumed by the writer.
+			std::atomic<size_t> m_Written; // Number of records the writer has finished with.
+			
+			std::atomic<bool> m_Running;
+			std::atomic<bool> m_Stopping;
+			std::atomic<bool> m_Sleeping;
+			
+			std::mutex              m_SleepLock;
+			std::condition_variable m_Wake;
+			
+			std::thread m_Thread;
+			
+			/** @brief Rate limiting of repeated logs. */
+			struct Repeat final {
+				
+				size_t m_Count;
+				size_t m_ThreadID;
+				LogType m_Type;
+				
+				std::string m_Message;
+			};
+			
+			std::unordered_map<size_t, Repeat> m_Repeats;
+			
+			std::chrono::steady_clock::time_point m_WindowStart;
+			
+			/** @brief Optional binary log. */
+			std::mutex    m_FileLock;
+			std::ofstream m_File;
+			
+			/** @brief Cached console header. */
+			std::string m_Buffer;
+			std::time_t m_BufferTime;
+			char        m_TimeString[32];
+			
+			Backend() :
+				m_Head      (0U),
+				m_Tail      (0U),
+				m_Written   (0U),
+				m_Running   (false),
+				m_Stopping  (false),
+				m_Sleeping  (false),
+				m_WindowStart(std::chrono::steady_clock::now()),
+				m_BufferTime(-1),
+				m_TimeString() {
+				
+				for (size_t i = 0U; i < s_Capacity; ++i) {
+					m_Records[i].m_Sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+			
+			/**
+			 * @brief Returns the backend.
+			 * @note The backend is intentionally leaked so that it outlives any static object which logs during destruction.
+			 */
+			static Backend& Get() {
+				
+				static auto* const s_Instance = new Backend();
+				
+				return *s_Instance;
+			}
+		};
+		
+		/**
+		 * @brief Starts the writer thread, if it has not been started already.
+		 * @return True if the writer thread is running.
+		 */
+		static bool Start() noexcept {
+			
+			static std::once_flag s_Started;
+			
+			auto& backend = Backend::Get();
+			
+			try {
+				std::call_once(s_Started, [&backend]() {
+					
+					backend.m_Thread  = std::thread(&Debug::Drain);
+					backend.m_Running = true;
+					
+					// Drain remaining logs on exit:
+					(void)std::atexit(&Debug::Stop);
+				});
+			}
+			catch (const std::exception& e) {
+				std::cerr << "LOG_ERR: " << e.what() << std::endl;
+			}
+			
+			return backend.m_Running && !backend.m_Stopping;
+		}
+		
+		/**
+		 * @brief Writes all pending logs and joins the writer thread. Subsequent logs are written synchronously.
+		 */
+		static void Stop() noexcept {
+			
+			auto& backend = Backend::Get();
+			
+			try {
+				
+				if (backend.m_Running) {
+					
+					{
+						const std::lock_guard<std::mutex> lock(backend.m_SleepLock);
+						
+						backend.m_Stopping = true;
+					}
+					
+					backend.m_Wake.notify_one();
+					
+					if (backend.m_Thread.joinable()) {
+						backend.m_Thread.join();
+					}
+					
+					backend.m_Running = false;
+				}
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Claims a record, fills it and publishes it to the writer thread.
+		 * @return The sequence number of the record.
+		 */
+		static size_t Push(const std::string_view& _message, const LogType& _type, const bool& _makeInline, std::vector<std::string>&& _trace) {
+			
+			auto& backend = Backend::Get();
+			
+			auto position = backend.m_Head.load(std::memory_order_relaxed);
+			
+			Record* record;
+			
+			while (true) {
+				
+				record = &backend.m_Records[position & (Backend::s_Capacity - 1U)];
+				
+				const auto sequence = record->m_Sequence.load(std::memory_order_acquire);
+				const auto diff     = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+				
+				if (diff == 0) {
+					
+					if (backend.m_Head.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed)) {
+						break;
+					}
+				}
+				else if (diff < 0) {
+					
+					// Buffer is full. Wait for the writer to catch up.
+					std::this_thread::yield();
+					
+					position = backend.m_Head.load(std::memory_order_relaxed);
+				}
+				else {
+					position = backend.m_Head.load(std::memory_order_relaxed);
+				}
+			}
+			
+			record->m_Timestamp = std::time(nullptr);
+			record->m_ThreadID  = ThreadID::Get();
+			record->m_Type      = _type;
+			record->m_Inline    = _makeInline;
+			record->m_Message.assign(_message);
+			record->m_Trace = std::move(_trace);
+			
+			record->m_Sequence.store(position + 1U, std::memory_order_release);
+			
+			if (backend.m_Sleeping.load(std::memory_order_acquire)) {
+				backend.m_Wake.notify_one();
+			}
+			
+			return position;
+		}
+		
+		/**
+		 * @brief Body of the writer thread.
+		 */
+		static void Drain() noexcept {
+			
+			auto& backend = Backend::Get();
+			
+			while (true) {
+				
+				bool wrote = false;
+				
+				while (true) {
+					
+					auto& record = backend.m_Records[backend.m_Tail & (Backend::s_Capacity - 1U)];
+					
+					if (record.m_Sequence.load(std::memory_order_acquire) != backend.m_Tail + 1U) {
+						break;
+					}
+					
+					Write(record);
+					
+					record.m_Sequence.store(backend.m_Tail + Backend::s_Capacity, std::memory_order_release);
+					
+					backend.m_Written.store(++backend.m_Tail, std::memory_order_release);
+					
+					wrote = true;
+				}
+				
+				try {
+					
+					RollRepeatWindow();
+					
+					if (wrote) {
+						std::cout << std::flush;
+					}
+				}
+				catch (...) {}
+				
+				if (backend.m_Stopping && backend.m_Head.load(std::memory_order_acquire) == backend.m_Tail) {
+					break;
+				}
+				
+				{
+					std::unique_lock<std::mutex> lock(backend.m_SleepLock);
+					
+					backend.m_Sleeping = true;
+					
+					backend.m_Wake.wait_for(lock, std::chrono::milliseconds(10), [&backend]() {
+						return backend.m_Stopping || backend.m_Head.load(std::memory_order_acquire) != backend.m_Tail;
+					});
+					
+					backend.m_Sleeping = false;
+				}
+			}
+			
+			try {
+				const std::lock_guard<std::mutex> lock(backend.m_FileLock);
+				
+				if (backend.m_File.is_open()) {
+					backend.m_File.close();
+				}
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Writes a record to the console and binary log.
+		 * @note Only called by the writer thread, or by the calling thread when the writer is not running.
+		 */
+		static void Write(const Record& _record) noexcept {
+			
+			try {
+				try {
+					
+					BinaryLog::Encode(_record);
+					
+					if (!Suppress(_record)) {
+						WriteConsole(_record.m_Timestamp, _record.m_ThreadID, _record.m_Type, _record.m_Inline, _record.m_Message, _record.m_Trace);
+					}
+				}
+				catch (const std::exception& e) {
+					std::cerr << "LOG_ERR: " << e.what() << std::endl;
+				}
+			}
+			catch (...) {}
+		}
+		
+		static void WriteConsole(const std::time_t& _timestamp, const size_t& _threadID, const LogType& _type, const bool& _makeInline, const std::string_view& _message, const std::vector<std::string>& _trace) {
+			
+			auto& backend = Backend::Get();
+			
+			/*
+			 * Construct a header containing various pieces of metadata about the current log.
+			 */
+			auto& message = backend.m_Buffer;
+			message.clear();
+			
+			// Timestamp:
+			if (!s_LastLog.m_Inline) {
+				
+				if (backend.m_BufferTime != _timestamp) {
+					backend.m_BufferTime = _timestamp;
+					
+					(void)std::strftime(backend.m_TimeString, sizeof(backend.m_TimeString), "[%H:%M:%S %d/%m/%Y] ", std::localtime(&_timestamp));
+				}
+				
+				message += backend.m_TimeString;
+			}
+			
+			// Thread ID:
+			if (!s_LastLog.m_Inline || s_LastLog.m_ThreadID != _threadID) {
+				message += '[';
+				message += std::to_string(_threadID);
+				message += "] ";
+			}
+			
+			message += _message;
+			
+			// Print log to console:
+			Print::Multiplatform(message, _type, _makeInline);
+			
+			// Add trace information:
+			if (!_trace.empty()) {
+				
+				// Start trace on new line always.
+				if (s_LastLog.m_Inline) {
+					std::cout << "\n";
+				}
+				
+				for (size_t i = 0U; i < _trace.size(); ++i) {
+					
+					// Indent each trace:
+					for (size_t j = 0; j < i; ++j) {
+						std::cout << '\t';
+					}
+					
+					Print::Multiplatform(_trace[i], LogType::Trace, false);
+				}
+				
+				// Flush the console.
+				std::cout << std::flush;
+			}
+			
+			s_LastLog = { _timestamp, _threadID, _makeInline };
+		}
+		
+		/**
+		 * @brief Returns true if a record should be withheld from the console due to being repeated too often.
+		 * @note Inline, Trace and Critical logs are never suppressed.
+		 */
+		static bool Suppress(const Record& _record) {
+			
+			bool result = false;
+			
+			if (!_record.m_Inline && _record.m_Type != Trace && _record.m_Type != Critical) {
+				
+				auto& backend = Backend::Get();
+				
+				const auto hash = std::hash<std::string_view>()(_record.m_Message) ^ (static_cast<size_t>(_record.m_Type) * 0x9E3779B97F4A7C15ULL);
+				
+				auto& repeat = backend.m_Repeats[hash];
+				
+				if (++repeat.m_Count > Backend::s_RepeatLimit) {
+					
+					if (repeat.m_Message.empty()) {
+						repeat.m_ThreadID = _record.m_ThreadID;
+						repeat.m_Type     = _record.m_Type;
+						repeat.m_Message  = _record.m_Message;
+					}
+					
+					result = true;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Reports logs which were suppressed during the current window, and begins a new one.
+		 */
+		static void RollRepeatWindow() {
+			
+			auto& backend = Backend::Get();
+			
+			const auto now = std::chrono::steady_clock::now();
+			
+			if (now - backend.m_WindowStart >= Backend::s_RepeatWindow) {
+				backend.m_WindowStart = now;
+				
+				for (const auto& kvp : backend.m_Repeats) {
+					
+					const auto& repeat = kvp.second;
+					
+					if (repeat.m_Count > Backend::s_RepeatLimit) {
+						
+						WriteConsole(
+							std::time(nullptr),
+							repeat.m_ThreadID,
+							repeat.m_Type,
+							false,
+							"(Suppressed " + std::to_string(repeat.m_Count - Backend::s_RepeatLimit) + " repeat(s)) " + repeat.m_Message,
+							{}
+						);
+					}
+				}
+				
+				backend.m_Repeats.clear();
+			}
+		}
+		
 	public:
 		
 		struct ThreadID final {
@@ -555,11 +1007,248 @@ namespace {
 			}
 			
 			static size_t Get() {
-				return Get(std::this_thread::get_id());
+				
+				// Cache the ID, as it cannot change for the lifetime of the thread.
+				static thread_local const size_t s_ID = Get(std::this_thread::get_id());
+				
+				return s_ID;
+			}
+			
+		};
+		
+		/**
+		 * @brief Compact binary log, written alongside the console output when open.
+		 *
+		 * @details The file begins with the magic "FYPLOG" and a 16-bit version, followed by records of the form:
+		 *          [u8 type][u8 inline][u32 thread][i64 unix time][u32 length][message][u16 trace count]([u32 length][trace])...
+		 *          All integers are little-endian. Unlike the console, the binary log is never rate-limited.
+		 */
+		struct BinaryLog final {
+		
+			friend Debug;
+			
+		private:
+			
+			static constexpr std::array<char, 6U> s_Magic { 'F', 'Y', 'P', 'L', 'O', 'G' };
+			
+			static constexpr uint16_t s_Version = 1U;
+			
+			template <typename T>
+			static void Put(std::ostream& _stream, const T& _value) {
+				
+				static_assert(std::is_integral_v<T>, "T must be an integral type.");
+				
+				for (size_t i = 0U; i < sizeof(T); ++i) {
+					_stream.put(static_cast<char>((static_cast<uint64_t>(_value) >> (i * 8U)) & 0xFFU));
+				}
+			}
+			
+			template <typename T>
+			static bool TryGet(std::istream& _stream, T& _value) {
+				
+				static_assert(std::is_integral_v<T>, "T must be an integral type.");
+				
+				uint64_t result = 0U;
+				
+				for (size_t i = 0U; i < sizeof(T); ++i) {
+					
+					const auto c = _stream.get();
+					
+					if (c == std::char_traits<char>::eof()) {
+						return false;
+					}
+					
+					result |= static_cast<uint64_t>(static_cast<unsigned char>(c)) << (i * 8U);
+				}
+				
+				_value = static_cast<T>(result);
+				
+				return true;
+			}
+			
+			static bool TryGet(std::istream& _stream, std::string& _value) {
+				
+				uint32_t length;
+				
+				bool result = TryGet(_stream, length);
+				
+				if (result) {
+					_value.resize(length);
+					
+					result = static_cast<bool>(_stream.read(_value.data(), static_cast<std::streamsize>(length)));
+				}
+				
+				return result;
+			}
+			
+			static void Put(std::ostream& _stream, const std::string_view& _value) {
+				Put(_stream, static_cast<uint32_t>(_value.size()));
+				_stream.write(_value.data(), static_cast<std::streamsize>(_value.size()));
+			}
+			
+			static void Encode(const Record& _record) {
+				
+				auto& backend = Backend::Get();
+				
+				const std::lock_guard<std::mutex> lock(backend.m_FileLock);
+				
+				if (backend.m_File.is_open()) {
+					
+					auto& file = backend.m_File;
+					
+					Put(file, static_cast<uint8_t>(_record.m_Type));
+					Put(file, static_cast<uint8_t>(_record.m_Inline ? 1U : 0U));
+					Put(file, static_cast<uint32_t>(_record.m_ThreadID));
+					Put(file, static_cast<int64_t>(_record.m_Timestamp));
+					Put(file, std::string_view(_record.m_Message));
+					Put(file, static_cast<uint16_t>(_record.m_Trace.size()));
+					
+					for (const auto& trace : _record.m_Trace) {
+						Put(file, std::string_view(trace));
+					}
+				}
+			}
+			
+		public:
+			
+			/**
+			 * @brief Opens a binary log at the given path, replacing any which is already open.
+			 * @return True if the file was opened successfully.
+			 */
+			static bool Open(const std::filesystem::path& _path) noexcept {
+				
+				bool result = false;
+				
+				Debug::Flush();
+				
+				try {
+					
+					auto& backend = Backend::Get();
+					
+					const std::lock_guard<std::mutex> lock(backend.m_FileLock);
+					
+					if (backend.m_File.is_open()) {
+						backend.m_File.close();
+					}
+					
+					backend.m_File.open(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+					
+					if (backend.m_File.is_open()) {
+						backend.m_File.write(s_Magic.data(), s_Magic.size());
+						Put(backend.m_File, s_Version);
+						
+						result = true;
+					}
+				}
+				catch (const std::exception& e) {
+					std::cerr << "LOG_ERR: " << e.what() << std::endl;
+				}
+				
+				return result;
 			}
 			
+			/**
+			 * @brief Writes all pending logs and closes the binary log, if open.
+			 */
+			static void Close() noexcept {
+				
+				Debug::Flush();
+				
+				try {
+					
+					auto& backend = Backend::Get();
+					
+					const std::lock_guard<std::mutex> lock(backend.m_FileLock);
+					
+					if (backend.m_File.is_open()) {
+						backend.m_File.close();
+					}
+				}
+				catch (const std::exception& e) {
+					std::cerr << "LOG_ERR: " << e.what() << std::endl;
+				}
+			}
+			
+			/**
+			 * @brief Decodes a binary log into human-readable text.
+			 *
+			 * @param[in,out] _input Stream of the binary log.
+			 * @param[in,out] _output Stream to write the decoded logs to.
+			 * @return The number of records decoded.
+			 *
+			 * @throws std::runtime_error If the input is not a binary log of a supported version.
+			 */
+			static size_t Decode(std::istream& _input, std::ostream& _output) {
+				
+				size_t result = 0U;
+				
+				std::array<char, s_Magic.size()> magic {};
+				uint16_t version;
+				
+				if (!_input.read(magic.data(), magic.size()) || magic != s_Magic) {
+					throw std::runtime_error("Not a binary log!");
+				}
+				
+				if (!TryGet(_input, version) || version != s_Version) {
+					throw std::runtime_error("Unsupported binary log version!");
+				}
+				
+				uint8_t  type;
+				uint8_t  makeInline;
+				uint32_t threadID;
+				int64_t  timestamp;
+				uint16_t traceCount;
+				
+				std::string message;
+				std::string trace;
+				
+				while (TryGet(_input, type)) {
+					
+					if (!TryGet(_input, makeInline) ||
+					    !TryGet(_input, threadID)   ||
+					    !TryGet(_input, timestamp)  ||
+					    !TryGet(_input, message)    ||
+					    !TryGet(_input, traceCount)
+					) {
+						throw std::runtime_error("Binary log is truncated!");
+					}
+					
+					const auto time = static_cast<std::time_t>(timestamp);
+					
+					_output << std::put_time(std::localtime(&time), "[%H:%M:%S %d/%m/%Y] ")
+					        << '[' << threadID << "] "
+					        << Print::ToString(static_cast<LogType>(type)) << ": "
+					        << message;
+					
+					if (makeInline == 0U) {
+						_output << '\n';
+					}
+					
+					for (uint16_t i = 0U; i < traceCount; ++i) {
+						
+						if (!TryGet(_input, trace)) {
+							throw std::runtime_error("Binary log is truncated!");
+						}
+						
+						_output << std::string(i + 1U, '\t') << trace << '\n';
+					}
+					
+					++result;
+				}
+				
+				return result;
+			}
 		};
 		
+		/**
+		 * @brief Returns true if logs of the given type are compiled in.
+		 *
+		 * @see FYP_LOG_LEVEL
+		 */
+		static constexpr bool Enabled(const LogType& _type) noexcept {
+			return (static_cast<unsigned>(FYP_LOG_LEVEL) & static_cast<unsigned>(_type)) != 0U;
+		}
+		
 		/**
 		 * @brief Asserts a condition and logs a message if the condition is false.
 		 * By default, the log type is set to `Debug`.
@@ -604,7 +1293,8 @@ namespace {
 		/**
 		 * @brief Flushes the log output.
 		 *
-		 * This static method is used to flush the log output. It flushes the output stream `std::cout` to ensure that any buffered log messages are immediately written to the output device.
+		 * This static method is used to flush the log output. It waits for the writer thread to write every log submitted
+		 * before the call, and then flushes the output stream `std::cout` to ensure that any buffered log messages are immediately written to the output device.
 		 *
 		 * @note This method is declared `noexcept`, indicating that it does not throw any exceptions.
 		 *
@@ -613,6 +1303,24 @@ namespace {
 		 */
 		static void Flush() noexcept {
 			
+			try {
+				
+				auto& backend = Backend::Get();
+				
+				if (backend.m_Running && std::this_thread::get_id() != backend.m_Thread.get_id()) {
+					
+					const auto target = backend.m_Head.load(std::memory_order_acquire);
+					
+					while (backend.m_Running && backend.m_Written.load(std::memory_order_acquire) < target) {
+						
+						backend.m_Wake.notify_one();
+						
+						std::this_thread::yield();
+					}
+				}
+			}
+			catch (...) {}
+			
 			const std::lock_guard<std::mutex> guard(s_Lock);
 			
 			try {
@@ -654,70 +1362,47 @@ namespace {
 		 * @param[in] _message The message to be logged.
 		 * @param[in] _type (optional) The log type for the message (default is `LogType::Debug`).
 		 * @param[in] _makeInline (optional) Specifies whether the log message should be displayed inline (default is `false`).
+		 *
+		 * @note Types excluded by FYP_LOG_LEVEL are discarded. Use FYP_LOG() to also avoid evaluating the message.
 		 */
 		static void Log(const std::string_view& _message, const LogType& _type = LogType::Debug, const bool& _makeInline = false) noexcept {
 			
-			const std::lock_guard<std::mutex> guard(s_Lock);
-			
 			static constexpr size_t max_frames = 10;
 			
+			if (!Enabled(_type)) { return; }
+			
 			try {
 				try {
 					
-					/*
-					 * Construct a header containing various pieces of metadata about the current log.
-					 */
-					std::ostringstream message;
-					
-					const Meta meta {
-						std::time(nullptr),
-						ThreadID::Get(),
-						_makeInline
-					};
-					
-					// Timestamp:
-					if (!s_LastLog.m_Inline) {
-						message << std::put_time(std::localtime(&meta.m_Timestamp), "[%H:%M:%S %d/%m/%Y] ");
+					// Stack traces must be captured on the calling thread.
+					std::vector<std::string> trace;
+					if (_type == LogType::Trace || _type == LogType::Critical) {
+						trace = StackTrace(max_frames);
 					}
 					
-					// Thread ID:
-					if (!s_LastLog.m_Inline || s_LastLog.m_ThreadID != meta.m_ThreadID) {
-						message << "[" + std::to_string(meta.m_ThreadID) + "] ";
+					if (Start()) {
+						(void)Push(_message, _type, _makeInline, std::move(trace));
 					}
-					
-					message << _message.data();
-					
-					// Print log to console:
-					Print::Multiplatform(message.str(), _type, _makeInline);
-					
-					// Add trace information:
-					if (_type == LogType::Trace || _type == LogType::Critical) {
+					else {
 						
-						// Start trace on new line always.
-						if (s_LastLog.m_Inline) {
-							std::cout << "\n";
-						}
+						// The writer is not running (i.e. during shutdown), so write synchronously.
+						const std::lock_guard<std::mutex> guard(s_Lock);
 						
-						auto trace = StackTrace(max_frames);
-						for (size_t i = 0U; i < trace.size(); ++i) {
-							
-							// Indent each trace:
-							for (size_t j = 0; j < i; ++j) {
-								std::cout << '\t';
-							}
-							
-							Print::Multiplatform(trace[i], LogType::Trace, false);
-						}
+						Record record;
+						record.m_Timestamp = std::time(nullptr);
+						record.m_ThreadID  = ThreadID::Get();
+						record.m_Type      = _type;
+						record.m_Inline    = _makeInline;
+						record.m_Message   = _message;
+						record.m_Trace     = std::move(trace);
 						
-						// Flush the console.
-						std::cout << std::flush;
+						Write(record);
 					}
 
 #if !defined(NDEBUG) || _DEBUG
 					if (_type == LogType::Critical) { Break(); }
 #endif
-					s_LastLog = meta;
-					
+					if (_type == LogType::Critical) { Flush(); }
 				}
 				catch (const std::exception& e) {
 					std::cerr << "LOG_ERR: " << e.what() << std::endl;
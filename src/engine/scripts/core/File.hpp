@@ -2,13 +2,30 @@
 #define FINALYEARPROJECT_FILE_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#if __linux__ || __APPLE__
+	
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+#elif _WIN32
+	
+	#include <windows.h>
+
+#endif
+
 namespace LouiEriksson::Engine {
 	
 	class File final {
@@ -45,38 +62,122 @@ namespace LouiEriksson::Engine {
 			static std::vector<std::filesystem::path> GetEntriesRecursive(const std::filesystem::path& _path, const Directory::EntryType& _type) {
 			
 				std::vector<std::filesystem::path> result;
-				std::vector<std::filesystem::path> subDirectories;
 				
-				// Get all entries.
-				for (const auto& item : GetEntries(_path, static_cast<Directory::EntryType>(Directory::EntryType::FILE | Directory::EntryType::DIRECTORY))) {
-					
-					bool append;
+				for (const auto& item : std::filesystem::recursive_directory_iterator(_path)) {
 					
-					if (is_directory(item)) {
+					// Use the cached type of the entry rather than querying the file system again.
+					const bool append = item.is_directory() ?
+							(_type & Directory::EntryType::DIRECTORY) != 0U :
+							(_type & Directory::EntryType::FILE     ) != 0U;
 					
-						// Append all subdirectories to a vector.
-						subDirectories.emplace_back(item);
-						
-						append = (_type & Directory::EntryType::DIRECTORY) != 0U;
-					}
-					else {
-						append = (_type & Directory::EntryType::FILE) != 0U;
+					if (append) {
+						result.emplace_back(item.path());
 					}
-					
-					// Append entries of requested type to result.
-					if (append) { result.emplace_back(item); }
 				}
 				
-				// Iterate through all subdirectories recursively and append output to result.
-				for (const auto& subDirectory : subDirectories) {
+				return result;
+			}
+		};
+		
+		/**
+		 * @class Mapping
+		 * @brief Read-only view of the contents of a file.
+		 *
+		 * @details Where supported, the file is memory-mapped so that its contents are paged in on demand rather than copied.
+		 *          Otherwise, the file is read into a buffer owned by the Mapping. The view is released on destruction.
+		 *
+		 * @see File::Map
+		 */
+		class Mapping final {
+			
+			friend File;
+		
+		private:
+			
+			const char* m_Data;
+			
+			size_t m_Size;
+			
+			/** @brief True if m_Data is a memory-mapped view, false if it points into m_Buffer. */
+			bool m_Mapped;
+			
+			std::unique_ptr<char[]> m_Buffer;
+			
+			void Release() noexcept {
+				
+				if (m_Mapped && m_Data != nullptr) {
+
+#if __linux__ || __APPLE__
+					munmap(const_cast<char*>(m_Data), m_Size);
+#elif _WIN32
+					UnmapViewOfFile(m_Data);
+#endif
+				}
+				
+				m_Buffer.reset();
+				
+				m_Data   = nullptr;
+				m_Size   = 0U;
+				m_Mapped = false;
+			}
+		
+		public:
+			
+			constexpr Mapping() noexcept :
+				m_Data(nullptr),
+				m_Size(0U),
+				m_Mapped(false) {}
+			
+			Mapping(const Mapping& _other) = delete;
+			Mapping& operator = (const Mapping& _other) = delete;
+			
+			Mapping(Mapping&& _other) noexcept :
+				m_Data  (std::exchange(_other.m_Data,   nullptr)),
+				m_Size  (std::exchange(_other.m_Size,   0U     )),
+				m_Mapped(std::exchange(_other.m_Mapped, false  )),
+				m_Buffer(std::move(_other.m_Buffer)) {}
+			
+			Mapping& operator = (Mapping&& _other) noexcept {
 				
-					auto items = GetEntriesRecursive(subDirectory, _type);
+				if (this != &_other) {
 					
-					result.insert(result.end(), items.begin(), items.end());
+					Release();
+					
+					m_Data   = std::exchange(_other.m_Data,   nullptr);
+					m_Size   = std::exchange(_other.m_Size,   0U     );
+					m_Mapped = std::exchange(_other.m_Mapped, false  );
+					m_Buffer = std::move(_other.m_Buffer);
 				}
 				
-				return result;
+				return *this;
+			}
+			
+			~Mapping() {
+				Release();
 			}
+			
+			/**
+			 * @brief Returns the contents of the file.
+			 * @note The view is not null-terminated, and is invalidated when the Mapping is destroyed.
+			 */
+			[[nodiscard]] constexpr std::string_view View() const noexcept { return { m_Data, m_Size }; }
+			
+			/** @brief Returns the size of the file in bytes. */
+			[[nodiscard]] constexpr const size_t& Size() const noexcept { return m_Size; }
+			
+			/** @brief Returns true if the file is memory-mapped, or false if it was read into a buffer. */
+			[[nodiscard]] constexpr const bool& Mapped() const noexcept { return m_Mapped; }
+			
+			constexpr operator std::string_view() const noexcept { return View(); }
+		};
+		
+		/**
+		 * @brief Expected pattern of access to a Mapping, which is passed to the operating system as a hint.
+		 */
+		enum AccessPattern : unsigned char {
+			Normal,     /**< @brief No hint is given.                                                       */
+			Sequential, /**< @brief The file is read from start to end, so is read ahead aggressively.    */
+			Random      /**< @brief The file is read in no particular order, so read-ahead is disabled.   */
 		};
 		
 		 File()                   = delete;
@@ -117,6 +218,105 @@ namespace LouiEriksson::Engine {
 		
 			return result;
 		}
+		
+		/**
+		 * @brief Provides read-only access to the contents of a file without copying it.
+		 *
+		 * @details The file is memory-mapped where supported. If the file cannot be mapped (or is empty),
+		 *          its contents are instead read into a buffer owned by the returned Mapping.
+		 *
+		 * @param[in] _path The path to the file.
+		 * @param[in] _pattern Expected pattern of access to the contents of the file.
+		 * @return A Mapping of the contents of the file.
+		 * @throws std::runtime_error If the file path is invalid or the file cannot be read.
+		 */
+		static Mapping Map(const std::filesystem::path& _path, const AccessPattern& _pattern = Sequential) {
+			
+			if (!exists(_path)) {
+				throw std::runtime_error("Invalid file path");
+			}
+			
+			Mapping result;
+			
+			const auto size = static_cast<size_t>(std::filesystem::file_size(_path));
+			
+			if (size > 0U) {
+
+#if __linux__ || __APPLE__
+				
+				const auto fd = open(_path.c_str(), O_RDONLY);
+				
+				if (fd != -1) {
+					
+					auto* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+					
+					// The mapping remains valid once the descriptor is closed.
+					close(fd);
+					
+					if (data != MAP_FAILED) {
+						
+						if (_pattern == Sequential) {
+							posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+							posix_madvise(data, size, POSIX_MADV_WILLNEED);
+						}
+						else if (_pattern == Random) {
+							posix_madvise(data, size, POSIX_MADV_RANDOM);
+						}
+						
+						result.m_Data   = static_cast<const char*>(data);
+						result.m_Size   = size;
+						result.m_Mapped = true;
+					}
+				}
+
+#elif _WIN32
+				
+				const auto flags = _pattern == Sequential ? FILE_FLAG_SEQUENTIAL_SCAN :
+				                   _pattern == Random     ? FILE_FLAG_RANDOM_ACCESS   : FILE_ATTRIBUTE_NORMAL;
+				
+				const auto file = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+				
+				if (file != INVALID_HANDLE_VALUE) {
+					
+					const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					
+					if (mapping != nullptr) {
+						
+						const auto* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+						
+						// The view remains valid once the handles are closed.
+						CloseHandle(mapping);
+						
+						if (data != nullptr) {
+							result.m_Data   = static_cast<const char*>(data);
+							result.m_Size   = size;
+							result.m_Mapped = true;
+						}
+					}
+					
+					CloseHandle(file);
+				}
+
+#endif
+				
+				// Fall back to a buffered read.
+				if (!result.m_Mapped) {
+					
+					std::ifstream fs(_path, std::ios::in | std::ios::binary);
+					
+					result.m_Buffer = std::make_unique<char[]>(size);
+					
+					if (!fs.is_open() || !fs.read(result.m_Buffer.get(), static_cast<std::streamsize>(size))) {
+						throw std::runtime_error("Failed to read file \"" + _path.string() + "\"");
+					}
+					
+					result.m_Data = result.m_Buffer.get();
+					result.m_Size = size;
+				}
+			}
+			
+			return result;
+		}
 	};
 	
 } // LouiEriksson::Engine
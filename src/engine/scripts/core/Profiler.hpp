@@ -0,0 +1,414 @@
+#ifndef FINALYEARPROJECT_PROFILER_HPP
+#define FINALYEARPROJECT_PROFILER_HPP
+
+#include "Debug.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define FYP_PROFILER_CONCAT_INNER(_a, _b) _a##_b
+#define FYP_PROFILER_CONCAT(_a, _b) FYP_PROFILER_CONCAT_INNER(_a, _b)
+
+/**
+ * @def PROFILE_ZONE
+ * @brief Profiles the remainder of the enclosing scope.
+ *
+ * @param[in] _name Name of the zone. Must have static storage duration (i.e. a string literal).
+ *
+ * @note Zones are compiled out if FYP_DISABLE_PROFILER is defined.
+ */
+#ifndef FYP_DISABLE_PROFILER
+	#define PROFILE_ZONE(_name) const LouiEriksson::Engine::Profiler::Zone FYP_PROFILER_CONCAT(_profiler_zone_, __LINE__)(_name)
+#else
+	#define PROFILE_ZONE(_name) do {} while (false)
+#endif
+
+/**
+ * @def PROFILE_FUNCTION
+ * @brief Profiles the remainder of the enclosing function, using its name.
+ */
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @class Profiler
+	 * @brief Hierarchical CPU profiler.
+	 *
+	 * @details Zones are recorded into a per-thread ring buffer which is written only by its owning thread,
+	 *          so recording a zone is lock-free. Readers (the GUI and the Chrome trace exporter) take a snapshot
+	 *          of the most recent zones of every thread.
+	 */
+	class Profiler final {
+	
+	public:
+		
+		/**
+		 * @brief A completed zone.
+		 */
+		struct Event final {
+			
+			const char* m_Name;
+			
+			uint64_t m_Start; /**< @brief Nanoseconds since the profiler epoch. */
+			uint64_t m_End;   /**< @brief Nanoseconds since the profiler epoch. */
+			
+			uint32_t m_Depth;
+			size_t   m_ThreadID;
+		};
+	
+	private:
+		
+		/** @brief Number of zones retained per thread. Must be a power of two. */
+		static constexpr size_t s_Capacity = 1U << 15U;
+		
+		/** @brief Number of frame boundaries retained. Must be a power of two. */
+		static constexpr size_t s_FrameCapacity = 256U;
+		
+		struct Slot final {
+			
+			std::atomic<const char*> m_Name  { nullptr };
+			std::atomic<uint64_t>    m_Start { 0U };
+			std::atomic<uint64_t>    m_End   { 0U };
+			std::atomic<uint32_t>    m_Depth { 0U };
+		};
+		
+		/**
+		 * @brief Single-producer ring buffer of zones belonging to one thread.
+		 */
+		struct Buffer final {
+			
+			std::array<Slot, s_Capacity> m_Slots;
+			
+			/** @brief Number of zones ever written. */
+			std::atomic<uint64_t> m_Head { 0U };
+			
+			size_t m_ThreadID { 0U };
+			
+			/** @brief Current nesting depth of the owning thread. */
+			uint32_t m_Depth { 0U };
+		};
+		
+		inline static const auto s_Epoch = std::chrono::steady_clock::now();
+		
+		inline static std::atomic<bool> s_Enabled { true };
+		
+		inline static std::mutex                           s_Lock;
+		inline static std::vector<std::shared_ptr<Buffer>> s_Buffers;
+		
+		inline static std::array<std::atomic<uint64_t>, s_FrameCapacity> s_Frames {};
+		inline static std::atomic<uint64_t>                              s_FrameCount { 0U };
+		
+		/**
+		 * @brief Returns the buffer of the calling thread, creating and registering it if necessary.
+		 */
+		static Buffer& Local() {
+			
+			static thread_local const auto s_Local = []() {
+				
+				auto result = std::make_shared<Buffer>();
+				result->m_ThreadID = Debug::ThreadID::Get();
+				
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				s_Buffers.emplace_back(result);
+				
+				return result;
+			}();
+			
+			return *s_Local;
+		}
+		
+		static void Record(Buffer& _buffer, const char* _name, const uint64_t& _start, const uint64_t& _end, const uint32_t& _depth) noexcept {
+			
+			const auto head = _buffer.m_Head.load(std::memory_order_relaxed);
+			
+			auto& slot = _buffer.m_Slots[head & (s_Capacity - 1U)];
+			
+			slot.m_Name. store(_name,  std::memory_order_relaxed);
+			slot.m_Start.store(_start, std::memory_order_relaxed);
+			slot.m_End.  store(_end,   std::memory_order_relaxed);
+			slot.m_Depth.store(_depth, std::memory_order_relaxed);
+			
+			_buffer.m_Head.store(head + 1U, std::memory_order_release);
+		}
+		
+		static void EscapeJSON(std::ostream& _stream, const char* _str) {
+			
+			for (const auto* c = _str; *c != '\0'; ++c) {
+				
+				switch (*c) {
+					case '"':  { _stream << "\\\""; break; }
+					case '\\': { _stream << "\\\\"; break; }
+					case '\n': { _stream << "\\n";  break; }
+					case '\t': { _stream << "\\t";  break; }
+					default: {
+						_stream << *c;
+					}
+				}
+			}
+		}
+	
+	public:
+		
+		 Profiler()                       = delete;
+		 Profiler(const Profiler& _other) = delete;
+		~Profiler()                       = delete;
+		
+		/**
+		 * @class Zone
+		 * @brief RAII object which records the time between its construction and destruction.
+		 * @see PROFILE_ZONE
+		 */
+		class Zone final {
+		
+		private:
+			
+			Buffer* m_Buffer;
+			
+			const char* m_Name;
+			
+			uint64_t m_Start;
+			uint32_t m_Depth;
+		
+		public:
+			
+			explicit Zone(const char* _name) noexcept :
+				m_Buffer(nullptr),
+				m_Name(_name),
+				m_Start(0U),
+				m_Depth(0U)
+			{
+				if (s_Enabled.load(std::memory_order_relaxed)) {
+					
+					try {
+						m_Buffer = &Local();
+						m_Depth  = m_Buffer->m_Depth++;
+						m_Start  = Now();
+					}
+					catch (...) {
+						m_Buffer = nullptr;
+					}
+				}
+			}
+			
+			Zone(const Zone& _other) = delete;
+			Zone& operator = (const Zone& _other) = delete;
+			
+			~Zone() {
+				
+				if (m_Buffer != nullptr) {
+					Record(*m_Buffer, m_Name, m_Start, Now(), m_Depth);
+					
+					--m_Buffer->m_Depth;
+				}
+			}
+		};
+		
+		/**
+		 * @brief Returns the number of nanoseconds elapsed since the profiler epoch.
+		 */
+		[[nodiscard]] static uint64_t Now() noexcept {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_Epoch).count());
+		}
+		
+		/**
+		 * @brief Enable or disable the recording of zones.
+		 */
+		static void Enabled(const bool& _value) noexcept {
+			s_Enabled = _value;
+		}
+		
+		/**
+		 * @brief Returns true if zones are being recorded.
+		 */
+		[[nodiscard]] static bool Enabled() noexcept {
+			return s_Enabled;
+		}
+		
+		/**
+		 * @brief Marks the beginning of a new frame.
+		 * @note Should be called once per frame by the main thread.
+		 */
+		static void Frame() noexcept {
+			
+			const auto count = s_FrameCount.load(std::memory_order_relaxed);
+			
+			s_Frames[count & (s_FrameCapacity - 1U)].store(Now(), std::memory_order_relaxed);
+			
+			s_FrameCount.store(count + 1U, std::memory_order_release);
+		}
+		
+		/**
+		 * @brief Returns the start and end of a recently completed frame.
+		 *
+		 * @param[in] _age Number of frames before the most recently completed frame (0 = most recent).
+		 * @param[out] _start The start of the frame, in nanoseconds since the profiler epoch.
+		 * @param[out] _end The end of the frame, in nanoseconds since the profiler epoch.
+		 * @return True if the frame is still retained.
+		 */
+		static bool TryGetFrame(const size_t& _age, uint64_t& _start, uint64_t& _end) noexcept {
+			
+			bool result = false;
+			
+			const auto count = s_FrameCount.load(std::memory_order_acquire);
+			
+			if (count >= _age + 2U && _age + 2U <= s_FrameCapacity) {
+				
+				_start = s_Frames[(count - _age - 2U) & (s_FrameCapacity - 1U)].load(std::memory_order_relaxed);
+				_end   = s_Frames[(count - _age - 1U) & (s_FrameCapacity - 1U)].load(std::memory_order_relaxed);
+				
+				result = true;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a snapshot of the retained zones of every thread which overlap the given interval.
+		 *
+		 * @param[in] _start Start of the interval, in nanoseconds since the profiler epoch.
+		 * @param[in] _end End of the interval, in nanoseconds since the profiler epoch.
+		 * @return Zones ordered by thread.
+		 */
+		static std::vector<Event> Snapshot(const uint64_t& _start = 0U, const uint64_t& _end = UINT64_MAX) {
+			
+			std::vector<Event> result;
+			
+			std::vector<std::shared_ptr<Buffer>> buffers;
+			{
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				buffers = s_Buffers;
+			}
+			
+			for (const auto& buffer : buffers) {
+				
+				const auto head = buffer->m_Head.load(std::memory_order_acquire);
+				const auto tail = head > s_Capacity ? head - s_Capacity : 0U;
+				
+				std::vector<Event> events;
+				events.reserve(static_cast<size_t>(head - tail));
+				
+				for (auto i = tail; i < head; ++i) {
+					
+					const auto& slot = buffer->m_Slots[i & (s_Capacity - 1U)];
+					
+					events.push_back({
+						slot.m_Name. load(std::memory_order_relaxed),
+						slot.m_Start.load(std::memory_order_relaxed),
+						slot.m_End.  load(std::memory_order_relaxed),
+						slot.m_Depth.load(std::memory_order_relaxed),
+						buffer->m_ThreadID
+					});
+				}
+				
+				/*
+				 * The owning thread may have overwritten slots at the tail while they were being copied.
+				 * Discard any which could have been, as they may be inconsistent.
+				 */
+				const auto latest = buffer->m_Head.load(std::memory_order_acquire);
+				const auto valid  = latest > s_Capacity ? std::max(tail, latest - s_Capacity) : tail;
+				
+				for (auto i = static_cast<size_t>(std::min(valid, head) - tail); i < events.size(); ++i) {
+					
+					const auto& event = events[i];
+					
+					if (event.m_Name != nullptr && event.m_End >= _start && event.m_Start <= _end) {
+						result.emplace_back(event);
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Writes the given zones in the Chrome trace event format.
+		 *
+		 * @param[in,out] _stream Output stream.
+		 * @param[in] _events Zones to write.
+		 *
+		 * @see <a href="https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU">Trace Event Format</a>
+		 */
+		static void ExportChromeTrace(std::ostream& _stream, const std::vector<Event>& _events) {
+			
+			const auto flags     = _stream.flags();
+			const auto precision = _stream.precision();
+			
+			_stream << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+			
+			bool first = true;
+			
+			for (const auto& event : _events) {
+				
+				if (!first) { _stream << ','; }
+				first = false;
+				
+				_stream << "{\"name\":\"";
+				EscapeJSON(_stream, event.m_Name);
+				_stream << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.m_ThreadID
+				        << ",\"ts\":"  << static_cast<double>(event.m_Start) / 1000.0
+				        << ",\"dur\":" << static_cast<double>(event.m_End - event.m_Start) / 1000.0
+				        << '}';
+			}
+			
+			_stream << "]}";
+			
+			_stream.flags(flags);
+			_stream.precision(precision);
+		}
+		
+		/**
+		 * @brief Writes every retained zone to a Chrome trace JSON file, which may be opened in chrome://tracing or Perfetto.
+		 *
+		 * @param[in] _path Path of the file.
+		 * @return True if the file was written successfully.
+		 */
+		static bool ExportChromeTrace(const std::filesystem::path& _path) noexcept {
+			
+			bool result = false;
+			
+			try {
+				
+				std::ofstream file(_path, std::ios::out | std::ios::trunc);
+				
+				if (file.is_open()) {
+					
+					ExportChromeTrace(file, Snapshot());
+					
+					result = file.good();
+				}
+				
+				if (result) {
+					Debug::Log("Exported profile to \"" + _path.string() + "\".", Info);
+				}
+				else {
+					throw std::runtime_error("Failed to write profile to \"" + _path.string() + "\"!");
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_PROFILER_HPP
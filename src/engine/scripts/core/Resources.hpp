@@ -7,37 +7,40 @@
 #include "../graphics/Shader.hpp"
 #include "../graphics/Texture.hpp"
 #include "../graphics/textures/Cubemap.hpp"
+#include "AssetHandle.hpp"
+#include "AssetId.hpp"
+#include "AssetImporter.hpp"
+#include "AssetManifest.hpp"
+#include "CookedAsset.hpp"
 #include "File.hpp"
 #include "utils/Hashmap.hpp"
+#include "utils/JobSystem.hpp"
 
 #include "Debug.hpp"
 
-#ifndef STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_STATIC
-#include "stb_image.h" // STB IMAGE
-#endif
-
-#include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
-#include <assimp/scene.h>
-
 #include <GL/glew.h>
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <type_traits>
 #include <typeindex>
 #include <utility>
 #include <vector>
@@ -59,6 +62,7 @@ namespace LouiEriksson::Engine {
 		
 		enum Status : unsigned char {
 			Unloaded, /**< @brief File is not yet loaded into memory. */
+			 Loading, /**< @brief File is being loaded asynchronously. */
 			  Loaded, /**< @brief File is currently loaded into memory. */
 			 Missing, /**< @brief File not found. */
 			   Error  /**< @brief Error loading file. */
@@ -66,19 +70,52 @@ namespace LouiEriksson::Engine {
 		
 		Status m_Status;
 		
+		/** @brief Name of the asset, and its identifier. */
+		std::string m_Name;
+		AssetId     m_Id;
+		
 		std::filesystem::path m_Path;
 		
 		std::shared_ptr<T> m_Item;
 		
+		/** @brief Hash of the contents of the file, used to validate its cooked form. Zero if unknown. */
+		uint64_t m_Hash;
+		
+		/** @brief Handle given to requests for the asset while it is loading asynchronously. */
+		AssetHandle<T> m_Handle;
+		
+		/** @brief Job decoding the asset while it is loading asynchronously. */
+		Threading::JobSystem::Handle m_Job;
+		
+		/** @brief Approximate size of the asset in memory while it is loaded, taken as the size of its decoded data. */
+		size_t m_Bytes;
+		
+		/** @brief Frame on which the asset was last retrieved, used to evict the least recently used assets first. */
+		uint64_t m_Used;
+		
 		Asset() noexcept :
 			m_Status(Unloaded),
+			m_Name(),
+			m_Id(),
 			m_Path(),
-			m_Item() {}
+			m_Item(),
+			m_Hash(0U),
+			m_Handle(),
+			m_Job(),
+			m_Bytes(0U),
+			m_Used(0U) {}
 			
-		Asset(std::filesystem::path _path) :
+		Asset(std::string _name, std::filesystem::path _path, const uint64_t& _hash = 0U) :
 			m_Status(Unloaded),
+			m_Name(std::move(_name)),
+			m_Id(m_Name),
 			m_Path(std::move(_path)),
-			m_Item() {}
+			m_Item(),
+			m_Hash(_hash),
+			m_Handle(),
+			m_Job(),
+			m_Bytes(0U),
+			m_Used(0U) {}
 		
 		/**
 		 * @brief Loads the asset.
@@ -107,12 +144,60 @@ namespace LouiEriksson::Engine {
 		
 	private:
 		
-		inline static Hashmap<std::string, Asset<   Audio::AudioClip>> m_Audio;
-		inline static Hashmap<std::string, Asset<Graphics::Material >> m_Materials;
-		inline static Hashmap<std::string, Asset<Graphics::Mesh     >> m_Meshes;
-		inline static Hashmap<std::string, Asset<Graphics::Shader   >> m_Shaders;
-		inline static Hashmap<std::string, Asset<Graphics::Texture  >> m_Textures;
-		inline static Hashmap<std::string, Asset<Graphics::Cubemap  >> m_Cubemaps;
+		/**
+		 * @struct Bucket
+		 * @brief The assets of a single type, stored densely in the order in which they were indexed.
+		 *
+		 * @details The identifier of each asset resolves to its slot. Assets never move between slots, so the slot of an asset may be
+		 *          cached by an AssetRef and then retrieved without a lookup.
+		 */
+		template<typename T>
+		struct Bucket final {
+			
+			/** @brief The assets. A deque does not relocate the existing assets as it grows. */
+			std::deque<Asset<T>> m_Slots;
+			
+			/** @brief Slot of each asset, by identifier. */
+			Hashmap<AssetId, size_t> m_Index;
+			
+			/** @brief Number of bytes of the assets which may remain resident before unreferenced assets are evicted. */
+			size_t m_Budget;
+			
+			/** @brief Number of bytes of the loaded assets. */
+			size_t m_Resident;
+			
+			/** @brief Number of assets evicted, and their total size in bytes. */
+			size_t m_Evictions,
+			       m_EvictedBytes;
+			
+			explicit Bucket(const size_t& _budget) noexcept :
+				m_Slots(),
+				m_Index(),
+				m_Budget(_budget),
+				m_Resident(0U),
+				m_Evictions(0U),
+				m_EvictedBytes(0U) {}
+			
+			void Clear() {
+				m_Index.Clear();
+				m_Slots.clear();
+				
+				m_Resident     = 0U;
+				m_Evictions    = 0U;
+				m_EvictedBytes = 0U;
+			}
+		};
+		
+		/*
+		 * Shaders and AudioClips are small, and are held weakly by their users, so are never evicted.
+		 * Materials own their Textures, so unreferenced Materials are always evicted, which allows their Textures to be evicted in turn.
+		 */
+		inline static Bucket<   Audio::AudioClip> m_Audio     { std::numeric_limits<size_t>::max() };
+		inline static Bucket<Graphics::Material > m_Materials { 0U                                 };
+		inline static Bucket<Graphics::Mesh     > m_Meshes    { 268435456U                         };
+		inline static Bucket<Graphics::Shader   > m_Shaders   { std::numeric_limits<size_t>::max() };
+		inline static Bucket<Graphics::Texture  > m_Textures  { 1073741824U                        };
+		inline static Bucket<Graphics::Cubemap  > m_Cubemaps  { 268435456U                         };
 		
 		inline static const Hashmap<std::string, std::type_index> s_Types {
 			{ ".wav",  typeid(   Audio::AudioClip) },
@@ -130,9 +215,9 @@ namespace LouiEriksson::Engine {
 		};
 		
 		template<typename T>
-		static constexpr Hashmap<std::string, Asset<T>>& GetBucket() {
+		static constexpr Bucket<T>& GetBucket() {
 
-			Hashmap<std::string, Asset<T>>* r;
+			Bucket<T>* r;
 			
 			     if constexpr (std::is_same_v<T,    Audio::AudioClip>) { r = &m_Audio;     }
 			else if constexpr (std::is_same_v<T, Graphics::Material >) { r = &m_Materials; }
@@ -147,12 +232,122 @@ namespace LouiEriksson::Engine {
 			return *r;
 		}
 		
+		/**
+		 * @brief Adds an asset to its bucket.
+		 *
+		 * @details If an asset with the same name is already indexed, it is replaced within its slot, so that any AssetRef to it remains valid.
+		 *
+		 * @param[in] _name The name of the asset.
+		 * @param[in] _path The path to the asset.
+		 * @param[in] _hash Hash of the contents of the asset, used to validate its cooked form.
+		 * @return The slot of the asset.
+		 */
+		template<typename T>
+		static size_t Index(const std::string& _name, const std::filesystem::path& _path, const uint64_t& _hash = 0U) {
+			
+			auto& bucket = GetBucket<T>();
+			
+			Asset<T> asset(_name, _path, _hash);
+			
+			size_t result;
+			
+			if (const auto slot = bucket.m_Index.Get(asset.m_Id)) {
+				
+				result = *slot;
+				
+				auto& existing = bucket.m_Slots[result];
+				
+				if (existing.m_Name != _name) {
+					throw std::runtime_error("The identifier of \"" + _name + "\" collides with that of \"" + existing.m_Name + "\"!");
+				}
+				
+				bucket.m_Resident -= existing.m_Bytes;
+				
+				existing = std::move(asset);
+			}
+			else {
+				
+				result = bucket.m_Slots.size();
+				
+				bucket.m_Index.Assign(asset.m_Id, result);
+				bucket.m_Slots.emplace_back(std::move(asset));
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the asset referred to by an AssetRef, resolving the slot of the reference if it has not been resolved or is stale.
+		 * @return A pointer to the asset, or nullptr if no asset of the type has the identifier of the reference.
+		 */
+		template<typename T>
+		static Asset<T>* Find(const AssetRef<T>& _ref) noexcept {
+			
+			Asset<T>* result = nullptr;
+			
+			auto& bucket = GetBucket<T>();
+			
+			if (_ref.m_Slot < bucket.m_Slots.size() && bucket.m_Slots[_ref.m_Slot].m_Id == _ref.m_Id) {
+				result = &bucket.m_Slots[_ref.m_Slot];
+			}
+			else if (const auto slot = bucket.m_Index.Get(_ref.m_Id)) {
+				_ref.m_Slot = *slot;
+				
+				result = &bucket.m_Slots[_ref.m_Slot];
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Determines the type of an asset from its file extension.
+		 * @return The name of the type, or an empty string if the file is not a supported asset.
+		 */
+		static std::string Classify(const std::filesystem::path& _path) {
+			
+			std::string result;
+			
+			if (_path.has_extension()) {
+				
+				if (_path.extension() == ".inc") {
+					result = "Dependency";
+				}
+				else if (const auto type = s_Types.Get(_path.extension())) {
+					
+					     if (*type == typeid(   Audio::AudioClip)) { result = "AudioClip"; }
+					else if (*type == typeid(Graphics::Material )) { result = "Material";  }
+					else if (*type == typeid(Graphics::Mesh     )) { result = "Mesh";      }
+					else if (*type == typeid(Graphics::Shader   )) { result = "Shader";    }
+					else if (*type == typeid(Graphics::Texture  )) { result = "Texture";   }
+				}
+			}
+			
+			return result;
+		}
+		
 		/**
 		 * @brief Initialises the Resources system.
+		 *
+		 * @details Assets are indexed using a manifest cached in "cache/assets.json", so that only directories which have changed
+		 *          since the previous run are rescanned.
 		 */
 		static void Init()  {
-			IndexDependencies();
-			IndexAssets();
+			
+			const auto manifest = AssetManifest::Refresh("assets/", "cache/assets.json", Classify);
+			
+			const auto& statistics = manifest.GetStatistics();
+			
+			Debug::Log(
+				"Indexed (" + std::to_string(statistics.m_Files) + ") file(s) in (" + std::to_string(statistics.m_Directories) + ") directories in " +
+				std::to_string(std::chrono::duration<double, std::milli>(statistics.m_Duration).count()) + "ms (" +
+				(statistics.m_Cold ? "cold" : "warm") + " start, " +
+				std::to_string(statistics.m_Rescanned) + " rescanned, " +
+				std::to_string(statistics.m_Hashed) + " hashed).",
+				Info
+			);
+			
+			IndexDependencies(manifest);
+			IndexAssets(manifest);
 		}
 		
 		static void Dispose() noexcept {
@@ -162,33 +357,47 @@ namespace LouiEriksson::Engine {
 			try {   m_Shaders.Clear(); } catch (const std::exception& e) { Debug::Log(e, Critical); };
 			try {  m_Textures.Clear(); } catch (const std::exception& e) { Debug::Log(e, Critical); };
 			try {  m_Cubemaps.Clear(); } catch (const std::exception& e) { Debug::Log(e, Critical); };
+			
+			try {
+				const std::lock_guard<std::mutex> lock(s_UploadLock);
+				
+				s_Uploads.clear();
+				s_Pending = 0U;
+			}
+			catch (const std::exception& e) { Debug::Log(e, Critical); };
 		}
 		
 		/**
 		 * @brief Index all of the assets the application has access to.
 		 *
 		 * This function indexes all assets in the "assets/" directory and assigns them to the appropriate asset bucket based on their type.
-		 * The assets are assigned to the asset buckets using the stem of their file name as the key.
+		 * The assets are assigned to the asset buckets using the stem of their file name as their name.
+		 *
+		 * @param[in] _manifest Manifest of the "assets/" directory.
 		 *
 		 * @note Assets with unsupported file extensions are logged as warnings.
 		 * @see Asset
 		 */
-		static void IndexAssets() {
+		static void IndexAssets(const AssetManifest& _manifest) {
 			
-			for (const auto& item : File::Directory::GetEntriesRecursive("assets/", File::Directory::EntryType::FILE)) {
-			
-				if (item.has_extension()) {
+			for (const auto& entry : _manifest.Entries()) {
 				
-					if (const auto type = s_Types.Get(item.extension())) {
-						   
-						     if (*type == typeid(   Audio::AudioClip)) {     m_Audio.Assign(item.stem().string(), { item }); }
-						else if (*type == typeid(Graphics::Material )) { m_Materials.Assign(item.stem().string(), { item }); }
-						else if (*type == typeid(Graphics::Mesh     )) {    m_Meshes.Assign(item.stem().string(), { item }); }
-						else if (*type == typeid(Graphics::Shader   )) {   m_Shaders.Assign(item.stem().string(), { item }); }
-						else if (*type == typeid(Graphics::Texture  )) {  m_Textures.Assign(item.stem().string(), { item }); }
+				const auto& item = entry.m_Path;
+				
+				if (item.has_extension()) {
+					
+					try {
+						     if (entry.m_Type == "AudioClip") { Index<   Audio::AudioClip>(item.stem().string(), item, entry.m_Hash); }
+						else if (entry.m_Type == "Material" ) { Index<Graphics::Material >(item.stem().string(), item, entry.m_Hash); }
+						else if (entry.m_Type == "Mesh"     ) { Index<Graphics::Mesh     >(item.stem().string(), item, entry.m_Hash); }
+						else if (entry.m_Type == "Shader"   ) { Index<Graphics::Shader   >(item.stem().string(), item, entry.m_Hash); }
+						else if (entry.m_Type == "Texture"  ) { Index<Graphics::Texture  >(item.stem().string(), item, entry.m_Hash); }
+						else if (entry.m_Type.empty()) {
+							Debug::Log("Unable to determine the type of asset with extension " + item.extension().string(), Warning);
+						}
 					}
-					else {
-						Debug::Log("Unable to determine the type of asset with extension " + item.extension().string(), Warning);
+					catch (const std::exception& e) {
+						Debug::Log(e);
 					}
 				}
 			}
@@ -197,24 +406,26 @@ namespace LouiEriksson::Engine {
 		/**
 		 * @brief Index items which other assets may be dependent on.
 		 *
+		 * @param[in] _manifest Manifest of the "assets/" directory.
+		 *
 		 * @note This function should be called before loading any assets that may have dependencies.
 		 */
-		static void IndexDependencies()  {
+		static void IndexDependencies(const AssetManifest& _manifest)  {
 			
 			/* INCLUDE SHADER DEPENDENCIES */
 			{
 				std::vector<std::filesystem::path> dependencies;
 				
-				for (const auto& item : File::Directory::GetEntriesRecursive("assets/", File::Directory::EntryType::FILE)) {
+				for (const auto& entry : _manifest.Entries()) {
 					
-					if (strcmp(item.extension().string().c_str(), ".inc") == 0) {
-						dependencies.emplace_back(item);
+					if (entry.m_Type == "Dependency") {
+						dependencies.emplace_back(entry.m_Path);
 					}
 				}
 				
 				for (const auto& dependency : dependencies) {
 				
-					Debug::Log("Loading Shader Dependency \"" + dependency.string() + "\"... ", Info, true);
+					FYP_LOG("Loading Shader Dependency \"" + dependency.string() + "\"... ", Info, true);
 					
 					try {
 						const auto name = "/" + dependency.string();
@@ -239,319 +450,570 @@ namespace LouiEriksson::Engine {
 			}
 		}
 		
-		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Audio::AudioClip>& _output) {
+		/**
+		 * @struct Decoded
+		 * @brief An asset which has been read from disk and decoded, but not yet uploaded.
+		 *
+		 * @details Decoding may happen on any thread. Uploading makes OpenGL (or OpenAL) calls, so must happen on the main thread.
+		 */
+		template<typename T>
+		struct Decoded final {
+			
+			/** @brief (Optional) Returns true once the dependencies of the asset are ready to be used. Invoked on the main thread. */
+			std::function<bool()> m_Ready;
+			
+			/** @brief (Optional) Blocks until the dependencies of the asset are ready to be used. Invoked on the main thread. */
+			std::function<void()> m_Await;
+			
+			/** @brief Creates the asset from the decoded data. Invoked on the main thread. Throws if the asset could not be created. */
+			std::function<void(std::shared_ptr<T>&)> m_Upload;
+			
+			/** @brief Approximate size of the decoded data in bytes, which is counted against the upload budget. */
+			size_t m_Bytes = 0U;
+		};
+		
+		/* STREAMING */
+		
+		/**
+		 * @struct Upload
+		 * @brief An asset decoded by a worker thread, which is waiting to be uploaded on the main thread.
+		 */
+		struct Upload final {
 			
-			bool result;
+			/** @brief The asset being uploaded, used only to identify it. */
+			const void* m_Asset;
+			
+			/** @brief (Optional) Returns true once the asset may be uploaded. */
+			std::function<bool()> m_Ready;
+			
+			/** @brief (Optional) Blocks until the asset may be uploaded. */
+			std::function<void()> m_Await;
+			
+			/** @brief Uploads the asset and completes its request. */
+			std::function<void()> m_Task;
+			
+			/** @brief Approximate size of the upload in bytes. */
+			size_t m_Bytes;
+		};
+		
+		inline static std::mutex         s_UploadLock;
+		inline static std::deque<Upload> s_Uploads;
+		
+		/** @brief Number of assets which are loading asynchronously. */
+		inline static size_t s_Pending { 0U };
+		
+		/** @brief Maximum number of bytes uploaded by Update() each frame. At least one asset is uploaded each frame, regardless. */
+		inline static size_t s_UploadBytes { 16777216U };
+		
+		/** @brief Maximum duration of the uploads performed by Update() each frame. At least one asset is uploaded each frame, regardless. */
+		inline static std::chrono::microseconds s_UploadTime { 2000 };
+		
+		/* RESIDENCY */
+		
+		/** @brief Number of calls to Update(), used to determine how recently each asset was retrieved. */
+		inline static uint64_t s_Frame { 0U };
+		
+		/**
+		 * @brief Number of frames for which an asset must go unretrieved before it may be evicted.
+		 * @details Protects assets which are used each frame without being held (e.g. by a std::weak_ptr which is locked when needed).
+		 */
+		inline static uint64_t s_Grace { 120U };
+		
+		/**
+		 * @brief Returns the name of the asset shown by default while an asset of the given type is loading asynchronously.
+		 * @return The name of the placeholder asset, or an empty string if there is none.
+		 */
+		template<typename T>
+		static std::string Placeholder() {
+			
+			std::string result;
 			
-			Debug::Log("Loading AudioClip \"" + _path.string() + "\"...", Info, true);
+			     if constexpr (std::is_same_v<T, Graphics::Material>) { result = "default"; }
+			else if constexpr (std::is_same_v<T, Graphics::Mesh    >) { result = "cube";    }
+			else if constexpr (std::is_same_v<T, Graphics::Texture >) { result = "grey";    }
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Decodes an asset on a worker thread, and queues it to be uploaded on the main thread.
+		 *
+		 * @param[in] _asset The asset, which is not accessed.
+		 * @param[in] _slot The slot of the asset.
+		 * @param[in] _path The path to the asset.
+		 * @param[in] _hash Hash of the contents of the asset, used to validate its cooked form.
+		 */
+		template<typename T>
+		static void Stream(const Asset<T>* _asset, const size_t& _slot, const std::filesystem::path& _path, const uint64_t& _hash) {
+			
+			Upload upload { _asset, {}, {}, {}, 0U };
 			
 			try {
-				_output = std::make_shared<Audio::AudioClip>(_path);
-				Debug::Log("Done.", Info);
 				
-				result = true;
+				if (exists(_path)) {
+					
+					auto decoded = Decode<T>(_path, _hash);
+					
+					upload.m_Ready = std::move(decoded.m_Ready);
+					upload.m_Await = std::move(decoded.m_Await);
+					upload.m_Bytes = decoded.m_Bytes;
+					upload.m_Task  = [_slot, bytes = decoded.m_Bytes, task = std::move(decoded.m_Upload)]() { Complete<T>(_slot, task, bytes); };
+				}
+				else {
+					upload.m_Task = [_slot]() { Complete<T>(_slot, {}, 0U); };
+				}
 			}
 			catch (const std::exception& e) {
-				Debug::Log("Failed.", Error);
-				Debug::Log(e);
 				
-				result = false;
+				// Report the error on the main thread, as the asset is uploaded.
+				upload.m_Task = [_slot, reason = std::string(e.what())]() {
+					Complete<T>(_slot, [&reason](std::shared_ptr<T>&) { throw std::runtime_error(reason); }, 0U);
+				};
 			}
 			
-			return result;
+			const std::lock_guard<std::mutex> lock(s_UploadLock);
+			
+			s_Uploads.emplace_back(std::move(upload));
 		}
 		
-		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Texture>& _output,
-			const Graphics::Texture::Parameters::Format&     _format,
-			const Graphics::Texture::Parameters::FilterMode& _filterMode,
-			const Graphics::Texture::Parameters::WrapMode&   _wrapMode
-		) {
-			
-			bool result = false;
+		/**
+		 * @brief Uploads an asset which was loading asynchronously, and completes its request.
+		 *
+		 * @param[in] _slot The slot of the asset.
+		 * @param[in] _upload Creates the asset from its decoded data, or is empty if the asset is missing.
+		 * @param[in] _bytes Approximate size of the decoded data in bytes.
+		 */
+		template<typename T>
+		static void Complete(const size_t& _slot, const std::function<void(std::shared_ptr<T>&)>& _upload, const size_t& _bytes) {
 			
-			Debug::Log("Loading Texture \"" + _path.string() + "\"... ", Info, true);
+			auto& bucket = GetBucket<T>();
+			auto& item   = bucket.m_Slots[_slot];
 			
-			try {
-				
-				_output.reset(
-					new Graphics::Texture(-1, -1, 0, _format, _filterMode, _wrapMode)
-				);
+			if (_upload) {
 				
-				glGenTextures(1, &_output->m_TextureID);
+				FYP_LOG("Streaming \"" + item.m_Path.string() + "\"... ", Info, true);
 				
-				if (_output->m_TextureID != GL_NONE) {
-					
-					int channels;
-					GLenum texture_format;
-					
-					Graphics::Texture::GetFormatData(_format.PixelFormat(), texture_format, channels);
+				try {
+					_upload(item.m_Item);
 					
-					void* data;
-					GLenum data_format;
+					item.m_Status = Asset<T>::Loaded;
+					item.m_Bytes  = _bytes;
 					
-					if (strcmp(_path.extension().string().c_str(), ".hdr") == 0 ||
-					    strcmp(_path.extension().string().c_str(), ".exr") == 0
-					) {
-						data_format = GL_FLOAT;
-						data = stbi_loadf(
-							_path.string().c_str(),
-							&_output->m_Width,
-							&_output->m_Height,
-							nullptr,
-							channels
-						);
-					}
-					else {
-						data_format = GL_UNSIGNED_BYTE;
-						data = stbi_load(
-							_path.string().c_str(),
-							&_output->m_Width,
-							&_output->m_Height,
-							nullptr,
-							channels
-						);
-					}
+					bucket.m_Resident += item.m_Bytes;
 					
-					if (data != nullptr) {
+					Debug::Log("Done.", Info);
+				}
+				catch (const std::exception& e) {
+					Debug::Log("Failed.", Error);
+					Debug::Log(e);
 					
-						Graphics::Texture::Bind(*_output);
-						
-						glTexImage2D(
-							GL_TEXTURE_2D,
-							0,
-							static_cast<GLint>(_format.PixelFormat()),
-							_output->m_Width,
-							_output->m_Height,
-							0,
-							texture_format,
-							   data_format,
-							   data
-						);
-						
-						stbi_image_free(data);
-						
-						if (_format.Mips()) {
-							glGenerateMipmap(GL_TEXTURE_2D);
-							
-							const auto min = _output->FilterMode().Min();
-							
-							switch (min) {
-								case GL_NEAREST: {
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
-									break;
-								}
-								case GL_LINEAR:  {
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-									break;
-								}
-								case GL_NEAREST_MIPMAP_NEAREST:
-								case GL_NEAREST_MIPMAP_LINEAR:
-								case GL_LINEAR_MIPMAP_NEAREST:
-								case GL_LINEAR_MIPMAP_LINEAR: {
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(min));
-									break;
-								}
-								default: {
-									
-									Debug::Log("Unknown (possibly unsupported) mipmap filtering value \"" + std::to_string(min) + "\". ", Warning, true);
-									
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(min));
-									break;
-								}
-							}
-						}
-						else {
-							glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(_output->FilterMode().Min()));
-						}
-						
-						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(_output->FilterMode().Mag()));
-						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-						
-						// Get maximum possible anisotropy:
-						GLfloat maxAnisotropy;
-						glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
-						
-						// Set texture anisotropy:
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, maxAnisotropy);
-						
-						result = true;
-						
-						Debug::Log("Done.", Info);
-					}
-					else {
-						throw std::runtime_error("Failed loading texture data!");
-					}
+					item.m_Status = Asset<T>::Error;
 				}
 			}
-			catch (const std::exception& e) {
-				Debug::Log("Failed.", Error);
-				Debug::Log(e);
+			else {
+				Debug::Log("Invalid path \"" + item.m_Path.string() + "\"", LogType::Error);
+				
+				item.m_Status = Asset<T>::Missing;
 			}
 			
-			return result;
+			const auto handle = std::move(item.m_Handle);
+			const auto loaded = item.m_Status == Asset<T>::Loaded;
+			
+			item.m_Job.reset();
+			
+			--s_Pending;
+			
+			if (handle.Valid()) {
+				
+				if (loaded) {
+					handle.Fulfil(AssetHandle<T>::Ready, item.m_Item);
+				}
+				else {
+					handle.Fulfil(AssetHandle<T>::Failed, Acquire(item, true));
+				}
+			}
 		}
 		
-		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Mesh>& _output) {
+		/**
+		 * @brief Uploads queued assets, in the order they were decoded, until a budget is exhausted.
+		 *
+		 * @param[in] _bytes The maximum number of bytes to upload.
+		 * @param[in] _time The maximum duration of the uploads.
+		 */
+		static void Drain(const size_t& _bytes, const std::chrono::microseconds& _time) {
 			
-			bool result = false;
+			const auto start = std::chrono::steady_clock::now();
 			
-			Debug::Log("Loading Mesh \"" + _path.string() + "\"... ", Info, true);
+			size_t count;
+			{
+				const std::lock_guard<std::mutex> lock(s_UploadLock);
+				
+				count = s_Uploads.size();
+			}
 			
-			/*
-			 * Implementation derived from Mesh.cpp and Mesh.h
-			 * provided with OBJLoader_v3 project in GACP labs.
-			 *
-			 * I added tangent calculations to the code derived from an implementation by Learn OpenGL:
-	         * de Vries, J. (n.d.). LearnOpenGL - Normal Mapping. [online] learnopengl.com. Available at: https://learnopengl.com/Advanced-Lighting/Normal-Mapping [Accessed 15 Dec. 2023].
-			 */
+			size_t bytes    = 0U;
+			size_t uploaded = 0U;
 			
-			try {
-				
-				Assimp::Importer importer;
-				const auto* const scene = importer.ReadFile(_path,
-						aiProcess_Triangulate | aiProcess_ImproveCacheLocality |
-						aiProcess_RemoveRedundantMaterials | aiProcess_OptimizeMeshes);
-				
-				assert(scene != nullptr &&
-					"No scene!");
-				
-				assert((scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) == 0u &&
-					"Incomplete!");
+			// Assets which are not ready return to the back of the queue, so visit each queued asset at most once.
+			for (size_t i = 0U; i < count; ++i) {
 				
-				assert(scene->mRootNode != nullptr &&
-					"No root node!");
-				
-				assert(scene->HasMeshes() &&
-					"No meshes!");
+				if (uploaded > 0U && (bytes >= _bytes || std::chrono::steady_clock::now() - start >= _time)) {
+					break;
+				}
 				
-				for (size_t i = 0U; i < scene->mNumMeshes; ++i) {
+				Upload upload;
+				{
+					const std::lock_guard<std::mutex> lock(s_UploadLock);
+					
+					if (s_Uploads.empty()) {
+						break;
+					}
 					
-					const auto* const mesh = scene->mMeshes[i];
+					upload = std::move(s_Uploads.front());
+					s_Uploads.pop_front();
+				}
+				
+				if (!upload.m_Ready || upload.m_Ready()) {
 					
-					assert(mesh->HasPositions() && "Mesh has no vertices!");
-					assert(mesh->HasNormals()   && "Mesh has no normals!" );
+					upload.m_Task();
 					
-					/* VERTEX DATA */
+					bytes += upload.m_Bytes;
+					++uploaded;
+				}
+				else {
 					
-					// Get vertices, normals, and texture coordinates:
-					std::vector<vec3> vertices;
-					std::vector<vec3>  normals;
-					std::vector<vec2>      uvs;
+					const std::lock_guard<std::mutex> lock(s_UploadLock);
 					
-					vertices.reserve(mesh->mNumVertices);
-					 normals.reserve(mesh->mNumVertices);
-					     uvs.reserve(mesh->mNumVertices);
+					s_Uploads.emplace_back(std::move(upload));
+				}
+			}
+		}
+		
+		/**
+		 * @brief Blocks until an asset which is loading asynchronously has been uploaded.
+		 * @details Blocks on the job decoding the asset, and then on the assets it depends on (e.g. the Textures of a Material).
+		 * @note Uploads every other decoded asset in the meantime, regardless of the budget.
+		 */
+		template<typename T>
+		static void Await(const Asset<T>& _item) {
+			
+			while (_item.m_Status == Asset<T>::Loading) {
+				
+				// Copy the handle, as the job is released once the asset is uploaded.
+				const auto job = _item.m_Job;
+				
+				Threading::JobSystem::Wait(job);
+				
+				Drain(std::numeric_limits<size_t>::max(), std::chrono::microseconds::max());
+				
+				// An asset which is still loading is waiting for its dependencies, so block on them before uploading it.
+				if (_item.m_Status == Asset<T>::Loading) {
 					
-					for (size_t j = 0U; j < mesh->mNumVertices; ++j) {
+					std::optional<Upload> upload;
+					{
+						const std::lock_guard<std::mutex> lock(s_UploadLock);
 						
-						const auto vert = mesh->mVertices[j];
-						const auto norm = mesh->mNormals [j];
-						const auto   uv = mesh->mTextureCoords[i][j];
+						const auto pending = std::find_if(s_Uploads.begin(), s_Uploads.end(), [&_item](const Upload& _upload) {
+							return _upload.m_Asset == &_item;
+						});
 						
-						vertices.emplace_back(vert.x, vert.y, vert.z);
-						 normals.emplace_back(norm.x, norm.y, norm.z);
-						     uvs.emplace_back(  uv.x,   uv.y        );
+						if (pending != s_Uploads.end()) {
+							upload = std::move(*pending);
+							s_Uploads.erase(pending);
+						}
 					}
 					
-					// Get tangents if they exist:
-					std::array<std::vector<vec3>, 2U> tangents;
-					
-					if (mesh->HasTangentsAndBitangents()) {
+					if (upload.has_value()) {
 						
-						tangents = {
-							std::vector<vec3>(),
-							std::vector<vec3>()
-						};
-						
-						tangents[0U].reserve(vertices.size());
-						tangents[1U].reserve(vertices.size());
+						if (upload->m_Await) {
+							upload->m_Await();
+						}
 						
-						for (size_t j = 0U; j < mesh->mNumVertices; ++j) {
+						if (!upload->m_Ready || upload->m_Ready()) {
+							upload->m_Task();
+						}
+						else {
 							
-							const auto  tan =   mesh->mTangents[j];
-							const auto btan = mesh->mBitangents[j];
+							const std::lock_guard<std::mutex> lock(s_UploadLock);
 							
-							tangents[0U].emplace_back( tan.x,  tan.y,  tan.z);
-							tangents[1U].emplace_back(btan.x, btan.y, btan.z);
+							s_Uploads.emplace_back(std::move(*upload));
 						}
 					}
-					
-					/* INDEX DATA */
-					
-					const auto* const faces = mesh->mFaces;
-					
-					// Determine if the mesh should use 8, 16, or 32-bit indices:
-					if (mesh->mNumVertices > std::numeric_limits<GLushort>::max()) {
-						
-						const size_t limit32 = std::numeric_limits<GLuint>::max();
-						Debug::Assert(
-								mesh->mNumVertices <= limit32, "Vertex count exceeds the 32-bit limit and will be truncated. ",
-								Warning, true
-						);
-						
-						// 32-bit:
-						std::vector<GLuint> indices;
-						indices.reserve(mesh->mNumVertices);
-						
-						for (size_t j = 0U; j < mesh->mNumFaces; ++j) {
-							for (size_t k = 0U; k < faces[j].mNumIndices; ++k) {
-								indices.emplace_back(faces[j].mIndices[k]);
-							}
-						}
-						
-						// If tangents don't exist, then compute them.
-						if (!mesh->HasTangentsAndBitangents()) {
-							tangents = Graphics::Mesh::GenerateTangents(vertices, uvs, indices);
-						}
+				}
+			}
+		}
+		
+		/* DECODING */
+		
+		/**
+		 * @brief Decodes an asset of the given type.
+		 *
+		 * @param[in] _path The path to the asset.
+		 * @param[in] _hash Hash of the contents of the asset. Meshes, Materials and Textures are decoded from their cooked form if it matches.
+		 * @throws std::exception If the asset could not be decoded.
+		 */
+		template<typename T>
+		static Decoded<T> Decode(const std::filesystem::path& _path, const uint64_t& _hash) {
+			
+			Decoded<T> result;
+			
+			     if constexpr (std::is_same_v<T,    Audio::AudioClip>) { result = DecodeAudioClip(_path       ); }
+			else if constexpr (std::is_same_v<T, Graphics::Material >) { result = DecodeMaterial (_path, _hash); }
+			else if constexpr (std::is_same_v<T, Graphics::Mesh     >) { result = DecodeMesh     (_path, _hash); }
+			else if constexpr (std::is_same_v<T, Graphics::Shader   >) { result = DecodeShader   (_path       ); }
+			else if constexpr (std::is_same_v<T, Graphics::Texture  >) {
+				result = DecodeTexture(_path, _hash, { AssetImporter::TextureFormat(_path), true }, { GL_LINEAR, GL_LINEAR }, { GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE });
+			}
+			else {
+				static_assert([]{ return false; }(), "Not implemented!");
+			}
+			
+			return result;
+		}
+		
+		static Decoded<Audio::AudioClip> DecodeAudioClip(const std::filesystem::path& _path) {
+			
+			// std::function requires a copyable target, so share the samples.
+			auto samples = std::make_shared<Audio::AudioClip::Decoded>(Audio::AudioClip::Decode(_path));
+			
+			Decoded<Audio::AudioClip> result;
+			result.m_Bytes  = samples->Length();
+			result.m_Upload = [samples](std::shared_ptr<Audio::AudioClip>& _output) {
+				_output = std::make_shared<Audio::AudioClip>(std::move(*samples));
+			};
+			
+			return result;
+		}
+		
+		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Audio::AudioClip>& _output, size_t& _bytes) {
+			
+			bool result;
+			
+			FYP_LOG("Loading AudioClip \"" + _path.string() + "\"...", Info, true);
+			
+			try {
+				auto decoded = DecodeAudioClip(_path);
+				decoded.m_Upload(_output);
+				
+				_bytes = decoded.m_Bytes;
+				
+				Debug::Log("Done.", Info);
+				
+				result = true;
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Failed.", Error);
+				Debug::Log(e);
+				
+				result = false;
+			}
+			
+			return result;
+		}
+		
+		
+		/**
+		 * @brief Returns true if the current context supports Textures of the given block-compressed internal format.
+		 * @see AssetImporter::CompressedFormat()
+		 */
+		static bool SupportsCompression(const GLenum& _compression) noexcept {
+			
+			bool result;
+			
+			switch (_compression) {
+				case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+				case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT: {
+					result = GLEW_EXT_texture_compression_s3tc != 0U;
+					break;
+				}
+				case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+				case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT: {
+					result = GLEW_EXT_texture_compression_s3tc != 0U && GLEW_EXT_texture_sRGB != 0U;
+					break;
+				}
+				case GL_COMPRESSED_RED_RGTC1:
+				case GL_COMPRESSED_RG_RGTC2: {
+					result = GLEW_VERSION_3_0 != 0U || GLEW_ARB_texture_compression_rgtc != 0U;
+					break;
+				}
+				case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT: {
+					result = GLEW_VERSION_4_2 != 0U || GLEW_ARB_texture_compression_bptc != 0U;
+					break;
+				}
+				default: {
+					result = false;
+				}
+			}
+			
+			return result;
+		}
+		
+		static Decoded<Graphics::Texture> DecodeTexture(const std::filesystem::path& _path, const uint64_t& _hash,
+			const Graphics::Texture::Parameters::Format&     _format,
+			const Graphics::Texture::Parameters::FilterMode& _filterMode,
+			const Graphics::Texture::Parameters::WrapMode&   _wrapMode
+		) {
+			
+			auto cooked = CookedAsset::Load<CookedAsset::TextureData>(_path, _hash);
+			
+			// Decode the source instead if the cooked Texture is compressed in a format the context cannot sample.
+			const auto usable = cooked.has_value() && cooked->m_PixelFormat == _format.PixelFormat() &&
+				(cooked->m_Compression == 0U || SupportsCompression(cooked->m_Compression));
+			
+			// std::function requires a copyable target, so share the pixels.
+			const auto texture = std::make_shared<const CookedAsset::TextureData>(
+				usable ?
+					std::move(*cooked) :
+					AssetImporter::ImportTexture(_path, _format.PixelFormat())
+			);
+			
+			if (texture->m_Levels.empty()) {
+				throw std::runtime_error("Texture has no pixels!");
+			}
+			
+			Decoded<Graphics::Texture> result;
+			result.m_Bytes  = texture->m_Size;
+			result.m_Upload = [texture, _format, _filterMode, _wrapMode](std::shared_ptr<Graphics::Texture>& _output) {
+				
+				const auto& base = texture->m_Levels.front();
+				
+				_output.reset(
+					new Graphics::Texture(static_cast<int>(base.m_Width), static_cast<int>(base.m_Height), 0, _format, _filterMode, _wrapMode)
+				);
+				
+				glGenTextures(1, &_output->m_TextureID);
+				
+				if (_output->m_TextureID == GL_NONE) {
+					throw std::runtime_error("Failed to create texture!");
+				}
+				
+				Graphics::Texture::Bind(*_output);
+				
+				// Rows of the smaller mip levels are not necessarily a multiple of 4 bytes long.
+				GLint alignment;
+				glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+				
+				// Upload the mip levels of a cooked Texture, or just the first level of a source Texture.
+				const auto levels = _format.Mips() ? texture->m_Levels.size() : 1U;
+				
+				for (size_t i = 0U; i < levels; ++i) {
+					
+					const auto& level = texture->m_Levels[i];
+					
+					if (texture->m_Compression != 0U) {
 						
-						_output = Graphics::Mesh::Create(vertices, indices, normals, uvs, tangents, GL_TRIANGLES);
+						glCompressedTexImage2D(
+							GL_TEXTURE_2D,
+							static_cast<GLint>(i),
+							texture->m_Compression,
+							static_cast<GLsizei>(level.m_Width),
+							static_cast<GLsizei>(level.m_Height),
+							0,
+							static_cast<GLsizei>(level.m_Size),
+							texture->m_Pixels + level.m_Offset
+						);
 					}
-					else if (mesh->mNumVertices > std::numeric_limits<GLubyte>::max()) {
-						
-						// 16-bit:
-						std::vector<GLushort> indices;
-						indices.reserve(mesh->mNumVertices);
+					else {
 						
-						for (size_t j = 0U; j < mesh->mNumFaces; ++j) {
-							for (size_t k = 0U; k < faces[j].mNumIndices; ++k) {
-								indices.emplace_back(faces[j].mIndices[k]);
-							}
+						glTexImage2D(
+							GL_TEXTURE_2D,
+							static_cast<GLint>(i),
+							static_cast<GLint>(_format.PixelFormat()),
+							static_cast<GLsizei>(level.m_Width),
+							static_cast<GLsizei>(level.m_Height),
+							0,
+							texture->m_TextureFormat,
+							texture->m_Type,
+							texture->m_Pixels + level.m_Offset
+						);
+					}
+				}
+				
+				glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+				
+				// BC4 stores only the red channel, so replicate it to sample greyscale Textures as they were before compression.
+				if (texture->m_Compression == GL_COMPRESSED_RED_RGTC1) {
+					
+					const std::array<GLint, 4U> swizzle { GL_RED, GL_RED, GL_RED, GL_ONE };
+					
+					glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle.data());
+				}
+				
+				if (_format.Mips()) {
+					
+					if (levels == 1U) {
+						glGenerateMipmap(GL_TEXTURE_2D);
+					}
+					
+					const auto min = _output->FilterMode().Min();
+					
+					switch (min) {
+						case GL_NEAREST: {
+							glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+							break;
 						}
-						
-						// If tangents don't exist, then compute them.
-						if (!mesh->HasTangentsAndBitangents()) {
-							tangents = Graphics::Mesh::GenerateTangents(vertices, uvs, indices);
+						case GL_LINEAR:  {
+							glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+							break;
 						}
-						
-						_output = Graphics::Mesh::Create(vertices, indices, normals, uvs, tangents, GL_TRIANGLES);
-					}
-					else {
-						
-						// 8-bit:
-						std::vector<GLubyte> indices;
-						indices.reserve(mesh->mNumVertices);
-						
-						for (size_t j = 0U; j < mesh->mNumFaces; ++j) {
-							for (size_t k = 0U; k < faces[j].mNumIndices; ++k) {
-								indices.emplace_back(faces[j].mIndices[k]);
-							}
+						case GL_NEAREST_MIPMAP_NEAREST:
+						case GL_NEAREST_MIPMAP_LINEAR:
+						case GL_LINEAR_MIPMAP_NEAREST:
+						case GL_LINEAR_MIPMAP_LINEAR: {
+							glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(min));
+							break;
 						}
-						
-						// If tangents don't exist, then compute them.
-						if (!mesh->HasTangentsAndBitangents()) {
-							tangents = Graphics::Mesh::GenerateTangents(vertices, uvs, indices);
+						default: {
+							
+							Debug::Log("Unknown (possibly unsupported) mipmap filtering value \"" + std::to_string(min) + "\". ", Warning, true);
+							
+							glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(min));
+							break;
 						}
-						
-						_output = Graphics::Mesh::Create(vertices, indices, normals, uvs, tangents, GL_TRIANGLES);
 					}
-					
-					break;
+				}
+				else {
+					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(_output->FilterMode().Min()));
 				}
 				
-				Debug::Log("Done.", Info);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(_output->FilterMode().Mag()));
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+				
+				// Get maximum possible anisotropy:
+				GLfloat maxAnisotropy;
+				glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+				
+				// Set texture anisotropy:
+				glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, maxAnisotropy);
+			};
+			
+			return result;
+		}
+		
+		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Texture>& _output,
+			const Graphics::Texture::Parameters::Format&     _format,
+			const Graphics::Texture::Parameters::FilterMode& _filterMode,
+			const Graphics::Texture::Parameters::WrapMode&   _wrapMode,
+			size_t& _bytes,
+			const uint64_t& _hash = 0U
+		) {
+			
+			bool result = false;
+			
+			FYP_LOG("Loading Texture \"" + _path.string() + "\"... ", Info, true);
+			
+			try {
+				
+				auto decoded = DecodeTexture(_path, _hash, _format, _filterMode, _wrapMode);
+				decoded.m_Upload(_output);
+				
+				_bytes = decoded.m_Bytes;
 				
 				result = true;
+				
+				Debug::Log("Done.", Info);
 			}
 			catch (const std::exception& e) {
 				Debug::Log("Failed.", Error);
@@ -561,231 +1023,176 @@ namespace LouiEriksson::Engine {
 			return result;
 		}
 		
-		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Material>& _output) {
+		/**
+		 * @brief Returns a Decoded Mesh which creates the Mesh from the given vertex data.
+		 * @note The indices are narrowed to the smallest type able to address every vertex.
+		 */
+		template<typename I>
+		static Decoded<Graphics::Mesh> Pack(CookedAsset::MeshData&& _mesh) {
+			
+			std::vector<I> indices;
+			indices.reserve(_mesh.m_Indices.size());
+			
+			for (const auto& index : _mesh.m_Indices) {
+				indices.emplace_back(static_cast<I>(index));
+			}
+			
+			Decoded<Graphics::Mesh> result;
+			result.m_Bytes = _mesh.Size() - (_mesh.m_Indices.size() * (sizeof(uint32_t) - sizeof(I)));
+			
+			result.m_Upload = [
+				mesh    = std::make_shared<CookedAsset::MeshData>(std::move(_mesh)),
+				indices = std::move(indices)
+			](std::shared_ptr<Graphics::Mesh>& _output) {
+				_output = Graphics::Mesh::Create(mesh->m_Vertices, indices, mesh->m_Normals, mesh->m_UVs, mesh->m_Tangents, GL_TRIANGLES);
+			};
+			
+			return result;
+		}
+		
+		static Decoded<Graphics::Mesh> DecodeMesh(const std::filesystem::path& _path, const uint64_t& _hash) {
+			
+			Decoded<Graphics::Mesh> result;
+			
+			auto cooked = CookedAsset::Load<CookedAsset::MeshData>(_path, _hash);
+			
+			auto mesh = cooked.has_value() ? std::move(*cooked) : AssetImporter::ImportMesh(_path);
+			
+			// Determine if the mesh should use 8, 16, or 32-bit indices:
+			     if (mesh.m_Vertices.size() > std::numeric_limits<GLushort>::max()) { result = Pack<GLuint  >(std::move(mesh)); }
+			else if (mesh.m_Vertices.size() > std::numeric_limits<GLubyte >::max()) { result = Pack<GLushort>(std::move(mesh)); }
+			else                                                                    { result = Pack<GLubyte >(std::move(mesh)); }
+			
+			return result;
+		}
+		
+		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Mesh>& _output, size_t& _bytes, const uint64_t& _hash = 0U) {
 			
 			bool result = false;
 			
-			Debug::Log("Loading Material \"" + _path.string() + "\"... ", Info, true);
+			FYP_LOG("Loading Mesh \"" + _path.string() + "\"... ", Info, true);
 			
 			try {
 				
-				/* MATERIAL PARAMETERS */
+				auto decoded = DecodeMesh(_path, _hash);
+				decoded.m_Upload(_output);
+				
+				_bytes = decoded.m_Bytes;
 				
-				std::weak_ptr<Graphics::Shader >               shader;
-				std::weak_ptr<Graphics::Texture>       albedo_texture;
-				std::weak_ptr<Graphics::Texture>           ao_texture;
-				std::weak_ptr<Graphics::Texture> displacement_texture;
-				std::weak_ptr<Graphics::Texture>     emission_texture;
-				std::weak_ptr<Graphics::Texture>     metallic_texture;
-				std::weak_ptr<Graphics::Texture>       normal_texture;
-				std::weak_ptr<Graphics::Texture>    roughness_texture;
+				Debug::Log("Done.", Info);
 				
-				std::optional<vec4>   albedo_color;
-				std::optional<vec3> emission_color;
+				result = true;
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Failed.", Error);
+				Debug::Log(e);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Creates a Material from its definition, loading any of its Textures which are not yet loaded. */
+		static void CreateMaterial(const CookedAsset::MaterialData& _definition, std::shared_ptr<Graphics::Material>& _output) {
+			
+			using MaterialData = CookedAsset::MaterialData;
+			
+			/* MATERIAL PARAMETERS */
+			
+			std::array<std::shared_ptr<Graphics::Texture>, 7U> textures;
+			
+			for (size_t i = 0U; i < textures.size(); ++i) {
 				
-				std::optional<scalar_t> ao;
-				std::optional<scalar_t> displacement;
-				std::optional<scalar_t> normal;
-				std::optional<scalar_t> roughness;
+				auto texture = Resources::Get<Graphics::Texture>(_definition.m_Textures[i]);
 				
-				/* LOAD FILE AND PARSE */
+				if (texture == nullptr) {
+					texture = Resources::Get<Graphics::Texture>(MaterialData::s_Defaults[i]);
+				}
 				
-				std::fstream fs;
-				fs.open(_path, std::ios::in);
+				textures[i] = texture;
+			}
 			
-				if (fs.is_open()) {
+			/* CREATE OBJECT */
 			
-					std::string line;
+			_output.reset(
+				new Graphics::Material(
+				       Resources::Get<Graphics::Shader>("pbr"),
+				       textures[MaterialData::Albedo      ],
+				       textures[MaterialData::AO          ],
+				       textures[MaterialData::Displacement],
+				       textures[MaterialData::Emission    ],
+				       textures[MaterialData::Metallic    ],
+				       textures[MaterialData::Normal      ],
+				       textures[MaterialData::Roughness   ],
+				       _definition.m_AlbedoColor.value_or(vec4(1.0)),
+				       _definition.m_EmissionColor.value_or(vec3(0.0)),
+				       _definition.m_AO.value_or(1.0),
+				       _definition.m_Displacement.value_or(0.3),
+				       _definition.m_Normal.value_or(1.0),
+				       _definition.m_Roughness.value_or(1.0)
+				)
+			);
+		}
+		
+		/** @brief Parses an MTL file, or reads its cooked form if it matches. */
+		static CookedAsset::MaterialData ParseMaterial(const std::filesystem::path& _path, const uint64_t& _hash) {
 			
-					while (std::getline(fs, line)) {
-						
-						auto subStrings = Utils::Split(line, ' ');
-						
-						if (!subStrings.empty()) {
-							
-							const auto& key = subStrings.at(0U);
-							
-							if (key == "Ka") {
-								Debug::Log("Ambient color loading not implemented... ", Warning, true);
-							}
-							else if (key == "Kd") {
-								
-								auto r = Utils::Parse<float>(subStrings.at(1U));
-								auto g = Utils::Parse<float>(subStrings.at(2U));
-								auto b = Utils::Parse<float>(subStrings.at(3U));
-								
-								albedo_color = { r, g, b, 1.0 };
-								
-								if (subStrings.size() > 4U) {
-									albedo_color.value().a = Utils::Parse<float>(subStrings.at(4U));
-								}
-							}
-							else if (key == "d" || key == "Tr") {
-								albedo_color.value().a = static_cast<float>(1.0 - std::clamp(Utils::Parse<double>(subStrings.at(1U)), 0.0, 1.0));
-							}
-							else if (key == "Ks") {
-								Debug::Log("Specular color loading not implemented... ", Warning, true);
-							}
-							else if (key == "illum") {
-								Debug::Log("Support for different lighting models is not implemented... ", Warning, true);
-							}
-							else if (key == "Ao") {
-								ao = Utils::Parse<float>(subStrings.at(1U));
-							}
-							else if (key == "Ns") {
-								roughness = static_cast<float>(1.0 - (std::atan(Utils::Parse<float>(subStrings.at(1U))) / (M_PI / 2.0)));
-							}
-							else if (key == "Ke") {
-								
-								emission_color = {
-										Utils::Parse<float>(subStrings.at(1U)),
-										Utils::Parse<float>(subStrings.at(2U)),
-										Utils::Parse<float>(subStrings.at(3U))
-								};
-							}
-							else if (key == "Ni") {
-								Debug::Log("Optical density loading not implemented... ", Warning, true);
-							}
-							else if (key == "map_Kd") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										albedo_texture = texture;
-									}
-								}
-							}
-							else if (key == "map_Ks") {
-								Debug::Log("Specular map loading not implemented... ", Warning, true);
-							}
-							else if (key == "map_Tr" || key == "map_d") {
-								Debug::Log("Transparency map loading not implemented... ", Warning, true);
-							}
-							else if (key == "bump" || key == "map_bump" || key == "bm") {
-								Debug::Log("Bump map loading not implemented... ", Warning, true);
-							}
-							else if (key == "disp") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										displacement_texture = texture;
-									}
-								}
-							}
-							else if (key == "map_Pr") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										roughness_texture = texture;
-									}
-								}
-							}
-							else if (key == "map_Pm") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										metallic_texture = texture;
-									}
-								}
-							}
-							else if (key == "map_Ke") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										emission_texture = texture;
-									}
-								}
-							}
-							else if (key == "norm") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										normal_texture = texture;
-									}
-								}
-							}
-							else if (key == "map_Ao") {
-								
-								if (subStrings.size() >= 2U) {
-								
-									const std::filesystem::path path(subStrings.at(1U));
-									
-									if (const auto texture = Resources::Get<Graphics::Texture>(path.stem().string())) {
-										ao_texture = texture;
-									}
-								}
-							}
-							else {
-								Debug::Log("Unknown MTL key \"" + std::string(key.data()) + "\" ", Warning, true);
-							}
-						}
-					}
-					
-					fs.close();
-					
-					/* USE DEFAULTS FOR NON-EXISTENT PARAMETERS: */
-					
-					if (              shader.expired()) {               shader = Resources::Get<Graphics::Shader> ("pbr"   ); }
-					if (      albedo_texture.expired()) {       albedo_texture = Resources::Get<Graphics::Texture>("white" ); }
-					if (          ao_texture.expired()) {           ao_texture = Resources::Get<Graphics::Texture>("white" ); }
-					if (displacement_texture.expired()) { displacement_texture = Resources::Get<Graphics::Texture>("black" ); }
-					if (    emission_texture.expired()) {     emission_texture = Resources::Get<Graphics::Texture>("white" ); }
-					if (    metallic_texture.expired()) {     metallic_texture = Resources::Get<Graphics::Texture>("black" ); }
-					if (      normal_texture.expired()) {       normal_texture = Resources::Get<Graphics::Texture>("normal"); }
-					if (   roughness_texture.expired()) {    roughness_texture = Resources::Get<Graphics::Texture>("black" ); }
-					
-					if (  !albedo_color.has_value()) {   albedo_color = vec4(1.0); }
-					if (!emission_color.has_value()) { emission_color = vec3(0.0); }
-					if (            !ao.has_value()) {             ao = 1.0; }
-					if (  !displacement.has_value()) {   displacement = 0.3; }
-					if (        !normal.has_value()) {         normal = 1.0; }
-					if (     !roughness.has_value()) {      roughness = 1.0; }
-					
-					/* CREATE OBJECT */
-					
-					_output.reset(
-						new Graphics::Material(
-						               shader,
-						       albedo_texture,
-						           ao_texture,
-						 displacement_texture,
-						     emission_texture,
-						     metallic_texture,
-						       normal_texture,
-						    roughness_texture,
-						         albedo_color.value(),
-	                           emission_color.value(),
-	                                       ao.value(),
-	                             displacement.value(),
-	                                   normal.value(),
-	                                roughness.value()
-						)
-					);
-					
-					result = true;
-					
-					Debug::Log("Done.", Info);
+			auto cooked = CookedAsset::Load<CookedAsset::MaterialData>(_path, _hash);
+			
+			return cooked.has_value() ? std::move(*cooked) : AssetImporter::ImportMaterial(_path);
+		}
+		
+		static Decoded<Graphics::Material> DecodeMaterial(const std::filesystem::path& _path, const uint64_t& _hash) {
+			
+			const auto definition = std::make_shared<const CookedAsset::MaterialData>(ParseMaterial(_path, _hash));
+			
+			Decoded<Graphics::Material> result;
+			
+			// Stream the Textures of the Material, and wait for them before creating it.
+			result.m_Ready = [definition]() {
+				
+				bool ready = true;
+				
+				for (const auto& texture : definition->m_Textures) {
+					ready &= Resources::Prefetch<Graphics::Texture>(texture).GetStatus() != AssetHandle<Graphics::Texture>::Pending;
 				}
-				else {
-					throw std::runtime_error("Couldn't open filestream.");
+				
+				return ready;
+			};
+			
+			result.m_Await = [definition]() {
+				
+				for (const auto& texture : definition->m_Textures) {
+					
+					if (const auto* const item = Find(AssetRef<Graphics::Texture> { AssetId(texture) }); item != nullptr && item->m_Status == Asset<Graphics::Texture>::Loading) {
+						Await(*item);
+					}
 				}
+			};
+			
+			result.m_Bytes  = sizeof(Graphics::Material);
+			result.m_Upload = [definition](std::shared_ptr<Graphics::Material>& _output) {
+				CreateMaterial(*definition, _output);
+			};
+			
+			return result;
+		}
+		
+		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Material>& _output, size_t& _bytes, const uint64_t& _hash = 0U) {
+			
+			bool result = false;
+			
+			FYP_LOG("Loading Material \"" + _path.string() + "\"... ", Info, true);
+			
+			try {
+				
+				CreateMaterial(ParseMaterial(_path, _hash), _output);
+				
+				// The Textures of a Material are accounted for separately, so count only the Material itself.
+				_bytes = sizeof(Graphics::Material);
+				
+				result = true;
+				
+				Debug::Log("Done.", Info);
 			}
 			catch (const std::exception& e) {
 				Debug::Log("Failed.", Error);
@@ -795,10 +1202,63 @@ namespace LouiEriksson::Engine {
 			return result;
 		}
 		
+		/**
+		 * @brief Loads the cooked forms of the faces of a Cubemap, which are indexed (and cooked) as Textures.
+		 *
+		 * @details The faces of a Cubemap must share a format, so the cooked faces are only used if every face is square, and
+		 *          block-compressed in the same format and at the same size, which the context can sample.
+		 *
+		 * @param[in] _paths The paths to the faces.
+		 * @return The cooked faces, or std::nullopt if the faces must be decoded from source.
+		 */
+		static std::optional<std::array<CookedAsset::TextureData, 6U>> CookedFaces(const std::array<std::filesystem::path, 6U>& _paths) {
+			
+			std::optional<std::array<CookedAsset::TextureData, 6U>> result;
+			
+			std::array<CookedAsset::TextureData, 6U> faces;
+			
+			bool usable = true;
+			
+			for (size_t i = 0U; i < _paths.size() && usable; ++i) {
+				
+				std::error_code error;
+				
+				const auto* const item = Find(AssetRef<Graphics::Texture> { AssetId(_paths[i].stem().string()) });
+				
+				usable = item != nullptr && std::filesystem::equivalent(item->m_Path, _paths[i], error);
+				
+				if (usable) {
+					
+					auto cooked = CookedAsset::Load<CookedAsset::TextureData>(_paths[i], item->m_Hash);
+					
+					usable = cooked.has_value() && cooked->m_Compression != 0U && SupportsCompression(cooked->m_Compression) &&
+						cooked->m_Levels.front().m_Width == cooked->m_Levels.front().m_Height;
+					
+					if (usable && i > 0U) {
+						
+						usable = cooked->m_Compression            == faces[0U].m_Compression            &&
+						         cooked->m_Levels.size()          == faces[0U].m_Levels.size()          &&
+						         cooked->m_Levels.front().m_Width == faces[0U].m_Levels.front().m_Width;
+					}
+					
+					if (usable) {
+						faces[i] = std::move(*cooked);
+					}
+				}
+			}
+			
+			if (usable) {
+				result = std::move(faces);
+			}
+			
+			return result;
+		}
+		
 		static bool TryLoad(const std::array<std::filesystem::path, 6U>& _paths, std::shared_ptr<Graphics::Cubemap>& _output,
 				const Graphics::Texture::Parameters::Format&     _format,
 				const Graphics::Texture::Parameters::FilterMode& _filterMode,
-				const Graphics::Texture::Parameters::WrapMode&   _wrapMode
+				const Graphics::Texture::Parameters::WrapMode&   _wrapMode,
+				size_t& _bytes
 			) {
 			
 			bool result = false;
@@ -807,6 +1267,8 @@ namespace LouiEriksson::Engine {
 			
 			try {
 				
+				size_t bytes = 0U;
+				
 				_output.reset(
 					new Graphics::Cubemap(-1, -1, 0, _format, _filterMode, _wrapMode)
 				);
@@ -819,74 +1281,123 @@ namespace LouiEriksson::Engine {
 					
 					int cubemap_resolution = -1;
 					
+					// Upload the cooked faces if they can be used, or decode the source faces otherwise.
+					const auto cooked = CookedFaces(_paths);
+					
+					// Number of mip levels uploaded per face.
+					size_t levels = 1U;
+					
 					Graphics::Cubemap::Bind(*_output);
 					
 					for (size_t i = 0U; i < _paths.size(); ++i) {
 						
-						ivec2 loaded_resolution { -1, -1 };
-						
-						int channels;
-						GLenum texture_format;
-						
-						Graphics::Texture::GetFormatData(_format.PixelFormat(), texture_format, channels);
-						
-						void* data;
-						GLenum data_format;
-				
-						if (strcmp(_paths[i].extension().string().c_str(), ".hdr") == 0 ||
-						    strcmp(_paths[i].extension().string().c_str(), ".exr") == 0
-						) {
-							data_format = GL_FLOAT;
-							data = stbi_loadf(
-								_paths[i].string().c_str(),
-								&loaded_resolution.x,
-								&loaded_resolution.y,
-								nullptr,
-								_output->Format().Channels()
-							);
+						if (cooked.has_value()) {
+							
+							const auto& face = (*cooked)[i];
+							
+							levels = _format.Mips() ? face.m_Levels.size() : 1U;
+							
+							for (size_t j = 0U; j < levels; ++j) {
+								
+								const auto& level = face.m_Levels[j];
+								
+								glCompressedTexImage2D(
+									GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
+									static_cast<GLint>(j),
+									face.m_Compression,
+									static_cast<GLsizei>(level.m_Width),
+									static_cast<GLsizei>(level.m_Height),
+									0,
+									static_cast<GLsizei>(level.m_Size),
+									face.m_Pixels + level.m_Offset
+								);
+								
+								bytes += static_cast<size_t>(level.m_Size);
+							}
+							
+							cubemap_resolution = std::max(static_cast<int>(face.m_Levels.front().m_Width), cubemap_resolution);
 						}
 						else {
-							data_format = GL_UNSIGNED_BYTE;
-							data = stbi_load(
-								_paths[i].string().c_str(),
-								&loaded_resolution.x,
-								&loaded_resolution.y,
-								nullptr,
-								_output->Format().Channels()
-							);
-						}
-						
-						cubemap_resolution = std::max(
-							std::max(
-								loaded_resolution.x,
-								loaded_resolution.y
-							),
-							cubemap_resolution
-						);
-						
-						if (data != nullptr) {
 							
-							glTexImage2D(
-								GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
-								0,
-								static_cast<GLint>(_output->Format().PixelFormat()),
-								loaded_resolution.x,
-								loaded_resolution.y,
-								0,
-								_output->Format().TextureFormat(),
-								data_format,
-								data
+							ivec2 loaded_resolution { -1, -1 };
+							
+							int channels;
+							GLenum texture_format;
+							
+							Graphics::Texture::GetFormatData(_format.PixelFormat(), texture_format, channels);
+							
+							void* data;
+							GLenum data_format;
+							
+							if (strcmp(_paths[i].extension().string().c_str(), ".hdr") == 0 ||
+							    strcmp(_paths[i].extension().string().c_str(), ".exr") == 0
+							) {
+								data_format = GL_FLOAT;
+								data = stbi_loadf(
+									_paths[i].string().c_str(),
+									&loaded_resolution.x,
+									&loaded_resolution.y,
+									nullptr,
+									_output->Format().Channels()
+								);
+							}
+							else {
+								data_format = GL_UNSIGNED_BYTE;
+								data = stbi_load(
+									_paths[i].string().c_str(),
+									&loaded_resolution.x,
+									&loaded_resolution.y,
+									nullptr,
+									_output->Format().Channels()
+								);
+							}
+							
+							cubemap_resolution = std::max(
+								std::max(
+									loaded_resolution.x,
+									loaded_resolution.y
+								),
+								cubemap_resolution
 							);
 							
-							stbi_image_free(data);
-						}
-						else {
-							throw std::runtime_error("Failed to load texture at path \"" + _paths[i].string() + "\".");
+							if (data != nullptr) {
+								
+								glTexImage2D(
+									GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
+									0,
+									static_cast<GLint>(_output->Format().PixelFormat()),
+									loaded_resolution.x,
+									loaded_resolution.y,
+									0,
+									_output->Format().TextureFormat(),
+									data_format,
+									data
+								);
+								
+								stbi_image_free(data);
+								
+								bytes += static_cast<size_t>(loaded_resolution.x) * static_cast<size_t>(loaded_resolution.y) *
+									static_cast<size_t>(_output->Format().Channels()) * (data_format == GL_FLOAT ? sizeof(GLfloat) : sizeof(GLubyte));
+							}
+							else {
+								throw std::runtime_error("Failed to load texture at path \"" + _paths[i].string() + "\".");
+							}
 						}
 					}
 					
+					// BC4 stores only the red channel, so replicate it to sample greyscale faces as they were before compression.
+					if (cooked.has_value() && cooked->front().m_Compression == GL_COMPRESSED_RED_RGTC1) {
+						
+						const std::array<GLint, 4U> swizzle { GL_RED, GL_RED, GL_RED, GL_ONE };
+						
+						glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzle.data());
+					}
+					
 					if (_format.Mips()) {
-						glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+						
+						if (levels == 1U) {
+							glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+						}
 						
 						const auto min = _output->FilterMode().Min();
 						
@@ -920,58 +1431,268 @@ namespace LouiEriksson::Engine {
 					glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T,     static_cast<GLint>(_output->WrapMode().WrapT()));
 					glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R,     static_cast<GLint>(_output->WrapMode().WrapR()));
 					
-					glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+					glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+					
+					_output->m_Width  = cubemap_resolution;
+					_output->m_Height = cubemap_resolution;
+				}
+				
+				_bytes = bytes;
+				
+				result = true;
+				
+				Debug::Log("Done.", Info);
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Failed.", Error);
+				Debug::Log(e);
+			}
+			
+			return result;
+		}
+		
+		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Shader>& _output) {
+	
+			bool result = false;
+			
+			try {
+				_output.reset(new Graphics::Shader(_path), [](Graphics::Shader* _ptr) { delete _ptr; });
+	
+				result = true;
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Shaders are read and compiled in one step, so decoding a Shader defers all of its work to the main thread. */
+		static Decoded<Graphics::Shader> DecodeShader(const std::filesystem::path& _path) {
+			
+			Decoded<Graphics::Shader> result;
+			result.m_Upload = [_path](std::shared_ptr<Graphics::Shader>& _output) {
+				
+				if (!TryLoad(_path, _output)) {
+					throw std::runtime_error("Error loading resource!");
+				}
+			};
+			
+			return result;
+		}
+		
+		static bool TryLoad(const std::vector<Graphics::SubShader>& _subshaders, std::shared_ptr<Graphics::Shader>& _output) {
+			
+			bool result = false;
+			
+			try {
+				_output.reset(new Graphics::Shader(_subshaders), [](Graphics::Shader* _ptr) { delete _ptr; });
+	
+				result = true;
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Loads an asset synchronously, and accounts for its size if it loads. */
+		template<typename T>
+		static void Load(Asset<T>& _item) {
+			
+			_item.Load();
+			
+			if (_item.m_Status == Asset<T>::Loaded) {
+				GetBucket<T>().m_Resident += _item.m_Bytes;
+			}
+		}
+		
+		/**
+		 * @brief Returns an asset, loading it first if it is not already loaded.
+		 *
+		 * @param[in,out] _item The asset.
+		 * @param[in] _fallback Whether to fallback to the "missing" or "error" asset if the asset is missing or in an error state.
+		 * @return The asset, its fallback, or nullptr.
+		 */
+		template<typename T>
+		static std::shared_ptr<T> Acquire(Asset<T>& _item, const bool& _fallback) {
+			
+			static const AssetRef<T> s_Missing = "missing"_asset;
+			static const AssetRef<T> s_Error   =   "error"_asset;
+			
+			std::shared_ptr<T> result;
+			
+			_item.m_Used = s_Frame;
+			
+			switch (_item.m_Status) {
+				case Asset<T>::Unloaded: {
+					Load(_item);
+					result = _item.m_Item;
+					
+					break;
+				}
+				case Asset<T>::Loading: {
+					
+					// Finish loading the asset on this thread.
+					Await(_item);
+					
+					result = Acquire(_item, _fallback);
+					
+					break;
+				}
+				case Asset<T>::Loaded: {
+					result = _item.m_Item;
+					
+					break;
+				}
+				case Asset<T>::Missing: {
+					
+					if (_fallback && _item.m_Id != s_Missing.Id()) {
+						result = Resources::Get<T>(s_Missing);
+					}
+					
+					break;
+				}
+				case Asset<T>::Error: {
+					
+					if (_fallback && _item.m_Id != s_Error.Id()) {
+						result = Resources::Get<T>(s_Error);
+					}
 					
-					_output->m_Width  = cubemap_resolution;
-					_output->m_Height = cubemap_resolution;
+					break;
+				}
+				default: {
+					throw std::runtime_error("Not implemented!");
 				}
-				
-				result = true;
-				
-				Debug::Log("Done.", Info);
-			}
-			catch (const std::exception& e) {
-				Debug::Log("Failed.", Error);
-				Debug::Log(e);
 			}
 			
 			return result;
 		}
 		
-		static bool TryLoad(const std::filesystem::path& _path, std::shared_ptr<Graphics::Shader>& _output) {
-	
-			bool result = false;
+		/**
+		 * @brief Begins loading an asset asynchronously, if it is not already loaded.
+		 *
+		 * @param[in,out] _item The asset.
+		 * @param[in] _slot The slot of the asset.
+		 * @param[in] _placeholder The name of the asset referred to by the handle while the asset is loading, or an empty string for none.
+		 * @return A handle to the asset.
+		 */
+		template<typename T>
+		static AssetHandle<T> Request(Asset<T>& _item, const size_t& _slot, const std::string& _placeholder) {
 			
-			try {
-				_output.reset(new Graphics::Shader(_path), [](Graphics::Shader* _ptr) { delete _ptr; });
-	
-				result = true;
-			}
-			catch (const std::exception& e) {
-				Debug::Log(e);
+			AssetHandle<T> result;
+			
+			_item.m_Used = s_Frame;
+			
+			switch (_item.m_Status) {
+				case Asset<T>::Unloaded: {
+					
+					_item.m_Status = Asset<T>::Loading;
+					_item.m_Handle = AssetHandle<T>(
+						AssetHandle<T>::Pending,
+						_placeholder.empty() || _placeholder == _item.m_Name ? nullptr : Resources::Get<T>(_placeholder)
+					);
+					
+					_item.m_Job = Threading::JobSystem::Schedule(
+						[asset = &_item, _slot, path = _item.m_Path, hash = _item.m_Hash]() { Stream<T>(asset, _slot, path, hash); },
+						Threading::JobSystem::Streaming
+					);
+					
+					++s_Pending;
+					
+					result = _item.m_Handle;
+					
+					break;
+				}
+				case Asset<T>::Loading: {
+					result = _item.m_Handle;
+					
+					break;
+				}
+				case Asset<T>::Loaded: {
+					result = AssetHandle<T>(AssetHandle<T>::Ready, _item.m_Item);
+					
+					break;
+				}
+				case Asset<T>::Missing:
+				case Asset<T>::Error: {
+					result = AssetHandle<T>(AssetHandle<T>::Failed, Acquire(_item, true));
+					
+					break;
+				}
+				default: {
+					throw std::runtime_error("Not implemented!");
+				}
 			}
 			
 			return result;
 		}
 		
-		static bool TryLoad(const std::vector<Graphics::SubShader>& _subshaders, std::shared_ptr<Graphics::Shader>& _output) {
+		/**
+		 * @brief Unloads the least recently used assets of a type until its bucket is within budget.
+		 *
+		 * @details Only assets which are not referenced outside of Resources (i.e. whose std::shared_ptr is unique), and which have not been
+		 *          retrieved for s_Grace frames, are evicted. Evicted assets return to Unloaded, and are loaded again when next retrieved.
+		 */
+		template<typename T>
+		static void Evict() {
 			
-			bool result = false;
+			auto& bucket = GetBucket<T>();
 			
-			try {
-				_output.reset(new Graphics::Shader(_subshaders), [](Graphics::Shader* _ptr) { delete _ptr; });
-	
-				result = true;
-			}
-			catch (const std::exception& e) {
-				Debug::Log(e);
+			if (bucket.m_Resident > bucket.m_Budget) {
+				
+				std::vector<Asset<T>*> candidates;
+				
+				for (auto& item : bucket.m_Slots) {
+					
+					if (item.m_Status == Asset<T>::Loaded && item.m_Item.use_count() == 1 && s_Frame - item.m_Used >= s_Grace) {
+						candidates.emplace_back(&item);
+					}
+				}
+				
+				std::sort(candidates.begin(), candidates.end(), [](const Asset<T>* _a, const Asset<T>* _b) {
+					return _a->m_Used < _b->m_Used;
+				});
+				
+				for (auto* const item : candidates) {
+					
+					if (bucket.m_Resident <= bucket.m_Budget) {
+						break;
+					}
+					
+					FYP_LOG("Evicting \"" + item->m_Path.string() + "\" (" + std::to_string(item->m_Bytes) + " bytes).", LogType::Debug);
+					
+					bucket.m_Resident     -= item->m_Bytes;
+					bucket.m_EvictedBytes += item->m_Bytes;
+					++bucket.m_Evictions;
+					
+					item->m_Item.reset();
+					item->m_Status = Asset<T>::Unloaded;
+					item->m_Bytes  = 0U;
+				}
 			}
-			
-			return result;
 		}
 		
 	public:
 	
+		/**
+		 * @struct Residency
+		 * @brief Statistics of the residency of the assets of a single type.
+		 * @see GetResidency()
+		 */
+		struct Residency final {
+			
+			size_t m_Loaded;     /**< @brief Number of loaded assets.                                  */
+			size_t m_Referenced; /**< @brief Number of loaded assets referenced outside of Resources. */
+			
+			size_t m_Resident; /**< @brief Approximate size of the loaded assets, in bytes.              */
+			size_t m_Budget;   /**< @brief Size above which unreferenced assets are evicted, in bytes. */
+			
+			size_t m_Evictions;    /**< @brief Number of assets evicted.                    */
+			size_t m_EvictedBytes; /**< @brief Total size of the assets evicted, in bytes. */
+		};
+	
 		/**
 		 * @brief Loads a specified asset if not already loaded.
 		 *
@@ -989,10 +1710,14 @@ namespace LouiEriksson::Engine {
 			
 			try {
 				
-				auto& item = GetBucket<T>().Return(_name);
-				
-				if (item.m_Status == Asset<T>::Unloaded) {
-					item.Load();
+				if (auto* const item = Find(AssetRef<T>(AssetId(_name)))) {
+					
+					if (item->m_Status == Asset<T>::Unloaded) {
+						Load(*item);
+					}
+				}
+				else {
+					throw std::runtime_error("No asset is named \"" + _name + "\"!");
 				}
 			}
 			catch (const std::exception& e) {
@@ -1015,6 +1740,7 @@ namespace LouiEriksson::Engine {
 		 * @return std::weak_ptr<T> A weak pointer to the requested asset.
 		 *
 		 * @note This function logs an error message if there is an exception while accessing the resource.
+		 * @note The name is hashed on every call. Prefer the overload accepting an AssetRef on hot paths.
 		 */
 		template<typename T>
 		static std::shared_ptr<T> Get(const std::string& _name, const bool& _fallback = true) noexcept {
@@ -1023,39 +1749,89 @@ namespace LouiEriksson::Engine {
 			
 			try {
 				
-				auto& item = const_cast<Asset<T>&>(GetBucket<T>()[_name]);
+				if (auto* const item = Find(AssetRef<T>(AssetId(_name)))) {
+					result = Acquire(*item, _fallback);
+				}
+				else {
+					throw std::runtime_error("No asset is named \"" + _name + "\"!");
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Error accessing resource \"" + _name + "\". Reason : " + std::string(e.what()), Error);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Retrieves the asset referred to by an AssetRef.
+		 *
+		 * Behaves as Get(const std::string&, const bool&), but once the reference has been resolved the asset is retrieved by indexing
+		 * an array, without hashing its name or locking. References may be constructed from identifiers, e.g:
+		 * @code
+		 * static const AssetRef<Graphics::Material> side = "side"_asset;
+		 *
+		 * renderer->SetMaterial(Resources::Get(side));
+		 * @endcode
+		 *
+		 * @tparam T The type of asset to retrieve.
+		 * @param[in] _ref A reference to the asset to retrieve, which caches its slot.
+		 * @param[in] _fallback Whether to fallback to the "missing" or "error" asset if the requested asset is missing or in an error state.
+		 * @return A pointer to the requested asset.
+		 *
+		 * @note Cubemaps are only retrievable by name until they have been loaded once.
+		 * @see AssetRef
+		 */
+		template<typename T>
+		static std::shared_ptr<T> Get(const AssetRef<T>& _ref, const bool& _fallback = true) noexcept {
+			
+			std::shared_ptr<T> result;
+			
+			try {
 				
-				switch (item.m_Status) {
-					case Asset<T>::Unloaded: {
-						item.Load();
-						result = item.m_Item;
-						
-						break;
-					}
-					case Asset<T>::Loaded: {
-						result = item.m_Item;
-						
-						break;
-					}
-					case Asset<T>::Missing: {
-						
-						if (_fallback && _name != "missing") {
-							result = Resources::Get<T>("missing");
-						}
-						
-						break;
-					}
-					case Asset<T>::Error: {
-						
-						if (_fallback && _name != "error") {
-							result = Resources::Get<T>("error");
-						}
-						
-						break;
-					}
-					default: {
-						throw std::runtime_error("Not implemented!");
-					}
+				if (auto* const item = Find(_ref)) {
+					result = Acquire(*item, _fallback);
+				}
+				else {
+					throw std::runtime_error("No asset has the identifier " + std::to_string(_ref.Id().Value()) + "!");
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Error accessing resource #" + std::to_string(_ref.Id().Value()) + ". Reason : " + std::string(e.what()), Error);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Retrieves the asset with the specified name without blocking, loading it asynchronously if it is not already loaded.
+		 *
+		 * The asset is read and decoded (e.g. by stb_image, Assimp, or SDL) on a worker thread, and then uploaded on the main thread by Update().
+		 * Until then, the returned handle refers to a placeholder asset. If the asset is missing or fails to load, the handle refers to the
+		 * "missing" or "error" asset respectively.
+		 *
+		 * @tparam T The type of asset to retrieve. Cubemaps are not supported.
+		 * @param[in] _name The name of the asset to retrieve.
+		 * @param[in] _placeholder The name of the asset referred to by the handle while the asset is loading, or an empty string for none.
+		 * @return A handle to the asset, which is invalid if no asset has the specified name.
+		 *
+		 * @note Must be called on the main thread. Shaders are compiled entirely on the main thread.
+		 * @see Update()
+		 */
+		template<typename T>
+		static AssetHandle<T> GetAsync(const std::string& _name, const std::string& _placeholder = Placeholder<T>()) noexcept {
+			
+			AssetHandle<T> result;
+			
+			try {
+				
+				const AssetRef<T> ref { AssetId(_name) };
+				
+				if (auto* const item = Find(ref)) {
+					result = Request(*item, ref.m_Slot, _placeholder);
+				}
+				else {
+					throw std::runtime_error("No asset is named \"" + _name + "\"!");
 				}
 			}
 			catch (const std::exception& e) {
@@ -1064,6 +1840,130 @@ namespace LouiEriksson::Engine {
 			
 			return result;
 		}
+		
+		/**
+		 * @brief Retrieves the asset referred to by an AssetRef without blocking, loading it asynchronously if it is not already loaded.
+		 *
+		 * @tparam T The type of asset to retrieve. Cubemaps are not supported.
+		 * @param[in] _ref A reference to the asset to retrieve, which caches its slot.
+		 * @param[in] _placeholder The name of the asset referred to by the handle while the asset is loading, or an empty string for none.
+		 * @return A handle to the asset, which is invalid if no asset has the identifier of the reference.
+		 *
+		 * @see GetAsync(const std::string&, const std::string&)
+		 */
+		template<typename T>
+		static AssetHandle<T> GetAsync(const AssetRef<T>& _ref, const std::string& _placeholder = Placeholder<T>()) noexcept {
+			
+			AssetHandle<T> result;
+			
+			try {
+				
+				if (auto* const item = Find(_ref)) {
+					result = Request(*item, _ref.m_Slot, _placeholder);
+				}
+				else {
+					throw std::runtime_error("No asset has the identifier " + std::to_string(_ref.Id().Value()) + "!");
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log("Error accessing resource #" + std::to_string(_ref.Id().Value()) + ". Reason : " + std::string(e.what()), Error);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Begins loading the asset with the specified name asynchronously, if it is not already loaded.
+		 *
+		 * @tparam T The type of asset to load.
+		 * @param[in] _name The name of the asset to load.
+		 * @return A handle to the asset, without a placeholder.
+		 *
+		 * @see GetAsync()
+		 */
+		template<typename T>
+		static AssetHandle<T> Prefetch(const std::string& _name) noexcept {
+			return GetAsync<T>(_name, {});
+		}
+		
+		/**
+		 * @brief Uploads assets which have finished decoding on worker threads, within the per-frame upload budget, and then evicts
+		 *        unreferenced assets of each type whose residency exceeds its budget.
+		 *
+		 * @note Must be called on the main thread, once per frame.
+		 * @see ResidencyBudget()
+		 */
+		static void Update() {
+			
+			++s_Frame;
+			
+			Drain(s_UploadBytes, s_UploadTime);
+			
+			Evict<   Audio::AudioClip>();
+			Evict<Graphics::Material >();
+			Evict<Graphics::Mesh     >();
+			Evict<Graphics::Shader   >();
+			Evict<Graphics::Texture  >();
+			Evict<Graphics::Cubemap  >();
+		}
+		
+		/**
+		 * @brief Sets the per-frame upload budget.
+		 *
+		 * @param[in] _bytes The maximum number of bytes to upload each frame.
+		 * @param[in] _time The maximum time to spend uploading each frame.
+		 *
+		 * @note At least one asset is uploaded each frame, even if it exceeds the budget.
+		 */
+		static void UploadBudget(const size_t& _bytes, const std::chrono::microseconds& _time) noexcept {
+			s_UploadBytes = _bytes;
+			s_UploadTime  = _time;
+		}
+		
+		/** @brief Returns the number of assets which are loading asynchronously. */
+		[[nodiscard]] static size_t Pending() noexcept {
+			return s_Pending;
+		}
+		
+		/**
+		 * @brief Sets the number of bytes of the assets of a type which may remain resident before unreferenced assets are evicted.
+		 *
+		 * @tparam T The type of asset.
+		 * @param[in] _bytes The budget, in bytes.
+		 *
+		 * @note Referenced assets are never evicted, so the budget may be exceeded.
+		 * @see Update()
+		 */
+		template<typename T>
+		static void ResidencyBudget(const size_t& _bytes) noexcept {
+			GetBucket<T>().m_Budget = _bytes;
+		}
+		
+		/**
+		 * @brief Returns statistics of the residency of the assets of a type.
+		 * @tparam T The type of asset.
+		 */
+		template<typename T>
+		[[nodiscard]] static Residency GetResidency() noexcept {
+			
+			const auto& bucket = GetBucket<T>();
+			
+			Residency result { 0U, 0U, bucket.m_Resident, bucket.m_Budget, bucket.m_Evictions, bucket.m_EvictedBytes };
+			
+			for (const auto& item : bucket.m_Slots) {
+				
+				if (item.m_Status == Asset<T>::Loaded) {
+					
+					++result.m_Loaded;
+					
+					if (item.m_Item.use_count() > 1) {
+						++result.m_Referenced;
+					}
+				}
+			}
+			
+			return result;
+		}
 	};
 	
 	template<>
@@ -1073,7 +1973,7 @@ namespace LouiEriksson::Engine {
 			
 			if (exists(m_Path)) {
 				
-				if (Resources::TryLoad(m_Path, m_Item)) {
+				if (Resources::TryLoad(m_Path, m_Item, m_Bytes)) {
 					m_Status = Loaded;
 				}
 				else {
@@ -1099,7 +1999,7 @@ namespace LouiEriksson::Engine {
 			
 			if (exists(m_Path)) {
 				
-				if (Resources::TryLoad(m_Path, m_Item)) {
+				if (Resources::TryLoad(m_Path, m_Item, m_Bytes, m_Hash)) {
 					m_Status = Loaded;
 				}
 				else {
@@ -1125,7 +2025,7 @@ namespace LouiEriksson::Engine {
 			
 			if (exists(m_Path)) {
 				
-				if (Resources::TryLoad(m_Path, m_Item)) {
+				if (Resources::TryLoad(m_Path, m_Item, m_Bytes, m_Hash)) {
 					m_Status = Loaded;
 				}
 				else {
@@ -1151,21 +2051,7 @@ namespace LouiEriksson::Engine {
 			
 			if (exists(m_Path)) {
 				
-				GLenum format = GL_SRGB;
-				
-				if (m_Path.has_extension()) {
-				
-					     if (m_Path.extension() == ".hdr") { format = GL_RGBA32F; }
-					else if (m_Path.extension() == ".exr") { format = GL_RGBA32F; }
-					else if (m_Path.has_parent_path()) {
-						
-						if (m_Path.parent_path().string().find("linear") != 0U) {
-							format = GL_RGBA32F;
-						}
-					}
-				}
-				
-				if (Resources::TryLoad(m_Path, m_Item, { format, true }, { GL_LINEAR, GL_LINEAR }, { GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE })) {
+				if (Resources::TryLoad(m_Path, m_Item, { AssetImporter::TextureFormat(m_Path), true }, { GL_LINEAR, GL_LINEAR }, { GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE }, m_Bytes, m_Hash)) {
 					m_Status = Loaded;
 				}
 				else {
@@ -1213,7 +2099,7 @@ namespace LouiEriksson::Engine {
 						}
 					}
 					
-					if (Resources::TryLoad(faces, m_Item, { GL_RGB32F, true }, { GL_LINEAR, GL_LINEAR }, { GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE })) {
+					if (Resources::TryLoad(faces, m_Item, { GL_RGB32F, true }, { GL_LINEAR, GL_LINEAR }, { GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE }, m_Bytes)) {
 						m_Status = Loaded;
 					}
 					else {
@@ -1267,42 +2153,14 @@ namespace LouiEriksson::Engine {
 		
 		try {
 			
-			auto item = Resources::GetBucket<Graphics::Cubemap>().Get(_name).value_or({ _name });
+			auto* item = Find(AssetRef<Graphics::Cubemap>(AssetId(_name)));
 			
-			switch (item.m_Status) {
-				case Asset<Graphics::Cubemap>::Status::Unloaded: {
-					item.Load();
-					result = item.m_Item;
-					
-					break;
-				}
-				case Asset<Graphics::Cubemap>::Loaded: {
-					result = item.m_Item;
-					
-					break;
-				}
-				case Asset<Graphics::Cubemap>::Missing: {
-					
-					if (_fallback && _name != "missing") {
-						result = Resources::Get<Graphics::Cubemap>("missing");
-					}
-					
-					break;
-				}
-				case Asset<Graphics::Cubemap>::Error: {
-					
-					if (_fallback && _name != "error") {
-						result = Resources::Get<Graphics::Cubemap>("error");
-					}
-					
-					break;
-				}
-				default: {
-					throw std::runtime_error("Not implemented!");
-				}
+			// Cubemaps are not indexed, so are added to their bucket when first requested, using their name as their path.
+			if (item == nullptr) {
+				item = &GetBucket<Graphics::Cubemap>().m_Slots[Index<Graphics::Cubemap>(_name, _name)];
 			}
 			
-			Resources::GetBucket<Graphics::Cubemap>().Assign(_name, item);
+			result = Acquire(*item, _fallback);
 		}
 		catch (const std::exception& e) {
 			Debug::Log("Error accessing resource \"" + _name + "\". Reason : " + std::string(e.what()), Error);
@@ -1,6 +1,7 @@
 #ifndef FINALYEARPROJECT_SCRIPT_HPP
 #define FINALYEARPROJECT_SCRIPT_HPP
 
+#include "../ecs/Access.hpp"
 #include "../ecs/Component.hpp"
 
 #include <memory>
@@ -9,6 +10,7 @@ namespace LouiEriksson::Engine::ECS {
 	
 	class GameObject;
 	class Scene;
+	class Scheduler;
 	
 } // LouiEriksson::Engine::ECS
 
@@ -38,12 +40,16 @@ namespace LouiEriksson::Engine {
 	class Script : public ECS::Component {
 	
 		friend ECS::Scene;
+		friend ECS::Scheduler;
 		friend LouiEriksson::Game::Core::ScriptInjector;
 	
 	private:
 		
 		bool m_Initialised = false;
 		
+		/** @brief Dependencies of the Script, queried once it has begun. Until then, the Script is exclusive. */
+		ECS::Access m_Access = ECS::Access::Exclusive();
+		
 		void Invoke(const bool& _late) {
 			
 			try {
@@ -53,6 +59,8 @@ namespace LouiEriksson::Engine {
 					if (!m_Initialised) {
 						Begin();
 						m_Initialised = true;
+						
+						m_Access = Dependencies();
 					}
 					else {
 						Tick();
@@ -89,6 +97,22 @@ namespace LouiEriksson::Engine {
 		/** @brief Called at the end of every frame. */
 		virtual void LateTick() {}
 		
+		/**
+		 * @brief Declares the types of data read and written by Tick() and LateTick(), allowing them to run alongside other Scripts.
+		 *
+		 * @details Scripts which run in parallel must record structural changes (creating or removing GameObjects, and adding
+		 *          or removing Components) using the Scene's CommandBuffer instead of making them directly.
+		 *          Begin() and FixedTick() always run on the main thread, without any other Scripts running.
+		 *
+		 * @note Called once, after Begin().
+		 *
+		 * @return The Access of the Script. By default, the Script is exclusive.
+		 * @see ECS::Scene::Commands()
+		 */
+		[[nodiscard]] virtual ECS::Access Dependencies() const {
+			return ECS::Access::Exclusive();
+		}
+		
 		/** @brief Called every tick of the physics engine. */
 		virtual void FixedTick() {}
 		
@@ -1,6 +1,7 @@
 #ifndef FINALYEARPROJECT_SERIALISATION_HPP
 #define FINALYEARPROJECT_SERIALISATION_HPP
 
+#include "Types.hpp"
 #include "utils/Utils.hpp"
 
 #include <glm/ext.hpp>
@@ -25,7 +26,8 @@ namespace LouiEriksson::Engine {
 		 * @brief The type of serialisation format.
 		 */
 		enum Format : unsigned char {
-			XML, /**< @brief XML format. */
+			XML,    /**< @brief XML format. */
+			Binary, /**< @brief Binary format. See ECS::SceneFile. */
 		};
 		
 		 Serialisation()                            = delete;
@@ -62,7 +64,7 @@ namespace LouiEriksson::Engine {
 						Debug::Log("\t", Info, true);
 					}
 				
-					Debug::Log(std::string(name) + " " + "\"" + result + "\"", Info);
+					FYP_LOG(std::string(name) + " " + "\"" + result + "\"", Info);
 				}
 			}
 		
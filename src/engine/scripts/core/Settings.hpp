@@ -1,11 +1,13 @@
 #ifndef FINALYEARPROJECT_SETTINGS_HPP
 #define FINALYEARPROJECT_SETTINGS_HPP
 
+#include "Debug.hpp"
 #include "Resources.hpp"
 #include "Types.hpp"
 
 #include <glm/ext/vector_float4.hpp>
 
+#include <exception>
 #include <memory>
 #include <vector>
 
@@ -55,6 +57,21 @@ namespace LouiEriksson::Engine {
 			Settings::Graphics::Material::UpdateShader(Settings::Graphics::Material::s_CurrentShaderSelection);
 		}
 		
+		/**
+		 * @brief Releases the assets held by the settings.
+		 *
+		 * @note This function should be called before Resources::Dispose().
+		 */
+		static void Dispose() noexcept {
+			
+			try {
+				Settings::Graphics::Skybox::s_Skybox.reset();
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+		}
+		
 		struct Spatial final {
 			
 			/** @brief Origin coordinate of the coordinate system (in latitude, longitude, and altitude). */
@@ -106,7 +123,8 @@ namespace LouiEriksson::Engine {
 				
 				inline static int s_CurrentSkyboxSelection { 4 };
 				
-				inline static std::weak_ptr<LouiEriksson::Engine::Graphics::Cubemap> s_Skybox;
+				/** @brief The current skybox. Held strongly, so that it is never evicted while it is in use (see Resources::Evict()). */
+				inline static std::shared_ptr<LouiEriksson::Engine::Graphics::Cubemap> s_Skybox;
 				
 				static void UpdateSkybox(const size_t& _index) {
 					
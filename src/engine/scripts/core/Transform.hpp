@@ -2,12 +2,22 @@
 #define FINALYEARPROJECT_TRANSFORM_HPP
 
 #include "../ecs/Component.hpp"
+#include "../ecs/Handle.hpp"
+#include "utils/Hashmap.hpp"
+
+#include "Types.hpp"
 
 #include <glm/ext.hpp>
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <typeindex>
+#include <vector>
 
 #define VEC_ZERO    vec3(0)
 #define VEC_ONE     vec3(1)
@@ -33,8 +43,19 @@ namespace LouiEriksson::Engine {
 	 */
 	struct Transform final : public ECS::Component {
 	
+		class Hierarchy;
+		
 	private:
 		
+		/** @brief Source of revisions. Revisions are unique across all Transforms, so a cached world matrix is never mistaken for one computed from a different parent. */
+		inline static std::atomic<uint64_t> s_Revision { 0U };
+		
+		/**
+		 * @brief Incremented whenever any Transform changes.
+		 * @details Once a world matrix has been validated, it stays valid until this changes, which keeps repeated calls to World() cheap.
+		 */
+		inline static std::atomic<uint64_t> s_Modified { 0U };
+		
 		/**
 		 * @brief Transform and scale components.
 		 *
@@ -49,46 +70,89 @@ namespace LouiEriksson::Engine {
 		mat4 m_World;
 		mat4 m_Local;
 		
+		/** @brief World matrix of the Transform as of the previous frame. */
+		mat4 m_PreviousWorld;
+		
 		/**< @brief Rotation of the Transform. */
 		glm::quat m_Rotation;
 		
-		vec3 m_LastPosition; /**< @brief Previous position of the Transform. */
-		glm::quat m_LastRotation; /**< @brief Previous rotation of the Transform. */
-		vec3 m_LastScale;    /**< @brief Previous scale of the Transform.    */
-		
 		/** @brief Parent of this Transform. */
-		std::weak_ptr<Transform> m_Parent;
+		ECS::Handle<Transform> m_Parent;
+		
+		/** @brief Parent from which the world matrix was computed. */
+		const Transform* m_WorldParent;
+		
+		/** @brief Revision of the parent's world matrix from which the world matrix was computed. */
+		uint64_t m_ParentRevision;
+		
+		/** @brief Revision of the world matrix, or zero if it has not been computed. */
+		uint64_t m_Revision;
+		
+		/** @brief Value of s_Modified when the world matrix was last known to be up to date. */
+		uint64_t m_Validated;
+		
+		/** @brief Reparent counter of the Hierarchy containing the Transform, or nullptr if it is in none. */
+		std::shared_ptr<std::atomic<uint64_t>> m_Reparented;
+		
+		bool m_LocalDirty; /**< @brief Whether the local matrix is out of date. */
+		bool m_WorldDirty; /**< @brief Whether the world matrix is out of date, regardless of the parent. */
+		
+		void Dirty() noexcept {
+			m_LocalDirty = true;
+			m_WorldDirty = true;
+			
+			s_Modified.fetch_add(1U, std::memory_order_relaxed);
+		}
 		
-		/** @brief Children of this Transform. */
-		std::vector<std::weak_ptr<Transform>> m_Children;
+		/**
+		 * @brief Recomputes the world matrix, if it is out of date.
+		 * @param[in] _parent The parent of the Transform, whose world matrix must be up to date.
+		 */
+		void Refresh(const Transform* const _parent) {
+			
+			if (m_WorldDirty || m_WorldParent != _parent || (_parent != nullptr && m_ParentRevision != _parent->m_Revision)) {
+				
+				m_World = _parent != nullptr ? _parent->m_World * Local() : Local();
+				
+				m_WorldParent    = _parent;
+				m_ParentRevision = _parent != nullptr ? _parent->m_Revision : 0U;
+				m_Revision       = s_Revision.fetch_add(1U, std::memory_order_relaxed) + 1U;
+				m_WorldDirty     = false;
+			}
+		}
 		
 	public:
 		
 		explicit Transform(const std::weak_ptr<ECS::GameObject>& _parent) noexcept : Component(_parent),
-			          m_TS(1.0),
-			       m_World(1.0),
-			       m_Local(1.0),
-			    m_Rotation(QUAT_IDENTITY),
-			m_LastPosition(0.0),
-			m_LastRotation(QUAT_IDENTITY),
-			m_LastScale   (1.0) {}
+			            m_TS(1.0),
+			         m_World(1.0),
+			         m_Local(1.0),
+			 m_PreviousWorld(1.0),
+			      m_Rotation(QUAT_IDENTITY),
+			   m_WorldParent(nullptr),
+			m_ParentRevision(0U),
+			      m_Revision(0U),
+			     m_Validated(std::numeric_limits<uint64_t>::max()),
+			    m_LocalDirty(true),
+			    m_WorldDirty(true) {}
 		
 		/** @inheritdoc */
 		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Transform); };
 		
 		void ParentTransform(const std::weak_ptr<Transform>& _value) {
-			m_Parent = _value;
-		}
-		
-		[[nodiscard]] std::shared_ptr<Transform> ParentTransform() {
 			
-			std::shared_ptr<Transform> result;
+			m_Parent = _value.lock();
 			
-			if (const auto p = m_Parent.lock()) {
-				result = p;
+			if (m_Reparented != nullptr) {
+				m_Reparented->fetch_add(1U, std::memory_order_relaxed);
 			}
 			
-			return result;
+			Dirty();
+		}
+		
+		/** @brief Returns the parent of this Transform, or nullptr if it has none. */
+		[[nodiscard]] Transform* ParentTransform() const noexcept {
+			return m_Parent.Get();
 		}
 		
 		/**
@@ -110,6 +174,8 @@ namespace LouiEriksson::Engine {
 		
 		void Position(const vec3& _position) noexcept {
 			m_TS[3] = vec4(_position, 1.0);
+			
+			Dirty();
 		}
 		
 		[[nodiscard]] constexpr const glm::quat& Rotation() const noexcept {
@@ -118,6 +184,8 @@ namespace LouiEriksson::Engine {
 		
 		void Rotation(const glm::quat& _rotation) noexcept {
 			m_Rotation = _rotation;
+			
+			Dirty();
 		}
 		
 		[[nodiscard]] vec3 Scale() const noexcept {
@@ -128,50 +196,221 @@ namespace LouiEriksson::Engine {
 			m_TS[0].x = _scale.x;
 			m_TS[1].y = _scale.y;
 			m_TS[2].z = _scale.z;
+			
+			Dirty();
 		}
 		
 		/**
-		 * @brief Returns the model / World matrix of this transform.
-		 * @return The World matrix of the Transform.
+		 * @brief Returns the local matrix of this transform.
+		 * @return The local matrix of the Transform.
 		 */
 		[[nodiscard]] const mat4& Local() {
 		
-			if (m_Rotation != QUAT_IDENTITY && m_Rotation != QUAT_IDENTITY_NEG) {
+			if (m_LocalDirty) {
+				m_LocalDirty = false;
 				
-				if (Position() != m_LastPosition ||
-				    m_Rotation != m_LastRotation ||
-					   Scale() != m_LastScale
-				) {
-					m_LastPosition = Position();
-					m_LastRotation = Rotation();
-					m_LastScale    = Scale();
-					
+				if (m_Rotation != QUAT_IDENTITY && m_Rotation != QUAT_IDENTITY_NEG) {
 					m_Local = m_TS * mat4_cast(glm::inverse(m_Rotation));
 				}
-			}
-			else {
-				m_Local = m_TS;
+				else {
+					m_Local = m_TS;
+				}
 			}
 			
 			return m_Local;
 		}
 		
-		[[nodiscard]] mat4 World() {
+		/**
+		 * @brief Returns the model / World matrix of this transform.
+		 *
+		 * @details The matrix is cached, and only recomputed if this Transform or one of its ancestors has changed since.
+		 *          The Scene updates every Transform once per frame (see Hierarchy), so this is normally a lookup.
+		 *
+		 * @return The World matrix of the Transform.
+		 */
+		[[nodiscard]] const mat4& World() {
+			
+			if (const auto modified = s_Modified.load(std::memory_order_relaxed); m_Validated != modified) {
+				
+				auto* const p = m_Parent.Get();
+				
+				if (p != nullptr) {
+					(void)p->World();
+				}
+				
+				Refresh(p);
+				
+				m_Validated = modified;
+			}
+			
+			return m_World;
+		}
+		
+		/**
+		 * @brief Returns a number which changes whenever the World matrix of this transform is recomputed.
+		 * @note Zero until the World matrix has first been computed.
+		 */
+		[[nodiscard]] constexpr const uint64_t& Revision() const noexcept {
+			return m_Revision;
+		}
+		
+		/**
+		 * @brief Returns the World matrix of this transform as of the previous frame (e.g. for motion vectors).
+		 * @note Equal to World() until the Transform has been updated by a Hierarchy.
+		 */
+		[[nodiscard]] constexpr const mat4& PreviousWorld() const noexcept {
+			return m_PreviousWorld;
+		}
+	};
+	
+	/**
+	 * @class Transform::Hierarchy
+	 * @brief Flattened, topologically sorted hierarchy of Transforms, used to update their World matrices in a single pass.
+	 *
+	 * @details Parents are always ordered before their children, so each Transform is visited once, and only recomputed if it
+	 *          or one of its ancestors has changed. The order is rebuilt when Transforms are added to or removed from the
+	 *          Scene, or a Transform within it is reparented. Changes to other Scenes do not affect it.
+	 *
+	 * @note Not thread-safe. Must be updated on the main thread.
+	 */
+	class Transform::Hierarchy final {
+	
+	private:
+		
+		static constexpr size_t s_None = std::numeric_limits<size_t>::max();
+		
+		struct Node final {
+			
+			Transform* m_Transform;
+			
+			/** @brief Index of the parent within the hierarchy, or s_None. */
+			size_t m_Parent;
+			
+			size_t m_Depth;
+		};
+		
+		std::vector<Node> m_Nodes;
+		
+		/** @brief Incremented whenever a Transform in the hierarchy is reparented. Shared with each Transform. */
+		std::shared_ptr<std::atomic<uint64_t>> m_Reparented = std::make_shared<std::atomic<uint64_t>>(0U);
+		
+		/** @brief Revision of the set of Transforms when the hierarchy was last built. */
+		uint64_t m_Revision = std::numeric_limits<uint64_t>::max();
+		
+		/** @brief Value of m_Reparented when the hierarchy was last built. */
+		uint64_t m_Structure = std::numeric_limits<uint64_t>::max();
+		
+		/** @brief Rebuilds the hierarchy from every Transform in the given range. */
+		template<typename R>
+		void Rebuild(R&& _transforms) {
+			
+			m_Nodes.clear();
+			
+			Hashmap<const Transform*, size_t> indices;
+			
+			for (const auto& [transform, owner] : _transforms) {
+				
+				indices.Add(&transform, m_Nodes.size());
+				
+				m_Nodes.push_back({ &transform, s_None, 0U });
+				
+				transform.m_Reparented = m_Reparented;
+			}
+			
+			for (auto& node : m_Nodes) {
+				
+				if (const auto index = indices.Get(node.m_Transform->m_Parent.Get())) {
+					node.m_Parent = *index;
+				}
+				
+				for (const auto* t = node.m_Transform->m_Parent.Get(); t != nullptr && node.m_Depth < m_Nodes.size(); t = t->m_Parent.Get()) {
+					++node.m_Depth;
+				}
+			}
+			
+			/* SORT BY DEPTH, AND REMAP PARENTS */
+			std::vector<size_t> order(m_Nodes.size());
 			
-			mat4 result;
+			for (size_t i = 0U; i < order.size(); ++i) {
+				order[i] = i;
+			}
+			
+			std::stable_sort(order.begin(), order.end(), [this](const size_t& _a, const size_t& _b) {
+				return m_Nodes[_a].m_Depth < m_Nodes[_b].m_Depth;
+			});
+			
+			std::vector<size_t> remap(order.size());
+			std::vector<Node> sorted;
+			sorted.reserve(order.size());
+			
+			for (size_t i = 0U; i < order.size(); ++i) {
+				remap[order[i]] = i;
+				
+				sorted.emplace_back(m_Nodes[order[i]]);
+			}
 			
-			if (const auto p = m_Parent.lock()) {
-				m_World = p->World() * Local();
+			for (auto& node : sorted) {
 				
-				result = m_World;
+				if (node.m_Parent != s_None) {
+					node.m_Parent = remap[node.m_Parent];
+				}
 			}
-			else {
-				result = Local();
+			
+			m_Nodes.swap(sorted);
+		}
+		
+	public:
+		
+		/**
+		 * @brief Updates the World matrix of every Transform, keeping the previous one.
+		 * @param[in] _transforms Every Transform in the Scene, as a range of (Transform&, GameObject&).
+		 * @param[in] _revision A number which changes whenever a Transform is added to or removed from the Scene (see Storage::Revision()).
+		 * @note Should be called once per frame.
+		 */
+		template<typename R>
+		void Update(R&& _transforms, const uint64_t& _revision) {
+			
+			if (const auto structure = m_Reparented->load(std::memory_order_relaxed); m_Revision != _revision || m_Structure != structure) {
+				
+				Rebuild(std::forward<R>(_transforms));
+				
+				m_Revision  = _revision;
+				m_Structure = structure;
 			}
 			
-			return result;
+			const auto modified = s_Modified.load(std::memory_order_relaxed);
+			
+			for (const auto& node : m_Nodes) {
+				
+				auto& transform = *node.m_Transform;
+				
+				const auto* const parent = node.m_Parent != s_None ?
+					m_Nodes[node.m_Parent].m_Transform :
+					transform.m_Parent.Get();
+				
+				const auto initialised = transform.m_Revision != 0U;
+				
+				transform.m_PreviousWorld = transform.m_World;
+				
+				if (parent != nullptr && node.m_Parent == s_None) {
+					(void)transform.World();
+				}
+				else {
+					transform.Refresh(parent);
+				}
+				
+				if (!initialised) {
+					transform.m_PreviousWorld = transform.m_World;
+				}
+				
+				transform.m_Validated = modified;
+			}
 		}
 		
+		/** @brief Returns the number of Transforms in the hierarchy. */
+		[[nodiscard]] size_t size() const noexcept {
+			return m_Nodes.size();
+		}
 	};
 	
 } // LouiEriksson::Engine
@@ -0,0 +1,467 @@
+#ifndef FINALYEARPROJECT_BVH_HPP
+#define FINALYEARPROJECT_BVH_HPP
+
+#include "../Types.hpp"
+
+#include "Bounds.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @class BVH
+	 * @brief Dynamic bounding volume hierarchy of AABBs, for spatial queries.
+	 *
+	 * @details Each item is stored in a leaf whose AABB is enlarged by a margin ("fattened"), so items which move slightly
+	 *          do not need to be reinserted. Leaves are inserted beside the node which minimises the growth in surface area
+	 *          of the tree, and the tree is kept balanced using rotations, so it remains shallow as items are added,
+	 *          moved and removed in any order.
+	 *
+	 * @tparam T Type of the items stored in the BVH (e.g. a handle).
+	 *
+	 * @see Catto, E. (2019). Dynamic Bounding Volume Hierarchies. Game Developers Conference.
+	 * @note Not thread-safe. Queries may run concurrently with each other, but not with modifications.
+	 */
+	template<typename T>
+	class BVH final {
+	
+	public:
+		
+		/** @brief Id of a leaf which does not exist. */
+		static constexpr size_t s_None = std::numeric_limits<size_t>::max();
+	
+	private:
+		
+		struct Node final {
+			
+			AABB m_Bounds;
+			
+			/** @brief Parent of the node, or (if the node is free) the next free node. */
+			size_t m_Parent;
+			
+			size_t m_Left;
+			size_t m_Right;
+			
+			/** @brief Height of the node above its deepest leaf, or -1 if the node is free. */
+			int32_t m_Height;
+			
+			T m_Item;
+			
+			[[nodiscard]] constexpr bool Leaf() const noexcept { return m_Left == s_None; }
+		};
+		
+		std::vector<Node> m_Nodes;
+		
+		size_t m_Root;
+		size_t m_Free;
+		size_t m_Count;
+		
+		scalar_t m_Margin;
+		
+		size_t Allocate() {
+			
+			if (m_Free == s_None) {
+				
+				m_Free = m_Nodes.size();
+				
+				m_Nodes.push_back({ AABB(), s_None, s_None, s_None, -1, T() });
+			}
+			
+			const auto result = m_Free;
+			
+			auto& node = m_Nodes[result];
+			
+			m_Free = node.m_Parent;
+			
+			node.m_Parent = s_None;
+			node.m_Left   = s_None;
+			node.m_Right  = s_None;
+			node.m_Height = 0;
+			
+			return result;
+		}
+		
+		void Free(const size_t& _node) noexcept {
+			
+			auto& node = m_Nodes[_node];
+			
+			node.m_Parent = m_Free;
+			node.m_Height = -1;
+			node.m_Item   = T();
+			
+			m_Free = _node;
+		}
+		
+		/** @brief Replaces a child of a node (or the root, if the node is s_None). */
+		void Replace(const size_t& _parent, const size_t& _old, const size_t& _new) noexcept {
+			
+			if (_parent == s_None) {
+				m_Root = _new;
+			}
+			else if (m_Nodes[_parent].m_Left == _old) {
+				m_Nodes[_parent].m_Left = _new;
+			}
+			else {
+				m_Nodes[_parent].m_Right = _new;
+			}
+		}
+		
+		/**
+		 * @brief Rotates the taller grandchild of an unbalanced node above it.
+		 * @return The node which has taken the place of the given node.
+		 */
+		size_t Balance(const size_t& _a) noexcept {
+			
+			auto result = _a;
+			
+			auto& a = m_Nodes[_a];
+			
+			if (!a.Leaf() && a.m_Height >= 2) {
+				
+				const auto ib = a.m_Left;
+				const auto ic = a.m_Right;
+				
+				auto& b = m_Nodes[ib];
+				auto& c = m_Nodes[ic];
+				
+				const auto balance = c.m_Height - b.m_Height;
+				
+				if (balance > 1 || balance < -1) {
+					
+					// The taller child (which rises), and the child which stays below the node.
+					const auto  irise = balance > 1 ? ic : ib;
+					auto&        rise = m_Nodes[irise];
+					const auto& other = balance > 1 ? b : c;
+					
+					const auto i0 = rise.m_Left;
+					const auto i1 = rise.m_Right;
+					
+					// Keep the taller grandchild beneath the risen node, and give the shorter one to the original node.
+					const auto keep = m_Nodes[i0].m_Height > m_Nodes[i1].m_Height ? i0 : i1;
+					const auto give = keep == i0 ? i1 : i0;
+					
+					rise.m_Left   = _a;
+					rise.m_Right  = keep;
+					rise.m_Parent = a.m_Parent;
+					
+					a.m_Parent = irise;
+					
+					Replace(rise.m_Parent, _a, irise);
+					
+					if (balance > 1) {
+						a.m_Right = give;
+					}
+					else {
+						a.m_Left = give;
+					}
+					
+					m_Nodes[give].m_Parent = _a;
+					
+					a.m_Bounds = AABB::Union(other.m_Bounds, m_Nodes[give].m_Bounds);
+					a.m_Height = 1 + std::max(other.m_Height, m_Nodes[give].m_Height);
+					
+					rise.m_Bounds = AABB::Union(a.m_Bounds, m_Nodes[keep].m_Bounds);
+					rise.m_Height = 1 + std::max(a.m_Height, m_Nodes[keep].m_Height);
+					
+					result = irise;
+				}
+			}
+			
+			return result;
+		}
+		
+		/** @brief Walks from a node to the root, restoring the balance, bounds and height of each node. */
+		void Refit(size_t _node) noexcept {
+			
+			while (_node != s_None) {
+				
+				_node = Balance(_node);
+				
+				auto& node = m_Nodes[_node];
+				
+				const auto& left  = m_Nodes[node.m_Left];
+				const auto& right = m_Nodes[node.m_Right];
+				
+				node.m_Bounds = AABB::Union(left.m_Bounds, right.m_Bounds);
+				node.m_Height = 1 + std::max(left.m_Height, right.m_Height);
+				
+				_node = node.m_Parent;
+			}
+		}
+		
+		void InsertLeaf(const size_t& _leaf) {
+			
+			if (m_Root == s_None) {
+				
+				m_Root = _leaf;
+				m_Nodes[_leaf].m_Parent = s_None;
+			}
+			else {
+				
+				const auto bounds = m_Nodes[_leaf].m_Bounds;
+				
+				/* FIND THE BEST SIBLING */
+				auto sibling = m_Root;
+				
+				while (!m_Nodes[sibling].Leaf()) {
+					
+					const auto& node = m_Nodes[sibling];
+					
+					const auto area     = node.m_Bounds.Area();
+					const auto combined = AABB::Union(node.m_Bounds, bounds).Area();
+					
+					// Cost of pairing with this node, and the cost inherited by descending past it.
+					const auto cost        = static_cast<scalar_t>(2.0) * combined;
+					const auto inheritance = static_cast<scalar_t>(2.0) * (combined - area);
+					
+					const auto descend = [this, &bounds, &inheritance](const size_t& _child) {
+						
+						const auto& child = m_Nodes[_child];
+						
+						const auto enlarged = AABB::Union(child.m_Bounds, bounds).Area();
+						
+						return inheritance + (child.Leaf() ? enlarged : enlarged - child.m_Bounds.Area());
+					};
+					
+					const auto left  = descend(node.m_Left);
+					const auto right = descend(node.m_Right);
+					
+					if (cost < left && cost < right) {
+						break;
+					}
+					
+					sibling = left < right ? node.m_Left : node.m_Right;
+				}
+				
+				/* PAIR THE LEAF WITH THE SIBLING UNDER A NEW PARENT */
+				const auto parent = Allocate();
+				const auto old    = m_Nodes[sibling].m_Parent;
+				
+				auto& node = m_Nodes[parent];
+				node.m_Parent = old;
+				node.m_Left   = sibling;
+				node.m_Right  = _leaf;
+				node.m_Bounds = AABB::Union(m_Nodes[sibling].m_Bounds, bounds);
+				node.m_Height = m_Nodes[sibling].m_Height + 1;
+				
+				Replace(old, sibling, parent);
+				
+				m_Nodes[sibling].m_Parent = parent;
+				m_Nodes[_leaf  ].m_Parent = parent;
+				
+				Refit(parent);
+			}
+		}
+		
+		void RemoveLeaf(const size_t& _leaf) noexcept {
+			
+			if (_leaf == m_Root) {
+				m_Root = s_None;
+			}
+			else {
+				
+				const auto parent  = m_Nodes[_leaf].m_Parent;
+				const auto grand   = m_Nodes[parent].m_Parent;
+				const auto sibling = m_Nodes[parent].m_Left == _leaf ? m_Nodes[parent].m_Right : m_Nodes[parent].m_Left;
+				
+				Replace(grand, parent, sibling);
+				
+				m_Nodes[sibling].m_Parent = grand;
+				
+				Free(parent);
+				
+				Refit(grand);
+			}
+		}
+		
+		/**
+		 * @brief Visits every leaf whose ancestors and own bounds pass a test.
+		 *
+		 * @param[in] _test Returns true if the subtree with the given bounds should be visited.
+		 * @param[in] _visit Invoked with each leaf which passes the test.
+		 */
+		template<typename Test, typename Visit>
+		void Traverse(const Test& _test, const Visit& _visit) const {
+			
+			if (m_Root != s_None) {
+				
+				std::vector<size_t> stack;
+				stack.reserve(64U);
+				stack.push_back(m_Root);
+				
+				while (!stack.empty()) {
+					
+					const auto& node = m_Nodes[stack.back()];
+					stack.pop_back();
+					
+					if (_test(node.m_Bounds)) {
+						
+						if (node.Leaf()) {
+							_visit(node);
+						}
+						else {
+							stack.push_back(node.m_Right);
+							stack.push_back(node.m_Left);
+						}
+					}
+				}
+			}
+		}
+	
+	public:
+		
+		/** @param[in] _margin Distance by which the bounds of each leaf are enlarged. */
+		explicit BVH(const scalar_t& _margin = 0.1) noexcept :
+			m_Root(s_None),
+			m_Free(s_None),
+			m_Count(0U),
+			m_Margin(_margin) {}
+		
+		/**
+		 * @brief Inserts an item.
+		 *
+		 * @param[in] _bounds Bounds of the item.
+		 * @param[in] _item The item.
+		 * @return Id of the leaf holding the item, which remains valid until it is removed.
+		 */
+		size_t Insert(const AABB& _bounds, T _item) {
+			
+			const auto result = Allocate();
+			
+			auto& leaf = m_Nodes[result];
+			leaf.m_Bounds = _bounds.Expanded(m_Margin);
+			leaf.m_Item   = std::move(_item);
+			
+			InsertLeaf(result);
+			
+			++m_Count;
+			
+			return result;
+		}
+		
+		/** @brief Removes the item held by a leaf. */
+		void Remove(const size_t& _leaf) noexcept {
+			
+			RemoveLeaf(_leaf);
+			Free(_leaf);
+			
+			--m_Count;
+		}
+		
+		/**
+		 * @brief Updates the bounds of the item held by a leaf.
+		 *
+		 * @details The leaf is only reinserted if the new bounds are not contained by its enlarged bounds.
+		 * @return True if the leaf was reinserted.
+		 */
+		bool Update(const size_t& _leaf, const AABB& _bounds) {
+			
+			const auto result = !m_Nodes[_leaf].m_Bounds.Contains(_bounds);
+			
+			if (result) {
+				
+				RemoveLeaf(_leaf);
+				
+				m_Nodes[_leaf].m_Bounds = _bounds.Expanded(m_Margin);
+				
+				InsertLeaf(_leaf);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Removes every item for which a predicate returns true. */
+		template<typename Predicate>
+		void RemoveIf(const Predicate& _predicate) {
+			
+			for (size_t i = 0U; i < m_Nodes.size(); ++i) {
+				
+				if (const auto& node = m_Nodes[i]; node.m_Height == 0 && _predicate(node.m_Item)) {
+					Remove(i);
+				}
+			}
+		}
+		
+		/** @brief Removes every item. */
+		void Clear() noexcept {
+			
+			m_Nodes.clear();
+			
+			m_Root  = s_None;
+			m_Free  = s_None;
+			m_Count = 0U;
+		}
+		
+		/** @brief Returns the item held by a leaf. */
+		[[nodiscard]] constexpr const T& Get(const size_t& _leaf) const noexcept {
+			return m_Nodes[_leaf].m_Item;
+		}
+		
+		/** @brief Returns the (enlarged) bounds of a leaf. */
+		[[nodiscard]] constexpr const AABB& Bounds(const size_t& _leaf) const noexcept {
+			return m_Nodes[_leaf].m_Bounds;
+		}
+		
+		/** @brief Invokes a function with every item whose bounds overlap an AABB. */
+		template<typename F>
+		void Query(const AABB& _aabb, const F& _function) const {
+			
+			Traverse(
+				[&_aabb](const AABB& _bounds) { return _aabb.Overlaps(_bounds); },
+				[&_function](const Node& _node) { _function(_node.m_Item); }
+			);
+		}
+		
+		/** @brief Invokes a function with every item whose bounds overlap a sphere. */
+		template<typename F>
+		void Query(const Sphere& _sphere, const F& _function) const {
+			
+			Traverse(
+				[&_sphere](const AABB& _bounds) { return _sphere.Overlaps(_bounds); },
+				[&_function](const Node& _node) { _function(_node.m_Item); }
+			);
+		}
+		
+		/** @brief Invokes a function with every item whose bounds are at least partially inside a frustum. */
+		template<typename F>
+		void Query(const Frustum& _frustum, const F& _function) const {
+			
+			Traverse(
+				[&_frustum](const AABB& _bounds) { return _frustum.Overlaps(_bounds); },
+				[&_function](const Node& _node) { _function(_node.m_Item); }
+			);
+		}
+		
+		/**
+		 * @brief Invokes a function with every item whose bounds are hit by a ray.
+		 * @param[in] _function Invoked with each item, and the distance along the ray at which its bounds are hit (in no particular order).
+		 */
+		template<typename F>
+		void Raycast(const Ray& _ray, const F& _function) const {
+			
+			scalar_t distance = 0.0;
+			
+			Traverse(
+				[&_ray, &distance](const AABB& _bounds) { return _ray.Intersects(_bounds, distance); },
+				[&_function, &distance](const Node& _node) { _function(_node.m_Item, distance); }
+			);
+		}
+		
+		/** @brief Returns the number of items in the BVH. */
+		[[nodiscard]] constexpr const size_t& size() const noexcept { return m_Count; }
+		
+		/** @brief Returns the height of the tree, or -1 if it is empty. */
+		[[nodiscard]] int32_t Height() const noexcept {
+			return m_Root != s_None ? m_Nodes[m_Root].m_Height : -1;
+		}
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_BVH_HPP
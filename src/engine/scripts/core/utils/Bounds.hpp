@@ -0,0 +1,243 @@
+#ifndef FINALYEARPROJECT_BOUNDS_HPP
+#define FINALYEARPROJECT_BOUNDS_HPP
+
+#include "../Types.hpp"
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @struct AABB
+	 * @brief Axis-aligned bounding box.
+	 *
+	 * @details A default-constructed AABB is empty (its minimum exceeds its maximum), and becomes valid once it encapsulates a point.
+	 */
+	struct AABB final {
+		
+		vec3 m_Min;
+		vec3 m_Max;
+		
+		constexpr AABB() noexcept :
+			m_Min(std::numeric_limits<scalar_t>::max()),
+			m_Max(std::numeric_limits<scalar_t>::lowest()) {}
+		
+		constexpr AABB(const vec3& _min, const vec3& _max) noexcept :
+			m_Min(_min),
+			m_Max(_max) {}
+		
+		/** @brief Returns true if the AABB encapsulates at least one point. */
+		[[nodiscard]] constexpr bool Valid() const noexcept {
+			return m_Min.x <= m_Max.x && m_Min.y <= m_Max.y && m_Min.z <= m_Max.z;
+		}
+		
+		[[nodiscard]] constexpr vec3 Centre() const noexcept {
+			return (m_Min + m_Max) * static_cast<scalar_t>(0.5);
+		}
+		
+		/** @brief Returns half of the size of the AABB along each axis. */
+		[[nodiscard]] constexpr vec3 Extents() const noexcept {
+			return (m_Max - m_Min) * static_cast<scalar_t>(0.5);
+		}
+		
+		/** @brief Returns the surface area of the AABB. */
+		[[nodiscard]] constexpr scalar_t Area() const noexcept {
+			
+			const auto size = m_Max - m_Min;
+			
+			return static_cast<scalar_t>(2.0) * ((size.x * size.y) + (size.y * size.z) + (size.z * size.x));
+		}
+		
+		/** @brief Grows the AABB to contain a point. */
+		void Encapsulate(const vec3& _point) noexcept {
+			
+			m_Min = glm::min(m_Min, _point);
+			m_Max = glm::max(m_Max, _point);
+		}
+		
+		/** @brief Grows the AABB to contain another. */
+		void Encapsulate(const AABB& _other) noexcept {
+			
+			m_Min = glm::min(m_Min, _other.m_Min);
+			m_Max = glm::max(m_Max, _other.m_Max);
+		}
+		
+		/** @brief Returns the smallest AABB containing two others. */
+		[[nodiscard]] static AABB Union(const AABB& _a, const AABB& _b) noexcept {
+			return { glm::min(_a.m_Min, _b.m_Min), glm::max(_a.m_Max, _b.m_Max) };
+		}
+		
+		/** @brief Returns the AABB grown by a margin on every side. */
+		[[nodiscard]] constexpr AABB Expanded(const scalar_t& _margin) const noexcept {
+			return { m_Min - vec3(_margin), m_Max + vec3(_margin) };
+		}
+		
+		/** @brief Returns true if the AABB contains another entirely. */
+		[[nodiscard]] constexpr bool Contains(const AABB& _other) const noexcept {
+			
+			return m_Min.x <= _other.m_Min.x && m_Min.y <= _other.m_Min.y && m_Min.z <= _other.m_Min.z &&
+			       m_Max.x >= _other.m_Max.x && m_Max.y >= _other.m_Max.y && m_Max.z >= _other.m_Max.z;
+		}
+		
+		/** @brief Returns true if the AABB overlaps another. */
+		[[nodiscard]] constexpr bool Overlaps(const AABB& _other) const noexcept {
+			
+			return m_Min.x <= _other.m_Max.x && m_Max.x >= _other.m_Min.x &&
+			       m_Min.y <= _other.m_Max.y && m_Max.y >= _other.m_Min.y &&
+			       m_Min.z <= _other.m_Max.z && m_Max.z >= _other.m_Min.z;
+		}
+		
+		/**
+		 * @brief Returns the AABB of this AABB after it has been transformed by a matrix.
+		 *
+		 * @see Arvo, J. (1990). Transforming Axis-Aligned Bounding Boxes. In: Graphics Gems. Academic Press, pp.548-550.
+		 */
+		[[nodiscard]] AABB Transformed(const mat4& _matrix) const noexcept {
+			
+			const auto translation = vec3(_matrix[3]);
+			
+			AABB result(translation, translation);
+			
+			for (glm::length_t i = 0; i < 3; ++i) {
+				
+				const auto a = vec3(_matrix[i]) * m_Min[i];
+				const auto b = vec3(_matrix[i]) * m_Max[i];
+				
+				result.m_Min += glm::min(a, b);
+				result.m_Max += glm::max(a, b);
+			}
+			
+			return result;
+		}
+	};
+	
+	/**
+	 * @struct Sphere
+	 * @brief Bounding sphere.
+	 */
+	struct Sphere final {
+		
+		vec3     m_Centre;
+		scalar_t m_Radius;
+		
+		/** @brief Returns true if the sphere overlaps an AABB. */
+		[[nodiscard]] bool Overlaps(const AABB& _aabb) const noexcept {
+			
+			const auto delta = m_Centre - glm::clamp(m_Centre, _aabb.m_Min, _aabb.m_Max);
+			
+			return glm::dot(delta, delta) <= m_Radius * m_Radius;
+		}
+	};
+	
+	/**
+	 * @struct Ray
+	 * @brief Finite ray, used for picking.
+	 */
+	struct Ray final {
+		
+		vec3 m_Origin;
+		
+		/** @brief Direction of the ray. Need not be normalised; distances are measured in multiples of its length. */
+		vec3 m_Direction;
+		
+		/** @brief Maximum distance along the ray. */
+		scalar_t m_Length;
+		
+		/**
+		 * @brief Tests the ray against an AABB, using the slab method.
+		 *
+		 * @param[in] _aabb The AABB.
+		 * @param[out] _distance Distance along the ray at which it enters the AABB, or zero if it starts inside it.
+		 * @return True if the ray hits the AABB within its length.
+		 */
+		[[nodiscard]] bool Intersects(const AABB& _aabb, scalar_t& _distance) const noexcept {
+			
+			scalar_t near = 0.0;
+			scalar_t far  = m_Length;
+			
+			for (glm::length_t i = 0; i < 3 && near <= far; ++i) {
+				
+				if (m_Direction[i] != static_cast<scalar_t>(0.0)) {
+					
+					const auto inverse = static_cast<scalar_t>(1.0) / m_Direction[i];
+					
+					auto t0 = (_aabb.m_Min[i] - m_Origin[i]) * inverse;
+					auto t1 = (_aabb.m_Max[i] - m_Origin[i]) * inverse;
+					
+					if (t0 > t1) {
+						std::swap(t0, t1);
+					}
+					
+					near = std::max(near, t0);
+					far  = std::min(far,  t1);
+				}
+				else if (m_Origin[i] < _aabb.m_Min[i] || m_Origin[i] > _aabb.m_Max[i]) {
+					far = static_cast<scalar_t>(-1.0);
+				}
+			}
+			
+			_distance = near;
+			
+			return near <= far;
+		}
+	};
+	
+	/**
+	 * @struct Frustum
+	 * @brief The six planes bounding the view volume of a projection.
+	 *
+	 * @see Gribb, G. and Hartmann, K. (2001). Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix.
+	 */
+	struct Frustum final {
+		
+		/** @brief Planes (normal, distance) facing into the frustum, in the order left, right, bottom, top, near, far. */
+		std::array<vec4, 6U> m_Planes;
+		
+		/** @brief Extracts the planes of a (OpenGL) view-projection matrix. */
+		explicit Frustum(const mat4& _viewProjection) noexcept {
+			
+			const auto row = [&_viewProjection](const glm::length_t& _i) {
+				return vec4(_viewProjection[0][_i], _viewProjection[1][_i], _viewProjection[2][_i], _viewProjection[3][_i]);
+			};
+			
+			const auto x = row(0);
+			const auto y = row(1);
+			const auto z = row(2);
+			const auto w = row(3);
+			
+			m_Planes = { w + x, w - x, w + y, w - y, w + z, w - z };
+		}
+		
+		/** @brief Returns true if an AABB is at least partially inside the frustum. */
+		[[nodiscard]] bool Overlaps(const AABB& _aabb) const noexcept {
+			
+			bool result = true;
+			
+			for (const auto& plane : m_Planes) {
+				
+				// Test the corner of the AABB furthest along the normal of the plane.
+				const vec3 corner(
+					plane.x >= static_cast<scalar_t>(0.0) ? _aabb.m_Max.x : _aabb.m_Min.x,
+					plane.y >= static_cast<scalar_t>(0.0) ? _aabb.m_Max.y : _aabb.m_Min.y,
+					plane.z >= static_cast<scalar_t>(0.0) ? _aabb.m_Max.z : _aabb.m_Min.z
+				);
+				
+				if (glm::dot(vec3(plane), corner) + plane.w < static_cast<scalar_t>(0.0)) {
+					result = false;
+					
+					break;
+				}
+			}
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_BOUNDS_HPP
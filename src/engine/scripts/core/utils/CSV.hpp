@@ -0,0 +1,269 @@
+#ifndef FINALYEARPROJECT_CSV_HPP
+#define FINALYEARPROJECT_CSV_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__AVX2__)
+	#define CSV_AVX2
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define CSV_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#define CSV_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace LouiEriksson::Engine {
+	
+	/**
+	 * @class CSV
+	 * @brief Utilities for reading delimiter-separated text in place.
+	 *
+	 * @details Delimiters and line breaks are located a block at a time using SIMD where available (AVX2, SSE2 or NEON).
+	 *          Fields are returned as views into the source text, so nothing is copied or allocated while reading.
+	 *
+	 * @note Quoted fields are not supported; a delimiter inside quotes is treated as a delimiter.
+	 */
+	class CSV final {
+	
+	private:
+
+#if defined(CSV_AVX2)
+		static constexpr size_t s_BlockWidth = 32U;
+#else
+		static constexpr size_t s_BlockWidth = 16U;
+#endif
+		
+		/**
+		 * @brief Returns a mask of the bytes in a block which are either the delimiter or a line feed.
+		 *
+		 * @param[in] _data Start of the block. At least s_BlockWidth bytes must be readable.
+		 * @param[in] _delimiter The delimiter.
+		 * @return A mask where bit i is set if byte i is a delimiter or line feed.
+		 */
+		static uint32_t Match(const char* _data, const char& _delimiter) noexcept {
+
+#if defined(CSV_AVX2)
+			
+			const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data));
+			
+			return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(
+				_mm256_cmpeq_epi8(block, _mm256_set1_epi8(_delimiter)),
+				_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'))
+			)));
+
+#elif defined(CSV_SSE2)
+			
+			const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data));
+			
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(
+				_mm_cmpeq_epi8(block, _mm_set1_epi8(_delimiter)),
+				_mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))
+			)));
+
+#elif defined(CSV_NEON)
+			
+			static constexpr uint8_t weights[16U] = { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U };
+			
+			const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(_data));
+			
+			const auto bits = vandq_u8(
+				vorrq_u8(
+					vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>(_delimiter))),
+					vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>('\n')))
+				),
+				vld1q_u8(weights)
+			);
+			
+			return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) |
+			      (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8U);
+
+#else
+			return Match(_data, s_BlockWidth, _delimiter);
+#endif
+		}
+		
+		/**
+		 * @brief Scalar equivalent of Match(), for blocks shorter than s_BlockWidth.
+		 */
+		static uint32_t Match(const char* _data, const size_t& _length, const char& _delimiter) noexcept {
+			
+			uint32_t result = 0U;
+			
+			for (size_t i = 0U; i < _length; ++i) {
+				result |= static_cast<uint32_t>(_data[i] == _delimiter || _data[i] == '\n') << i;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the index of the lowest set bit in a non-zero mask.
+		 */
+		static constexpr size_t CountTrailingZeros(uint32_t _mask) noexcept {
+
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<size_t>(__builtin_ctz(_mask));
+#else
+			size_t result = 0U;
+			
+			while ((_mask & 1U) == 0U) {
+				_mask >>= 1U;
+				++result;
+			}
+			
+			return result;
+#endif
+		}
+	
+	public:
+		
+		 CSV()                  = delete;
+		 CSV(const CSV& _other) = delete;
+		~CSV()                  = delete;
+		
+		/**
+		 * @class Reader
+		 * @brief Reads the rows of delimiter-separated text held in memory.
+		 *
+		 * @note The text must outlive the Reader and any fields returned by it.
+		 */
+		class Reader final {
+		
+		private:
+			
+			std::string_view m_Data;
+			
+			size_t m_Position;
+			
+			char m_Delimiter;
+			
+			/** @brief Removes a trailing carriage return, so that CRLF line endings are handled. */
+			static constexpr std::string_view TrimCR(const std::string_view& _field) noexcept {
+				return !_field.empty() && _field.back() == '\r' ? _field.substr(0U, _field.size() - 1U) : _field;
+			}
+		
+		public:
+			
+			/**
+			 * @brief Creates a Reader over the given text.
+			 *
+			 * @param[in] _data The text to read.
+			 * @param[in] _delimiter The character separating fields.
+			 */
+			explicit constexpr Reader(const std::string_view& _data, const char& _delimiter = ',') noexcept :
+				m_Data(_data),
+				m_Position(0U),
+				m_Delimiter(_delimiter) {}
+			
+			/** @brief Returns true if every row has been read. */
+			[[nodiscard]] constexpr bool End() const noexcept {
+				return m_Position >= m_Data.size();
+			}
+			
+			/** @brief Returns the number of bytes read so far. */
+			[[nodiscard]] constexpr size_t Position() const noexcept {
+				return m_Position;
+			}
+			
+			/**
+			 * @brief Skips the current row (e.g. a header).
+			 */
+			void SkipRow() noexcept {
+				
+				const auto end = m_Data.find('\n', m_Position);
+				
+				m_Position = end != std::string_view::npos ? end + 1U : m_Data.size();
+			}
+			
+			/**
+			 * @brief Reads selected columns of the next row.
+			 *
+			 * @details Only the requested columns are located. Once the last of them has been found,
+			 *          the remainder of the row is skipped without being tokenised.
+			 *
+			 * @tparam N Number of columns to read.
+			 * @param[in] _columns Indices of the columns to read, in ascending order.
+			 * @param[out] _fields The requested fields of the row. Fields missing from the row are left empty.
+			 * @return True if a row was read, or false if there are no rows left.
+			 */
+			template<size_t N>
+			bool Next(const std::array<size_t, N>& _columns, std::array<std::string_view, N>& _fields) noexcept {
+				
+				static_assert(N > 0U, "At least one column must be requested.");
+				
+				_fields.fill({});
+				
+				const auto result = !End();
+				
+				if (result) {
+					
+					const auto* const data = m_Data.data();
+					const auto        size = m_Data.size();
+					
+					size_t found  = 0U;
+					size_t column = 0U;
+					size_t start  = m_Position;
+					
+					bool done = false;
+					
+					for (auto block = m_Position; !done && block < size; block += s_BlockWidth) {
+						
+						auto mask = block + s_BlockWidth <= size ?
+							Match(data + block, m_Delimiter) :
+							Match(data + block, size - block, m_Delimiter);
+						
+						while (mask != 0U) {
+							
+							const auto index = block + CountTrailingZeros(mask);
+							
+							mask &= mask - 1U;
+							
+							if (column == _columns[found]) {
+								_fields[found++] = TrimCR(m_Data.substr(start, index - start));
+							}
+							
+							++column;
+							start = index + 1U;
+							
+							if (data[index] == '\n') {
+								
+								m_Position = start;
+								
+								done = true;
+								break;
+							}
+							
+							if (found == N) {
+								
+								SkipRow();
+								
+								done = true;
+								break;
+							}
+						}
+					}
+					
+					// The final row may not be terminated by a line feed.
+					if (!done) {
+						
+						if (found < N && column == _columns[found]) {
+							_fields[found] = TrimCR(m_Data.substr(start));
+						}
+						
+						m_Position = size;
+					}
+				}
+				
+				return result;
+			}
+		};
+	};
+
+} // LouiEriksson::Engine
+
+#endif //FINALYEARPROJECT_CSV_HPP
@@ -28,30 +28,71 @@
 //#define HASHMAP_SUPPRESS_EXCEPTION_WARNING // Uncomment if you wish to remove the warning about possible unhandled exceptions.
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <limits>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <mutex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define HASHMAP_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#define HASHMAP_NEON
+	#include <arm_neon.h>
+#endif
 
 namespace LouiEriksson::Engine {
 	
 	/**
-	 * @mainpage Version 2.0.1
+	 * @brief A mutex which does nothing.
+	 * @details Can be supplied to a Hashmap that is only ever accessed from a single thread,
+	 *          or which is never modified after construction, to remove the cost of locking.
+	 */
+	struct NullMutex final {
+		
+		constexpr void   lock() noexcept {}
+		constexpr void unlock() noexcept {}
+		
+		[[nodiscard]] constexpr bool try_lock() noexcept { return true; }
+	};
+	
+	/**
+	 * @mainpage Version 3.0.0
 	 * @details Custom Hashmap implementation accepting a customisable key and value type.
-	 *          This implementation requires that your "key" type is compatible with std::hash and that the stored data types are copyable.
+	 *          This implementation requires that your "key" type is compatible with std::hash and equality comparable, and that the stored data types are copyable.
+	 *
+	 *          Entries are stored contiguously in insertion order and are indexed by an open-addressing table of
+	 *          control bytes, which is probed sixteen slots at a time (using SIMD where available).
+	 *          Each Hashmap owns its own lock, so unrelated instances no longer contend with one another.
+	 *
+	 *          Maps with string keys support heterogeneous lookup, meaning they may be queried using std::string_view
+	 *          or string literals without constructing a temporary std::string.
+	 *
+	 *          View() provides iteration over the entries without copying them. While any view is open, the entries it visits are
+	 *          never modified: removed entries are detached from the table immediately but erased only once the last view closes,
+	 *          and inserted or reassigned entries are staged separately until then.
+	 *
 	 * @see Wang, Q. (Harry) (2020). Implementing Your Own HashMap (Explanation + Code). YouTube.
 	 *      Available at: https://www.youtube.com/watch?v=_Q-eNqTOxlE [Accessed 2021].
+	 * @see Kulukundis, M. (2017). Designing a Fast, Efficient, Cache-friendly Hash Table, Step by Step. CppCon.
+	 *      Available at: https://www.youtube.com/watch?v=ncHmEUmJZf4 [Accessed 2024].
 	 * @tparam Tk Key type of the Hashmap.
 	 * @tparam Tv Value type of the Hashmap.
+	 * @tparam Mutex (optional) Type of lock used to synchronise access to the Hashmap. Defaults to std::recursive_mutex.
 	 */
-	template<typename Tk, typename Tv>
+	template<typename Tk, typename Tv, typename Mutex = std::recursive_mutex>
 	class Hashmap final {
 		
-		inline static std::recursive_mutex s_Lock;
-		
 	public:
 		
 		/**
@@ -68,6 +109,11 @@ namespace LouiEriksson::Engine {
 				 first(_key),
 				second(_value) {}
 			
+			template<typename K, typename V>
+			KeyValuePair(K&& _key, V&& _value) :
+				 first(std::forward<K>(_key)),
+				second(std::forward<V>(_value)) {}
+			
 			constexpr KeyValuePair(const KeyValuePair& _other) :
 				 first(_other.first),
 				second(_other.second) {}
@@ -92,91 +138,666 @@ namespace LouiEriksson::Engine {
 				return *this;
 			}
 		};
-	
+		
+		using const_iterator = typename std::vector<KeyValuePair>::const_iterator;
+		
 	private:
 		
-		/** @brief Buckets of the Hashmap. */
-		std::vector<std::vector<KeyValuePair>> m_Buckets;
+		using ctrl_t = signed char;
+		using lock_t = std::lock_guard<Mutex>;
+		
+		/** @brief Control byte of a slot which has never been occupied. */
+		static constexpr ctrl_t s_Empty   = -128;
 		
-		/** @brief Current number of elements within the Hashmap. */
-		size_t m_Size;
+		/** @brief Control byte of a slot whose entry has been removed (tombstone). */
+		static constexpr ctrl_t s_Deleted = -2;
+		
+		/** @brief Number of control bytes probed at once. */
+		static constexpr size_t s_GroupWidth = 16U;
+		
+		/** @brief Value returned by the probing functions when no slot is found. */
+		static constexpr size_t s_NoSlot = std::numeric_limits<size_t>::max();
+		
+		/** @brief Slot of an entry which has been removed from the table, and is awaiting erasure (tombstone). */
+		static constexpr uint32_t s_Detached = std::numeric_limits<uint32_t>::max();
+		
+		/** @brief Whether the key type is a string, and therefore supports heterogeneous lookup. */
+		static constexpr bool s_IsStringKey = std::is_same_v<Tk, std::string> || std::is_same_v<Tk, std::string_view>;
+		
+		/** @brief Enables an overload for keys which may be used in place of Tk without conversion. */
+		template<typename K>
+		using enable_if_heterogeneous_t = std::enable_if_t<
+			s_IsStringKey &&
+			!std::is_same_v<std::decay_t<K>, Tk> &&
+			 std::is_convertible_v<const K&, std::string_view>, int
+		>;
 		
 		/**
-		 * @brief Calculate the hashcode of a given object using std::fnv1a.
-		 * @param[in] _item Item to calculate fnv1a of.
-		 * @return Hashcode of _item.
-		 * @throw std::exception If the type of _item is not supported by std::fnv1a.
+		 * @brief A group of control bytes, which can be matched against a value in one operation.
 		 */
-		static constexpr size_t GetHashcode(const Tk& _item) {
-			return std::hash<Tk>()(_item);
+		struct Group final {
+		
+#if defined(HASHMAP_SSE2)
+			
+			__m128i m_Ctrl;
+			
+			explicit Group(const ctrl_t* _ctrl) noexcept :
+				m_Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_ctrl))) {}
+			
+			[[nodiscard]] uint32_t Match(const ctrl_t& _value) const noexcept {
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(_value), m_Ctrl)));
+			}
+			
+			[[nodiscard]] uint32_t MatchEmptyOrDeleted() const noexcept {
+				
+				// Only non-full slots have the sign bit set.
+				return static_cast<uint32_t>(_mm_movemask_epi8(m_Ctrl));
+			}
+			
+#elif defined(HASHMAP_NEON)
+			
+			int8x16_t m_Ctrl;
+			
+			explicit Group(const ctrl_t* _ctrl) noexcept :
+				m_Ctrl(vld1q_s8(_ctrl)) {}
+			
+			[[nodiscard]] static uint32_t MoveMask(const uint8x16_t& _lanes) noexcept {
+				
+				static constexpr uint8_t weights[16U] = { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U };
+				
+				const auto bits = vandq_u8(_lanes, vld1q_u8(weights));
+				
+				return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) |
+				      (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8U);
+			}
+			
+			[[nodiscard]] uint32_t Match(const ctrl_t& _value) const noexcept {
+				return MoveMask(vceqq_s8(vdupq_n_s8(_value), m_Ctrl));
+			}
+			
+			[[nodiscard]] uint32_t MatchEmptyOrDeleted() const noexcept {
+				return MoveMask(vcltzq_s8(m_Ctrl));
+			}
+			
+#else
+			
+			std::array<ctrl_t, s_GroupWidth> m_Ctrl;
+			
+			explicit Group(const ctrl_t* _ctrl) noexcept {
+				std::copy(_ctrl, _ctrl + s_GroupWidth, m_Ctrl.begin());
+			}
+			
+			[[nodiscard]] uint32_t Match(const ctrl_t& _value) const noexcept {
+				
+				uint32_t result = 0U;
+				
+				for (size_t i = 0U; i < s_GroupWidth; ++i) {
+					result |= static_cast<uint32_t>(m_Ctrl[i] == _value) << i;
+				}
+				
+				return result;
+			}
+			
+			[[nodiscard]] uint32_t MatchEmptyOrDeleted() const noexcept {
+				
+				uint32_t result = 0U;
+				
+				for (size_t i = 0U; i < s_GroupWidth; ++i) {
+					result |= static_cast<uint32_t>(m_Ctrl[i] < 0) << i;
+				}
+				
+				return result;
+			}
+			
+#endif
+			
+			[[nodiscard]] uint32_t MatchEmpty() const noexcept {
+				return Match(s_Empty);
+			}
+		};
+		
+		/** @brief Entries of the Hashmap, stored contiguously. */
+		std::vector<KeyValuePair> m_Entries;
+		
+		/**
+		 * @brief Entries inserted or reassigned while a view was open, which are appended to m_Entries once the last view closes.
+		 * @details The index of a staged entry continues on from the indices of m_Entries.
+		 */
+		std::vector<KeyValuePair> m_Staged;
+		
+		/** @brief Slot in the table occupied by each entry (staged or not), or s_Detached if the entry has been removed. */
+		std::vector<uint32_t> m_EntrySlots;
+		
+		/** @brief Control byte of each slot in the table. */
+		std::vector<ctrl_t> m_Ctrl;
+		
+		/** @brief Index of the entry referenced by each slot in the table. */
+		std::vector<uint32_t> m_Slots;
+		
+		/** @brief Number of slots currently marked as deleted. */
+		size_t m_Tombstones;
+		
+		/** @brief Number of views currently open over the Hashmap. */
+		mutable size_t m_Views;
+		
+		/** @brief Indices of the entries detached while a view was open, which are erased once the last view closes. */
+		std::vector<uint32_t> m_Deferred;
+		
+		/** @brief Lock synchronising access to this Hashmap. */
+		mutable Mutex m_Lock;
+		
+		/**
+		 * @brief Returns the index of the lowest set bit in a non-zero mask.
+		 * @param[in] _mask Mask to evaluate.
+		 * @return Index of the lowest set bit.
+		 */
+		static constexpr size_t CountTrailingZeros(uint32_t _mask) noexcept {
+
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<size_t>(__builtin_ctz(_mask));
+#else
+			size_t result = 0U;
+			
+			while ((_mask & 1U) == 0U) {
+				_mask >>= 1U;
+				++result;
+			}
+			
+			return result;
+#endif
 		}
 		
 		/**
-		 * @brief Reinitialise the Hashmap. An expensive operation that increases the Hashmap's capacity.
-		 *
-		 * @param _newSize The new size of the Hashmap.
+		 * @brief Calculate the hashcode of a given key.
+		 * @details The output of std::hash is mixed, as many implementations use the identity function for integral types,
+		 *          which would otherwise leave the control bytes with very little entropy.
+		 * @param[in] _key Key to calculate the hashcode of.
+		 * @return Hashcode of _key.
 		 */
-		constexpr void Resize(const size_t& _newSize) {
+		template<typename K>
+		static size_t GetHashcode(const K& _key) {
+			
+			size_t result;
+			
+			if constexpr (s_IsStringKey) {
+				result = std::hash<std::string_view>()(std::string_view(_key));
+			}
+			else {
+				result = std::hash<Tk>()(_key);
+			}
+			
+			// Finalise using the "fmix" step of MurmurHash3.
+			if constexpr (sizeof(size_t) >= 8U) {
+				result ^= result >> 33U;
+				result *= static_cast<size_t>(0xFF51AFD7ED558CCDULL);
+				result ^= result >> 33U;
+			}
+			else {
+				result ^= result >> 16U;
+				result *= static_cast<size_t>(0x85EBCA6BU);
+				result ^= result >> 13U;
+			}
 			
-			std::vector<std::vector<KeyValuePair>> shallow_cpy(m_Buckets);
+			return result;
+		}
+		
+		/** @brief Portion of the hash used to select the starting group. */
+		static constexpr size_t H1(const size_t& _hash) noexcept { return _hash >> 7U; }
+		
+		/** @brief Portion of the hash stored in the control byte of a full slot. */
+		static constexpr ctrl_t H2(const size_t& _hash) noexcept { return static_cast<ctrl_t>(_hash & 0x7FU); }
+		
+		/**
+		 * @brief Returns the smallest valid capacity able to contain the given number of entries.
+		 * @details Capacities are a power-of-two multiple of the group width, and are kept at most 7/8 full.
+		 * @param[in] _count Number of entries.
+		 * @return The capacity.
+		 */
+		static constexpr size_t CapacityFor(const size_t& _count) noexcept {
 			
-			m_Size = 0U;
-			m_Buckets.clear();
-			m_Buckets.resize(_newSize > 0U ? _newSize : 1U);
+			size_t result = 0U;
 			
-			for (auto& bucket : shallow_cpy) {
-				for (auto& kvp : bucket) {
-					Assign(std::move(kvp.first), std::move(kvp.second));
+			if (_count > 0U) {
+				
+				result = s_GroupWidth;
+				
+				while (_count * 8U > result * 7U) {
+					result *= 2U;
 				}
 			}
+			
+			return result;
 		}
 		
 		/**
-		 * @brief Retrieves a reference to the entry within the Hashmap with the given key, if one exists.
-		 * This method will throw an exception if no entry is found. Consider using Get() for safe access instead.
-		 *
-		 * @param[in] _key Key of the entry to retrieve.
-		 * @return Out value result.
-		 * @throw std::runtime_error If no entry is found.
-		 * @see Get(const Tk& _key, Tv& _out)
+		 * @brief Finds the slot of the entry with the given key.
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The slot of the entry, or s_NoSlot if no such entry exists.
 		 */
-		constexpr const Tv& Return(const Tk& _key) const {
+		template<typename K>
+		size_t FindSlot(const K& _key, const size_t& _hash) const {
 			
-			const Tv* result = nullptr;
+			size_t result = s_NoSlot;
 			
-			if (!m_Buckets.empty()) {
+			if (!m_Ctrl.empty()) {
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				size_t hash = GetHashcode(_key);
-				size_t i = hash % m_Buckets.size();
+				const auto mask = (m_Ctrl.size() / s_GroupWidth) - 1U;
+				const auto h2   = H2(_hash);
 				
-				auto& bucket = m_Buckets[i];
+				auto g = H1(_hash) & mask;
 				
-				for (auto& kvp : bucket) {
+				// Triangular probing visits every group exactly once when the group count is a power of two.
+				for (size_t probe = 1U; probe <= mask + 1U; ++probe) {
+					
+					const Group group(m_Ctrl.data() + (g * s_GroupWidth));
 					
-					if (GetHashcode(kvp.first) == hash) {
-						result = &kvp.second;
+					for (auto bits = group.Match(h2); bits != 0U; bits &= bits - 1U) {
 						
+						const auto slot = (g * s_GroupWidth) + CountTrailingZeros(bits);
+						
+						if (Entry(m_Slots[slot]).first == _key) {
+							return slot;
+						}
+					}
+					
+					// An empty slot terminates the probe sequence; the key is not present.
+					if (group.MatchEmpty() != 0U) {
 						break;
 					}
+					
+					g = (g + probe) & mask;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Finds the first empty or deleted slot in the probe sequence of the given hash.
+		 * @param[in] _hash Hashcode of the key to insert.
+		 * @return A free slot.
+		 * @note The table must contain at least one free slot.
+		 */
+		size_t FindFreeSlot(const size_t& _hash) const {
+			
+			const auto mask = (m_Ctrl.size() / s_GroupWidth) - 1U;
+			
+			auto g = H1(_hash) & mask;
+			
+			for (size_t probe = 1U; ; ++probe) {
+				
+				if (const auto bits = Group(m_Ctrl.data() + (g * s_GroupWidth)).MatchEmptyOrDeleted()) {
+					return (g * s_GroupWidth) + CountTrailingZeros(bits);
+				}
+				
+				g = (g + probe) & mask;
+			}
+		}
+		
+		/**
+		 * @brief Rebuild the table with a new capacity. Removes all tombstones.
+		 * @param[in] _capacity The new capacity. Must be able to contain every entry.
+		 */
+		void Rehash(const size_t& _capacity) {
+			
+			m_Ctrl.assign(_capacity, s_Empty);
+			m_Slots.assign(_capacity, 0U);
+			m_Tombstones = 0U;
+			
+			for (size_t i = 0U; i < Count(); ++i) {
+				
+				if (m_EntrySlots[i] != s_Detached) {
+					
+					const auto hash = GetHashcode(Entry(i).first);
+					const auto slot = FindFreeSlot(hash);
+					
+					m_Ctrl [slot] = H2(hash);
+					m_Slots[slot] = static_cast<uint32_t>(i);
+					
+					m_EntrySlots[i] = static_cast<uint32_t>(slot);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Ensures there is room for one more entry, growing or cleaning the table if necessary.
+		 */
+		void PrepareInsert() {
+			
+			const auto capacity = m_Ctrl.size();
+			
+			const auto live = Live();
+			
+			if ((live + m_Tombstones + 1U) * 8U > capacity * 7U) {
+				
+				// Grow if the table is genuinely filling up, otherwise just clear out the tombstones.
+				if ((live + 1U) * 16U > capacity * 7U) {
+					Rehash(std::max(capacity * 2U, CapacityFor(live + 1U)));
+				}
+				else {
+					Rehash(capacity);
+				}
+			}
+		}
+		
+		/** @brief Returns the number of entries stored, including staged entries and those awaiting erasure. */
+		[[nodiscard]] size_t Count() const noexcept {
+			return m_Entries.size() + m_Staged.size();
+		}
+		
+		/** @brief Returns the number of entries in the table, excluding those awaiting erasure. */
+		[[nodiscard]] size_t Live() const noexcept {
+			return Count() - m_Deferred.size();
+		}
+		
+		/**
+		 * @brief Returns the entry at the given index, which may be staged.
+		 * @param[in] _index Index of the entry.
+		 * @return The entry.
+		 */
+		[[nodiscard]] KeyValuePair& Entry(const size_t& _index) noexcept {
+			return _index < m_Entries.size() ? m_Entries[_index] : m_Staged[_index - m_Entries.size()];
+		}
+		
+		/** @copydoc Entry(const size_t&) */
+		[[nodiscard]] const KeyValuePair& Entry(const size_t& _index) const noexcept {
+			return _index < m_Entries.size() ? m_Entries[_index] : m_Staged[_index - m_Entries.size()];
+		}
+		
+		/**
+		 * @brief Finds the slot of the entry with the given key.
+		 * @details Removed entries are detached from the table, so are never found.
+		 * @param[in] _key Key of the entry.
+		 * @return The slot of the entry, or s_NoSlot if no such entry exists.
+		 */
+		template<typename K>
+		size_t Find(const K& _key) const {
+			return FindSlot(_key, GetHashcode(_key));
+		}
+		
+		/**
+		 * @brief Frees a slot in the table.
+		 * @param[in] _slot The slot.
+		 */
+		void Vacate(const size_t& _slot) noexcept {
+			
+			// If the slot's group already contains an empty slot, no probe sequence can pass through it, so a tombstone is unnecessary.
+			const auto group = (_slot / s_GroupWidth) * s_GroupWidth;
+			
+			if (Group(m_Ctrl.data() + group).MatchEmpty() != 0U) {
+				m_Ctrl[_slot] = s_Empty;
+			}
+			else {
+				m_Ctrl[_slot] = s_Deleted;
+				++m_Tombstones;
+			}
+		}
+		
+		/**
+		 * @brief Erases the entry at the given index from storage.
+		 * @details The last entry is moved into the vacated position, keeping storage contiguous. Must not be called while a view is open.
+		 * @param[in] _index Index of the entry. The last entry must not be detached, unless it is the entry being erased.
+		 */
+		void EraseIndex(const size_t& _index) {
+			
+			const auto last = m_Entries.size() - 1U;
+			
+			if (_index != last) {
+				
+				m_Entries   [_index] = std::move(m_Entries   [last]);
+				m_EntrySlots[_index] = m_EntrySlots[last];
+				
+				m_Slots[m_EntrySlots[_index]] = static_cast<uint32_t>(_index);
+			}
+			
+			m_Entries.pop_back();
+			m_EntrySlots.pop_back();
+		}
+		
+		/**
+		 * @brief Removes the entry occupying the given slot.
+		 * @details If a view is open, the entry is detached from the table and erased once the last view closes. Otherwise, it is erased immediately.
+		 * @param[in] _slot Slot of the entry to remove.
+		 */
+		void Erase(const size_t& _slot) {
+			
+			const auto index = m_Slots[_slot];
+			
+			if (m_Views == 0U) {
+				
+				Vacate(_slot);
+				EraseIndex(index);
+			}
+			else {
+				
+				// Defer first, so that the table is left untouched if the allocation throws.
+				m_Deferred.emplace_back(index);
+				
+				Vacate(_slot);
+				m_EntrySlots[index] = s_Detached;
+			}
+		}
+		
+		/**
+		 * @brief Appends the staged entries to storage, and erases all detached entries.
+		 * @note Must not be called while a view is open.
+		 */
+		void FlushDeferred() {
+			
+			for (auto& entry : m_Staged) {
+				m_Entries.emplace_back(std::move(entry));
+			}
+			
+			m_Staged.clear();
+			
+			// Erase from the highest index down, so that entries moved into vacated positions are never detached themselves.
+			std::sort(m_Deferred.begin(), m_Deferred.end(), std::greater<>());
+			
+			for (const auto& index : m_Deferred) {
+				EraseIndex(index);
+			}
+			
+			m_Deferred.clear();
+		}
+		
+		/**
+		 * @brief Closes a view, flushing any deferred changes if it was the last one open.
+		 * @note Must be called while the lock is held.
+		 */
+		void CloseView() const {
+			
+			if (--m_Views == 0U && (!m_Deferred.empty() || !m_Staged.empty())) {
+				
+				// Changes can only have been deferred through a non-const path, so the Hashmap is not a const object.
+				const_cast<Hashmap*>(this)->FlushDeferred();
+			}
+		}
+		
+		/**
+		 * @brief Inserts an entry, optionally overwriting the value of an existing entry with the same key.
+		 *
+		 * @details While a view is open, new entries are staged, and existing entries are replaced by a staged copy rather than overwritten,
+		 *          so that the entries visited by the view are never modified.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _overwrite Whether the value of an existing entry should be replaced.
+		 * @return True if a new entry was inserted, false if the key already existed.
+		 */
+		template<typename K, typename V>
+		bool Insert(K&& _key, V&& _value, const bool& _overwrite) {
+			
+			bool result = false;
+			
+			const auto hash = GetHashcode(_key);
+			
+			if (const auto existing = FindSlot(_key, hash); existing != s_NoSlot) {
+				
+				if (_overwrite) {
+					
+					const auto index = m_Slots[existing];
+					
+					if (m_Views != 0U && index < m_Entries.size()) {
+						
+						m_Staged.emplace_back(m_Entries[index].first, std::forward<V>(_value));
+						m_EntrySlots.emplace_back(static_cast<uint32_t>(existing));
+						
+						m_Slots[existing] = static_cast<uint32_t>(Count() - 1U);
+						
+						m_EntrySlots[index] = s_Detached;
+						m_Deferred.emplace_back(index);
+					}
+					else {
+						Entry(index).second = std::forward<V>(_value);
+					}
+				}
+			}
+			else {
+				
+				PrepareInsert();
+				
+				const auto slot = FindFreeSlot(hash);
+				
+				// Emplace first, so that the table is left untouched if construction throws.
+				if (m_Views == 0U) {
+					m_Entries.emplace_back(std::forward<K>(_key), std::forward<V>(_value));
+				}
+				else {
+					m_Staged.emplace_back(std::forward<K>(_key), std::forward<V>(_value));
+				}
+				
+				m_EntrySlots.emplace_back(static_cast<uint32_t>(slot));
+				
+				if (m_Ctrl[slot] == s_Deleted) {
+					--m_Tombstones;
+				}
+				
+				m_Ctrl [slot] = H2(hash);
+				m_Slots[slot] = static_cast<uint32_t>(Count() - 1U);
+				
+				result = true;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Replaces the entries of the Hashmap with the live entries of another.
+		 * @param[in] _other The Hashmap to copy. Must be locked.
+		 */
+		void CopyFrom(const Hashmap& _other) {
+			
+			if (m_Views == 0U && _other.m_Staged.empty() && _other.m_Deferred.empty()) {
+				
+				m_Entries    = _other.m_Entries;
+				m_EntrySlots = _other.m_EntrySlots;
+				m_Ctrl       = _other.m_Ctrl;
+				m_Slots      = _other.m_Slots;
+				m_Tombstones = _other.m_Tombstones;
+				
+				m_Staged.clear();
+				m_Deferred.clear();
+			}
+			else if (m_Views == 0U) {
+				
+				m_Entries.clear();
+				m_Staged.clear();
+				m_EntrySlots.clear();
+				m_Deferred.clear();
+				
+				m_Entries.reserve(_other.Live());
+				m_EntrySlots.reserve(_other.Live());
+				
+				for (size_t i = 0U; i < _other.Count(); ++i) {
+					
+					if (_other.m_EntrySlots[i] != s_Detached) {
+						m_Entries.emplace_back(_other.Entry(i));
+						m_EntrySlots.emplace_back(0U);
+					}
+				}
+				
+				Rehash(CapacityFor(m_Entries.size()));
+			}
+			else {
+				
+				// Views are open over this Hashmap, so replace its entries through the deferred paths.
+				ClearEntries();
+				
+				for (size_t i = 0U; i < _other.Count(); ++i) {
+					
+					if (_other.m_EntrySlots[i] != s_Detached) {
+						Insert(_other.Entry(i).first, _other.Entry(i).second, true);
+					}
 				}
 			}
+		}
+		
+		/**
+		 * @brief Removes all entries.
+		 * @note Must be called while the lock is held.
+		 */
+		void ClearEntries() {
+			
+			if (m_Views == 0U) {
+				
+				m_Entries.clear();
+				m_Staged.clear();
+				m_EntrySlots.clear();
+				m_Ctrl.clear();
+				m_Slots.clear();
+				m_Deferred.clear();
+				
+				m_Tombstones = 0U;
+			}
+			else {
+				
+				// Detach every entry, and erase them once the last view closes.
+				for (size_t i = 0U; i < Count(); ++i) {
+					
+					if (m_EntrySlots[i] != s_Detached) {
+						m_EntrySlots[i] = s_Detached;
+						m_Deferred.emplace_back(static_cast<uint32_t>(i));
+					}
+				}
+				
+				std::fill(m_Ctrl.begin(), m_Ctrl.end(), s_Empty);
+				
+				m_Tombstones = 0U;
+			}
+		}
+		
+		/**
+		 * @brief Retrieves a reference to the entry within the Hashmap with the given key, if one exists.
+		 * This method will throw an exception if no entry is found. Consider using Get() for safe access instead.
+		 *
+		 * @param[in] _key Key of the entry to retrieve.
+		 * @return Out value result.
+		 * @throw std::runtime_error If no entry is found.
+		 * @see Get(const Tk& _key, Tv& _out)
+		 */
+		constexpr const Tv& Return(const Tk& _key) const {
+			
+			const auto slot = Find(_key);
 			
-			if (result == nullptr) {
+			if (slot == s_NoSlot) {
 				throw std::runtime_error("Attempted to access a nonexistent entry from the Hashmap.");
 			}
 			
-			return *result;
+			return Entry(m_Slots[slot]).second;
 		}
 		
 	public:
 		
 		/**
 		 * @brief Initialise Hashmap.
-		 * @param[in] _capacity Initial capacity of the Hashmap. Must be larger than 0.
+		 * @param[in] _capacity Initial capacity of the Hashmap.
 		 */
-		constexpr Hashmap(const size_t& _capacity = 1U) : m_Size(0U) {
-			m_Buckets.resize(_capacity);
+		Hashmap(const size_t& _capacity = 1U) :
+			m_Tombstones(0U),
+			m_Views     (0U)
+		{
+			Reserve(_capacity);
 		}
 		
 		/**
@@ -186,19 +807,87 @@ namespace LouiEriksson::Engine {
 		 * @param[in] _items A collection of key-value pairs.
 		 * @param[in] _capacity Initial capacity of the Hashmap. If a value less than 1 is assigned, it will use the size of the provided collection.
 		 */
-		constexpr Hashmap(const std::initializer_list<KeyValuePair>& _items, const size_t& _capacity = 0U) : m_Size(0U) {
+		Hashmap(const std::initializer_list<KeyValuePair>& _items, const size_t& _capacity = 0U) :
+			m_Tombstones(0U),
+			m_Views     (0U)
+		{
+			Reserve(std::max(_capacity, _items.size()));
+			
+			for (const auto& item : _items) {
+				Insert(item.first, item.second, true);
+			}
+		}
+		
+		Hashmap(const Hashmap& _other) :
+			m_Tombstones(0U),
+			m_Views     (0U)
+		{
+			const lock_t lock(_other.m_Lock);
 			
-			size_t auto_capacity = _capacity;
+			CopyFrom(_other);
+		}
+		
+		/**
+		 * @brief Moves the entries of another Hashmap.
+		 * @throws std::bad_alloc (or any exception thrown by copying Tk or Tv) if views are open over the other Hashmap, as its entries are copied instead.
+		 */
+		Hashmap(Hashmap&& _other) :
+			m_Tombstones(0U),
+			m_Views     (0U)
+		{
+			const lock_t lock(_other.m_Lock);
+			
+			// Entries visited by open views must not be moved from.
+			if (_other.m_Views == 0U) {
+				m_Entries    = std::move(_other.m_Entries);
+				m_EntrySlots = std::move(_other.m_EntrySlots);
+				m_Ctrl       = std::move(_other.m_Ctrl);
+				m_Slots      = std::move(_other.m_Slots);
+				m_Tombstones = std::exchange(_other.m_Tombstones, 0U);
+			}
+			else {
+				CopyFrom(_other);
+			}
+		}
+		
+		Hashmap& operator = (const Hashmap& _other) {
 			
-			if (auto_capacity < 1) {
-				auto_capacity = std::max<size_t>(_items.size(), 1);
+			if (this != &_other) {
+				
+				const std::scoped_lock lock(m_Lock, _other.m_Lock);
+				
+				CopyFrom(_other);
 			}
 			
-			m_Buckets.resize(auto_capacity);
+			return *this;
+		}
+		
+		/**
+		 * @brief Moves the entries of another Hashmap.
+		 * @throws std::bad_alloc (or any exception thrown by copying Tk or Tv) if views are open over either Hashmap, as the entries are copied instead.
+		 */
+		Hashmap& operator = (Hashmap&& _other) {
 			
-			for (const auto& item : _items) {
-				Assign(item.first, item.second);
+			if (this != &_other) {
+				
+				const std::scoped_lock lock(m_Lock, _other.m_Lock);
+				
+				// Entries visited by open views must not be moved, whether to or from.
+				if (m_Views == 0U && _other.m_Views == 0U) {
+					m_Entries    = std::move(_other.m_Entries);
+					m_Staged.clear();
+					m_EntrySlots = std::move(_other.m_EntrySlots);
+					m_Ctrl       = std::move(_other.m_Ctrl);
+					m_Slots      = std::move(_other.m_Slots);
+					m_Tombstones = std::exchange(_other.m_Tombstones, 0U);
+					m_Deferred.clear();
+				}
+				else {
+					CopyFrom(_other);
+				}
 			}
+			
+			return *this;
 		}
 		
 		struct optional_ref final {
@@ -230,10 +919,10 @@ namespace LouiEriksson::Engine {
 		 * @brief Returns the number of items stored within the Hashmap.
 		 * @return The number of items stored within the Hashmap.
 		 */
-		[[nodiscard]] const size_t& size() const noexcept {
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+		[[nodiscard]] size_t size() const noexcept {
+			const lock_t lock(m_Lock);
 			
-			return m_Size;
+			return Live();
 		}
 		
 		/**
@@ -253,26 +942,36 @@ namespace LouiEriksson::Engine {
 		 */
 		bool ContainsKey(const Tk& _key, [[maybe_unused]] std::exception_ptr _exception = nullptr) const noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			auto result = false;
 			
 			try {
-				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				size_t hash = GetHashcode(_key);
-				size_t i = hash % m_Buckets.size();
-				
-				auto& bucket = m_Buckets[i];
-				
-				for (auto& kvp : bucket) {
-					
-					if (GetHashcode(kvp.first) == hash) {
-						result = true;
-						
-						break;
-					}
-				}
+				result = Find(_key) != s_NoSlot;
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Queries for the existence of an item in the Hashmap, without converting the key to Tk.
+		 *
+		 * @param[in] _key Key of the entry. Must be convertible to std::string_view.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		template<typename K, enable_if_heterogeneous_t<K> = 0>
+		bool ContainsKey(const K& _key, [[maybe_unused]] std::exception_ptr _exception = nullptr) const noexcept {
+			
+			const lock_t lock(m_Lock);
+			
+			auto result = false;
+			
+			try {
+				result = Find(std::string_view(_key)) != s_NoSlot;
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -292,38 +991,12 @@ namespace LouiEriksson::Engine {
 		 */
 		bool Add(const Tk& _key, const Tv& _value, [[maybe_unused]] std::exception_ptr _exception = nullptr) noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
-			auto result = true;
+			auto result = false;
 			
 			try {
-				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2);
-				}
-				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-				
-				auto& bucket = m_Buckets[i];
-				
-				// In the case of a hash collision, determine if the key is unique.
-				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
-				for (auto& kvp : bucket) {
-					if (GetHashcode(kvp.first) == hash) {
-						result = false;
-						
-						break;
-					}
-				}
-				
-				// Insert the item into the bucket.
-				if (result) {
-					m_Size++;
-					
-					bucket.emplace_back(_key, _value);
-				}
+				result = Insert(_key, _value, false);
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -343,38 +1016,12 @@ namespace LouiEriksson::Engine {
 		 */
 		bool Add(const Tk&& _key, const Tv&& _value, [[maybe_unused]] std::exception_ptr _exception = nullptr) noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
-			auto result = true;
+			auto result = false;
 			
 			try {
-				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2);
-				}
-				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-				
-				auto& bucket = m_Buckets[i];
-				
-				// In the case of a hash collision, determine if the key is unique.
-				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
-				for (auto& kvp : bucket) {
-					if (GetHashcode(kvp.first) == hash) {
-						result = false;
-						
-						break;
-					}
-				}
-				
-				// Insert the item into the bucket.
-				if (result) {
-					m_Size++;
-					
-					bucket.emplace_back(_key, _value);
-				}
+				result = Insert(std::move(_key), std::move(_value), false);
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -392,37 +1039,10 @@ namespace LouiEriksson::Engine {
 		 */
 		void Assign(const Tk& _key, const Tv& _value, [[maybe_unused]] std::exception_ptr _exception = nullptr) noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			try {
-				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2);
-				}
-				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-				
-				auto& bucket = m_Buckets[i];
-				
-				auto exists = false;
-				for (auto& kvp : bucket) {
-					
-					if (GetHashcode(kvp.first) == hash) {
-						exists = true;
-						
-						kvp.second = _value;
-						
-						break;
-					}
-				}
-				
-				if (!exists) {
-					m_Size++;
-					
-					bucket.emplace_back(_key, _value);
-				}
+				Insert(_key, _value, true);
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -438,37 +1058,10 @@ namespace LouiEriksson::Engine {
 		 */
 		void Assign(Tk&& _key, Tv&& _value, [[maybe_unused]] std::exception_ptr _exception = nullptr) noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			try {
-				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2);
-				}
-				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-				
-				auto& bucket = m_Buckets[i];
-				
-				auto exists = false;
-				for (auto& kvp : bucket) {
-					
-					if (GetHashcode(kvp.first) == hash) {
-						exists = true;
-						
-						kvp.second = std::move(_value);
-						
-						break;
-					}
-				}
-				
-				if (!exists) {
-					m_Size++;
-					
-					bucket.emplace_back(std::move(_key), std::move(_value));
-				}
+				Insert(std::move(_key), std::move(_value), true);
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -484,32 +1077,47 @@ namespace LouiEriksson::Engine {
 		 */
 		bool Remove(const Tk& _key, [[maybe_unused]] std::exception_ptr _exception = nullptr) noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			bool result = false;
 			
 			try {
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const size_t hash = GetHashcode(_key);
-				const size_t i = hash % m_Buckets.size();
-				
-				auto& bucket = m_Buckets[i];
-				
-				// In the case of accessing a "collided" hash, find the value in the bucket using equality checks.
-				for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+				if (const auto slot = Find(_key); slot != s_NoSlot) {
 					
-					if (GetHashcode(itr->first) == hash) {
-						result = true;
-						
-						bucket.erase(itr);
-						
-						break;
-					}
+					Erase(slot);
+					
+					result = true;
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Removes entry with given key from the Hashmap, without converting the key to Tk.
+		 *
+		 * @param[in] _key Key of the entry to be removed. Must be convertible to std::string_view.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		template<typename K, enable_if_heterogeneous_t<K> = 0>
+		bool Remove(const K& _key, [[maybe_unused]] std::exception_ptr _exception = nullptr) noexcept {
+			
+			const lock_t lock(m_Lock);
+			
+			bool result = false;
+			
+			try {
+				if (const auto slot = Find(std::string_view(_key)); slot != s_NoSlot) {
+					
+					Erase(slot);
+					
+					result = true;
 				}
-				
-				m_Size -= static_cast<size_t>(result);
-				
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -519,7 +1127,7 @@ namespace LouiEriksson::Engine {
 		}
 		
 		/**
-		 * @brief Retrieves the value associated with the given key from the fnv1a table.
+		 * @brief Retrieves the value associated with the given key from the Hashmap.
 		 *
 		 * @tparam Tk The type of the key.
 		 * @param[in] _key The key to retrieve the value for.
@@ -529,27 +1137,14 @@ namespace LouiEriksson::Engine {
 		 */
 		optional_ref Get(const Tk& _key, std::exception_ptr _exception = nullptr) const noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			typename optional_ref::optional_t result = std::nullopt;
 			
 			try {
-			
-				if (!m_Buckets.empty()) {
-					
-					// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-					size_t hash = GetHashcode(_key);
-					size_t i = hash % m_Buckets.size();
-					
-					auto& bucket = m_Buckets[i];
-					
-					for (auto& kvp : bucket) {
-						
-						if (GetHashcode(kvp.first) == hash) {
-							result = std::cref(kvp.second);
-							break;
-						}
-					}
+				
+				if (const auto slot = Find(_key); slot != s_NoSlot) {
+					result = std::cref(Entry(m_Slots[slot]).second);
 				}
 			}
 			catch (...) {
@@ -560,38 +1155,71 @@ namespace LouiEriksson::Engine {
 		}
 		
 		/**
-		 * @brief Trims unused entries from the end of the Hashmap.
+		 * @brief Retrieves the value associated with the given key from the Hashmap, without converting the key to Tk.
+		 *
+		 * @param[in] _key The key to retrieve the value for. Must be convertible to std::string_view.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return An optional reference to the value associated with the key, or std::nullopt if the key is not present.
+		 * @note This function is noexcept.
 		 */
-		void Trim() {
+		template<typename K, enable_if_heterogeneous_t<K> = 0>
+		optional_ref Get(const K& _key, std::exception_ptr _exception = nullptr) const noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
-			size_t trimStart = 1U;
+			typename optional_ref::optional_t result = std::nullopt;
 			
-			for (size_t i = trimStart; i < m_Buckets.size(); ++i) {
-				if (m_Buckets[i].size() != 0U) {
-					trimStart = i + 1U;
+			try {
+				if (const auto slot = Find(std::string_view(_key)); slot != s_NoSlot) {
+					result = std::cref(Entry(m_Slots[slot]).second);
 				}
 			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Shrinks the Hashmap to the smallest capacity able to contain its entries.
+		 */
+		void Trim() {
+			
+			const lock_t lock(m_Lock);
 			
-			if (trimStart < m_Buckets.size()) {
-				m_Buckets.erase(m_Buckets.begin() + trimStart);
+			const auto capacity = CapacityFor(m_Entries.size());
+			
+			// Open views may be visiting the entries, so their storage is only shrunk while none are.
+			if (m_Views == 0U && capacity < m_Ctrl.size()) {
+				
+				m_Entries.shrink_to_fit();
+				m_EntrySlots.shrink_to_fit();
+				
+				m_Ctrl.clear();
+				m_Ctrl.shrink_to_fit();
+				m_Slots.clear();
+				m_Slots.shrink_to_fit();
+				
+				Rehash(capacity);
 			}
 		}
 		
 		/**
-		 * @brief Returns a shallow copy of all entries stored within the Hashmap.
-		 * @return A shallow copy of all entries stored within the Hashmap.
+		 * @brief Returns a shallow copy of all keys stored within the Hashmap.
+		 * @return A shallow copy of all keys stored within the Hashmap.
 		 */
 		[[nodiscard]] std::vector<Tk> Keys() const {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			std::vector<Tk> result;
+			result.reserve(Live());
 			
-			for (const auto& bucket : m_Buckets) {
-				for (const auto& kvp : bucket) {
-					result.emplace_back(kvp.first);
+			for (size_t i = 0U; i < Count(); ++i) {
+				
+				if (m_EntrySlots[i] != s_Detached) {
+					result.emplace_back(Entry(i).first);
 				}
 			}
 			
@@ -599,18 +1227,20 @@ namespace LouiEriksson::Engine {
 		}
 		
 		/**
-		 * @brief Returns a shallow copy of all entries stored within the Hashmap.
-		 * @return A shallow copy of all entries stored within the Hashmap.
+		 * @brief Returns a shallow copy of all values stored within the Hashmap.
+		 * @return A shallow copy of all values stored within the Hashmap.
 		 */
 		[[nodiscard]] std::vector<Tv> Values() const {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			std::vector<Tv> result;
+			result.reserve(Live());
 			
-			for (const auto& bucket : m_Buckets) {
-				for (const auto& kvp : bucket) {
-					result.emplace_back(kvp.second);
+			for (size_t i = 0U; i < Count(); ++i) {
+				
+				if (m_EntrySlots[i] != s_Detached) {
+					result.emplace_back(Entry(i).second);
 				}
 			}
 			
@@ -623,13 +1253,21 @@ namespace LouiEriksson::Engine {
 		 */
 		[[nodiscard]] std::vector<KeyValuePair> GetAll() const {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			std::vector<KeyValuePair> result;
 			
-			for (const auto& bucket : m_Buckets) {
-				for (const auto& kvp : bucket) {
-					result.emplace_back(kvp);
+			if (m_Deferred.empty() && m_Staged.empty()) {
+				result = m_Entries;
+			}
+			else {
+				result.reserve(Live());
+				
+				for (size_t i = 0U; i < Count(); ++i) {
+					
+					if (m_EntrySlots[i] != s_Detached) {
+						result.emplace_back(Entry(i));
+					}
 				}
 			}
 			
@@ -643,10 +1281,20 @@ namespace LouiEriksson::Engine {
 		 */
 		void Reserve(const std::size_t& _newSize) {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
-			if (m_Size < _newSize) {
-				Resize(_newSize);
+			const auto capacity = CapacityFor(_newSize);
+			
+			if (capacity > m_Ctrl.size()) {
+				
+				// Open views may be visiting the entries, so they must not be reallocated.
+				if (m_Views == 0U) {
+					m_Entries.reserve(_newSize);
+				}
+				
+				m_EntrySlots.reserve(_newSize);
+				
+				Rehash(capacity);
 			}
 		}
 		
@@ -655,14 +1303,10 @@ namespace LouiEriksson::Engine {
 		 */
 		void Clear() noexcept {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 			try {
-				m_Buckets.clear();
-				m_Size = 0U;
-			}
-			catch (const std::exception& e) {
-				std::cerr << e.what() << std::endl;
+				ClearEntries();
 			}
 			catch (...) {}
 		}
@@ -682,7 +1326,7 @@ namespace LouiEriksson::Engine {
 #endif
 		const Tv& operator[](const Tk& _key) const {
 			
-			const std::lock_guard<std::recursive_mutex> lock(s_Lock);
+			const lock_t lock(m_Lock);
 			
 		    return Return(_key);
 		}
@@ -690,64 +1334,110 @@ namespace LouiEriksson::Engine {
 		/* ITERATORS */
 		
 		/**
-		 * @class const_iterator
-		 * @brief Represents an iterator to traverse through the elements in a Hashmap.
+		 * @class view
+		 * @brief A zero-copy view over the entries of a Hashmap.
+		 *
+		 * @details The Hashmap is only locked while a view is opened and closed, so other threads are not blocked while one iterates.
+		 *          The entries visited by a view are never modified while any view is open, so the Hashmap may continue to be modified
+		 *          (by any thread) while iterating:
+		 *          - Entries inserted, or whose values are assigned, while any view is open are staged, and are not visited by views
+		 *            opened before the last view closes.
+		 *          - Entries removed while any view is open are hidden from lookups immediately, but continue to be visited
+		 *            by open views and are only erased once the last view closes.
 		 */
-		class const_iterator final {
+		class view final {
 		
 			friend Hashmap;
 			
-			using outer_itr = typename std::vector<std::vector<KeyValuePair>>::const_iterator;
-			using inner_itr = typename std::vector<KeyValuePair>::const_iterator;
-			
 		private:
 			
-			outer_itr m_Outer;
-			outer_itr m_Outer_End;
-			inner_itr m_Inner;
+			const Hashmap* m_Map;
 			
-			constexpr const_iterator(const outer_itr& _outer,
-			                         const outer_itr& _outer_end,
-			                         const inner_itr& _inner) :
-				    m_Outer(_outer),
-				m_Outer_End(_outer_end),
-				    m_Inner(_inner)
+			/** @brief Number of entries at the time the view was opened. */
+			size_t m_Count;
+			
+			explicit view(const Hashmap& _map) :
+				m_Map(&_map),
+				m_Count(0U)
 			{
-				if (m_Outer != m_Outer_End && m_Inner == m_Outer->end()) {
-					++(*this);
-				}
+				const lock_t lock(m_Map->m_Lock);
+				
+				++m_Map->m_Views;
+				m_Count = m_Map->m_Entries.size();
 			}
 			
 		public:
 			
-			const const_iterator& operator ++() {
+			/**
+			 * @class iterator
+			 * @brief Iterates a view by index, so that it remains valid if the Hashmap's storage is reallocated.
+			 */
+			class iterator final {
+			
+				friend view;
 				
-				if (++m_Inner == m_Outer->end()) {
+			private:
+				
+				const Hashmap* m_Map;
+				size_t m_Index;
+				
+				constexpr iterator(const Hashmap* _map, const size_t& _index) noexcept :
+					m_Map(_map),
+					m_Index(_index) {}
+				
+			public:
+				
+				iterator& operator ++() noexcept {
+					++m_Index;
 					
-					while (++m_Outer != m_Outer_End) {
-						
-						if (!m_Outer->empty()) {
-							m_Inner = m_Outer->begin();
-							break;
-						}
-					}
-					if (m_Outer == m_Outer_End) {
-						m_Inner = inner_itr();
-					}
+					return *this;
 				}
-				return *this;
+				
+				const KeyValuePair& operator  *() const { return  m_Map->m_Entries[m_Index]; }
+				const KeyValuePair* operator ->() const { return &m_Map->m_Entries[m_Index]; }
+				
+				bool operator ==(const iterator& _other) const noexcept { return m_Index == _other.m_Index; }
+				bool operator !=(const iterator& _other) const noexcept { return m_Index != _other.m_Index; }
+			};
+			
+			view             (const view& _other) = delete;
+			view& operator = (const view& _other) = delete;
+			
+			~view() {
+				
+				const lock_t lock(m_Map->m_Lock);
+				
+				try {
+					m_Map->CloseView();
+				}
+				catch (...) {}
 			}
 			
-			const KeyValuePair& operator *() const { return *m_Inner; }
+			[[nodiscard]] iterator begin() const noexcept { return { m_Map, 0U      }; }
+			[[nodiscard]] iterator   end() const noexcept { return { m_Map, m_Count }; }
 			
-			bool operator ==(const const_iterator& other) const { return ((m_Outer == other.m_Outer) && (m_Outer == m_Outer_End || m_Inner == other.m_Inner)); }
-			bool operator !=(const const_iterator& other) const { return !operator ==(other); }
+			[[nodiscard]] size_t size() const noexcept { return m_Count; }
+			
+			[[nodiscard]] bool empty() const noexcept { return m_Count == 0U; }
 		};
 		
-		constexpr const_iterator begin() const { return const_iterator(m_Buckets.begin(), m_Buckets.end(), m_Buckets.empty() ? typename std::vector<KeyValuePair>::const_iterator() : m_Buckets.begin()->begin()); }
-		constexpr const_iterator   end() const { return const_iterator(m_Buckets.end(),   m_Buckets.end(), typename std::vector<KeyValuePair>::const_iterator()); }
+		/**
+		 * @brief Opens a zero-copy view over the entries of the Hashmap.
+		 * @details Prefer this over Keys(), Values() or GetAll() for iteration, as it neither allocates nor copies.
+		 * @return A view over the entries of the Hashmap.
+		 * @see view
+		 */
+		[[nodiscard]] view View() const {
+			return view(*this);
+		}
+		
+		/**
+		 * @note Unlike View(), these iterators do not lock the Hashmap and are invalidated by any modification.
+		 */
+		const_iterator begin() const noexcept { return m_Entries.begin(); }
+		const_iterator   end() const noexcept { return m_Entries.end();   }
 	};
 	
 } // LouiEriksson::Engine
 
-#endif //LOUIERIKSSON_HASHMAP_HPP
\ No newline at end of file
+#endif //LOUIERIKSSON_HASHMAP_HPP
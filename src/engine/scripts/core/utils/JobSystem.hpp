@@ -0,0 +1,702 @@
+#ifndef FINALYEARPROJECT_JOBSYSTEM_HPP
+#define FINALYEARPROJECT_JOBSYSTEM_HPP
+
+#include "../Debug.hpp"
+
+#include "ThreadUtils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine::Threading {
+	
+	/**
+	 * @class JobSystem
+	 * @brief Fixed pool of worker threads which execute jobs from per-worker, work-stealing deques.
+	 *
+	 * @details Each worker owns one deque per priority. Workers pop their own work in LIFO order (for locality) and steal
+	 *          the oldest work from other workers when idle. A thread which waits on a job runs that job, or any of its
+	 *          unfinished dependencies, itself if it has not yet started, so jobs may safely wait on other jobs regardless
+	 *          of pool size. Only threads outside the pool (i.e. the main thread) help with unrelated work while waiting.
+	 *
+	 * @note The pool is started by Init(), or lazily on first use, and joined by Dispose(). Once disposed, the pool
+	 *       rejects new work until Init() is called again.
+	 */
+	class JobSystem final {
+	
+	public:
+		
+		/**
+		 * @brief Scheduling priority of a job.
+		 * @note Higher priorities are always drained before lower ones.
+		 */
+		enum Priority : unsigned char {
+			Gameplay  = 0U, /**< @brief Work required by the current or next frame. */
+			Normal    = 1U, /**< @brief General-purpose work. */
+			Streaming = 2U, /**< @brief Long-running loading, parsing and network work. */
+		};
+		
+		/**
+		 * @class Job
+		 * @brief A unit of work, and the continuations waiting on it.
+		 */
+		class Job final {
+			
+			friend JobSystem;
+		
+		private:
+			
+			std::function<void()> m_Task;
+			
+			Priority m_Priority;
+			
+			Utils::CancellationToken* m_CancellationToken;
+			
+			/** @brief Number of unfinished dependencies, plus one while the job is being scheduled. */
+			std::atomic<size_t> m_Pending;
+			
+			std::atomic<bool> m_Done;
+			
+			/** @brief Set by the first thread to start executing the job, so that it runs exactly once. */
+			std::atomic<bool> m_Claimed;
+			
+			std::mutex m_Lock;
+			
+			/** @brief Notified once the job is ready to run, and once it has finished. */
+			std::condition_variable m_Changed;
+			
+			std::vector<std::shared_ptr<Job>> m_Continuations;
+			
+			/** @brief Jobs which must finish before this job may start. Immutable once the job is scheduled. */
+			std::vector<std::weak_ptr<Job>> m_Dependencies;
+		
+		public:
+			
+			Job(std::function<void()>&& _task, const Priority& _priority, Utils::CancellationToken* _cancellationToken) noexcept :
+				m_Task(std::move(_task)),
+				m_Priority(_priority),
+				m_CancellationToken(_cancellationToken),
+				m_Pending(1U),
+				m_Done(false),
+				m_Claimed(false) {}
+			
+			/**
+			 * @brief Returns true if the job has finished executing, or was skipped due to cancellation.
+			 */
+			[[nodiscard]] bool Done() const noexcept {
+				return m_Done.load(std::memory_order_acquire);
+			}
+		};
+		
+		using Handle = std::shared_ptr<Job>;
+		
+		/**
+		 * @class Task
+		 * @brief Move-only future of a job scheduled using JobSystem::Async().
+		 *
+		 * @details Mirrors the subset of std::future used by the engine. Like a std::future returned by std::async(),
+		 *          a Task waits for its job to finish when destroyed, so the job may safely reference the caller's state.
+		 *          Unlike std::future, waiting on a Task runs its job on the calling thread if it has not yet started.
+		 */
+		template <typename T>
+		class Task final {
+			
+			friend JobSystem;
+		
+		private:
+			
+			std::future<T> m_Future;
+			
+			Handle m_Job;
+			
+			Task(std::future<T>&& _future, Handle _job) noexcept :
+				m_Future(std::move(_future)),
+				m_Job(std::move(_job)) {}
+		
+		public:
+			
+			Task() noexcept = default;
+			
+			Task(const Task& _other) = delete;
+			Task& operator = (const Task& _other) = delete;
+			
+			Task(Task&& _other) noexcept = default;
+			
+			Task& operator = (Task&& _other) noexcept {
+				
+				if (this != &_other) {
+					wait();
+					
+					m_Future = std::move(_other.m_Future);
+					m_Job    = std::move(_other.m_Job);
+				}
+				
+				return *this;
+			}
+			
+			~Task() {
+				wait();
+			}
+			
+			/** @brief Returns true if the Task refers to a job. */
+			[[nodiscard]] bool valid() const noexcept {
+				return m_Future.valid();
+			}
+			
+			/** @brief Waits for the job to finish. @see JobSystem::Wait() */
+			void wait() const {
+				
+				if (m_Future.valid()) {
+					JobSystem::Wait(m_Job);
+				}
+			}
+			
+			/** @brief Waits for, and then returns the result of the job. */
+			T get() {
+				
+				wait();
+				
+				return m_Future.get();
+			}
+			
+			/** @brief Non-blocking equivalent of std::future::wait_for(). */
+			template <typename Rep, typename Period>
+			[[nodiscard]] std::future_status wait_for(const std::chrono::duration<Rep, Period>& _duration) const {
+				return m_Future.wait_for(_duration);
+			}
+		};
+	
+	private:
+		
+		static constexpr size_t s_PriorityCount = 3U;
+		static constexpr size_t s_NoWorker      = std::numeric_limits<size_t>::max();
+		
+		struct Worker final {
+			
+			std::mutex m_Lock;
+			
+			std::array<std::deque<Handle>, s_PriorityCount> m_Queues;
+			
+			std::thread m_Thread;
+		};
+		
+		inline static std::vector<std::unique_ptr<Worker>> s_Workers;
+		
+		inline static std::mutex s_InitLock;
+		
+		inline static std::atomic<bool> s_Running { false };
+		inline static std::atomic<bool> s_Stopping { false };
+		
+		/** @brief Number of jobs currently sitting in a queue. */
+		inline static std::atomic<size_t> s_Queued { 0U };
+		
+		/** @brief Round-robin counter used to distribute jobs submitted by non-worker threads. */
+		inline static std::atomic<size_t> s_Next { 0U };
+		
+		inline static std::mutex              s_SleepLock;
+		inline static std::condition_variable s_Wake;
+		
+		/** @brief Index of the worker owning the current thread, or s_NoWorker. */
+		inline static thread_local size_t s_WorkerIndex { s_NoWorker };
+		
+		/** @brief Number of jobs executing on the current thread, including jobs run inline while waiting. */
+		inline static thread_local size_t s_Depth { 0U };
+		
+		static void Enqueue(const Handle& _job) {
+			
+			const auto count = s_Workers.size();
+			
+			auto index = s_WorkerIndex;
+			if (index == s_NoWorker || index >= count) {
+				index = s_Next.fetch_add(1U, std::memory_order_relaxed) % count;
+			}
+			
+			{
+				auto& worker = *s_Workers[index];
+				
+				const std::lock_guard<std::mutex> lock(worker.m_Lock);
+				
+				worker.m_Queues[_job->m_Priority].emplace_back(_job);
+			}
+			
+			s_Queued.fetch_add(1U, std::memory_order_release);
+			
+			// Synchronise with the sleep predicate to avoid a lost wakeup.
+			{ const std::lock_guard<std::mutex> lock(s_SleepLock); }
+			
+			s_Wake.notify_one();
+		}
+		
+		/**
+		 * @brief Pops the next job for the given worker, stealing from other workers if necessary.
+		 * @param[in] _index Index of the calling worker, or s_NoWorker if called from outside the pool.
+		 * @param[in] _lowest The lowest priority to consider.
+		 */
+		static Handle TryPop(const size_t& _index, const Priority& _lowest = Streaming) {
+			
+			Handle result;
+			
+			while (s_Queued.load(std::memory_order_acquire) != 0U) {
+				
+				const auto count = s_Workers.size();
+				
+				for (size_t p = 0U; p <= _lowest && result == nullptr; ++p) {
+					
+					// Own queue (newest first):
+					if (_index < count) {
+						
+						auto& worker = *s_Workers[_index];
+						
+						const std::lock_guard<std::mutex> lock(worker.m_Lock);
+						
+						if (auto& queue = worker.m_Queues[p]; !queue.empty()) {
+							result = std::move(queue.back());
+							queue.pop_back();
+						}
+					}
+					
+					// Steal (oldest first):
+					for (size_t i = 1U; i <= count && result == nullptr; ++i) {
+						
+						const auto victim = (_index < count ? _index + i : i) % count;
+						
+						if (victim != _index) {
+							
+							auto& worker = *s_Workers[victim];
+							
+							const std::lock_guard<std::mutex> lock(worker.m_Lock);
+							
+							if (auto& queue = worker.m_Queues[p]; !queue.empty()) {
+								result = std::move(queue.front());
+								queue.pop_front();
+							}
+						}
+					}
+				}
+				
+				if (result == nullptr) {
+					break;
+				}
+				
+				s_Queued.fetch_sub(1U, std::memory_order_acq_rel);
+				
+				// Discard jobs which a waiting thread has already run inline.
+				if (!result->m_Claimed.exchange(true, std::memory_order_acq_rel)) {
+					break;
+				}
+				
+				result = nullptr;
+			}
+			
+			return result;
+		}
+		
+		/** @brief Decrements the pending count of a job, enqueueing it if it is ready. */
+		static void Release(const Handle& _job) {
+			
+			if (_job->m_Pending.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+				Enqueue(_job);
+				
+				// Synchronise with the predicate in Wait() to avoid a lost wakeup.
+				{ const std::lock_guard<std::mutex> lock(_job->m_Lock); }
+				
+				_job->m_Changed.notify_all();
+			}
+		}
+		
+		static void Execute(const Handle& _job) {
+			
+			++s_Depth;
+			
+			try {
+				
+				if (_job->m_CancellationToken == nullptr || !_job->m_CancellationToken->IsCancellationRequested()) {
+					_job->m_Task();
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+			
+			--s_Depth;
+			
+			// Release captured state as soon as possible.
+			_job->m_Task = nullptr;
+			
+			std::vector<Handle> continuations;
+			{
+				const std::lock_guard<std::mutex> lock(_job->m_Lock);
+				
+				_job->m_Done.store(true, std::memory_order_release);
+				
+				continuations.swap(_job->m_Continuations);
+			}
+			
+			_job->m_Changed.notify_all();
+			
+			for (const auto& continuation : continuations) {
+				Release(continuation);
+			}
+		}
+		
+		/**
+		 * @brief Runs a job on the calling thread if it is ready and has not yet started. Otherwise, does the same for
+		 *        the first of its unfinished dependencies which can be run.
+		 *
+		 * @param[in] _job The job being waited on.
+		 * @return True if a job was executed.
+		 */
+		static bool Claim(const Handle& _job) {
+			
+			bool result = false;
+			
+			if (_job != nullptr && !_job->Done()) {
+				
+				if (_job->m_Pending.load(std::memory_order_acquire) == 0U) {
+					
+					// The job may still be sitting in a queue, in which case TryPop() discards it.
+					if (!_job->m_Claimed.exchange(true, std::memory_order_acq_rel)) {
+						Execute(_job);
+						
+						result = true;
+					}
+				}
+				else {
+					
+					for (const auto& dependency : _job->m_Dependencies) {
+						
+						if (Claim(dependency.lock())) {
+							result = true;
+							
+							break;
+						}
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		static void Run(const size_t _index) {
+			
+			s_WorkerIndex = _index;
+			
+			while (true) {
+				
+				if (const auto job = TryPop(_index)) {
+					Execute(job);
+				}
+				else {
+					
+					std::unique_lock<std::mutex> lock(s_SleepLock);
+					
+					s_Wake.wait(lock, []() {
+						return s_Queued.load(std::memory_order_acquire) != 0U || s_Stopping.load(std::memory_order_acquire);
+					});
+					
+					// Drain remaining work before exiting so that no future is left unsatisfied.
+					if (s_Stopping && s_Queued.load(std::memory_order_acquire) == 0U) {
+						break;
+					}
+				}
+			}
+			
+			s_WorkerIndex = s_NoWorker;
+		}
+	
+	public:
+		
+		JobSystem()                                    = delete;
+		JobSystem(const JobSystem& _other)             = delete;
+		JobSystem& operator = (const JobSystem& _other) = delete;
+		
+		/**
+		 * @brief Starts the worker pool.
+		 *
+		 * @param[in] _workers Number of workers. Defaults to one less than the number of hardware threads, leaving a core for the main thread.
+		 *
+		 * @note Has no effect if the pool is already running.
+		 */
+		static void Init(size_t _workers = 0U) {
+			
+			const std::lock_guard<std::mutex> lock(s_InitLock);
+			
+			if (!s_Running) {
+				
+				if (_workers == 0U) {
+					_workers = std::max<size_t>(std::thread::hardware_concurrency(), 2U) - 1U;
+				}
+				
+				s_Stopping = false;
+				
+				s_Workers.clear();
+				s_Workers.reserve(_workers);
+				
+				for (size_t i = 0U; i < _workers; ++i) {
+					s_Workers.emplace_back(std::make_unique<Worker>());
+				}
+				
+				for (size_t i = 0U; i < _workers; ++i) {
+					s_Workers[i]->m_Thread = std::thread(&JobSystem::Run, i);
+				}
+				
+				s_Running = true;
+				
+				Debug::Log("JobSystem started with (" + std::to_string(_workers) + ") worker(s).", Info);
+			}
+		}
+		
+		/**
+		 * @brief Finishes all queued work and joins the worker pool.
+		 * @note Jobs whose dependencies never complete are discarded. Jobs may not be scheduled from outside the pool
+		 *       once disposal has begun.
+		 */
+		static void Dispose() noexcept {
+			
+			try {
+				
+				const std::lock_guard<std::mutex> lock(s_InitLock);
+				
+				if (s_Running) {
+					
+					{
+						const std::lock_guard<std::mutex> sleep(s_SleepLock);
+						
+						s_Stopping = true;
+					}
+					
+					s_Wake.notify_all();
+					
+					for (auto& worker : s_Workers) {
+						
+						if (worker->m_Thread.joinable()) {
+							worker->m_Thread.join();
+						}
+					}
+					
+					s_Workers.clear();
+					
+					s_Running = false;
+				}
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+		}
+		
+		/**
+		 * @brief Returns the number of worker threads in the pool.
+		 */
+		[[nodiscard]] static size_t WorkerCount() noexcept {
+			return s_Workers.size();
+		}
+		
+		/**
+		 * @brief Returns true if the calling thread is a worker of the pool.
+		 */
+		[[nodiscard]] static bool IsWorker() noexcept {
+			return s_WorkerIndex != s_NoWorker;
+		}
+		
+		/**
+		 * @brief Schedules a job.
+		 *
+		 * @param[in] _task The work to execute.
+		 * @param[in] _priority The priority of the job.
+		 * @param[in] _cancellationToken (Optional) If cancellation is requested before the job starts, the job is skipped.
+		 * @param[in] _dependencies (Optional) Jobs which must finish before this job may start.
+		 * @return A handle to the job, which may be waited on or used as a dependency.
+		 *
+		 * @throws std::runtime_error If called from outside the pool after Dispose(), rather than restarting the pool.
+		 */
+		static Handle Schedule(std::function<void()>&& _task, const Priority& _priority = Normal, Utils::CancellationToken* _cancellationToken = nullptr, const std::vector<Handle>& _dependencies = {}) {
+			
+			// Workers may still schedule continuations while the pool drains.
+			if (s_Stopping.load(std::memory_order_acquire) && s_WorkerIndex == s_NoWorker) {
+				throw std::runtime_error("JobSystem has been disposed!");
+			}
+			
+			if (!s_Running) {
+				Init();
+			}
+			
+			auto result = std::make_shared<Job>(std::move(_task), _priority, _cancellationToken);
+			
+			for (const auto& dependency : _dependencies) {
+				
+				if (dependency != nullptr) {
+					
+					const std::lock_guard<std::mutex> lock(dependency->m_Lock);
+					
+					if (!dependency->Done()) {
+						result->m_Pending.fetch_add(1U, std::memory_order_relaxed);
+						result->m_Dependencies.emplace_back(dependency);
+						
+						dependency->m_Continuations.emplace_back(result);
+					}
+				}
+			}
+			
+			Release(result);
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Schedules a job to run once another has finished.
+		 * @see Schedule()
+		 */
+		static Handle Then(const Handle& _job, std::function<void()>&& _task, const Priority& _priority = Normal, Utils::CancellationToken* _cancellationToken = nullptr) {
+			return Schedule(std::move(_task), _priority, _cancellationToken, { _job });
+		}
+		
+		/**
+		 * @brief Schedules a job returning a value.
+		 *
+		 * @note If the job is skipped due to cancellation, retrieving its result throws std::future_error (broken promise).
+		 *
+		 * @see Schedule()
+		 */
+		template <typename F, typename R = std::invoke_result_t<std::decay_t<F>>>
+		static Task<R> Async(F&& _task, const Priority& _priority = Normal, Utils::CancellationToken* _cancellationToken = nullptr, const std::vector<Handle>& _dependencies = {}) {
+			
+			// std::function requires a copyable target, so share the packaged_task.
+			auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(_task));
+			
+			auto future = task->get_future();
+			
+			return Task<R>(std::move(future), Schedule([task]() { (*task)(); }, _priority, _cancellationToken, _dependencies));
+		}
+		
+		/**
+		 * @brief Executes one pending job on the calling thread, if any.
+		 *
+		 * @note Only threads outside the pool (i.e. the main thread) help, and only with Gameplay jobs, so that waiting
+		 *       never picks up long-running streaming work. Workers never run unrelated jobs in the middle of another,
+		 *       which could re-enter locks held by the waiting job, or recurse without bound.
+		 *
+		 * @return True if a job was executed.
+		 */
+		static bool Help() {
+			
+			bool result = false;
+			
+			if (s_Running && s_WorkerIndex == s_NoWorker && s_Depth == 0U) {
+				
+				if (const auto job = TryPop(s_NoWorker, Gameplay)) {
+					Execute(job);
+					
+					result = true;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Waits for a job to finish.
+		 *
+		 * @details If the job, or one of its unfinished dependencies, has not yet started, it is run on the calling thread.
+		 *          Otherwise, the calling thread helps with pending work as described by Help(), and blocks while there is none.
+		 */
+		static void Wait(const Handle& _job) {
+			
+			if (_job != nullptr) {
+				
+				while (!_job->Done()) {
+					
+					if (!Claim(_job) && !Help()) {
+						
+						/*
+						 * Block until the job finishes, or becomes ready to be claimed. The job may be queued on this worker,
+						 * so it must not only wait for completion. Waking periodically retries the job's dependencies and
+						 * picks up new work, as in Wait(const std::future<T>&).
+						 */
+						std::unique_lock<std::mutex> lock(_job->m_Lock);
+						
+						(void)_job->m_Changed.wait_for(lock, std::chrono::microseconds(500), [&_job]() {
+							
+							return _job->m_Done.load(std::memory_order_acquire) || (
+								_job->m_Pending.load(std::memory_order_acquire) == 0U &&
+								!_job->m_Claimed.load(std::memory_order_acquire)
+							);
+						});
+					}
+				}
+			}
+		}
+		
+		/**
+		 * @brief Waits for a future to become ready, helping with pending work in the meantime.
+		 * @see Help()
+		 */
+		template <typename T>
+		static void Wait(const std::future<T>& _future) {
+			
+			while (Utils::Status(_future) != std::future_status::ready) {
+				
+				if (!Help()) {
+					(void)_future.wait_for(std::chrono::microseconds(500));
+				}
+			}
+		}
+		
+		/**
+		 * @brief Waits for a task to finish or until a timeout occurs, with support for cancellation.
+		 *
+		 * @details Equivalent to Threading::Utils::Wait(), except that the task's job is run on the calling thread if it
+		 *          has not yet started, as no other thread could finish it sooner. Once started inline, it runs to completion.
+		 *
+		 * @param[in,out] _task The Task to wait for.
+		 * @param[in] _timeout The maximum duration to wait for the task to complete.
+		 * @param[in,out] _cancellationToken The CancellationToken object used to check for cancellation.
+		 * @return The status of the task at the time of returning.
+		 */
+		template <typename T>
+		static std::future_status Wait(Task<T>& _task, const std::chrono::system_clock::duration& _timeout, Utils::CancellationToken& _cancellationToken) {
+			
+			std::future_status result;
+			
+			const auto end = std::chrono::system_clock::now() + _timeout;
+			
+			do {
+				result = _task.wait_for(std::chrono::seconds(0));
+				
+				if (result == std::future_status::ready) {
+					break;
+				}
+				
+				if (Claim(_task.m_Job)) {
+					
+					// The job ran inline, so is ready even if the timeout has since elapsed.
+					result = _task.wait_for(std::chrono::seconds(0));
+				}
+				else if (!Help()) {
+					(void)_task.wait_for(std::chrono::microseconds(500));
+				}
+			}
+			while (!_cancellationToken.IsCancellationRequested() && std::chrono::system_clock::now() < end);
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson::Engine::Threading
+
+#endif //FINALYEARPROJECT_JOBSYSTEM_HPP
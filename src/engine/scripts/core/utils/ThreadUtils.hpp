@@ -1,37 +1,210 @@
 #ifndef FINALYEARPROJECT_THREADUTILS_HPP
 #define FINALYEARPROJECT_THREADUTILS_HPP
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <functional>
 #include <future>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace LouiEriksson::Engine::Threading {
 
 	struct Utils final {
 		
 		/**
-		 * @brief Dispatcher for scheduling and dispatching tasks in a synchronized manner.
+		 * @brief Dispatcher for scheduling tasks from any thread and dispatching them on a single (usually the main) thread.
+		 *
+		 * @details Each priority class is a lock-free, multi-producer single-consumer queue, so producers never block
+		 *          while the consumer executes tasks. Higher priority classes are always drained first.
+		 *
+		 * @note Dispatch() must only be called from one thread at a time. Live dispatchers are registered by name, so that
+		 *       their statistics can be inspected using Snapshot().
 		 */
 		struct Dispatcher final {
 		
+		public:
+			
+			/**
+			 * @brief Priority class of a scheduled task.
+			 */
+			enum Priority : unsigned char {
+				High   = 0U, /**< @brief Time-sensitive tasks, such as updating existing objects. */
+				Normal = 1U, /**< @brief Default priority.                                         */
+				Low    = 2U, /**< @brief Bulk work, such as creating many objects.                 */
+			};
+			
+			/**
+			 * @brief Counters describing the most recent call to Dispatch().
+			 */
+			struct Statistics final {
+				
+				size_t m_Dispatched { 0U }; /**< @brief Number of tasks executed.                   */
+				size_t m_Pending    { 0U }; /**< @brief Number of tasks remaining in the queue.     */
+				
+				std::chrono::nanoseconds m_Elapsed { 0 }; /**< @brief Time spent executing tasks. */
+			};
+			
 		private:
 			
-			std::mutex m_Lock;
+			/** @brief Guards the registry of live dispatchers, and the statistics they publish. */
+			inline static std::mutex s_Lock;
+			
+			inline static std::vector<const Dispatcher*> s_Instances;
+			
+			struct Node final {
+				
+				std::atomic<Node*> m_Next { nullptr };
+				
+				std::function<void()> m_Task;
+			};
+			
+			/**
+			 * @brief Unbounded MPSC queue (D. Vyukov). Producers swap the head, the consumer advances the tail past a stub.
+			 */
+			struct Queue final {
+				
+				std::atomic<Node*> m_Head;
+				
+				Node* m_Tail;
+				
+				Queue() : m_Head(new Node()), m_Tail(m_Head.load()) {}
+				
+				Queue(const Queue& _other) = delete;
+				Queue& operator = (const Queue& _other) = delete;
+				
+				~Queue() {
+					
+					while (m_Tail != nullptr) {
+						delete std::exchange(m_Tail, m_Tail->m_Next.load(std::memory_order_relaxed));
+					}
+				}
+				
+				void Push(std::function<void()>&& _task) {
+					
+					auto* node = new Node();
+					node->m_Task = std::move(_task);
+					
+					m_Head.exchange(node, std::memory_order_acq_rel)->m_Next.store(node, std::memory_order_release);
+				}
+				
+				bool TryPop(std::function<void()>& _task) {
+					
+					bool result = false;
+					
+					if (auto* next = m_Tail->m_Next.load(std::memory_order_acquire)) {
+						
+						_task = std::move(next->m_Task);
+						
+						delete std::exchange(m_Tail, next);
+						
+						result = true;
+					}
+					
+					return result;
+				}
+			};
+			
+			std::array<Queue, 3U> m_Queues;
 			
-			std::queue<std::function<void()>> m_Tasks;
+			std::atomic<size_t> m_Pending { 0U };
+			
+			std::string m_Name;
+			
+			Statistics m_Statistics;
+			
+			bool TryPop(std::function<void()>& _task) {
+				
+				bool result = false;
+				
+				for (auto& queue : m_Queues) {
+					
+					if (queue.TryPop(_task)) {
+						
+						m_Pending.fetch_sub(1U, std::memory_order_relaxed);
+						
+						result = true;
+						
+						break;
+					}
+				}
+				
+				return result;
+			}
+			
+			template <typename Predicate>
+			void DispatchWhile(const Predicate& _continue) {
+				
+				const auto start = std::chrono::steady_clock::now();
+				
+				size_t dispatched = 0U;
+				
+				std::function<void()> task;
+				
+				while (_continue(dispatched, start) && TryPop(task)) {
+					
+					++dispatched;
+					
+					task();
+				}
+				
+				const auto elapsed = std::chrono::steady_clock::now() - start;
+				
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				m_Statistics.m_Dispatched = dispatched;
+				m_Statistics.m_Pending    = m_Pending.load(std::memory_order_relaxed);
+				m_Statistics.m_Elapsed    = elapsed;
+			}
 		
 		public:
 			
+			/**
+			 * @brief Initialises a new Dispatcher.
+			 * @param[in] _name Name under which the dispatcher's statistics are reported.
+			 */
+			explicit Dispatcher(std::string _name = "Dispatcher") :
+				m_Name(std::move(_name))
+			{
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				s_Instances.emplace_back(this);
+			}
+			
+			Dispatcher(const Dispatcher& _other) = delete;
+			Dispatcher& operator = (const Dispatcher& _other) = delete;
+			
+			~Dispatcher() {
+				
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				for (auto& instance : s_Instances) {
+					
+					if (instance == this) {
+						instance = s_Instances.back();
+						
+						s_Instances.pop_back();
+						
+						break;
+					}
+				}
+			}
+			
 			/**
 			 * @brief Schedule a task by adding it to the task queue.
 			 *
 			 * @param[in] _task The task to be scheduled.
+			 * @param[in] _priority (Optional) The priority class of the task.
 			 */
-			void Schedule(std::function<void()>&& _task) {
+			void Schedule(std::function<void()>&& _task, const Priority& _priority = Normal) {
 				
-				std::lock_guard<std::mutex> lock(m_Lock);
+				m_Pending.fetch_add(1U, std::memory_order_relaxed);
 				
-				m_Tasks.emplace(_task);
+				m_Queues[_priority].Push(std::move(_task));
 			}
 			
 			/**
@@ -41,15 +214,59 @@ namespace LouiEriksson::Engine::Threading {
 			 */
 			void Dispatch(const size_t& _count = 1) {
 				
-				std::lock_guard<std::mutex> lock(m_Lock);
+				DispatchWhile([&_count](const size_t& _dispatched, const std::chrono::steady_clock::time_point&) {
+					return _dispatched < _count;
+				});
+			}
+			
+			/**
+			 * @brief Dispatches tasks from the task queue until the time budget is exhausted.
+			 *
+			 * @param[in] _budget The wall-clock time available for executing tasks.
+			 *
+			 * @note At least one task is dispatched (if available), so a budget smaller than a single task cannot stall the queue.
+			 */
+			template <typename Rep, typename Period>
+			void Dispatch(const std::chrono::duration<Rep, Period>& _budget) {
 				
-				for (size_t i = 0; i < _count; ++i) {
-					
-					if (!m_Tasks.empty()) {
-						m_Tasks.front()();
-						m_Tasks.pop();
-					}
+				DispatchWhile([&_budget](const size_t& _dispatched, const std::chrono::steady_clock::time_point& _start) {
+					return _dispatched == 0U || std::chrono::steady_clock::now() - _start < _budget;
+				});
+			}
+			
+			/**
+			 * @brief Returns the number of tasks waiting to be dispatched.
+			 */
+			[[nodiscard]] size_t Pending() const noexcept {
+				return m_Pending.load(std::memory_order_relaxed);
+			}
+			
+			/**
+			 * @brief Returns counters describing the most recent call to Dispatch().
+			 */
+			[[nodiscard]] Statistics Stats() const {
+				
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				return m_Statistics;
+			}
+			
+			/**
+			 * @brief Returns the name and most recent statistics of every live Dispatcher.
+			 * @note Safe to call from any thread.
+			 */
+			[[nodiscard]] static std::vector<std::pair<std::string, Statistics>> Snapshot() {
+				
+				const std::lock_guard<std::mutex> lock(s_Lock);
+				
+				std::vector<std::pair<std::string, Statistics>> result;
+				result.reserve(s_Instances.size());
+				
+				for (const auto* const instance : s_Instances) {
+					result.emplace_back(instance->m_Name, instance->m_Statistics);
 				}
+				
+				return result;
 			}
 		};
 		
@@ -13,7 +13,10 @@
 
 #include <json.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cctype>
+#include <charconv>
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
@@ -25,6 +28,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <vector>
 
@@ -335,6 +339,70 @@ namespace LouiEriksson::Engine {
 			
 		}
 		
+		/**
+		 * @brief Parses the leading number of a string using std::from_chars.
+		 *
+		 * @details Leading whitespace and a leading '+' are skipped, matching the behaviour of the strto* family.
+		 *          Unlike strto*, the string does not need to be null-terminated.
+		 *
+		 * @tparam T The arithmetic type to parse.
+		 * @param[in] _str The string to parse.
+		 * @param[out] _value The parsed value. Only valid if parsing succeeded.
+		 * @return A pointer to the first character not consumed, or _str.data() if parsing failed.
+		 */
+		template <typename T>
+		static const char* FromChars(const std::string_view& _str, T& _value) noexcept {
+			
+			const char* result = _str.data();
+			
+			const auto* first = _str.data();
+			const auto* last  = _str.data() + _str.size();
+			
+			while (first != last && std::isspace(static_cast<unsigned char>(*first)) != 0) { ++first; }
+			
+			if (first != last && *first == '+' && (first + 1) != last && *(first + 1) != '-') { ++first; }
+			
+			if constexpr (std::is_floating_point_v<T>) {
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+				
+				const auto [ptr, ec] = std::from_chars(first, last, _value);
+				
+				if (ec == std::errc()) {
+					result = ptr;
+				}
+#else
+				// Floating-point std::from_chars is unavailable, so copy to a null-terminated buffer for strto*.
+				std::array<char, 128U> buffer {};
+				
+				const auto length = std::min(static_cast<size_t>(last - first), buffer.size() - 1U);
+				
+				std::copy(first, first + length, buffer.begin());
+				
+				char* e = nullptr;
+				
+				     if constexpr (std::is_same_v<T, float >) { _value = std::strtof(buffer.data(), &e); }
+				else if constexpr (std::is_same_v<T, double>) { _value = std::strtod(buffer.data(), &e); }
+				else                                          { _value = std::strtold(buffer.data(), &e); }
+				
+				if (e != buffer.data()) {
+					result = first + (e - buffer.data());
+				}
+#endif
+			
+			}
+			else {
+				
+				const auto [ptr, ec] = std::from_chars(first, last, _value, 10);
+				
+				if (ec == std::errc()) {
+					result = ptr;
+				}
+			}
+			
+			return result;
+		}
+		
 		/**
 		 * @brief Attempts to parse a string into an optional value of type T.
 		 *
@@ -353,23 +421,11 @@ namespace LouiEriksson::Engine {
 			
 			T r;
 			
-		    char* e          = nullptr; // (end)
-			constexpr auto b = 10;      // (base)
+			const char* e = nullptr; // (end)
 			
 			try {
 				
-				     if constexpr (std::is_same_v<T, int                >) { r = static_cast<T>(std::strtol  (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, short              >) { r = static_cast<T>(std::strtol  (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, long               >) { r =                std::strtol  (_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, long long          >) { r =                std::strtoll (_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, unsigned int       >) { r = static_cast<T>(std::strtoul (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, unsigned short     >) { r = static_cast<T>(std::strtoul (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, unsigned long      >) { r =                std::strtoul (_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, unsigned long long >) { r =                std::strtoull(_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, float              >) { r =                std::strtof  (_str.data(), &e    ); }
-				else if constexpr (std::is_same_v<T, double             >) { r =                std::strtod  (_str.data(), &e    ); }
-				else if constexpr (std::is_same_v<T, long double        >) { r =                std::strtold (_str.data(), &e    ); }
-				else if constexpr (std::is_same_v<T, char         > ||
+				     if constexpr (std::is_same_v<T, char         > ||
 				                   std::is_same_v<T, unsigned char> ||
 								   std::is_same_v<T, signed char  > ||
 						           std::is_same_v<T, char16_t     > ||
@@ -380,12 +436,15 @@ namespace LouiEriksson::Engine {
 			            r = static_cast<T>(_str[0U]);
 					}
 					else {
-						e = const_cast<char*>(_str.data());
+						e = _str.data();
 					}
 				}
 				else if constexpr (std::is_same_v<T, bool>) {
 			        r = _str == "true" || _str == "True" || _str == "TRUE" || _str == "T" || _str == "1";
 				}
+				else if constexpr (std::is_arithmetic_v<T>) {
+					e = FromChars(_str, r);
+				}
 				else {
 					static_assert([]{ return false; }(), "No specialisation exists for parsing string to T");
 				}
@@ -394,7 +453,7 @@ namespace LouiEriksson::Engine {
 				
 				/* Shouldn't ever happen but catch anyway... */
 				
-				e = const_cast<char*>(_str.data());
+				e = _str.data();
 				
 				Debug::Log(err);
 				Debug::Break();
@@ -423,21 +482,9 @@ namespace LouiEriksson::Engine {
 			
 			T r;
 			
-		    char* e          = nullptr; // (end)
-			constexpr auto b = 10;      // (base)
-			
-			     if constexpr (std::is_same_v<T, int                >) { r = static_cast<T>(std::strtol  (_str.data(), &e, b)); }
-			else if constexpr (std::is_same_v<T, short              >) { r = static_cast<T>(std::strtol  (_str.data(), &e, b)); }
-			else if constexpr (std::is_same_v<T, long               >) { r =                std::strtol  (_str.data(), &e, b ); }
-			else if constexpr (std::is_same_v<T, long long          >) { r =                std::strtoll (_str.data(), &e, b ); }
-			else if constexpr (std::is_same_v<T, unsigned int       >) { r = static_cast<T>(std::strtoul (_str.data(), &e, b)); }
-			else if constexpr (std::is_same_v<T, unsigned short     >) { r = static_cast<T>(std::strtoul (_str.data(), &e, b)); }
-			else if constexpr (std::is_same_v<T, unsigned long      >) { r =                std::strtoul (_str.data(), &e, b ); }
-			else if constexpr (std::is_same_v<T, unsigned long long >) { r =                std::strtoull(_str.data(), &e, b ); }
-			else if constexpr (std::is_same_v<T, float              >) { r =                std::strtof  (_str.data(), &e    ); }
-			else if constexpr (std::is_same_v<T, double             >) { r =                std::strtod  (_str.data(), &e    ); }
-			else if constexpr (std::is_same_v<T, long double        >) { r =                std::strtold (_str.data(), &e    ); }
-			else if constexpr (std::is_same_v<T, char         > ||
+			const char* e = nullptr; // (end)
+			
+			     if constexpr (std::is_same_v<T, char         > ||
 			                   std::is_same_v<T, unsigned char> ||
 							   std::is_same_v<T, signed char  > ||
 					           std::is_same_v<T, char16_t     > ||
@@ -448,12 +495,15 @@ namespace LouiEriksson::Engine {
 		            r = static_cast<T>(_str[0U]);
 				}
 				else {
-					e = const_cast<char*>(_str.data());
+					e = _str.data();
 				}
 			}
 			else if constexpr (std::is_same_v<T, bool>) {
 		        r = _str == "true" || _str == "True" || _str == "TRUE" || _str == "t" || _str == "T" || _str == "1";
 			}
+			else if constexpr (std::is_arithmetic_v<T>) {
+				e = FromChars(_str, r);
+			}
 			else {
 				static_assert([]{ return false; }(), "No specialisation exists for parsing string to T");
 			}
@@ -0,0 +1,104 @@
+#ifndef FINALYEARPROJECT_ACCESS_HPP
+#define FINALYEARPROJECT_ACCESS_HPP
+
+#include <algorithm>
+#include <typeindex>
+#include <vector>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	/**
+	 * @class Access
+	 * @brief Declaration of the types of data a Script reads and writes while ticking.
+	 *
+	 * @details Types are usually Components (e.g. Transform), but any type may be used to stand for shared state (e.g. a Settings struct).
+	 *          Two Scripts conflict if either writes a type the other reads or writes, and conflicting Scripts never run at the same time.
+	 *          State owned by the Script itself does not need to be declared.
+	 *
+	 * @see Scheduler
+	 */
+	class Access final {
+	
+	private:
+		
+		std::vector<std::type_index> m_Reads;
+		std::vector<std::type_index> m_Writes;
+		
+		bool m_Exclusive;
+		bool m_MainThread;
+		
+		static bool Overlaps(const std::vector<std::type_index>& _a, const std::vector<std::type_index>& _b) noexcept {
+			
+			return std::any_of(_a.begin(), _a.end(), [&_b](const std::type_index& _type) {
+				return std::find(_b.begin(), _b.end(), _type) != _b.end();
+			});
+		}
+	
+	public:
+		
+		/** @brief Creates an Access which reads and writes nothing, and may run on any thread. */
+		Access() noexcept :
+			m_Exclusive (false),
+			m_MainThread(false) {}
+		
+		/**
+		 * @brief Returns an Access which may read and write anything, and runs on the main thread.
+		 * @note This is the default for Scripts which do not declare their dependencies.
+		 */
+		[[nodiscard]] static Access Exclusive() noexcept {
+			
+			Access result;
+			result.m_Exclusive  = true;
+			result.m_MainThread = true;
+			
+			return result;
+		}
+		
+		/** @brief Declares types which are read. */
+		template<typename... Ts>
+		Access& Read() {
+			
+			(m_Reads.emplace_back(typeid(Ts)), ...);
+			
+			return *this;
+		}
+		
+		/** @brief Declares types which are written. */
+		template<typename... Ts>
+		Access& Write() {
+			
+			(m_Writes.emplace_back(typeid(Ts)), ...);
+			
+			return *this;
+		}
+		
+		/**
+		 * @brief Requires the Script to run on the main thread (e.g. if it makes OpenGL, SDL, or OpenAL calls).
+		 * @note Main-thread Scripts still run alongside other Scripts they do not conflict with.
+		 */
+		Access& MainThread() noexcept {
+			
+			m_MainThread = true;
+			
+			return *this;
+		}
+		
+		/** @brief Returns true if the Script may read and write anything. */
+		[[nodiscard]] constexpr const bool& IsExclusive() const noexcept { return m_Exclusive; }
+		
+		/** @brief Returns true if the Script must run on the main thread. */
+		[[nodiscard]] constexpr const bool& IsMainThread() const noexcept { return m_MainThread; }
+		
+		/** @brief Returns true if Scripts with the two Accesses must not run at the same time. */
+		[[nodiscard]] bool Conflicts(const Access& _other) const noexcept {
+			
+			return m_Exclusive || _other.m_Exclusive ||
+				Overlaps(m_Writes, _other.m_Writes) ||
+				Overlaps(m_Writes, _other.m_Reads ) ||
+				Overlaps(m_Reads,  _other.m_Writes);
+		}
+	};
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_ACCESS_HPP
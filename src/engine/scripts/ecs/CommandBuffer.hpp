@@ -0,0 +1,143 @@
+#ifndef FINALYEARPROJECT_COMMANDBUFFER_HPP
+#define FINALYEARPROJECT_COMMANDBUFFER_HPP
+
+#include "../core/Debug.hpp"
+
+#include "GameObject.hpp"
+#include "Handle.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	class Scene;
+	
+	/**
+	 * @class CommandBuffer
+	 * @brief Records structural changes to a Scene, to be applied later on the main thread.
+	 *
+	 * @details Scripts which run in parallel must not create or remove GameObjects, or add or remove Components, directly.
+	 *          Instead, they record the change here, and the Scene applies it at the next sync point (after each phase of the tick).
+	 *          Commands are applied in the order they were recorded.
+	 *
+	 * @note Recording is thread-safe. Applying is not, and must happen on the main thread.
+	 * @see Scene::Commands()
+	 */
+	class CommandBuffer final {
+	
+	private:
+		
+		std::mutex m_Lock;
+		
+		std::vector<std::function<void(Scene&)>> m_Commands;
+	
+	public:
+		
+		CommandBuffer() = default;
+		
+		CommandBuffer(const CommandBuffer& _other) = delete;
+		CommandBuffer& operator = (const CommandBuffer& _other) = delete;
+		
+		/** @brief Records an arbitrary command. */
+		void Run(std::function<void(Scene&)>&& _command) {
+			
+			const std::lock_guard<std::mutex> lock(m_Lock);
+			
+			m_Commands.emplace_back(std::move(_command));
+		}
+		
+		/**
+		 * @brief Records the creation of a GameObject.
+		 *
+		 * @param[in] _name The name of the GameObject.
+		 * @param[in] _initialiser (Optional) Function called with the new GameObject (e.g. to add Components to it).
+		 */
+		void Create(const std::string& _name, std::function<void(GameObject&)>&& _initialiser = {});
+		
+		/** @brief Records the removal of a GameObject. */
+		void Remove(const std::string& _name);
+		
+		/**
+		 * @brief Records the addition of a Component to a GameObject.
+		 *
+		 * @param[in] _entity The GameObject. If it has been destroyed by the time the command is applied, the command is skipped.
+		 * @param[in] _initialiser (Optional) Function called with the new Component.
+		 */
+		template<typename T>
+		void AddComponent(const Entity& _entity, std::function<void(T&)>&& _initialiser = {}) {
+			
+			static_assert(std::is_base_of_v<Component, T>, "Provided type must derive from \"Component\".");
+			
+			Run([_entity, initialiser = std::move(_initialiser)]([[maybe_unused]] Scene& _scene) {
+				
+				if (auto* const entity = _entity.Get()) {
+					
+					if (const auto component = entity->AddComponent<T>()) {
+						
+						if (initialiser) {
+							initialiser(*component);
+						}
+					}
+				}
+			});
+		}
+		
+		/** @brief Records the removal of a Component from a GameObject. */
+		template<typename T>
+		void RemoveComponent(const Entity& _entity, const size_t& _index = 0U) {
+			
+			static_assert(std::is_base_of_v<Component, T>, "Provided type must derive from \"Component\".");
+			
+			Run([_entity, _index]([[maybe_unused]] Scene& _scene) {
+				
+				if (auto* const entity = _entity.Get()) {
+					entity->RemoveComponent<T>(_index);
+				}
+			});
+		}
+		
+		/**
+		 * @brief Applies, and then clears the recorded commands.
+		 * @note Commands recorded while applying are also applied.
+		 */
+		void Apply(Scene& _scene) {
+			
+			std::vector<std::function<void(Scene&)>> commands;
+			
+			while (true) {
+				
+				{
+					const std::lock_guard<std::mutex> lock(m_Lock);
+					
+					if (m_Commands.empty()) {
+						break;
+					}
+					
+					commands.swap(m_Commands);
+				}
+				
+				for (auto& command : commands) {
+					
+					try {
+						command(_scene);
+					}
+					catch (const std::exception& e) {
+						Debug::Log(e);
+					}
+				}
+				
+				commands.clear();
+			}
+		}
+	};
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_COMMANDBUFFER_HPP
@@ -3,7 +3,11 @@
 
 #include "../core/Debug.hpp"
 
+#include "Handle.hpp"
+
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <typeindex>
 
@@ -15,6 +19,7 @@ namespace LouiEriksson::Engine {
 namespace LouiEriksson::Engine::ECS {
 	
 	class GameObject;
+	class Storage;
 	
 	/**
 	 * @class Component
@@ -26,26 +31,57 @@ namespace LouiEriksson::Engine::ECS {
 	class Component {
 		
 		friend GameObject;
+		friend Storage;
+		
+		template<typename T>
+		friend class Handle;
 	
 	private:
 	
 		/** @brief Index of the component within its category in the Parent. Used for tidying up during destruction. */
 		size_t m_Index;
+		
+		/** @brief Category of the component in the Storage of its Scene. */
+		size_t m_Category;
+		
+		/** @brief Index of the component within its category in the Storage of its Scene. */
+		size_t m_Slot;
 	
 		/** @brief Parent GameObject that contains the component. */
 		std::weak_ptr<GameObject> m_GameObject;
 		
+		/** @brief Handle to the parent GameObject, set once the component is attached. */
+		Entity m_Owner;
+		
+		/** @brief Id of the component's slot, used by Handle. */
+		uint64_t m_Handle;
+		
 	protected:
 	
 		explicit Component(const std::weak_ptr<GameObject>& _parent) noexcept :
 			m_Index(0U),
-			m_GameObject(_parent)
+			m_Category(std::numeric_limits<size_t>::max()),
+			m_Slot    (std::numeric_limits<size_t>::max()),
+			m_GameObject(_parent),
+			m_Handle(Slots<Component>::Acquire(this))
 		{
 			Debug::Assert(!_parent.expired(), "Component initialised with no valid parent!", Warning);
 		}
 		
+		/** @brief Copies the Component. The copy is given its own Handle and is not attached. */
+		Component(const Component& _other) :
+			m_Index(0U),
+			m_Category(std::numeric_limits<size_t>::max()),
+			m_Slot    (std::numeric_limits<size_t>::max()),
+			m_GameObject(_other.m_GameObject),
+			m_Handle(Slots<Component>::Acquire(this)) {}
+		
+		Component& operator = (const Component& _other) = delete;
+		
 		/** @brief Invoked on finalisation of the Component. */
-		virtual ~Component() = default;
+		virtual ~Component() {
+			Slots<Component>::Release(m_Handle);
+		}
 	
 	public:
 		
@@ -68,6 +104,16 @@ namespace LouiEriksson::Engine::ECS {
 		[[nodiscard]] std::shared_ptr<GameObject> Parent() const noexcept {
 			return m_GameObject.lock();
 		}
+		
+		/**
+		 * @brief Get the Component's parent GameObject, without taking a reference to it.
+		 *
+		 * @return A pointer to the parent GameObject, or nullptr if it has been destroyed or the Component is not attached.
+		 * @note Prefer this to Parent() in code which runs every frame.
+		 */
+		[[nodiscard]] GameObject* Owner() const noexcept {
+			return m_Owner.Get();
+		}
 	};
 	
 } // LouiEriksson::Engine::ECS
@@ -4,10 +4,19 @@
 #include "../core/Script.hpp"
 #include "../core/utils/Hashmap.hpp"
 
+#include "Handle.hpp"
+#include "Storage.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 #include <utility>
@@ -25,12 +34,19 @@ namespace LouiEriksson::Engine::ECS {
 		
 		friend class Component;
 		friend class Scene;
+		friend Storage;
+		
+		template<typename T>
+		friend class Handle;
 	
 	private:
 	
 		/* @brief Whether or not the GameObject is active. */
 		bool m_Active;
 		
+		/** @brief Id of the GameObject's slot, used by Handle. */
+		uint64_t m_Handle;
+		
 		/** @brief Scene the Parent belongs to. */
 		std::weak_ptr<Scene> m_Scene;
 	
@@ -39,7 +55,38 @@ namespace LouiEriksson::Engine::ECS {
 	
 		/** @brief Components attached to the Parent. */
 		Hashmap<std::type_index, std::vector<std::shared_ptr<Component>>> m_Components;
-	
+		
+		/** @brief Storage holding the Components of the Scene the Parent belongs to. */
+		std::shared_ptr<Storage> m_Storage;
+		
+		/** @brief Selections the Parent has matches in, and the slot of each match. */
+		std::vector<std::pair<Storage::SelectionBase*, size_t>> m_Memberships;
+		
+		/**
+		 * @brief Removes the Components of the Parent from the Storage of its Scene.
+		 *
+		 * @details Called when the Parent is removed from its Scene, so that it is no longer visited by the Scene's systems
+		 *          even if references to it remain. Components added afterwards are not stored.
+		 */
+		void Unlink() noexcept {
+			
+			if (m_Storage != nullptr) {
+				
+				// Release the Storage first, so that the Parent is not matched again as its Components are removed.
+				const auto storage = std::move(m_Storage);
+				
+				for (const auto& kvp : m_Components) {
+					for (const auto& component : kvp.second) {
+						storage->Unregister(component.get());
+					}
+				}
+				
+				while (!m_Memberships.empty()) {
+					m_Memberships.front().first->Remove(*this);
+				}
+			}
+		}
+		
 		/**
 		 * @brief Attaches a component to the Parent.
 		 *
@@ -54,7 +101,9 @@ namespace LouiEriksson::Engine::ECS {
 			
 			static_assert(std::is_base_of<Component, T>::value, "Provided type must derive from \"Component\".");
 			
-			const auto* category = std::is_base_of<Script, T>::value ? &typeid(Script) : &typeid(T);
+			using category_t = std::conditional_t<std::is_base_of<Script, T>::value, Script, T>;
+			
+			const auto* category = &typeid(category_t);
 			
 			const auto existing = m_Components.Get(*category);
 			
@@ -70,6 +119,12 @@ namespace LouiEriksson::Engine::ECS {
 			else {
 				m_Components.Assign(*category, { _component });
 			}
+			
+			_component->m_Owner = Entity(*this);
+			
+			if (m_Storage != nullptr) {
+				m_Storage->Register(Storage::ID<category_t>(), _component.get(), this);
+			}
 		}
 		
 		template <typename T>
@@ -79,16 +134,34 @@ namespace LouiEriksson::Engine::ECS {
 			
 			const auto* category = std::is_base_of<Script, T>::value ? &typeid(Script) : &typeid(T);
 			
-			if (const auto entries = m_Components.Get(*category)) {
-	
-				// Bounds check.
-				if (_index < entries->size()) {
+			const auto existing = m_Components.Get(*category);
+			
+			// Bounds check.
+			if (existing.has_value() && _index < existing->size()) {
+				
+				auto bucket = existing.value();
+				
+				auto itr = bucket.begin() + static_cast<std::vector<std::shared_ptr<Component>>::difference_type>(_index);
+				
+				const auto component = *itr;
+				
+				// Remove component from collection.
+				bucket.erase(itr);
+				
+				if (bucket.empty()) {
+					m_Components.Remove(*category);
+				}
+				else {
 					
-					auto itr = entries->begin() + static_cast<std::vector<std::shared_ptr<Component>>::difference_type>(_index);
+					for (size_t i = _index; i < bucket.size(); ++i) {
+						bucket[i]->m_Index = i;
+					}
 					
-					// Remove component from collection.
-					const auto unsafe_collection = const_cast<std::vector<std::reference_wrapper<T>>>(entries);
-					unsafe_collection.get().erase(itr);
+					m_Components.Assign(*category, std::move(bucket));
+				}
+				
+				if (m_Storage != nullptr) {
+					m_Storage->Unregister(component.get());
 				}
 			}
 			else {
@@ -96,25 +169,51 @@ namespace LouiEriksson::Engine::ECS {
 			}
 		}
 		
-		GameObject(const std::weak_ptr<Scene>& _scene, std::string _name) noexcept :
+		GameObject(const std::weak_ptr<Scene>& _scene, std::shared_ptr<Storage> _storage, std::string _name) noexcept :
 			m_Active(true),
+			m_Handle(Slots<GameObject>::Acquire(this)),
 			m_Scene(_scene),
-			m_Name (std::move(_name)) {}
+			m_Name (std::move(_name)),
+			m_Storage(std::move(_storage)) {}
 		
 	public:
 	
 		GameObject(GameObject&& _other) noexcept :
 			m_Active    (std::move(_other.m_Active    )),
+			m_Handle    (std::exchange(_other.m_Handle, 0U)),
 			m_Scene     (std::move(_other.m_Scene     )),
 			m_Name      (std::move(_other.m_Name      )),
-			m_Components(std::move(_other.m_Components))
+			m_Components(std::move(_other.m_Components)),
+			m_Storage    (std::move(_other.m_Storage    )),
+			m_Memberships(std::move(_other.m_Memberships))
 		{
 			if (&_other != this) {
+				Slots<GameObject>::Rebind(m_Handle, this);
+				
 				_other.m_Scene.reset();
 				_other.m_Components.Clear();
+				
+				if (m_Storage != nullptr) {
+					
+					for (const auto& kvp : m_Components) {
+						for (const auto& component : kvp.second) {
+							m_Storage->Rebind(component.get(), this);
+						}
+					}
+					
+					for (const auto& [selection, slot] : m_Memberships) {
+						selection->Rebind(slot, this);
+					}
+				}
 			}
 		}
 		
+		~GameObject() {
+			Unlink();
+			
+			Slots<GameObject>::Release(m_Handle);
+		}
+		
 		GameObject             (const GameObject& _other) = delete;
 		GameObject& operator = (const GameObject& _other) = delete;
 		
@@ -124,7 +223,14 @@ namespace LouiEriksson::Engine::ECS {
 		 * @param[in] _value The active state to set. True for active, false for inactive.
 		 */
 		void Active(const bool& _value) {
-			m_Active = _value;
+			
+			if (m_Active != _value) {
+				m_Active = _value;
+				
+				if (m_Storage != nullptr) {
+					m_Storage->Refresh(*this);
+				}
+			}
 		}
 		
 		/**
@@ -136,6 +242,14 @@ namespace LouiEriksson::Engine::ECS {
 			return m_Active;
 		}
 		
+		/**
+		 * @brief Get a Handle to the GameObject.
+		 * @return An Entity which resolves to the GameObject for as long as it exists.
+		 */
+		[[nodiscard]] Entity GetHandle() const noexcept {
+			return Entity(*this);
+		}
+		
 		/**
 		 * @brief Set the name of the Parent.
 		 *
@@ -224,6 +338,32 @@ namespace LouiEriksson::Engine::ECS {
 			return result;
 		}
 		
+		/**
+		 * @brief Get a Component of type in the Parent by index, without taking a reference to it.
+		 *
+		 * @tparam T TypeID to be searched.
+		 * @param[in] _index Index of the Component.
+		 * @return A pointer to the Component if successful, or nullptr if unsuccessful.
+		 *
+		 * @note Prefer this to GetComponent() in code which runs every frame. The pointer is only valid until the Component is removed.
+		 */
+		template<typename T>
+		[[nodiscard]] T* FindComponent(const size_t& _index = 0U) const {
+			
+			static_assert(std::is_base_of<Component, T>::value, "Provided type must derive from \"Component\".");
+			
+			T* result = nullptr;
+			
+			if (const auto category = m_Components.Get(typeid(T))) {
+				
+				if (_index < category->size()) {
+					result = static_cast<T*>((*category)[_index].get());
+				}
+			}
+			
+			return result;
+		}
+		
 		/**
 		 * @brief Add a Component of type to the Parent.
 		 *
@@ -240,7 +380,17 @@ namespace LouiEriksson::Engine::ECS {
 			static_assert(std::is_base_of<Component, T>::value, "Provided type must derive from \"Component\".");
 			
 			// Create a new instance of the component, taking a pointer to this gameobject.
-			std::shared_ptr<T> result(new T(weak_from_this()));
+			std::shared_ptr<T> result;
+			
+			if (m_Storage != nullptr) {
+				result = m_Storage->Allocate<T>(weak_from_this());
+			}
+			
+			if (result == nullptr) {
+				result = std::shared_ptr<T>(new T(weak_from_this()));
+				
+				Storage::s_Fallbacks.fetch_add(1U, std::memory_order_relaxed);
+			}
 			
 			try {
 				Attach(std::move(result)); // Attach the component to the GameObject.
@@ -273,6 +423,182 @@ namespace LouiEriksson::Engine::ECS {
 		}
 	};
 	
+	inline std::shared_ptr<GameObject> Storage::Create(const std::weak_ptr<Scene>& _scene, const std::string_view& _name) {
+		return std::allocate_shared<GameObject>(Allocator<GameObject>(m_Objects), _scene, shared_from_this(), std::string(_name));
+	}
+	
+	template<typename... Ts>
+	std::vector<std::shared_ptr<GameObject>> Storage::Create(const std::weak_ptr<Scene>& _scene, const size_t& _count, const Prototype<Ts...>& _prototype) {
+		
+		std::vector<std::shared_ptr<GameObject>> result;
+		result.reserve(_count);
+		
+		Slots<GameObject>::Reserve(_count);
+		
+		for (size_t i = 0U; i < _count; ++i) {
+			
+			const auto& entity = result.emplace_back(Create(_scene, _prototype.m_Name ? _prototype.m_Name(i) : std::string()));
+			
+			// Components are added in the order given (a braced initialiser is evaluated from left to right).
+			const std::tuple<std::shared_ptr<Ts>...> components { entity->template AddComponent<Ts>()... };
+			
+			// The first GameObject and its Components set the sizes of the blocks of their Pools, so the rest of the batch is reserved afterwards.
+			if (i == 0U) {
+				m_Objects->Reserve(_count - 1U);
+				
+				ReserveBatch<Ts...>(_count - 1U);
+			}
+			
+			if (_prototype.m_Initialiser) {
+				
+				std::apply([&_prototype, &i, &entity](const auto&... _components) {
+					_prototype.m_Initialiser(i, *entity, *_components...);
+				}, components);
+			}
+		}
+		
+		return result;
+	}
+	
+	template<typename T>
+	T* Storage::First(const GameObject& _owner) {
+		
+		T* result = nullptr;
+		
+		if (const auto components = _owner.m_Components.Get(typeid(T))) {
+			
+			if (!components->empty()) {
+				result = static_cast<T*>(components->front().get());
+			}
+		}
+		
+		return result;
+	}
+	
+	inline void Storage::SelectionBase::Remove(GameObject& _owner) noexcept {
+		
+		auto& memberships = _owner.m_Memberships;
+		
+		for (auto itr = memberships.begin(); itr != memberships.end();) {
+			
+			if (itr->first == this) {
+				Erase(itr->second);
+				
+				itr = memberships.erase(itr);
+			}
+			else {
+				++itr;
+			}
+		}
+		
+		Compact();
+	}
+	
+	template<typename T, typename... Us>
+	void Storage::Selection<T, Us...>::Update(GameObject& _owner) {
+		
+		auto& memberships = _owner.m_Memberships;
+		
+		std::tuple<Us*...> required {};
+		
+		auto valid = _owner.m_Active && _owner.m_Storage != nullptr;
+		
+		if (valid) {
+			required = { First<Us>(_owner)... };
+			
+			valid = std::apply([](const auto*... _components) { return ((_components != nullptr) && ...); }, required);
+		}
+		
+		const auto components = _owner.m_Components.Get(typeid(T));
+		
+		const auto attached = [&components](const T* _component) {
+			
+			return components && std::any_of(components->begin(), components->end(), [_component](const auto& _item) {
+				return static_cast<T*>(_item.get()) == _component;
+			});
+		};
+		
+		const auto matched = [this, &memberships](const T* _component) {
+			
+			return std::any_of(memberships.begin(), memberships.end(), [this, _component](const auto& _membership) {
+				return _membership.first == this && std::get<0>(m_Matches[_membership.second].m_Components) == _component;
+			});
+		};
+		
+		// Keep the matches of Components which are still attached, updating the Components they require in place.
+		for (auto itr = memberships.begin(); itr != memberships.end();) {
+			
+			if (itr->first == this) {
+				
+				auto& match = m_Matches[itr->second];
+				
+				if (auto* const component = std::get<0>(match.m_Components); valid && attached(component)) {
+					match.m_Components = std::tuple_cat(std::make_tuple(component), required);
+					
+					++itr;
+				}
+				else {
+					Erase(itr->second);
+					
+					itr = memberships.erase(itr);
+				}
+			}
+			else {
+				++itr;
+			}
+		}
+		
+		// Append matches for Components which have none.
+		if (valid && components) {
+			
+			for (const auto& item : *components) {
+				
+				if (auto* const component = static_cast<T*>(item.get()); !matched(component)) {
+					
+					memberships.emplace_back(this, m_Matches.size());
+					
+					m_Matches.push_back({ std::tuple_cat(std::make_tuple(component), required), &_owner });
+				}
+			}
+		}
+		
+		Compact();
+	}
+	
+	template<typename T, typename... Us>
+	void Storage::Selection<T, Us...>::Compact() noexcept {
+		
+		if (m_Removed > 0U && m_Views == 0U && m_Removed * 4U >= m_Matches.size()) {
+			
+			size_t count = 0U;
+			
+			for (size_t i = 0U; i < m_Matches.size(); ++i) {
+				
+				if (const auto& match = m_Matches[i]; match.m_Owner != nullptr) {
+					
+					if (i != count) {
+						
+						for (auto& membership : match.m_Owner->m_Memberships) {
+							
+							if (membership.first == this && membership.second == i) {
+								membership.second = count;
+								
+								break;
+							}
+						}
+						
+						m_Matches[count] = match;
+					}
+					
+					++count;
+				}
+			}
+			
+			m_Matches.resize(count);
+			m_Removed = 0U;
+		}
+	}
+	
 } // LouiEriksson::Engine::ECS
 
 #endif //FINALYEARPROJECT_GAMEOBJECT_HPP
\ No newline at end of file
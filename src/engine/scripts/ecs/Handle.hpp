@@ -0,0 +1,273 @@
+#ifndef FINALYEARPROJECT_HANDLE_HPP
+#define FINALYEARPROJECT_HANDLE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	class Component;
+	class GameObject;
+	
+	/**
+	 * @class Slots
+	 * @brief Table of the live objects of type T, addressed by generational id.
+	 *
+	 * @details The low 32 bits of an id index a slot, and the high 32 bits hold the generation of the slot when the id was issued.
+	 *          Slots are reused once released, with their generation incremented, so stale ids no longer resolve.
+	 *          The generation of a slot is never zero, so an id of zero is always null.
+	 *
+	 *          Slots are allocated in fixed-size chunks which never move, so ids may be resolved on any thread without
+	 *          locking, while objects are created and destroyed on others. Assigning and freeing slots is serialised by a mutex.
+	 *
+	 * @note Resolving an id does not keep the object alive. The caller must ensure it is not destroyed while in use.
+	 */
+	template<typename T>
+	class Slots final {
+	
+	private:
+		
+		struct Slot final {
+			
+			std::atomic<T*> m_Item { nullptr };
+			
+			/** @brief Generation of the slot. Zero until the slot is first assigned. */
+			std::atomic<uint32_t> m_Generation { 0U };
+		};
+		
+		static constexpr uint32_t s_ChunkBits  = 14U;
+		static constexpr uint32_t s_ChunkSize  = 1U << s_ChunkBits;
+		static constexpr uint32_t s_ChunkCount = 4096U;
+		
+		/** @brief Chunks of slots. A chunk is published once initialised, and never freed or moved. */
+		inline static std::array<std::atomic<Slot*>, s_ChunkCount> s_Chunks {};
+		
+		/** @brief Owns the chunks. */
+		inline static std::vector<std::unique_ptr<Slot[]>> s_Storage;
+		
+		inline static std::vector<uint32_t> s_Free;
+		
+		/** @brief Number of slots which have been assigned at least once. */
+		inline static uint32_t s_Size { 0U };
+		
+		/** @brief Guards s_Storage, s_Free, s_Size, and assignment of slots. */
+		inline static std::mutex s_Lock;
+		
+		static constexpr uint32_t Index(const uint64_t& _id) noexcept { return static_cast<uint32_t>(_id); }
+		
+		static constexpr uint32_t Generation(const uint64_t& _id) noexcept { return static_cast<uint32_t>(_id >> 32U); }
+		
+		/** @brief Returns the slot an id refers to, or nullptr if the id is null or stale. */
+		static Slot* Find(const uint64_t& _id) noexcept {
+			
+			Slot* result = nullptr;
+			
+			const auto index = Index(_id);
+			
+			if (const auto chunk = index >> s_ChunkBits; chunk < s_ChunkCount && Generation(_id) != 0U) {
+				
+				if (auto* const slots = s_Chunks[chunk].load(std::memory_order_acquire)) {
+					
+					auto& slot = slots[index & (s_ChunkSize - 1U)];
+					
+					if (slot.m_Generation.load(std::memory_order_acquire) == Generation(_id)) {
+						result = &slot;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Allocates chunks until the table holds the given number of slots.
+		 * @note Must be called while the lock is held.
+		 */
+		static void Grow(const size_t& _capacity) {
+			
+			if (_capacity > static_cast<size_t>(s_ChunkCount) * s_ChunkSize) {
+				throw std::length_error("Exceeded the maximum number of live objects!");
+			}
+			
+			while (s_Storage.size() * s_ChunkSize < _capacity) {
+				
+				auto& chunk = s_Storage.emplace_back(std::make_unique<Slot[]>(s_ChunkSize));
+				
+				s_Chunks[s_Storage.size() - 1U].store(chunk.get(), std::memory_order_release);
+			}
+		}
+	
+	public:
+		
+		 Slots()                    = delete;
+		 Slots(const Slots& _other) = delete;
+		~Slots()                    = delete;
+		
+		/**
+		 * @brief Assigns a slot to an object.
+		 * @return The id of the slot.
+		 */
+		static uint64_t Acquire(T* _item) {
+			
+			const std::lock_guard<std::mutex> lock(s_Lock);
+			
+			uint32_t index;
+			
+			if (s_Free.empty()) {
+				Grow(static_cast<size_t>(s_Size) + 1U);
+				
+				index = s_Size++;
+			}
+			else {
+				index = s_Free.back();
+				
+				s_Free.pop_back();
+			}
+			
+			auto& slot = s_Chunks[index >> s_ChunkBits].load(std::memory_order_relaxed)[index & (s_ChunkSize - 1U)];
+			
+			auto generation = slot.m_Generation.load(std::memory_order_relaxed);
+			if (generation == 0U) {
+				generation = 1U;
+			}
+			
+			// Publish the object before the generation, so that any reader matching the id also sees the object.
+			slot.m_Item.store(_item, std::memory_order_release);
+			slot.m_Generation.store(generation, std::memory_order_release);
+			
+			return (static_cast<uint64_t>(generation) << 32U) | index;
+		}
+		
+		/** @brief Ensures the given number of additional objects can be assigned slots without allocating. */
+		static void Reserve(const size_t& _count) {
+			
+			const std::lock_guard<std::mutex> lock(s_Lock);
+			
+			if (_count > s_Free.size()) {
+				Grow(static_cast<size_t>(s_Size) + (_count - s_Free.size()));
+			}
+		}
+		
+		/** @brief Frees the slot of an id, invalidating it. */
+		static void Release(const uint64_t& _id) {
+			
+			const std::lock_guard<std::mutex> lock(s_Lock);
+			
+			if (auto* const slot = Find(_id)) {
+				
+				auto generation = Generation(_id) + 1U;
+				if (generation == 0U) {
+					generation = 1U;
+				}
+				
+				slot->m_Generation.store(generation, std::memory_order_release);
+				slot->m_Item.store(nullptr, std::memory_order_release);
+				
+				s_Free.push_back(Index(_id));
+			}
+		}
+		
+		/** @brief Updates the object an id refers to (e.g. after it has been moved). */
+		static void Rebind(const uint64_t& _id, T* _item) noexcept {
+			
+			if (auto* const slot = Find(_id)) {
+				slot->m_Item.store(_item, std::memory_order_release);
+			}
+		}
+		
+		/** @brief Returns the object an id refers to, or nullptr if it has been destroyed. */
+		[[nodiscard]] static T* Resolve(const uint64_t& _id) noexcept {
+			
+			T* result = nullptr;
+			
+			if (const auto* const slot = Find(_id)) {
+				
+				const auto item = slot->m_Item.load(std::memory_order_acquire);
+				
+				// Reject the object if the slot was released, and possibly reassigned, in the meantime.
+				if (slot->m_Generation.load(std::memory_order_acquire) == Generation(_id)) {
+					result = item;
+				}
+			}
+			
+			return result;
+		}
+	};
+	
+	/**
+	 * @class Handle
+	 * @brief Generational reference to a GameObject or Component.
+	 *
+	 * @details Unlike std::weak_ptr, resolving a Handle does not touch a reference count, and a Handle is a plain
+	 *          64-bit integer, so it can be serialised and compared directly.
+	 *          A Handle to an object which has been destroyed resolves to nullptr.
+	 *
+	 * @tparam T GameObject, or a type deriving from Component.
+	 *
+	 * @note The pointer returned by Get() is only valid until the object is destroyed, so it should not be stored.
+	 */
+	template<typename T>
+	class Handle final {
+	
+	private:
+		
+		using slots_t = Slots<std::conditional_t<std::is_same_v<T, GameObject>, GameObject, Component>>;
+		
+		uint64_t m_ID;
+	
+	public:
+		
+		/** @brief Creates a null Handle. */
+		constexpr Handle() noexcept :
+			m_ID(0U) {}
+		
+		/** @brief Creates a Handle to an object. */
+		Handle(const T& _item) noexcept :
+			m_ID(_item.m_Handle) {}
+		
+		/** @brief Creates a Handle to an object, or a null Handle if the pointer is null. */
+		Handle(const std::shared_ptr<T>& _item) noexcept :
+			m_ID(_item != nullptr ? _item->m_Handle : 0U) {}
+		
+		/** @brief Returns the Handle with the given id (e.g. when deserialising). */
+		[[nodiscard]] static constexpr Handle FromID(const uint64_t& _id) noexcept {
+			
+			Handle result;
+			result.m_ID = _id;
+			
+			return result;
+		}
+		
+		/** @brief Returns the id of the Handle. */
+		[[nodiscard]] constexpr const uint64_t& ID() const noexcept { return m_ID; }
+		
+		/** @brief Returns the object referred to by the Handle, or nullptr if it has been destroyed. */
+		[[nodiscard]] T* Get() const noexcept {
+			return static_cast<T*>(slots_t::Resolve(m_ID));
+		}
+		
+		T* operator ->() const noexcept { return Get(); }
+		
+		explicit operator bool() const noexcept { return Get() != nullptr; }
+		
+		constexpr bool operator ==(const Handle& _other) const noexcept { return m_ID == _other.m_ID; }
+		constexpr bool operator !=(const Handle& _other) const noexcept { return m_ID != _other.m_ID; }
+	};
+	
+	/** @brief Handle to a GameObject. */
+	using Entity = Handle<GameObject>;
+	
+	/** @brief Handle to a Component. */
+	template<typename T>
+	using ComponentHandle = Handle<T>;
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_HANDLE_HPP
@@ -0,0 +1,32 @@
+#ifndef FINALYEARPROJECT_PROTOTYPE_HPP
+#define FINALYEARPROJECT_PROTOTYPE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	class GameObject;
+	
+	/**
+	 * @struct Prototype
+	 * @brief Description of a batch of GameObjects which share the same Components.
+	 *
+	 * @tparam Ts Types of the Components of each GameObject, added in order. A type may be repeated (e.g. for several Renderers).
+	 *
+	 * @see Scene::SpawnBatch()
+	 */
+	template<typename... Ts>
+	struct Prototype final {
+		
+		/** @brief (Optional) Returns the name of the GameObject at an index of the batch. */
+		std::function<std::string(const size_t&)> m_Name;
+		
+		/** @brief (Optional) Initialises the GameObject at an index of the batch, and its Components. */
+		std::function<void(const size_t&, GameObject&, Ts&...)> m_Initialiser;
+	};
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_PROTOTYPE_HPP
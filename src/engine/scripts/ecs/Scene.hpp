@@ -2,27 +2,30 @@
 #define FINALYEARPROJECT_SCENE_HPP
 
 #include "../core/Debug.hpp"
+#include "../core/Profiler.hpp"
 #include "../core/Script.hpp"
 #include "../core/Serialisation.hpp"
 #include "../core/Transform.hpp"
+#include "../core/utils/BVH.hpp"
 #include "../core/utils/Hashmap.hpp"
 #include "../graphics/Camera.hpp"
 #include "../graphics/Light.hpp"
 #include "../graphics/Renderer.hpp"
 #include "../physics/Collider.hpp"
 #include "../physics/Rigidbody.hpp"
+#include "../physics/StateBuffer.hpp"
 
+#include "CommandBuffer.hpp"
 #include "GameObject.hpp"
+#include "SceneFile.hpp"
+#include "Scheduler.hpp"
+#include "Storage.hpp"
 
-#include <cereal/archives/xml.hpp>
-#include <cereal/cereal.hpp>
-
-#include <cstring>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <filesystem>
-#include <fstream>
 #include <memory>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -54,135 +57,413 @@ namespace LouiEriksson::Engine::ECS {
 		
 		std::filesystem::path m_Path;
 		
+		CommandBuffer m_Commands;
+		
+		Scheduler m_Scheduler;
+		
+		/** @brief Hierarchy of the Transforms in the Scene, used to update their World matrices once per frame. */
+		Transform::Hierarchy m_Hierarchy;
+		
+		/** @brief Spatial index of the world-space bounds of the Renderers in the Scene. */
+		BVH<ECS::ComponentHandle<Graphics::Renderer>> m_Renderables;
+		
+		/** @brief Renderers whose Mesh has no bounds, which are drawn by every Camera and Light. */
+		std::vector<Graphics::Renderer*> m_Unbounded;
+		
+		/** @brief Number of times the spatial index has been updated. */
+		uint64_t m_Frame = 0U;
+		
+		/** @brief Number of GameObjects spawned without a name, used to name each uniquely. */
+		size_t m_Unnamed = 0U;
+		
+		/** @brief Snapshots of the poses of the Rigidbodies in the Scene, written each physics update and interpolated each frame. */
+		Physics::StateBuffer m_States;
+		
+		/** @brief Scripts to be run by the Scheduler. Reused between ticks to avoid allocation. */
+		std::vector<Script*> m_Scheduled;
+		
 		/**
-		 * @fn void Scene::Draw(const LouiEriksson::Engine::Graphics::Camera::RenderFlags& _flags)
-		 * @brief Render the Scene.
+		 * @brief Ticks every Script in the Scene.
 		 *
-		 * @param[in] _flags The render flags specifying what actions to take during the render process.
+		 * @details Scripts which have declared their dependencies are run first, by the Scheduler.
+		 *          Exclusive Scripts are then run on the main thread, once no other Scripts are running.
+		 *
+		 * @param[in] _late Whether to invoke LateTick() instead of Tick().
 		 */
-		void Draw(const LouiEriksson::Engine::Graphics::Camera::RenderFlags& _flags) {
+		void Invoke(const bool& _late) {
+			
+			for (const auto& [script, entity] : Query<Script>()) {
+				
+				if (!script.m_Access.IsExclusive()) {
+					m_Scheduled.emplace_back(&script);
+				}
+			}
+			
+			if (!m_Scheduled.empty()) {
+				
+				m_Scheduler.Run(m_Scheduled, _late);
+				
+				m_Scheduled.clear();
+			}
+			
+			for (const auto& [script, entity] : Query<Script>()) {
+				
+				if (script.m_Access.IsExclusive()) {
+					script.Invoke(_late);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Updates the spatial index of the Renderers in the Scene.
+		 *
+		 * @details Renderers are inserted once they have a Transform and a Mesh with bounds, and updated only when the World
+		 *          matrix of their Transform (see Transform::Revision()) or their Mesh changes. Renderers which are no longer
+		 *          visited (as they have been destroyed, deactivated, or lost their Transform or Mesh) are removed.
+		 *          Renderers whose Mesh has no bounds are not indexed, and are never culled.
+		 */
+		void UpdateRenderables() {
+			
+			++m_Frame;
 			
-			const auto entities = m_Entities.Values();
+			m_Unbounded.clear();
 			
-			/* GET ALL RENDERERS */
-			std::vector<std::weak_ptr<Graphics::Renderer>> casted_renderers;
+			size_t indexed = 0U;
 			
-			for (const auto& entity : entities) {
+			for (const auto& [renderer, entity] : Query<Graphics::Renderer>()) {
 				
-				if (entity->Active()) {
+				renderer.Resolve();
+				
+				if (const auto* const transform = renderer.GetTransform()) {
 					
-					if (const auto& renderers = entity->Components().Get(typeid(Graphics::Renderer))) {
-						for (const auto& item : *renderers) {
-							
-							const auto r = std::dynamic_pointer_cast<Graphics::Renderer>(item);
+					if (const auto* const mesh = renderer.m_Mesh.get()) {
+						
+						if (mesh->Bounds().Valid()) {
 							
-							if (auto t = r->GetTransform().lock()) {
-								casted_renderers.emplace_back(r);
+							if (renderer.m_Leaf == BVH<ECS::ComponentHandle<Graphics::Renderer>>::s_None) {
+								renderer.m_Leaf = m_Renderables.Insert(renderer.Bounds(), ECS::ComponentHandle<Graphics::Renderer>(renderer));
 							}
+							else if (renderer.m_Revision != transform->Revision() || renderer.m_Bounded != mesh) {
+								(void)m_Renderables.Update(renderer.m_Leaf, renderer.Bounds());
+							}
+							
+							renderer.m_Revision = transform->Revision();
+							renderer.m_Bounded  = mesh;
+							renderer.m_Seen     = m_Frame;
+							
+							++indexed;
 						}
+						else {
+							m_Unbounded.emplace_back(&renderer);
+						}
+					}
+				}
+			}
+			
+			// Every visited Renderer has exactly one leaf, so any extra leaves belong to Renderers which were not visited.
+			if (m_Renderables.size() > indexed) {
+				
+				m_Renderables.RemoveIf([this](const ECS::ComponentHandle<Graphics::Renderer>& _handle) {
+					
+					auto* const renderer = _handle.Get();
+					
+					const auto result = renderer == nullptr || renderer->m_Seen != m_Frame;
+					
+					if (result && renderer != nullptr) {
+						renderer->m_Leaf = BVH<ECS::ComponentHandle<Graphics::Renderer>>::s_None;
 					}
+					
+					return result;
+				});
+			}
+		}
+		
+		/**
+		 * @brief Collects every Renderer which may be inside a volume.
+		 *
+		 * @param[in] _volume The volume (e.g. a Frustum or Sphere).
+		 * @param[out] _result The Renderers whose bounds overlap the volume, and every Renderer without bounds.
+		 */
+		template<typename V>
+		void Cull(const V& _volume, std::vector<Graphics::Renderer*>& _result) const {
+			
+			_result = m_Unbounded;
+			
+			m_Renderables.Query(_volume, [&_result](const ECS::ComponentHandle<Graphics::Renderer>& _renderer) {
+				
+				if (auto* const renderer = _renderer.Get()) {
+					_result.emplace_back(renderer);
 				}
+			});
+		}
+		
+		/**
+		 * @fn void Scene::Draw(const LouiEriksson::Engine::Graphics::Camera::RenderFlags& _flags)
+		 * @brief Render the Scene.
+		 *
+		 * @param[in] _flags The render flags specifying what actions to take during the render process.
+		 */
+		void Draw(const LouiEriksson::Engine::Graphics::Camera::RenderFlags& _flags) {
+			
+			PROFILE_ZONE("Scene::Draw");
+			
+			const auto entities = m_Entities.View();
+			
+			/* UPDATE TRANSFORMS */
+			{
+				PROFILE_ZONE("Scene::UpdateTransforms");
+				
+				m_Hierarchy.Update(m_Storage->View<Transform>(), m_Storage->Revision<Transform>());
 			}
 			
+			/* UPDATE SPATIAL INDEX */
+			{
+				PROFILE_ZONE("Scene::UpdateRenderables");
+				
+				UpdateRenderables();
+			}
 			
 			/* GET ALL LIGHTS */
-			std::vector<std::weak_ptr<Graphics::Light>> casted_lights;
+			std::vector<Graphics::Light*> lights;
+			
+			{
+				const auto query = Query<Graphics::Light>();
+				
+				lights.reserve(query.size());
+				
+				for (const auto& [light, entity] : query) {
+					lights.emplace_back(&light);
+				}
+			}
+			
+			std::vector<Graphics::Renderer*> renderers;
+			std::vector<std::vector<Graphics::Renderer*>> casters(lights.size());
 			
-			for (const auto& entity : entities) {
+			/* GET ALL CAMERAS */
+			for (const auto& [camera, entity] : Query<Graphics::Camera>()) {
 				
-				if (entity->Active()) {
+				try {
 					
-					if (const auto& lights = entity->Components().Get(typeid(Graphics::Light))) {
-						for (const auto& item : *lights) {
-							casted_lights.emplace_back(std::dynamic_pointer_cast<Graphics::Light>(item));
+					/* CULL */
+					{
+						PROFILE_ZONE("Scene::Cull");
+						
+						Cull(camera.GetFrustum(), renderers);
+						
+						for (size_t i = 0U; i < lights.size(); ++i) {
+							Cull(camera.ShadowBounds(*lights[i]), casters[i]);
 						}
 					}
+					
+					/* RENDER */
+					camera.PreRender(_flags);
+					camera.Render(renderers, lights, casters);
+					camera.PostRender();
+				}
+				catch (const std::exception& e) {
+					Debug::Log(e);
 				}
 			}
+		}
+		
+		/** @brief Returns the names of the component types in XML Scene files, which are those given by the compiler. */
+		[[nodiscard]] static SceneFile::Names TypeNames() {
+			
+			return {
+				typeid(Transform         ).name(),
+				typeid(Physics::Rigidbody).name(),
+				typeid(Graphics::Camera  ).name(),
+				typeid(Graphics::Light   ).name(),
+				typeid(Graphics::Renderer).name(),
+				typeid(Script            ).name()
+			};
+		}
+		
+		/** @brief Returns the serialisable state of the Scene. */
+		[[nodiscard]] SceneFile Capture() const {
 			
-			/* GET ALL CAMERAS */
-			for (const auto& entity : entities) {
+			SceneFile result;
+			
+			for (const auto& kvp : m_Entities) {
 				
-				if (entity->Active()) {
+				const auto index = result.AddEntity(kvp.second->Name());
+				
+				for (const auto& [type, components] : kvp.second->Components()) {
 					
-					if (const auto& cameras = entity->Components().Get(typeid(Graphics::Camera))) {
-						for (const auto& item : *cameras) {
+					if (type == typeid(Transform)) {
+						
+						auto& transforms = result.m_Transforms;
+						
+						for (const auto& component : components) {
 							
-							try {
-								
-								/* RENDER */
-								const auto camera = std::dynamic_pointer_cast<Graphics::Camera>(item);
-								camera->PreRender(_flags);
-								camera->Render(casted_renderers, casted_lights);
-								camera->PostRender();
-							}
-							catch (const std::exception& e) {
-								Debug::Log(e);
-							}
+							const auto* const transform = static_cast<const Transform*>(component.get());
+							const auto& rotation = transform->Rotation();
+							
+							transforms.m_Entities.emplace_back(index);
+							transforms.m_Positions.emplace_back(transform->Position());
+							transforms.m_Rotations.emplace_back(rotation.x, rotation.y, rotation.z, rotation.w);
+							transforms.m_Scales.emplace_back(transform->Scale());
+						}
+					}
+					else if (type == typeid(Physics::Rigidbody)) {
+						
+						auto& rigidbodies = result.m_Rigidbodies;
+						
+						for (const auto& component : components) {
+							
+							auto* const rigidbody = static_cast<Physics::Rigidbody*>(component.get());
+							
+							rigidbodies.m_Entities.emplace_back(index);
+							rigidbodies.m_Velocities.emplace_back(rigidbody->Velocity());
+							rigidbodies.m_AngularVelocities.emplace_back(rigidbody->AngularVelocity());
+							rigidbodies.m_Masses.emplace_back(rigidbody->Mass());
+							rigidbodies.m_Drags.emplace_back(rigidbody->Drag());
+							rigidbodies.m_AngularDrags.emplace_back(rigidbody->AngularDrag());
 						}
 					}
+					else if (type == typeid(Graphics::Camera  )) { result.m_Cameras.insert  (result.m_Cameras.end(),   components.size(), index); }
+					else if (type == typeid(Graphics::Light   )) { result.m_Lights.insert   (result.m_Lights.end(),    components.size(), index); }
+					else if (type == typeid(Graphics::Renderer)) { result.m_Renderers.insert(result.m_Renderers.end(), components.size(), index); }
+					else if (type == typeid(Script)) {
+						
+						for (const auto& component : components) {
+							result.m_Scripts.m_Entities.emplace_back(index);
+							result.m_Scripts.m_Types.emplace_back(result.Intern(component->TypeID().name()));
+						}
+					}
+					else {
+						Debug::Log("Serialisation for type \"" + std::string(type.name()) + "\" has not been implemented.", Warning);
+					}
 				}
 			}
+			
+			return result;
 		}
 		
-	protected:
-	
-		/** @brief Entities within the Scene. */
-		Hashmap<std::string, std::shared_ptr<GameObject>> m_Entities;
-		
 		/**
-		 * @brief Called every frame.
-		 * @param[in] _flags The render flags specifying what actions to take during the render process.
+		 * @brief Populates the Scene from a SceneFile.
+		 *
+		 * @details Every GameObject is created before any Components are added, and Components are added one type at a time,
+		 *          reading each block of the file from start to end.
+		 *
+		 * @param[in] _file The SceneFile.
+		 * @param[in] _initialisers A Hashmap of scripts types and their initialisers.
 		 */
-		void Tick(const Graphics::Camera::RenderFlags& _flags) {
+		void Instantiate(const SceneFile& _file, const Hashmap<std::string, std::shared_ptr<Script> (*)(const std::weak_ptr<ECS::GameObject>& parent)>& _initialisers) {
 			
-			const auto entities = m_Entities.Values();
+			std::vector<std::shared_ptr<GameObject>> entities;
+			entities.reserve(_file.m_Entities.size());
 			
-			/* INTERPOLATE RIGIDBODIES */
-			for (const auto& entity : entities) {
+			for (const auto& name : _file.m_Entities) {
+				entities.emplace_back(Create(_file.String(name)));
+			}
+			
+			/* TRANSFORMS */
+			{
+				const auto& transforms = _file.m_Transforms;
 				
-				if (entity->Active()) {
+				for (size_t i = 0U; i < transforms.m_Entities.size(); ++i) {
 					
-					if (const auto& rigidbodies = entity->Components().Get(typeid(Physics::Rigidbody))) {
-						for (const auto& item : *rigidbodies) {
-							
-							try {
-								const auto rigidbody = std::dynamic_pointer_cast<Physics::Rigidbody>(item);
-								rigidbody->Interpolate();
-							}
-							catch (const std::exception& e) {
-								Debug::Log(e);
-							}
-						}
+					if (const auto t = entities[transforms.m_Entities[i]]->AddComponent<Transform>()) {
+						
+						const auto& rotation = transforms.m_Rotations[i];
+						
+						t->Position(transforms.m_Positions[i]);
+						t->Rotation(glm::quat(rotation.w, rotation.x, rotation.y, rotation.z));
+						t->Scale   (transforms.m_Scales[i]);
 					}
 				}
 			}
 			
-			/* TICK SCRIPTS */
-			for (const auto& entity : entities) {
+			/* RIGIDBODIES */
+			{
+				const auto& rigidbodies = _file.m_Rigidbodies;
 				
-				if (entity->Active()) {
+				for (size_t i = 0U; i < rigidbodies.m_Entities.size(); ++i) {
 					
-					if (const auto& scripts = entity->Components().Get(typeid(Script))) {
-						for (const auto& item : *scripts) {
-							std::dynamic_pointer_cast<Script>(item)->Invoke(false);
-						}
+					if (const auto r = entities[rigidbodies.m_Entities[i]]->AddComponent<Physics::Rigidbody>()) {
+						
+						r->       Velocity(rigidbodies.m_Velocities[i]);
+						r->AngularVelocity(rigidbodies.m_AngularVelocities[i]);
+						r->           Mass(rigidbodies.m_Masses[i]);
+						r->           Drag(rigidbodies.m_Drags[i]);
+						r->    AngularDrag(rigidbodies.m_AngularDrags[i]);
 					}
 				}
 			}
 			
-			/* LATE-TICK SCRIPTS */
-			for (const auto& entity : entities) {
+			/* CAMERAS, LIGHTS, AND RENDERERS */
+			for (const auto& entity : _file.m_Cameras  ) { entities[entity]->AddComponent<Graphics::Camera>();   }
+			for (const auto& entity : _file.m_Lights   ) { entities[entity]->AddComponent<Graphics::Light>();    }
+			for (const auto& entity : _file.m_Renderers) { entities[entity]->AddComponent<Graphics::Renderer>(); }
+			
+			/* SCRIPTS */
+			{
+				const auto& scripts = _file.m_Scripts;
 				
-				if (entity->Active()) {
+				for (size_t i = 0U; i < scripts.m_Entities.size(); ++i) {
 					
-					if (const auto& scripts = entity->Components().Get(typeid(Script))) {
-						for (const auto& item : *scripts) {
-							std::dynamic_pointer_cast<Script>(item)->Invoke(true);
+					try {
+						
+						const auto type = std::string(_file.String(scripts.m_Types[i]));
+						
+						if (const auto fPtr = _initialisers.Get(type)) {
+							
+							auto& go = entities[scripts.m_Entities[i]];
+							
+							auto script = (*fPtr)(go->weak_from_this());
+							go->Attach(std::move(script));
 						}
+						else {
+							throw std::runtime_error("Deserialisation for type \"" + type + "\" has not been implemented.");
+						}
+					}
+					catch (const std::exception& e) {
+						Debug::Log(e);
 					}
 				}
 			}
+		}
+		
+	protected:
+	
+		/** @brief Entities within the Scene. */
+		Hashmap<std::string, std::shared_ptr<GameObject>> m_Entities;
+		
+		/** @brief Components of the entities within the Scene, grouped by type. */
+		std::shared_ptr<Storage> m_Storage = std::make_shared<Storage>();
+		
+		/**
+		 * @brief Called every frame.
+		 * @param[in] _flags The render flags specifying what actions to take during the render process.
+		 */
+		void Tick(const Graphics::Camera::RenderFlags& _flags) {
+			
+			PROFILE_ZONE("Scene::Tick");
+			
+			/*
+			 * Entities removed during the tick are kept alive until the view closes,
+			 * so components can be accessed without taking a reference to them.
+			 */
+			const auto entities = m_Entities.View();
+			
+			/* INTERPOLATE RIGIDBODIES */
+			try {
+				m_States.Interpolate(static_cast<scalar_t>(Physics::Physics::Alpha()));
+			}
+			catch (const std::exception& e) {
+				Debug::Log(e);
+			}
+			
+			/* TICK SCRIPTS */
+			Invoke(false);
+			
+			m_Commands.Apply(*this);
+			
+			/* LATE-TICK SCRIPTS */
+			Invoke(true);
+			
+			m_Commands.Apply(*this);
 			
 			try {
 				Draw(_flags);
@@ -195,84 +476,72 @@ namespace LouiEriksson::Engine::ECS {
 		/** @brief Called every physics update. */
 		void FixedTick() {
 		
-			const auto entities = m_Entities.Values();
+			PROFILE_ZONE("Scene::FixedTick");
+			
+			const auto entities = m_Entities.View();
 			
 			/* UPDATE RIGIDBODIES */
-			for (const auto& entity : entities) {
-				
-				if (entity->Active()) {
+			for (const auto& [rigidbody, entity] : Query<Physics::Rigidbody>()) {
 				
-					if (const auto& rigidbodies = entity->Components().Get(typeid(Physics::Rigidbody))) {
-						for (const auto& item : rigidbodies.value()) {
-							
-							try {
-								auto rigidbody = std::dynamic_pointer_cast<Physics::Rigidbody>(item);
-								rigidbody->Sync();
-							}
-							catch (const std::exception& e) {
-								Debug::Log(e);
-							}
-						}
-					}
+				try {
+					rigidbody.Sync(m_States);
+				}
+				catch (const std::exception& e) {
+					Debug::Log(e);
 				}
 			}
 			
+			m_States.Publish();
+			
 			/* SCRIPT FIXED-TICK */
-			for (const auto& entity : entities) {
+			for (const auto& [component, entity] : Query<Script>()) {
 				
-				if (entity->Active()) {
+				try {
+					auto* const script = &component;
 					
-					if (const auto& items = entity->Components().Get(typeid(Script))) {
-						for (const auto& item : *items) {
-							
-							try {
-								const auto script = std::dynamic_pointer_cast<Script>(item);
+					try {
+						
+						/*
+						 * Invoke collision event for every collision that the attached
+						 * rigidbody component has encountered.
+						 */
+						{
+							// Get rigidbody on Script's parent.
+							if (const auto rb = entity.GetComponent<Physics::Rigidbody>()) {
+								
+								// Invoke collision event for every Collision:
+								const auto collisions = rb->Collisions();
 								
-								try {
+								for (auto collision : collisions) {
 									
-									/*
-									 * Invoke collision event for every collision that the attached
-									 * rigidbody component has encountered.
-									 */
-									{
-										// Get rigidbody on Script's parent.
-										if (const auto  p = script->Parent()) {
-										if (const auto rb = p->GetComponent<Physics::Rigidbody>()) {
-											
-											// Invoke collision event for every Collision:
-											const auto collisions = rb->Collisions();
-											
-											for (auto collision : collisions) {
-												
-												try {
-													script->OnCollision(collision);
-												}
-												catch (const std::exception& e) {
-													Debug::Log(e);
-												}
-											}
-										}}
+									try {
+										script->OnCollision(collision);
+									}
+									catch (const std::exception& e) {
+										Debug::Log(e);
 									}
 								}
-								catch (const std::exception& e) {
-									Debug::Log(e);
-								}
-								
-								try {
-									// Run the script's FixedTick().
-									script->FixedTick();
-								}
-								catch (const std::exception& e) {
-									Debug::Log(e);
-								}
-							}
-							catch (const std::exception& e) {
-								Debug::Log(e);
 							}
 						}
 					}
+					catch (const std::exception& e) {
+						Debug::Log(e);
+					}
+					
+					try {
+						// Run the script's FixedTick().
+						script->FixedTick();
+					}
+					catch (const std::exception& e) {
+						Debug::Log(e);
+					}
+				}
+				catch (const std::exception& e) {
+					Debug::Log(e);
 				}
 			}
+			
+			m_Commands.Apply(*this);
 		}
 		
 	public:
@@ -292,131 +561,138 @@ namespace LouiEriksson::Engine::ECS {
 		 */
 		[[nodiscard]] std::shared_ptr<GameObject> Create(const std::string_view& _name = "")  {
 			
-			std::shared_ptr<GameObject> item(new GameObject(weak_from_this(), _name.data()), [](GameObject* _ptr) { delete _ptr; });
+			auto item = m_Storage->Create(weak_from_this(), _name);
+			
+			// An entity with the same name is replaced.
+			if (const auto existing = m_Entities.Get(std::string(_name))) {
+				(*existing)->Unlink();
+			}
 			
 			m_Entities.Assign(std::string(_name), item);
 			
 			return item;
 		}
 		
+		/**
+		 * @brief Creates a batch of GameObjects with the same Components.
+		 *
+		 * @details Prefer this to calling Create() and AddComponent() repeatedly when instantiating many GameObjects at once
+		 *          (e.g. streamed content), as room for the whole batch is reserved up front.
+		 *
+		 * @tparam Ts Types of the Components of each GameObject.
+		 * @param[in] _count The number of GameObjects to create.
+		 * @param[in] _prototype Description of the GameObjects. As with Create(), an existing GameObject with the same name is replaced.
+		 *                       If the Prototype does not name them, each GameObject is given a unique name.
+		 * @return Handles to the new GameObjects, in order.
+		 */
+		template<typename... Ts>
+		std::vector<Entity> SpawnBatch(const size_t& _count, const Prototype<Ts...>& _prototype) {
+			
+			std::vector<std::shared_ptr<GameObject>> items;
+			
+			if (_prototype.m_Name) {
+				items = m_Storage->Create(weak_from_this(), _count, _prototype);
+			}
+			else {
+				
+				// Otherwise, every GameObject of the batch would share a name, and replace the one before it.
+				auto prototype = _prototype;
+				prototype.m_Name = [first = m_Unnamed](const size_t& _index) {
+					return "GameObject#" + std::to_string(first + _index);
+				};
+				
+				m_Unnamed += _count;
+				
+				items = m_Storage->Create(weak_from_this(), _count, prototype);
+			}
+			
+			m_Entities.Reserve(m_Entities.size() + _count);
+			
+			std::vector<Entity> result;
+			result.reserve(_count);
+			
+			for (auto& item : items) {
+				
+				auto name = std::string(item->Name());
+				
+				// An entity with the same name is replaced.
+				if (const auto existing = m_Entities.Get(name)) {
+					(*existing)->Unlink();
+				}
+				
+				result.emplace_back(item);
+				
+				m_Entities.Assign(std::move(name), std::move(item));
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns every Component of type T in the Scene whose GameObject is active and has Components of each of the types Us.
+		 *
+		 * @details Results are cached, and updated as Components are added and removed, GameObjects are activated and deactivated,
+		 *          and GameObjects are removed from the Scene.
+		 *
+		 * @tparam T The type of Component to query. Scripts are all queried as Script.
+		 * @tparam Us Types of Component the GameObject must also have.
+		 * @return An iterable range of std::tuple<T&, Us&..., GameObject&>.
+		 */
+		template<typename T, typename... Us>
+		[[nodiscard]] auto Query() {
+			return m_Storage->Query<T, Us...>();
+		}
+		
+		/**
+		 * @brief Returns the spatial index of the Renderers in the Scene, for frustum, sphere, and ray queries (e.g. picking).
+		 * @note Updated once per frame, before rendering. Renderers whose Mesh has no bounds are not indexed.
+		 */
+		[[nodiscard]] constexpr const BVH<ECS::ComponentHandle<Graphics::Renderer>>& Renderables() const noexcept {
+			return m_Renderables;
+		}
+		
+		/**
+		 * @brief Returns the CommandBuffer of the Scene.
+		 *
+		 * @details Structural changes recorded in the CommandBuffer are applied after the Tick(), LateTick(), and FixedTick() of every Script.
+		 *          Scripts which run in parallel must use it instead of changing the Scene directly.
+		 *
+		 * @see Script::Dependencies()
+		 */
+		[[nodiscard]] CommandBuffer& Commands() noexcept {
+			return m_Commands;
+		}
+		
 		void Remove(const std::string& _name) {
 			
-			if (m_Entities.ContainsKey(_name)) {
+			if (const auto existing = m_Entities.Get(_name)) {
+				(*existing)->Unlink();
+				
 				m_Entities.Remove(_name);
 			}
 		}
 		
 		/**
-		 * @fn void Scene::Save(const path &_path)
-		 * @brief Save the Scene in XML format at a given path.
+		 * @fn void Scene::Save(const path &_path, const Serialisation::Format& _format)
+		 * @brief Save the Scene at a given path.
 		 *
-		 * @param[in] _path - The path to save the Scene in xml format.
+		 * @param[in] _path - The path to save the Scene to.
+		 * @param[in] _format - (Optional) The format to save the Scene in. Binary Scenes load considerably faster.
 		 */
-		void Save(const std::filesystem::path& _path) {
+		void Save(const std::filesystem::path& _path, const Serialisation::Format& _format = Serialisation::XML) {
 		
 			Debug::Log("Saving Scene... ", Info, true);
 			
 			try {
-				auto ofStream = std::ofstream(_path);
-		
-				auto xml = cereal::XMLOutputArchive(ofStream);
-		
-				xml.setNextName("Entities"); // Start "Entities"
-				xml.startNode();
-		
-				for (const auto& entity : m_Entities) { // Only serialise things attached to GameObject.
-	
-					xml.setNextName(std::string(entity.second->Name()).c_str());
-					xml.startNode();
-					
-					for (const auto& kvp : entity.second->Components()) {
-	
-						const auto& components = kvp.second;
-	
-						if  (kvp.first == typeid(Transform)) {		// Serialise Transform.
-	
-							for (const auto& component : components) {
-	
-								auto transform = std::dynamic_pointer_cast<Transform>(component);
-	
-								xml.setNextName(kvp.first.name());
-								xml.startNode();
-	
-								xml(cereal::make_nvp("Position", Serialisation::Serialise(transform->Position())));
-								xml(cereal::make_nvp("Rotation", Serialisation::Serialise(transform->Rotation())));
-								xml(cereal::make_nvp("Scale",    Serialisation::Serialise(transform->Scale())));
-	
-								xml.finishNode();
-							}
-						}
-						else if (kvp.first == typeid( Physics::Rigidbody)) {	// Serialise Rigidbody.
-	
-							for (const auto& component : components) {
-	
-								auto rigidbody = std::dynamic_pointer_cast<Physics::Rigidbody>(component);
-	
-								xml.setNextName(kvp.first.name());
-								xml.startNode();
-	
-								xml(cereal::make_nvp("Velocity",        Serialisation::Serialise(rigidbody->Velocity())));
-								xml(cereal::make_nvp("AngularVelocity", Serialisation::Serialise(rigidbody->AngularVelocity())));
-								xml(cereal::make_nvp("Mass",            rigidbody->Mass()));
-								xml(cereal::make_nvp("Drag",            rigidbody->Drag()));
-								xml(cereal::make_nvp("AngularDrag",     rigidbody->AngularDrag()));
-	
-								xml.finishNode();
-							}
-						}
-						else if (kvp.first == typeid(Graphics::Camera   )) {		// Serialise Camera.
-	
-							for (const auto& component : components) {
-	
-								xml.setNextName(kvp.first.name());
-	
-								xml.startNode();
-								xml.finishNode();
-							}
-						}
-						else if (kvp.first == typeid(Graphics::Light    )) {    // Serialise Light.
-	
-							for (const auto& component : components) {
-	
-								xml.setNextName(kvp.first.name());
-	
-								xml.startNode();
-								xml.finishNode();
-							}
-						}
-						else if (kvp.first == typeid(Graphics::Renderer )) {	// Serialise Renderer.
-	
-							for (const auto& component : components) {
-	
-								xml.setNextName(kvp.first.name());
-	
-								xml.startNode();
-								xml.finishNode();
-							}
-						}
-						else if (kvp.first == typeid(Script)) {		        // Serialise Shader.
-	
-							xml.setNextName(kvp.first.name());
-							xml.startNode();
-	
-							for (const auto& component : components) {
-								xml(cereal::make_nvp("TypeID", std::string(component->TypeID().name())));
-							}
-	
-							xml.finishNode();
-						}
-						else {
-							Debug::Log("Serialisation for type \"" + std::string(kvp.first.name()) + "\" has not been implemented.", Warning);
-						}
-					}
-					
-					xml.finishNode();
-				}
 				
-				xml.finishNode();
+				const auto file = Capture();
+				
+				if (_format == Serialisation::Binary) {
+					file.Write(_path);
+				}
+				else {
+					file.ToXML(_path, TypeNames());
+				}
 				
 				Debug::Log("Done.", Info);
 			}
@@ -427,7 +703,7 @@ namespace LouiEriksson::Engine::ECS {
 		}
 		
 		/**
-		 * @brief Loads a scene from a file.
+		 * @brief Loads a scene from a file, in either the XML or binary format.
 		 *
 		 * @param[in] _path - The path to the scene file.
 		 * @param[in] _initialisers - A Hashmap of scripts types and their initialisers.
@@ -440,135 +716,13 @@ namespace LouiEriksson::Engine::ECS {
 			auto result = std::make_shared<Scene>();
 			result->m_Path = _path;
 			
-			// TODO: Better logging.
-			const auto log = false;
-			
 			try {
 				
-				auto ifStream = std::ifstream(_path, std::ifstream::in);
-			
-				auto xml = cereal::XMLInputArchive(ifStream);
-				xml.startNode();
-			
-				auto gameObjectCount = 0;
-				xml.loadSize(gameObjectCount);
-			
-				Debug::Assert(!log, "GameObjects: " + std::to_string(gameObjectCount), Info);
-				
-				for (auto i = 0; i < gameObjectCount; ++i) {
-			
-					const char* const goName = xml.getNodeName();
-					
-					Debug::Assert(!log, "\tName: \"" + std::string(goName) + "\"", Info);
-	
-					// Create GameObject to populate.
-					auto go = result->Create(goName);
-			
-					xml.startNode();
-			
-					auto count = 0;
-					xml.loadSize(count);
-					
-					Debug::Assert(!log, "\tComponents: " + std::to_string(count), Info);
-					
-					for (auto j = 0; j < count; j++) {
-			
-						const auto* const name = xml.getNodeName();
-						
-						Debug::Assert(!log, "\t\t" + std::string(name), Info);
-						
-						if (strcmp(name, typeid(Transform).name()) == 0) {			// Deserialise Transform.
-			
-							if (const auto t = go->AddComponent<Transform>()) {
-			
-								xml.startNode();
-								
-								t->Position(Serialisation::Deserialise<vec3>(Serialisation::ParseNext(xml, log ? 3 : -1)));
-								t->Rotation(Serialisation::Deserialise<glm::quat>(Serialisation::ParseNext(xml, log ? 3 : -1)));
-								t->Scale   (Serialisation::Deserialise<vec3>(Serialisation::ParseNext(xml, log ? 3 : -1)));
+				const auto file = SceneFile::IsBinary(_path) ?
+					SceneFile::Read(_path) :
+					SceneFile::FromXML(_path, TypeNames());
 				
-								xml.finishNode();
-							}
-						}
-						else if (strcmp(name, typeid( Physics::Rigidbody).name()) == 0) {	// Deserialise Rigidbody.
-			
-							if (const auto r = go->AddComponent<Physics::Rigidbody>()) {
-			
-								xml.startNode();
-				
-								r->       Velocity(Serialisation::Deserialise<vec3>(Serialisation::ParseNext(xml, log ? 3 : -1)));
-								r->AngularVelocity(Serialisation::Deserialise<vec3>(Serialisation::ParseNext(xml, log ? 3 : -1)));
-								r->           Mass(Serialisation::Deserialise<float>    (Serialisation::ParseNext(xml, log ? 3 : -1)));
-								r->           Drag(Serialisation::Deserialise<float>    (Serialisation::ParseNext(xml, log ? 3 : -1)));
-								r->    AngularDrag(Serialisation::Deserialise<float>    (Serialisation::ParseNext(xml, log ? 3 : -1)));
-								
-								xml.finishNode();
-							}
-						}
-						else if (strcmp(name, typeid(Graphics::Camera   ).name()) == 0) {		// Deserialise Camera.
-						
-							if (const auto c = go->AddComponent<Graphics::Camera>()) {
-								
-								xml.startNode();
-								xml.finishNode();
-							}
-						}
-						else if (strcmp(name, typeid(Graphics::Light    ).name()) == 0) {		// Deserialise Light
-							
-							if (const auto l = go->AddComponent<Graphics::Light>()) {
-			
-								xml.startNode();
-								xml.finishNode();
-							}
-						}
-						else if (strcmp(name, typeid(Graphics::Renderer ).name()) == 0) {		// Deserialise Renderer.
-			
-							if (const auto r = go->AddComponent<Graphics::Renderer>()) {
-				
-								xml.startNode();
-								xml.finishNode();
-							}
-						}
-						else if (strcmp(name, typeid(Script).name()) == 0) {		// Deserialise Scripts...
-			
-							xml.startNode();
-			
-							std::string type;
-							xml(type);
-							
-							Debug::Assert(!log, "\t\t\t\"" + std::string(type) + "\"", Info);
-							
-							try {
-							
-								if (const auto fPtr = _initialisers.Get(type)) {
-									
-									auto script = (*fPtr)(go->weak_from_this());
-									go->Attach(std::move(script));
-								}
-								else {
-									
-									std::ostringstream err;
-									err << "Deserialisation for type \"" << type << "\" has not been implemented.\n";
-								
-									throw(std::runtime_error(err.str()));
-								}
-								
-							}
-							catch (const std::exception& e) {
-								Debug::Log(e);
-							}
-			
-							xml.finishNode();
-						}
-						else {
-							Debug::Log("Deserialisation for type \"" + std::string(name) + "\" has not been implemented.", Warning);
-						}
-					}
-			
-					xml.finishNode();
-				}
-			
-				xml.finishNode();
+				result->Instantiate(file, _initialisers);
 				
 				Debug::Log("Done.", Info);
 			}
@@ -581,6 +735,25 @@ namespace LouiEriksson::Engine::ECS {
 		}
 	};
 	
+	inline void CommandBuffer::Create(const std::string& _name, std::function<void(GameObject&)>&& _initialiser) {
+		
+		Run([_name, initialiser = std::move(_initialiser)](Scene& _scene) {
+			
+			const auto entity = _scene.Create(_name);
+			
+			if (initialiser) {
+				initialiser(*entity);
+			}
+		});
+	}
+	
+	inline void CommandBuffer::Remove(const std::string& _name) {
+		
+		Run([_name](Scene& _scene) {
+			_scene.Remove(_name);
+		});
+	}
+	
 } // LouiEriksson::Engine::ECS
 
 #endif //FINALYEARPROJECT_SCENE_HPP
\ No newline at end of file
@@ -0,0 +1,723 @@
+#ifndef FINALYEARPROJECT_SCENEFILE_HPP
+#define FINALYEARPROJECT_SCENEFILE_HPP
+
+#include "../core/Debug.hpp"
+#include "../core/File.hpp"
+#include "../core/Serialisation.hpp"
+#include "../core/utils/Hashmap.hpp"
+
+#include <glm/ext.hpp>
+#include <glm/glm.hpp>
+
+#include <cereal/archives/xml.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	/**
+	 * @class SceneFile
+	 * @brief In-memory representation of a Scene file, and the binary format in which it is stored.
+	 *
+	 * @details The binary format consists of a header, a directory of blocks, and the blocks themselves:
+	 *          [Header][Entry]...[block]...
+	 *          Each block holds a single kind of data (e.g. every Transform in the Scene) as a structure of arrays,
+	 *          with each array aligned to s_Alignment bytes. Entity and script type names are held once, in a string table.
+	 *          Integers and floats are stored in the byte order of the machine that wrote the file, which is checked on load.
+	 *
+	 *          Loading a binary file maps it into memory and copies each array out in bulk. Nothing is parsed,
+	 *          and names are referenced directly from the mapping.
+	 *
+	 *          Blocks with an unknown type are skipped, so blocks may be added without breaking older readers.
+	 *          Changes to the layout of existing blocks must increment s_Version.
+	 *
+	 * @see Scene::Load()
+	 */
+	class SceneFile final {
+	
+	public:
+		
+		/** @brief Stable identifiers of the blocks in a file. Values must never change. */
+		enum Block : uint32_t {
+			Strings     = 1U, /**< @brief String table. [u32 offset] * (n + 1), [char]... */
+			Entities    = 2U, /**< @brief [u32 name] * n */
+			Transforms  = 3U, /**< @brief [u32 entity] * n, [vec3 position] * n, [vec4 rotation (x, y, z, w)] * n, [vec3 scale] * n */
+			Rigidbodies = 4U, /**< @brief [u32 entity] * n, [vec3 velocity] * n, [vec3 angular velocity] * n, [f32 mass] * n, [f32 drag] * n, [f32 angular drag] * n */
+			Cameras     = 5U, /**< @brief [u32 entity] * n */
+			Lights      = 6U, /**< @brief [u32 entity] * n */
+			Renderers   = 7U, /**< @brief [u32 entity] * n */
+			Scripts     = 8U, /**< @brief [u32 entity] * n, [u32 type] * n */
+		};
+		
+		/**
+		 * @struct Names
+		 * @brief Names of the component types in XML Scene files.
+		 */
+		struct Names final {
+			
+			std::string m_Transform;
+			std::string m_Rigidbody;
+			std::string m_Camera;
+			std::string m_Light;
+			std::string m_Renderer;
+			std::string m_Script;
+			
+			/** @brief Returns the names used by GCC and Clang, which are those found in the existing levels. */
+			[[nodiscard]] static Names Itanium() {
+				
+				return {
+					"N12LouiEriksson6Engine9TransformE",
+					"N12LouiEriksson6Engine7Physics9RigidbodyE",
+					"N12LouiEriksson6Engine8Graphics6CameraE",
+					"N12LouiEriksson6Engine8Graphics5LightE",
+					"N12LouiEriksson6Engine8Graphics8RendererE",
+					"N12LouiEriksson6Engine6ScriptE"
+				};
+			}
+		};
+		
+		struct TransformBlock final {
+			
+			std::vector<uint32_t>  m_Entities;
+			std::vector<glm::vec3> m_Positions;
+			std::vector<glm::vec4> m_Rotations; /**< @brief Stored as (x, y, z, w). */
+			std::vector<glm::vec3> m_Scales;
+		};
+		
+		struct RigidbodyBlock final {
+			
+			std::vector<uint32_t>  m_Entities;
+			std::vector<glm::vec3> m_Velocities;
+			std::vector<glm::vec3> m_AngularVelocities;
+			std::vector<float>     m_Masses;
+			std::vector<float>     m_Drags;
+			std::vector<float>     m_AngularDrags;
+		};
+		
+		struct ScriptBlock final {
+			
+			std::vector<uint32_t> m_Entities;
+			std::vector<uint32_t> m_Types; /**< @brief Indices of the names of the script types in the string table. */
+		};
+		
+		/** @brief Indices of the names of the entities in the string table. */
+		std::vector<uint32_t> m_Entities;
+		
+		TransformBlock m_Transforms;
+		RigidbodyBlock m_Rigidbodies;
+		
+		std::vector<uint32_t> m_Cameras;
+		std::vector<uint32_t> m_Lights;
+		std::vector<uint32_t> m_Renderers;
+		
+		ScriptBlock m_Scripts;
+	
+	private:
+		
+		static constexpr std::array<char, 8U> s_Magic { 'F', 'Y', 'P', 'S', 'C', 'E', 'N', 'E' };
+		
+		static constexpr uint32_t s_Version = 1U;
+		
+		/** @brief Written as-is, so reads back differently on a machine of the opposite byte order. */
+		static constexpr uint32_t s_ByteOrder = 0x01020304U;
+		
+		static constexpr size_t s_Alignment = 16U;
+		
+		struct Header final {
+			
+			std::array<char, 8U> m_Magic;
+			
+			uint32_t m_Version;
+			uint32_t m_ByteOrder;
+			uint32_t m_BlockCount;
+			uint32_t m_Reserved;
+		};
+		
+		struct Entry final {
+			
+			uint32_t m_Type;
+			uint32_t m_Count;
+			uint64_t m_Offset;
+			uint64_t m_Size;
+		};
+		
+		static_assert(sizeof(Header) == 24U && std::is_trivially_copyable_v<Header>, "Unexpected layout of SceneFile::Header.");
+		static_assert(sizeof(Entry)  == 24U && std::is_trivially_copyable_v<Entry>,  "Unexpected layout of SceneFile::Entry.");
+		
+		static_assert(sizeof(glm::vec3) == 12U && sizeof(glm::vec4) == 16U, "Unexpected layout of glm vectors.");
+		
+		/** @brief The binary file, if the SceneFile was read from one. Strings from it reference the mapping. */
+		File::Mapping m_Mapping;
+		
+		/** @brief Strings added to the SceneFile, which are not held by the mapping. */
+		std::deque<std::string> m_Owned;
+		
+		std::vector<std::string_view> m_Strings;
+		
+		Hashmap<std::string_view, uint32_t> m_Interned;
+		
+		static constexpr size_t Align(const size_t& _offset) noexcept {
+			return (_offset + (s_Alignment - 1U)) & ~(s_Alignment - 1U);
+		}
+		
+		template <typename T>
+		static void Put(std::vector<char>& _data, const T& _value) {
+			
+			static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+			
+			const auto offset = _data.size();
+			
+			_data.resize(offset + sizeof(T));
+			std::memcpy(_data.data() + offset, &_value, sizeof(T));
+		}
+		
+		/** @brief Appends an array to a block, aligned to s_Alignment. */
+		template <typename T>
+		static void PutArray(std::vector<char>& _data, const T* _values, const size_t& _count) {
+			
+			static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+			
+			const auto offset = Align(_data.size());
+			
+			_data.resize(offset + (sizeof(T) * _count));
+			
+			if (_count > 0U) {
+				std::memcpy(_data.data() + offset, _values, sizeof(T) * _count);
+			}
+		}
+		
+		template <typename T>
+		static void PutArray(std::vector<char>& _data, const std::vector<T>& _values) {
+			PutArray(_data, _values.data(), _values.size());
+		}
+		
+		/**
+		 * @brief Copies an array out of a block in bulk.
+		 *
+		 * @param[in] _block The contents of the block.
+		 * @param[in,out] _offset Offset of the end of the previous array within the block.
+		 * @param[in] _count Number of elements in the array.
+		 * @param[out] _values The array.
+		 */
+		template <typename T>
+		static void GetArray(const std::string_view& _block, size_t& _offset, const size_t& _count, std::vector<T>& _values) {
+			
+			static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+			
+			const auto offset = Align(_offset);
+			
+			if (offset > _block.size() || _count > (_block.size() - offset) / sizeof(T)) {
+				throw std::runtime_error("Truncated block in scene file.");
+			}
+			
+			_values.resize(_count);
+			
+			if (_count > 0U) {
+				std::memcpy(_values.data(), _block.data() + offset, sizeof(T) * _count);
+			}
+			
+			_offset = offset + (sizeof(T) * _count);
+		}
+		
+		/** @brief Throws if any of the given entity indices are out of range. */
+		void Validate(const std::vector<uint32_t>& _entities) const {
+			
+			for (const auto& entity : _entities) {
+				
+				if (entity >= m_Entities.size()) {
+					throw std::runtime_error("Invalid entity index in scene file.");
+				}
+			}
+		}
+		
+		void Validate(const uint32_t& _string) const {
+			
+			if (_string >= m_Strings.size()) {
+				throw std::runtime_error("Invalid string index in scene file.");
+			}
+		}
+	
+	public:
+		
+		SceneFile() = default;
+		
+		SceneFile(const SceneFile& _other) = delete;
+		SceneFile& operator = (const SceneFile& _other) = delete;
+		
+		SceneFile(SceneFile&& _other) noexcept = default;
+		SceneFile& operator = (SceneFile&& _other) noexcept = default;
+		
+		/** @brief Returns the string at the given index of the string table. */
+		[[nodiscard]] const std::string_view& String(const uint32_t& _index) const {
+			return m_Strings.at(_index);
+		}
+		
+		/**
+		 * @brief Adds a string to the string table, if it is not already present, and returns its index.
+		 * @note Strings read from a file are not checked, so may be duplicated.
+		 */
+		uint32_t Intern(const std::string_view& _value) {
+			
+			uint32_t result;
+			
+			if (const auto existing = m_Interned.Get(_value)) {
+				result = *existing;
+			}
+			else {
+				
+				result = static_cast<uint32_t>(m_Strings.size());
+				
+				const std::string_view owned = m_Owned.emplace_back(_value);
+				
+				m_Strings.emplace_back(owned);
+				m_Interned.Add(owned, result);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Adds an entity, and returns its index. */
+		uint32_t AddEntity(const std::string_view& _name) {
+			
+			m_Entities.emplace_back(Intern(_name));
+			
+			return static_cast<uint32_t>(m_Entities.size() - 1U);
+		}
+		
+		/** @brief Returns true if the file at the given path is a binary scene file. */
+		[[nodiscard]] static bool IsBinary(const std::filesystem::path& _path) {
+			
+			std::array<char, s_Magic.size()> magic {};
+			
+			std::ifstream stream(_path, std::ios::in | std::ios::binary);
+			
+			return stream.read(magic.data(), static_cast<std::streamsize>(magic.size())) && magic == s_Magic;
+		}
+		
+		/**
+		 * @brief Reads a binary scene file.
+		 * @throws std::runtime_error If the file is not a valid scene file of the current version.
+		 */
+		[[nodiscard]] static SceneFile Read(const std::filesystem::path& _path) {
+			
+			SceneFile result;
+			result.m_Mapping = File::Map(_path, File::Sequential);
+			
+			const auto data = result.m_Mapping.View();
+			
+			Header header {};
+			
+			if (data.size() < sizeof(Header)) {
+				throw std::runtime_error("Truncated scene file.");
+			}
+			
+			std::memcpy(&header, data.data(), sizeof(Header));
+			
+			if (header.m_Magic     != s_Magic    ) { throw std::runtime_error("Not a scene file."); }
+			if (header.m_ByteOrder != s_ByteOrder) { throw std::runtime_error("Scene file has a different byte order."); }
+			if (header.m_Version   != s_Version  ) { throw std::runtime_error("Unsupported scene file version (" + std::to_string(header.m_Version) + ")."); }
+			
+			if (header.m_BlockCount > (data.size() - sizeof(Header)) / sizeof(Entry)) {
+				throw std::runtime_error("Truncated scene file.");
+			}
+			
+			for (size_t i = 0U; i < header.m_BlockCount; ++i) {
+				
+				Entry entry {};
+				std::memcpy(&entry, data.data() + sizeof(Header) + (i * sizeof(Entry)), sizeof(Entry));
+				
+				if (entry.m_Offset > data.size() || entry.m_Size > data.size() - entry.m_Offset) {
+					throw std::runtime_error("Truncated scene file.");
+				}
+				
+				const auto block = data.substr(static_cast<size_t>(entry.m_Offset), static_cast<size_t>(entry.m_Size));
+				
+				const size_t count = entry.m_Count;
+				
+				size_t offset = 0U;
+				
+				switch (entry.m_Type) {
+					
+					case Strings: {
+						
+						std::vector<uint32_t> offsets;
+						GetArray(block, offset, count + 1U, offsets);
+						
+						const auto characters = block.substr(std::min(Align(offset), block.size()));
+						
+						result.m_Strings.reserve(count);
+						
+						for (size_t j = 0U; j < count; ++j) {
+							
+							if (offsets[j] > offsets[j + 1U] || offsets[j + 1U] > characters.size()) {
+								throw std::runtime_error("Invalid string table in scene file.");
+							}
+							
+							result.m_Strings.emplace_back(characters.substr(offsets[j], offsets[j + 1U] - offsets[j]));
+						}
+						
+						break;
+					}
+					case Entities: {
+						GetArray(block, offset, count, result.m_Entities);
+						
+						break;
+					}
+					case Transforms: {
+						
+						auto& transforms = result.m_Transforms;
+						
+						GetArray(block, offset, count, transforms.m_Entities );
+						GetArray(block, offset, count, transforms.m_Positions);
+						GetArray(block, offset, count, transforms.m_Rotations);
+						GetArray(block, offset, count, transforms.m_Scales   );
+						
+						break;
+					}
+					case Rigidbodies: {
+						
+						auto& rigidbodies = result.m_Rigidbodies;
+						
+						GetArray(block, offset, count, rigidbodies.m_Entities         );
+						GetArray(block, offset, count, rigidbodies.m_Velocities       );
+						GetArray(block, offset, count, rigidbodies.m_AngularVelocities);
+						GetArray(block, offset, count, rigidbodies.m_Masses           );
+						GetArray(block, offset, count, rigidbodies.m_Drags            );
+						GetArray(block, offset, count, rigidbodies.m_AngularDrags     );
+						
+						break;
+					}
+					case Cameras:   { GetArray(block, offset, count, result.m_Cameras  ); break; }
+					case Lights:    { GetArray(block, offset, count, result.m_Lights   ); break; }
+					case Renderers: { GetArray(block, offset, count, result.m_Renderers); break; }
+					case Scripts: {
+						
+						GetArray(block, offset, count, result.m_Scripts.m_Entities);
+						GetArray(block, offset, count, result.m_Scripts.m_Types   );
+						
+						break;
+					}
+					default: {
+						// Unknown blocks are skipped.
+						break;
+					}
+				}
+			}
+			
+			/* VALIDATE */
+			for (const auto& name : result.m_Entities) {
+				result.Validate(name);
+			}
+			
+			result.Validate(result.m_Transforms.m_Entities);
+			result.Validate(result.m_Rigidbodies.m_Entities);
+			result.Validate(result.m_Cameras);
+			result.Validate(result.m_Lights);
+			result.Validate(result.m_Renderers);
+			result.Validate(result.m_Scripts.m_Entities);
+			
+			for (const auto& type : result.m_Scripts.m_Types) {
+				result.Validate(type);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Writes the SceneFile to the given path in the binary format.
+		 * @throws std::runtime_error If the file cannot be written.
+		 */
+		void Write(const std::filesystem::path& _path) const {
+			
+			std::vector<std::pair<Entry, std::vector<char>>> blocks;
+			
+			/* STRINGS */
+			{
+				std::vector<uint32_t> offsets;
+				offsets.reserve(m_Strings.size() + 1U);
+				
+				std::string characters;
+				
+				for (const auto& item : m_Strings) {
+					offsets.emplace_back(static_cast<uint32_t>(characters.size()));
+					
+					characters.append(item);
+				}
+				
+				offsets.emplace_back(static_cast<uint32_t>(characters.size()));
+				
+				auto& [entry, data] = blocks.emplace_back(Entry { Strings, static_cast<uint32_t>(m_Strings.size()), 0U, 0U }, std::vector<char>());
+				
+				PutArray(data, offsets);
+				PutArray(data, characters.data(), characters.size());
+			}
+			
+			/* ENTITIES */
+			{
+				auto& [entry, data] = blocks.emplace_back(Entry { Entities, static_cast<uint32_t>(m_Entities.size()), 0U, 0U }, std::vector<char>());
+				
+				PutArray(data, m_Entities);
+			}
+			
+			/* COMPONENTS */
+			if (!m_Transforms.m_Entities.empty()) {
+				
+				auto& [entry, data] = blocks.emplace_back(Entry { Transforms, static_cast<uint32_t>(m_Transforms.m_Entities.size()), 0U, 0U }, std::vector<char>());
+				
+				PutArray(data, m_Transforms.m_Entities );
+				PutArray(data, m_Transforms.m_Positions);
+				PutArray(data, m_Transforms.m_Rotations);
+				PutArray(data, m_Transforms.m_Scales   );
+			}
+			
+			if (!m_Rigidbodies.m_Entities.empty()) {
+				
+				auto& [entry, data] = blocks.emplace_back(Entry { Rigidbodies, static_cast<uint32_t>(m_Rigidbodies.m_Entities.size()), 0U, 0U }, std::vector<char>());
+				
+				PutArray(data, m_Rigidbodies.m_Entities         );
+				PutArray(data, m_Rigidbodies.m_Velocities       );
+				PutArray(data, m_Rigidbodies.m_AngularVelocities);
+				PutArray(data, m_Rigidbodies.m_Masses           );
+				PutArray(data, m_Rigidbodies.m_Drags            );
+				PutArray(data, m_Rigidbodies.m_AngularDrags     );
+			}
+			
+			for (const auto& [type, entities] : { std::make_pair(Cameras, &m_Cameras), std::make_pair(Lights, &m_Lights), std::make_pair(Renderers, &m_Renderers) }) {
+				
+				if (!entities->empty()) {
+					
+					auto& [entry, data] = blocks.emplace_back(Entry { type, static_cast<uint32_t>(entities->size()), 0U, 0U }, std::vector<char>());
+					
+					PutArray(data, *entities);
+				}
+			}
+			
+			if (!m_Scripts.m_Entities.empty()) {
+				
+				auto& [entry, data] = blocks.emplace_back(Entry { Scripts, static_cast<uint32_t>(m_Scripts.m_Entities.size()), 0U, 0U }, std::vector<char>());
+				
+				PutArray(data, m_Scripts.m_Entities);
+				PutArray(data, m_Scripts.m_Types   );
+			}
+			
+			/* LAYOUT */
+			std::vector<char> file;
+			
+			Put(file, Header { s_Magic, s_Version, s_ByteOrder, static_cast<uint32_t>(blocks.size()), 0U });
+			
+			size_t offset = Align(sizeof(Header) + (blocks.size() * sizeof(Entry)));
+			
+			for (auto& [entry, data] : blocks) {
+				
+				entry.m_Offset = offset;
+				entry.m_Size   = data.size();
+				
+				Put(file, entry);
+				
+				offset = Align(offset + data.size());
+			}
+			
+			for (const auto& [entry, data] : blocks) {
+				PutArray(file, data);
+			}
+			
+			std::ofstream stream(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+			
+			if (!stream.write(file.data(), static_cast<std::streamsize>(file.size()))) {
+				throw std::runtime_error("Failed to write scene file \"" + _path.string() + "\".");
+			}
+		}
+		
+		/**
+		 * @brief Reads an XML scene file, as written by Scene::Save().
+		 *
+		 * @param[in] _path The path to the XML file.
+		 * @param[in] _names Names of the component types in the file.
+		 * @throws std::exception If the file is not a valid XML scene file.
+		 */
+		[[nodiscard]] static SceneFile FromXML(const std::filesystem::path& _path, const Names& _names = Names::Itanium()) {
+			
+			SceneFile result;
+			
+			auto ifStream = std::ifstream(_path, std::ifstream::in);
+			
+			auto xml = cereal::XMLInputArchive(ifStream);
+			xml.startNode();
+			
+			auto gameObjectCount = 0;
+			xml.loadSize(gameObjectCount);
+			
+			for (auto i = 0; i < gameObjectCount; ++i) {
+				
+				const auto entity = result.AddEntity(xml.getNodeName());
+				
+				xml.startNode();
+				
+				auto count = 0;
+				xml.loadSize(count);
+				
+				for (auto j = 0; j < count; j++) {
+					
+					const std::string_view name = xml.getNodeName();
+					
+					xml.startNode();
+					
+					if (name == _names.m_Transform) {
+						
+						const auto position = Serialisation::Deserialise<glm::vec3>(Serialisation::ParseNext(xml, -1));
+						const auto rotation = Serialisation::Deserialise<glm::quat>(Serialisation::ParseNext(xml, -1));
+						const auto scale    = Serialisation::Deserialise<glm::vec3>(Serialisation::ParseNext(xml, -1));
+						
+						auto& transforms = result.m_Transforms;
+						transforms.m_Entities.emplace_back(entity);
+						transforms.m_Positions.emplace_back(position);
+						transforms.m_Rotations.emplace_back(rotation.x, rotation.y, rotation.z, rotation.w);
+						transforms.m_Scales.emplace_back(scale);
+					}
+					else if (name == _names.m_Rigidbody) {
+						
+						auto& rigidbodies = result.m_Rigidbodies;
+						rigidbodies.m_Entities.emplace_back(entity);
+						rigidbodies.m_Velocities.emplace_back       (Serialisation::Deserialise<glm::vec3>(Serialisation::ParseNext(xml, -1)));
+						rigidbodies.m_AngularVelocities.emplace_back(Serialisation::Deserialise<glm::vec3>(Serialisation::ParseNext(xml, -1)));
+						rigidbodies.m_Masses.emplace_back           (Serialisation::Deserialise<float>    (Serialisation::ParseNext(xml, -1)));
+						rigidbodies.m_Drags.emplace_back            (Serialisation::Deserialise<float>    (Serialisation::ParseNext(xml, -1)));
+						rigidbodies.m_AngularDrags.emplace_back     (Serialisation::Deserialise<float>    (Serialisation::ParseNext(xml, -1)));
+					}
+					else if (name == _names.m_Camera) {
+						result.m_Cameras.emplace_back(entity);
+					}
+					else if (name == _names.m_Light) {
+						result.m_Lights.emplace_back(entity);
+					}
+					else if (name == _names.m_Renderer) {
+						result.m_Renderers.emplace_back(entity);
+					}
+					else if (name == _names.m_Script) {
+						
+						std::string type;
+						xml(type);
+						
+						result.m_Scripts.m_Entities.emplace_back(entity);
+						result.m_Scripts.m_Types.emplace_back(result.Intern(type));
+					}
+					else {
+						Debug::Log("Deserialisation for type \"" + std::string(name) + "\" has not been implemented.", Warning);
+					}
+					
+					xml.finishNode();
+				}
+				
+				xml.finishNode();
+			}
+			
+			xml.finishNode();
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Writes the SceneFile to the given path in the XML format.
+		 *
+		 * @param[in] _path The path to the XML file.
+		 * @param[in] _names Names to give the component types in the file.
+		 * @throws std::exception If the file cannot be written.
+		 */
+		void ToXML(const std::filesystem::path& _path, const Names& _names = Names::Itanium()) const {
+			
+			// Gather the components of each entity, in the order of the blocks.
+			std::vector<std::vector<std::pair<Block, size_t>>> components(m_Entities.size());
+			
+			for (size_t i = 0U; i < m_Transforms.m_Entities.size();  ++i) { components[m_Transforms.m_Entities[i]].emplace_back(Transforms, i);   }
+			for (size_t i = 0U; i < m_Rigidbodies.m_Entities.size(); ++i) { components[m_Rigidbodies.m_Entities[i]].emplace_back(Rigidbodies, i); }
+			for (size_t i = 0U; i < m_Cameras.size();                ++i) { components[m_Cameras[i]].emplace_back(Cameras, i);                     }
+			for (size_t i = 0U; i < m_Lights.size();                 ++i) { components[m_Lights[i]].emplace_back(Lights, i);                       }
+			for (size_t i = 0U; i < m_Renderers.size();              ++i) { components[m_Renderers[i]].emplace_back(Renderers, i);                 }
+			for (size_t i = 0U; i < m_Scripts.m_Entities.size();     ++i) { components[m_Scripts.m_Entities[i]].emplace_back(Scripts, i);          }
+			
+			auto ofStream = std::ofstream(_path);
+			
+			auto xml = cereal::XMLOutputArchive(ofStream);
+			
+			xml.setNextName("Entities"); // Start "Entities"
+			xml.startNode();
+			
+			for (size_t i = 0U; i < m_Entities.size(); ++i) {
+				
+				const auto name = std::string(String(m_Entities[i]));
+				
+				xml.setNextName(name.c_str());
+				xml.startNode();
+				
+				for (const auto& [block, index] : components[i]) {
+					
+					switch (block) {
+						case Transforms: {
+							
+							const auto& rotation = m_Transforms.m_Rotations[index];
+							
+							xml.setNextName(_names.m_Transform.c_str());
+							xml.startNode();
+							
+							xml(cereal::make_nvp("Position", Serialisation::Serialise(m_Transforms.m_Positions[index])));
+							xml(cereal::make_nvp("Rotation", Serialisation::Serialise(glm::quat(rotation.w, rotation.x, rotation.y, rotation.z))));
+							xml(cereal::make_nvp("Scale",    Serialisation::Serialise(m_Transforms.m_Scales[index])));
+							
+							break;
+						}
+						case Rigidbodies: {
+							
+							xml.setNextName(_names.m_Rigidbody.c_str());
+							xml.startNode();
+							
+							xml(cereal::make_nvp("Velocity",        Serialisation::Serialise(m_Rigidbodies.m_Velocities[index])));
+							xml(cereal::make_nvp("AngularVelocity", Serialisation::Serialise(m_Rigidbodies.m_AngularVelocities[index])));
+							xml(cereal::make_nvp("Mass",            m_Rigidbodies.m_Masses[index]));
+							xml(cereal::make_nvp("Drag",            m_Rigidbodies.m_Drags[index]));
+							xml(cereal::make_nvp("AngularDrag",     m_Rigidbodies.m_AngularDrags[index]));
+							
+							break;
+						}
+						case Cameras:   { xml.setNextName(_names.m_Camera.c_str());   xml.startNode(); break; }
+						case Lights:    { xml.setNextName(_names.m_Light.c_str());    xml.startNode(); break; }
+						case Renderers: { xml.setNextName(_names.m_Renderer.c_str()); xml.startNode(); break; }
+						case Scripts: {
+							
+							xml.setNextName(_names.m_Script.c_str());
+							xml.startNode();
+							
+							xml(cereal::make_nvp("TypeID", std::string(String(m_Scripts.m_Types[index]))));
+							
+							break;
+						}
+						default: {
+							throw std::logic_error("Unexpected block type.");
+						}
+					}
+					
+					xml.finishNode();
+				}
+				
+				xml.finishNode();
+			}
+			
+			xml.finishNode();
+		}
+	};
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_SCENEFILE_HPP
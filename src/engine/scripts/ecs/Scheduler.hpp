@@ -0,0 +1,149 @@
+#ifndef FINALYEARPROJECT_SCHEDULER_HPP
+#define FINALYEARPROJECT_SCHEDULER_HPP
+
+#include "../core/Script.hpp"
+#include "../core/utils/JobSystem.hpp"
+
+#include "Access.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	/**
+	 * @class Scheduler
+	 * @brief Runs Scripts which have declared their dependencies across the job pool.
+	 *
+	 * @details Each call builds a dependency graph from the Accesses of the Scripts, in the order given, including main-thread Scripts.
+	 *          Scripts which may run on any thread are scheduled as Gameplay jobs, each depending on the earlier jobs it conflicts with.
+	 *          Main-thread Scripts run in order, each waiting only for the earlier jobs it conflicts with, so they run alongside the rest.
+	 *          A Script which follows a conflicting main-thread Script is not scheduled until that Script has run.
+	 *
+	 * @note Scripts which have not declared their dependencies (see Access::Exclusive()) are not handled here, and are run by the Scene
+	 *       once no jobs are in flight.
+	 *
+	 * @see Script::Dependencies()
+	 */
+	class Scheduler final {
+	
+	private:
+		
+		/** @brief Scheduled jobs, and the Access of the Script each runs. */
+		std::vector<std::pair<const Access*, Threading::JobSystem::Handle>> m_Jobs;
+		
+		std::vector<Threading::JobSystem::Handle> m_Dependencies;
+		
+		/** @brief Positions of the main-thread Scripts. */
+		std::vector<size_t> m_MainThread;
+		
+		/** @brief Positions of the Scripts which must wait for a main-thread Script before being scheduled. */
+		std::vector<size_t> m_Deferred;
+		
+		/** @brief Schedules a Script as a job depending on the scheduled jobs it conflicts with. */
+		void Schedule(Script* _script, const bool& _late) {
+			
+			const auto& access = _script->m_Access;
+			
+			m_Dependencies.clear();
+			
+			for (const auto& [other, job] : m_Jobs) {
+				
+				if (access.Conflicts(*other)) {
+					m_Dependencies.emplace_back(job);
+				}
+			}
+			
+			m_Jobs.emplace_back(&access, Threading::JobSystem::Schedule([_script, _late]() {
+				_script->Invoke(_late);
+			}, Threading::JobSystem::Gameplay, nullptr, m_Dependencies));
+		}
+		
+		/** @brief Returns true if any of the given Scripts conflicts with the given Access. */
+		static bool Conflicts(const Access& _access, const std::vector<Script*>& _scripts, const std::vector<size_t>& _positions) {
+			
+			bool result = false;
+			
+			for (const auto& position : _positions) {
+				
+				if (_access.Conflicts(_scripts[position]->m_Access)) {
+					result = true;
+					
+					break;
+				}
+			}
+			
+			return result;
+		}
+	
+	public:
+		
+		/**
+		 * @brief Ticks the given Scripts, returning once they have all finished.
+		 *
+		 * @param[in] _scripts The Scripts to tick. None may be exclusive.
+		 * @param[in] _late Whether to invoke LateTick() instead of Tick().
+		 */
+		void Run(const std::vector<Script*>& _scripts, const bool& _late) {
+			
+			m_Jobs.clear();
+			m_MainThread.clear();
+			m_Deferred.clear();
+			
+			/* SCHEDULE PARALLEL SCRIPTS */
+			for (size_t i = 0U; i < _scripts.size(); ++i) {
+				
+				const auto& access = _scripts[i]->m_Access;
+				
+				if (access.IsMainThread()) {
+					m_MainThread.emplace_back(i);
+				}
+				else if (Conflicts(access, _scripts, m_MainThread) || Conflicts(access, _scripts, m_Deferred)) {
+					
+					// Must follow an earlier main-thread Script, either directly or through another deferred Script.
+					m_Deferred.emplace_back(i);
+				}
+				else {
+					Schedule(_scripts[i], _late);
+				}
+			}
+			
+			/* RUN MAIN-THREAD SCRIPTS */
+			size_t deferred = 0U;
+			
+			for (const auto& i : m_MainThread) {
+				
+				// The main-thread Scripts preceding the deferred Scripts before this one have now run.
+				for (; deferred < m_Deferred.size() && m_Deferred[deferred] < i; ++deferred) {
+					Schedule(_scripts[m_Deferred[deferred]], _late);
+				}
+				
+				const auto& access = _scripts[i]->m_Access;
+				
+				for (const auto& [other, job] : m_Jobs) {
+					
+					if (access.Conflicts(*other)) {
+						Threading::JobSystem::Wait(job);
+					}
+				}
+				
+				_scripts[i]->Invoke(_late);
+			}
+			
+			for (; deferred < m_Deferred.size(); ++deferred) {
+				Schedule(_scripts[m_Deferred[deferred]], _late);
+			}
+			
+			/* SYNC */
+			for (const auto& [other, job] : m_Jobs) {
+				Threading::JobSystem::Wait(job);
+			}
+			
+			m_Jobs.clear();
+		}
+	};
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_SCHEDULER_HPP
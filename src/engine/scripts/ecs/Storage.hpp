@@ -0,0 +1,968 @@
+#ifndef FINALYEARPROJECT_STORAGE_HPP
+#define FINALYEARPROJECT_STORAGE_HPP
+
+#include "../core/Script.hpp"
+
+#include "Component.hpp"
+#include "Prototype.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson::Engine::ECS {
+	
+	class GameObject;
+	class Scene;
+	
+	/**
+	 * @class Storage
+	 * @brief Contiguous storage of the Components of a Scene, grouped by type.
+	 *
+	 * @details GameObjects, and Components, are allocated from a pool per type, so that objects of the same type are adjacent in memory.
+	 *          Every attached Component is also listed, alongside its owner, in a dense array for its category (its own type,
+	 *          or Script for all scripts). Systems iterate these arrays directly using View(), rather than visiting every
+	 *          GameObject and looking up its Components.
+	 *
+	 *          Like Hashmap::View(), removals are deferred while a view of a category is open: removed entries are skipped
+	 *          immediately, but are only erased once no view of the category remains open.
+	 *
+	 *          Query() additionally caches which Components belong to active GameObjects with a given set of Component types.
+	 *
+	 * @note Storage is not thread-safe. GameObjects and their Components must be created, modified and destroyed on the main thread.
+	 */
+	class Storage final : public std::enable_shared_from_this<Storage> {
+		
+		friend GameObject;
+	
+	private:
+		
+		/** @brief Identifier of a category with no Components registered. */
+		static constexpr size_t s_None = std::numeric_limits<size_t>::max();
+		
+		struct Item final {
+			
+			Component*  m_Component;
+			GameObject* m_Owner;
+		};
+		
+		struct List final {
+			
+			std::vector<Item> m_Items;
+			
+			/** @brief Number of views currently open over the List. */
+			size_t m_Views = 0U;
+			
+			/** @brief Number of entries removed since the List was last compacted. */
+			size_t m_Removed = 0U;
+			
+			/** @brief Incremented whenever an entry is added or removed. */
+			uint64_t m_Revision = 0U;
+		};
+	
+	public:
+		
+		/**
+		 * @struct Entry
+		 * @brief A Component and the GameObject it is attached to.
+		 */
+		template<typename T>
+		struct Entry final {
+			
+			T&          m_Component;
+			GameObject& m_Owner;
+		};
+		
+		/**
+		 * @class Range
+		 * @brief Iterable view of every Component in a category.
+		 *
+		 * @details Components registered while the Range is open are not visited. Components removed while it is open are skipped.
+		 */
+		template<typename T>
+		class Range final {
+			
+			friend Storage;
+		
+		private:
+			
+			List* m_List;
+			
+			size_t m_Size;
+			
+			explicit Range(List* _list) noexcept :
+				m_List(_list),
+				m_Size(_list != nullptr ? _list->m_Items.size() : 0U)
+			{
+				if (m_List != nullptr) {
+					++m_List->m_Views;
+				}
+			}
+		
+		public:
+			
+			class Iterator final {
+				
+				friend Range;
+			
+			private:
+				
+				const List* m_List;
+				
+				size_t m_Index;
+				size_t m_End;
+				
+				constexpr Iterator(const List* _list, const size_t& _index, const size_t& _end) noexcept :
+					m_List(_list),
+					m_Index(_index),
+					m_End(_end)
+				{
+					Skip();
+				}
+				
+				/** @brief Advances past removed entries. */
+				constexpr void Skip() noexcept {
+					
+					while (m_Index < m_End && m_List->m_Items[m_Index].m_Component == nullptr) {
+						++m_Index;
+					}
+				}
+			
+			public:
+				
+				Entry<T> operator *() const noexcept {
+					
+					const auto& item = m_List->m_Items[m_Index];
+					
+					return { *static_cast<T*>(item.m_Component), *item.m_Owner };
+				}
+				
+				constexpr Iterator& operator ++() noexcept {
+					
+					++m_Index;
+					Skip();
+					
+					return *this;
+				}
+				
+				constexpr bool operator !=(const Iterator& _other) const noexcept {
+					return m_Index != _other.m_Index;
+				}
+			};
+			
+			Range(const Range& _other) = delete;
+			Range& operator = (const Range& _other) = delete;
+			
+			Range(Range&& _other) noexcept :
+				m_List(std::exchange(_other.m_List, nullptr)),
+				m_Size(std::exchange(_other.m_Size, 0U)) {}
+			
+			Range& operator = (Range&& _other) noexcept = delete;
+			
+			~Range() {
+				
+				if (m_List != nullptr && --m_List->m_Views == 0U) {
+					Compact(*m_List);
+				}
+			}
+			
+			/** @brief Returns the number of entries in the view, including any removed since it was opened. */
+			[[nodiscard]] constexpr const size_t& size() const noexcept { return m_Size; }
+			
+			[[nodiscard]] Iterator begin() const noexcept { return { m_List, 0U,     m_Size }; }
+			[[nodiscard]] Iterator   end() const noexcept { return { m_List, m_Size, m_Size }; }
+		};
+		
+		/**
+		 * @class SelectionBase
+		 * @brief Type-erased interface of a Selection.
+		 */
+		class SelectionBase {
+			
+			friend Storage;
+			friend GameObject;
+			
+		protected:
+			
+			/** @brief Number of views currently open over the Selection. */
+			size_t m_Views = 0U;
+			
+			/** @brief Number of matches removed since the Selection was last compacted. */
+			size_t m_Removed = 0U;
+			
+			/**
+			 * @brief Re-evaluates the matches of a GameObject.
+			 * @details Matches which still qualify are left in place, so that open Ranges continue to visit them. Matches which no
+			 *          longer qualify are marked as removed, and new matches are appended.
+			 */
+			virtual void Update(GameObject& _owner) = 0;
+			
+			/** @brief Marks the match at a slot as removed. */
+			virtual void Erase(const size_t& _slot) noexcept = 0;
+			
+			/** @brief Updates the owner of the match at a slot. */
+			virtual void Rebind(const size_t& _slot, GameObject* _owner) noexcept = 0;
+			
+			/**
+			 * @brief Erases removed matches, preserving the order of those remaining.
+			 * @note Only compacts once a quarter of the matches have been removed, so that removing many GameObjects costs linear time.
+			 */
+			virtual void Compact() noexcept = 0;
+			
+			/** @brief Removes every match of a GameObject. */
+			void Remove(GameObject& _owner) noexcept;
+			
+		public:
+			
+			SelectionBase() = default;
+			
+			SelectionBase(const SelectionBase& _other) = delete;
+			SelectionBase& operator = (const SelectionBase& _other) = delete;
+			
+			virtual ~SelectionBase() = default;
+		};
+		
+		/**
+		 * @class Selection
+		 * @brief Cached result of Query<T, Us...>().
+		 *
+		 * @details Holds each Component of type T whose GameObject is active and also has Components of each of the types Us,
+		 *          alongside the first of each. Matches are updated as Components are added or removed, GameObjects are
+		 *          activated or deactivated, and GameObjects are removed from their Scene.
+		 */
+		template<typename T, typename... Us>
+		class Selection final : public SelectionBase {
+			
+			friend Storage;
+			
+			static_assert(((std::is_same_v<T, Script> || !std::is_base_of_v<Script, T>) && ... && (std::is_same_v<Us, Script> || !std::is_base_of_v<Script, Us>)),
+				"Scripts can only be queried as \"Script\".");
+			
+		private:
+			
+			struct Match final {
+				
+				std::tuple<T*, Us*...> m_Components;
+				
+				GameObject* m_Owner;
+			};
+			
+			std::vector<Match> m_Matches;
+			
+			void Update(GameObject& _owner) override;
+			
+			void Erase(const size_t& _slot) noexcept override {
+				
+				m_Matches[_slot].m_Owner = nullptr;
+				++m_Removed;
+			}
+			
+			void Rebind(const size_t& _slot, GameObject* _owner) noexcept override {
+				m_Matches[_slot].m_Owner = _owner;
+			}
+			
+			void Compact() noexcept override;
+			
+		public:
+			
+			/**
+			 * @class Range
+			 * @brief Iterable view of the matches of a Selection.
+			 *
+			 * @details Matches added while the Range is open are not visited. Matches removed while it is open are skipped.
+			 */
+			class Range final {
+				
+				friend Storage;
+				
+			private:
+				
+				Selection* m_Selection;
+				
+				size_t m_Size;
+				
+				explicit Range(Selection* _selection) noexcept :
+					m_Selection(_selection),
+					m_Size(_selection->m_Matches.size())
+				{
+					++m_Selection->m_Views;
+				}
+				
+			public:
+				
+				class Iterator final {
+					
+					friend Range;
+					
+				private:
+					
+					const Selection* m_Selection;
+					
+					size_t m_Index;
+					size_t m_End;
+					
+					constexpr Iterator(const Selection* _selection, const size_t& _index, const size_t& _end) noexcept :
+						m_Selection(_selection),
+						m_Index(_index),
+						m_End(_end)
+					{
+						Skip();
+					}
+					
+					/** @brief Advances past removed matches. */
+					constexpr void Skip() noexcept {
+						
+						while (m_Index < m_End && m_Selection->m_Matches[m_Index].m_Owner == nullptr) {
+							++m_Index;
+						}
+					}
+					
+				public:
+					
+					std::tuple<T&, Us&..., GameObject&> operator *() const noexcept {
+						
+						const auto& match = m_Selection->m_Matches[m_Index];
+						
+						return std::apply([&match](auto*... _components) {
+							return std::tuple<T&, Us&..., GameObject&>(*_components..., *match.m_Owner);
+						}, match.m_Components);
+					}
+					
+					constexpr Iterator& operator ++() noexcept {
+						
+						++m_Index;
+						Skip();
+						
+						return *this;
+					}
+					
+					constexpr bool operator !=(const Iterator& _other) const noexcept {
+						return m_Index != _other.m_Index;
+					}
+				};
+				
+				Range(const Range& _other) = delete;
+				Range& operator = (const Range& _other) = delete;
+				
+				Range(Range&& _other) noexcept :
+					m_Selection(std::exchange(_other.m_Selection, nullptr)),
+					m_Size(std::exchange(_other.m_Size, 0U)) {}
+				
+				Range& operator = (Range&& _other) noexcept = delete;
+				
+				~Range() {
+					
+					if (m_Selection != nullptr && --m_Selection->m_Views == 0U) {
+						m_Selection->Compact();
+					}
+				}
+				
+				/** @brief Returns the number of matches in the view, including any removed since it was opened. */
+				[[nodiscard]] constexpr const size_t& size() const noexcept { return m_Size; }
+				
+				[[nodiscard]] Iterator begin() const noexcept { return { m_Selection, 0U,     m_Size }; }
+				[[nodiscard]] Iterator   end() const noexcept { return { m_Selection, m_Size, m_Size }; }
+			};
+		};
+	
+	private:
+		
+		/**
+		 * @class Pool
+		 * @brief Allocates fixed-size blocks from contiguous chunks of memory.
+		 *
+		 * @details The size of the blocks is set by the first allocation, which is the combined size of an object
+		 *          and the reference count std::allocate_shared places alongside it. Memory is only returned to the system
+		 *          when the Pool is destroyed, a chunk at a time.
+		 *
+		 * @note Pools are reference-counted by the allocators of the objects allocated from them,
+		 *       so that a Pool outlives any object which outlives its Storage.
+		 */
+		class Pool final {
+		
+		private:
+			
+			/** @brief Approximate size of each chunk, in bytes. */
+			static constexpr size_t s_ChunkBytes = 16384U;
+			
+			size_t m_Size;
+			size_t m_BlockSize;
+			size_t m_Alignment;
+			size_t m_Capacity;
+			
+			/** @brief Head of the intrusive list of free blocks. */
+			void* m_Free;
+			
+			/** @brief Number of blocks in the free list. */
+			size_t m_Available;
+			
+			std::vector<void*> m_Chunks;
+			
+			/** @brief Total number of blocks in the chunks. */
+			size_t m_Blocks;
+			
+			/** @brief Guards the free list, as the last reference to a Component may be released on any thread. */
+			std::mutex m_Lock;
+			
+			/** @brief Adds a chunk of the given number of blocks to the free list. */
+			void Grow(const size_t& _blocks) {
+				
+				auto* const chunk = static_cast<std::byte*>(::operator new(m_BlockSize * _blocks, std::align_val_t(m_Alignment)));
+				
+				m_Chunks.emplace_back(chunk);
+				
+				s_Chunks.fetch_add(1U, std::memory_order_relaxed);
+				s_Bytes.fetch_add(m_BlockSize * _blocks, std::memory_order_relaxed);
+				
+				// Thread the blocks of the chunk onto the free list, in order of address.
+				for (size_t i = _blocks; i > 0U; --i) {
+					
+					auto* const block = chunk + ((i - 1U) * m_BlockSize);
+					
+					*reinterpret_cast<void**>(block) = m_Free;
+					m_Free = block;
+				}
+				
+				m_Available += _blocks;
+				m_Blocks    += _blocks;
+			}
+			
+		public:
+			
+			Pool() noexcept :
+				m_Size     (0U),
+				m_BlockSize(0U),
+				m_Alignment(0U),
+				m_Capacity (0U),
+				m_Free(nullptr),
+				m_Available(0U),
+				m_Blocks(0U) {}
+			
+			Pool(const Pool& _other) = delete;
+			Pool& operator = (const Pool& _other) = delete;
+			
+			~Pool() {
+				
+				for (auto* const chunk : m_Chunks) {
+					::operator delete(chunk, std::align_val_t(m_Alignment));
+				}
+				
+				s_Chunks.fetch_sub(m_Chunks.size(), std::memory_order_relaxed);
+				s_Bytes.fetch_sub(m_BlockSize * m_Blocks, std::memory_order_relaxed);
+			}
+			
+			/**
+			 * @brief Allocates a block for an object of the given size and alignment.
+			 * @return The block, or nullptr if the object does not match the blocks of the Pool.
+			 */
+			void* Allocate(const size_t& _size, const size_t& _alignment) {
+				
+				const std::lock_guard<std::mutex> lock(m_Lock);
+				
+				if (m_Size == 0U) {
+					
+					m_Size      = _size;
+					m_Alignment = std::max(_alignment, alignof(void*));
+					m_BlockSize = ((std::max(_size, sizeof(void*)) + m_Alignment - 1U) / m_Alignment) * m_Alignment;
+					m_Capacity  = std::max(s_ChunkBytes / m_BlockSize, static_cast<size_t>(1U));
+				}
+				
+				void* result = nullptr;
+				
+				if (_size == m_Size && _alignment <= m_Alignment) {
+					
+					if (m_Free == nullptr) {
+						Grow(m_Capacity);
+					}
+					
+					result = m_Free;
+					m_Free = *static_cast<void**>(m_Free);
+					
+					--m_Available;
+					
+					s_Allocations.fetch_add(1U, std::memory_order_relaxed);
+					s_Live.fetch_add(1U, std::memory_order_relaxed);
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Ensures the given number of blocks can be allocated without growing the Pool again.
+			 * @note Has no effect until the size of the blocks is set by the first allocation.
+			 */
+			void Reserve(const size_t& _count) {
+				
+				const std::lock_guard<std::mutex> lock(m_Lock);
+				
+				if (m_Size != 0U && _count > m_Available) {
+					Grow(std::max(_count - m_Available, m_Capacity));
+				}
+			}
+			
+			/**
+			 * @brief Frees a block.
+			 * @return False if the object was not allocated by the Pool.
+			 */
+			bool Free(void* _block, const size_t& _size) noexcept {
+				
+				const std::lock_guard<std::mutex> lock(m_Lock);
+				
+				const auto result = _size == m_Size;
+				
+				if (result) {
+					*static_cast<void**>(_block) = m_Free;
+					m_Free = _block;
+					
+					++m_Available;
+					
+					s_Live.fetch_sub(1U, std::memory_order_relaxed);
+				}
+				
+				return result;
+			}
+		};
+		
+		/**
+		 * @brief Allocator which places an object (and its reference count) in a block of a Pool.
+		 *
+		 * @details Objects are constructed by the allocator, so that GameObjects (whose constructor is private to Storage) can be pooled.
+		 * @see std::allocate_shared
+		 */
+		template<typename U>
+		struct Allocator final {
+			
+			using value_type = U;
+			
+			std::shared_ptr<Pool> m_Pool;
+			
+			explicit Allocator(std::shared_ptr<Pool> _pool) noexcept :
+				m_Pool(std::move(_pool)) {}
+			
+			template<typename V>
+			Allocator(const Allocator<V>& _other) noexcept :
+				m_Pool(_other.m_Pool) {}
+			
+			U* allocate(const size_t _count) {
+				
+				void* result = _count == 1U ? m_Pool->Allocate(sizeof(U), alignof(U)) : nullptr;
+				
+				if (result == nullptr) {
+					result = ::operator new(_count * sizeof(U), std::align_val_t(alignof(U)));
+					
+					s_Fallbacks.fetch_add(1U, std::memory_order_relaxed);
+				}
+				
+				return static_cast<U*>(result);
+			}
+			
+			template<typename V, typename... Args>
+			void construct(V* _ptr, Args&&... _args) {
+				::new (static_cast<void*>(_ptr)) V(std::forward<Args>(_args)...);
+			}
+			
+			void deallocate(U* _ptr, const size_t _count) noexcept {
+				
+				if (_count != 1U || !m_Pool->Free(_ptr, sizeof(U))) {
+					::operator delete(_ptr, std::align_val_t(alignof(U)));
+				}
+			}
+			
+			template<typename V>
+			bool operator ==(const Allocator<V>& _other) const noexcept { return m_Pool == _other.m_Pool; }
+			
+			template<typename V>
+			bool operator !=(const Allocator<V>& _other) const noexcept { return m_Pool != _other.m_Pool; }
+		};
+		
+		inline static std::atomic<size_t> s_NextID { 0U };
+		
+		inline static std::atomic<size_t> s_Allocations { 0U };
+		inline static std::atomic<size_t> s_Live        { 0U };
+		inline static std::atomic<size_t> s_Fallbacks   { 0U };
+		inline static std::atomic<size_t> s_Chunks      { 0U };
+		inline static std::atomic<size_t> s_Bytes       { 0U };
+		
+		/** @brief Pool of the GameObjects of the Storage. */
+		std::shared_ptr<Pool> m_Objects = std::make_shared<Pool>();
+		
+		/** @brief Dense list of the Components of each category, indexed by ID(). */
+		std::vector<std::unique_ptr<List>> m_Lists;
+		
+		/** @brief Pool of each Component type, indexed by ID(). */
+		std::vector<std::shared_ptr<Pool>> m_Pools;
+		
+		/** @brief Selection of each Query, indexed by ID(). */
+		std::vector<std::unique_ptr<SelectionBase>> m_Selections;
+		
+		/** @brief Selections which depend on each category, indexed by ID(). */
+		std::vector<std::vector<SelectionBase*>> m_Dependents;
+		
+		/** @brief Returns a unique, sequential identifier for a type. */
+		template<typename T>
+		static size_t ID() noexcept {
+			
+			static const size_t s_ID = s_NextID.fetch_add(1U, std::memory_order_relaxed);
+			
+			return s_ID;
+		}
+		
+		/** @brief Returns the number of times T appears in Us. */
+		template<typename T, typename... Us>
+		static constexpr size_t Occurrences() noexcept {
+			return (static_cast<size_t>(std::is_same_v<T, Us>) + ... + 0U);
+		}
+		
+		/** @brief Category under which Components of type T are listed. Scripts are all listed as Script. */
+		template<typename T>
+		using Category = std::conditional_t<std::is_base_of_v<Script, T>, Script, T>;
+		
+		/**
+		 * @brief Ensures the given number of additional GameObjects with Components of types Ts can be created without reallocating.
+		 *
+		 * @details Unlike calling Reserve() for each type, types which are repeated or share a category (e.g. Scripts) are
+		 *          reserved for their total, and the Slots shared by every Component are reserved for the whole batch at once.
+		 */
+		template<typename... Ts>
+		void ReserveBatch(const size_t& _count) {
+			
+			([this, &_count]() {
+				
+				auto& items = GetList(ID<Category<Ts>>()).m_Items;
+				items.reserve(items.size() + (_count * Occurrences<Category<Ts>, Category<Ts>...>()));
+				
+				if (const auto id = ID<Ts>(); id < m_Pools.size() && m_Pools[id] != nullptr) {
+					m_Pools[id]->Reserve(_count * Occurrences<Ts, Ts...>());
+				}
+			}(), ...);
+			
+			Slots<Component>::Reserve(_count * sizeof...(Ts));
+		}
+		
+		/**
+		 * @brief Erases removed entries from a List, preserving the order of those remaining.
+		 * @note Only compacts once a quarter of the entries have been removed, so that removing many Components costs linear time.
+		 */
+		static void Compact(List& _list) noexcept {
+			
+			if (_list.m_Removed > 0U && _list.m_Views == 0U && _list.m_Removed * 4U >= _list.m_Items.size()) {
+				
+				size_t count = 0U;
+				
+				for (auto& item : _list.m_Items) {
+					
+					if (item.m_Component != nullptr) {
+						
+						item.m_Component->m_Slot = count;
+						_list.m_Items[count++] = item;
+					}
+				}
+				
+				_list.m_Items.resize(count);
+				_list.m_Removed = 0U;
+			}
+		}
+		
+		List& GetList(const size_t& _category) {
+			
+			if (_category >= m_Lists.size()) {
+				m_Lists.resize(_category + 1U);
+			}
+			
+			auto& result = m_Lists[_category];
+			
+			if (result == nullptr) {
+				result = std::make_unique<List>();
+			}
+			
+			return *result;
+		}
+		
+		/**
+		 * @brief Creates a Component of type T.
+		 *
+		 * @details Only types with a public constructor and destructor can be allocated from the Pool of their type.
+		 * @return The Component, or nullptr if T cannot be pooled.
+		 */
+		template<typename T>
+		std::shared_ptr<T> Allocate(const std::weak_ptr<GameObject>& _parent) {
+			
+			std::shared_ptr<T> result;
+			
+			if constexpr (std::is_constructible_v<T, const std::weak_ptr<GameObject>&> && std::is_destructible_v<T>) {
+				
+				const auto id = ID<T>();
+				
+				if (id >= m_Pools.size()) {
+					m_Pools.resize(id + 1U);
+				}
+				
+				auto& pool = m_Pools[id];
+				
+				if (pool == nullptr) {
+					pool = std::make_shared<Pool>();
+				}
+				
+				result = std::allocate_shared<T>(Allocator<T>(pool), _parent);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Returns the first Component of type T attached to a GameObject, or nullptr if there is none. */
+		template<typename T>
+		static T* First(const GameObject& _owner);
+		
+		/** @brief Re-evaluates the matches of a GameObject in the Selections which depend on a category. */
+		void Refresh(const size_t& _category, GameObject& _owner) {
+			
+			if (_category < m_Dependents.size()) {
+				
+				for (auto* const selection : m_Dependents[_category]) {
+					selection->Update(_owner);
+				}
+			}
+		}
+		
+		/** @brief Re-evaluates the matches of a GameObject in every Selection. */
+		void Refresh(GameObject& _owner) {
+			
+			for (const auto& selection : m_Selections) {
+				
+				if (selection != nullptr) {
+					selection->Update(_owner);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Lists a Component under a category.
+		 *
+		 * @param[in] _category Category of the Component.
+		 * @param[in] _component The Component.
+		 * @param[in] _owner GameObject the Component is attached to.
+		 */
+		void Register(const size_t& _category, Component* _component, GameObject* _owner) {
+			
+			if (_component->m_Category == s_None) {
+				
+				auto& list = GetList(_category);
+				
+				_component->m_Category = _category;
+				_component->m_Slot     = list.m_Items.size();
+				
+				list.m_Items.push_back({ _component, _owner });
+				++list.m_Revision;
+				
+				Refresh(_category, *_owner);
+			}
+		}
+		
+		/**
+		 * @brief Removes a Component from the list of its category.
+		 * @note The Component must already have been detached from its owner.
+		 */
+		void Unregister(Component* _component) {
+			
+			if (_component->m_Category != s_None) {
+				
+				const auto category = _component->m_Category;
+				
+				auto& list = *m_Lists[category];
+				
+				auto* const owner = list.m_Items[_component->m_Slot].m_Owner;
+				
+				list.m_Items[_component->m_Slot] = { nullptr, nullptr };
+				++list.m_Removed;
+				++list.m_Revision;
+				
+				_component->m_Category = s_None;
+				_component->m_Slot     = s_None;
+				
+				Compact(list);
+				
+				Refresh(category, *owner);
+			}
+		}
+		
+		/** @brief Updates the owner recorded for a Component. */
+		void Rebind(const Component* _component, GameObject* _owner) noexcept {
+			
+			if (_component->m_Category != s_None) {
+				m_Lists[_component->m_Category]->m_Items[_component->m_Slot].m_Owner = _owner;
+			}
+		}
+	
+	public:
+		
+		/**
+		 * @struct Statistics
+		 * @brief Summary of the allocations made by every Storage, for diagnostics.
+		 */
+		struct Statistics final {
+			
+			size_t m_Allocations; /**< @brief Number of objects ever allocated from Pools.           */
+			size_t m_Live;        /**< @brief Number of objects currently allocated from Pools.      */
+			size_t m_Fallbacks;   /**< @brief Number of objects which had to be allocated on the heap. */
+			size_t m_Chunks;      /**< @brief Number of chunks currently held by Pools.              */
+			size_t m_Bytes;       /**< @brief Total size of the chunks currently held by Pools.      */
+		};
+		
+		Storage() = default;
+		
+		Storage(const Storage& _other) = delete;
+		Storage& operator = (const Storage& _other) = delete;
+		
+		/**
+		 * @brief Creates a new GameObject whose Components are held by this Storage.
+		 *
+		 * @param[in] _scene The Scene the GameObject belongs to.
+		 * @param[in] _name The name of the GameObject.
+		 * @return A shared pointer to the new GameObject.
+		 */
+		[[nodiscard]] std::shared_ptr<GameObject> Create(const std::weak_ptr<Scene>& _scene, const std::string_view& _name);
+		
+		/**
+		 * @brief Creates a batch of GameObjects whose Components are held by this Storage.
+		 *
+		 * @details Room for every Component of the batch is reserved up front, so the Pools and lists of each type grow at most once.
+		 *
+		 * @param[in] _scene The Scene the GameObjects belong to.
+		 * @param[in] _count The number of GameObjects to create.
+		 * @param[in] _prototype Description of the GameObjects.
+		 * @return The new GameObjects, in order.
+		 */
+		template<typename... Ts>
+		[[nodiscard]] std::vector<std::shared_ptr<GameObject>> Create(const std::weak_ptr<Scene>& _scene, const size_t& _count, const Prototype<Ts...>& _prototype);
+		
+		/**
+		 * @brief Ensures the given number of additional Components of type T can be created without reallocating.
+		 * @note The Pool of T is only reserved once a Component of type T has been created, as this sets the size of its blocks.
+		 */
+		template<typename T>
+		void Reserve(const size_t& _count) {
+			
+			static_assert(std::is_base_of_v<Component, T>, "Provided type must derive from \"Component\".");
+			
+			auto& items = GetList(ID<Category<T>>()).m_Items;
+			items.reserve(items.size() + _count);
+			
+			if (const auto id = ID<T>(); id < m_Pools.size() && m_Pools[id] != nullptr) {
+				m_Pools[id]->Reserve(_count);
+			}
+			
+			Slots<Component>::Reserve(_count);
+		}
+		
+		/** @brief Returns a summary of the allocations made by every Storage. */
+		[[nodiscard]] static Statistics GetStatistics() noexcept {
+			
+			return {
+				s_Allocations.load(std::memory_order_relaxed),
+				s_Live       .load(std::memory_order_relaxed),
+				s_Fallbacks  .load(std::memory_order_relaxed),
+				s_Chunks     .load(std::memory_order_relaxed),
+				s_Bytes      .load(std::memory_order_relaxed)
+			};
+		}
+		
+		/**
+		 * @brief Returns a view of every Component in a category.
+		 *
+		 * @tparam T The category to view. Scripts are all viewed under the Script category.
+		 * @return An iterable Range of Entry<T>.
+		 */
+		template<typename T>
+		[[nodiscard]] Range<T> View() {
+			
+			const auto id = ID<T>();
+			
+			return Range<T>(id < m_Lists.size() ? m_Lists[id].get() : nullptr);
+		}
+		
+		/** @brief Returns a number which changes whenever a Component is added to or removed from a category. */
+		template<typename T>
+		[[nodiscard]] uint64_t Revision() const noexcept {
+			
+			const auto id = ID<T>();
+			
+			return id < m_Lists.size() && m_Lists[id] != nullptr ? m_Lists[id]->m_Revision : 0U;
+		}
+		
+		/** @brief Returns the number of Components in a category. */
+		template<typename T>
+		[[nodiscard]] size_t Count() const noexcept {
+			
+			const auto id = ID<T>();
+			
+			size_t result = 0U;
+			
+			if (id < m_Lists.size() && m_Lists[id] != nullptr) {
+				result = m_Lists[id]->m_Items.size() - m_Lists[id]->m_Removed;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns every Component of type T whose GameObject is active and has Components of each of the types Us.
+		 *
+		 * @details The Selection is built on first use and updated incrementally afterwards, so iterating it costs only
+		 *          the number of matches.
+		 *
+		 * @tparam T The type of Component to select. Scripts are all selected as Script.
+		 * @tparam Us Types of Component the GameObject must also have.
+		 * @return An iterable Range of std::tuple<T&, Us&..., GameObject&>.
+		 */
+		template<typename T, typename... Us>
+		[[nodiscard]] typename Selection<T, Us...>::Range Query() {
+			
+			const auto id = ID<Selection<T, Us...>>();
+			
+			if (id >= m_Selections.size()) {
+				m_Selections.resize(id + 1U);
+			}
+			
+			auto& selection = m_Selections[id];
+			
+			if (selection == nullptr) {
+				
+				selection = std::make_unique<Selection<T, Us...>>();
+				
+				for (const auto& category : { ID<T>(), ID<Us>()... }) {
+					
+					if (category >= m_Dependents.size()) {
+						m_Dependents.resize(category + 1U);
+					}
+					
+					m_Dependents[category].emplace_back(selection.get());
+				}
+				
+				if (const auto category = ID<T>(); category < m_Lists.size() && m_Lists[category] != nullptr) {
+					
+					for (const auto& item : m_Lists[category]->m_Items) {
+						
+						if (item.m_Owner != nullptr) {
+							selection->Update(*item.m_Owner);
+						}
+					}
+				}
+			}
+			
+			return typename Selection<T, Us...>::Range(static_cast<Selection<T, Us...>*>(selection.get()));
+		}
+	};
+
+} // LouiEriksson::Engine::ECS
+
+#endif //FINALYEARPROJECT_STORAGE_HPP
@@ -1,13 +1,16 @@
 #ifndef FINALYEARPROJECT_CAMERA_HPP
 #define FINALYEARPROJECT_CAMERA_HPP
 
+#include "../core/AssetId.hpp"
 #include "../core/Debug.hpp"
+#include "../core/Profiler.hpp"
 #include "../core/IViewport.hpp"
 #include "../core/Resources.hpp"
 #include "../core/Settings.hpp"
 #include "../core/Time.hpp"
 #include "../core/Transform.hpp"
 #include "../core/Types.hpp"
+#include "../core/utils/Bounds.hpp"
 #include "../core/utils/Utils.hpp"
 #include "../ecs/GameObject.hpp"
 #include "Light.hpp"
@@ -27,6 +30,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <queue>
 #include <string>
@@ -56,8 +60,8 @@ namespace LouiEriksson::Engine::Graphics {
 	
 	private:
 		
-		inline static std::weak_ptr<Shader> s_Passthrough{};
-		inline static std::weak_ptr<Mesh>   s_Cube{};
+		inline static std::  weak_ptr<Shader> s_Passthrough{};
+		inline static std::shared_ptr<Mesh>   s_Cube{}; // Held strongly, as it is retrieved only once (see Resources::Evict()).
 		
 		/** @brief Window of the camera. */
 		std::weak_ptr<IViewport<scalar_t, size_t>> m_Viewport;
@@ -109,7 +113,9 @@ namespace LouiEriksson::Engine::Graphics {
 		 *
 		 * \param[in] _renderers The list of renderers to perform the geometry pass for.
 		 */
-		void GeometryPass(const std::vector<std::weak_ptr<Renderer>>& _renderers) {
+		void GeometryPass(const std::vector<Renderer*>& _renderers) {
+			
+			PROFILE_ZONE("Camera::GeometryPass");
 			
 			if (const auto v = m_Viewport.lock()) {
 				
@@ -152,8 +158,8 @@ namespace LouiEriksson::Engine::Graphics {
 				
 							for (const auto& renderer : _renderers) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto tr = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto tr = r->GetTransform()       ) {
 								if (const auto ma = r->GetMaterial().lock() ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 									
@@ -194,8 +200,8 @@ namespace LouiEriksson::Engine::Graphics {
 				
 							for (const auto& renderer : _renderers) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto tr = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto tr = r->GetTransform()       ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 									
 									// Assign matrices.
@@ -244,8 +250,8 @@ namespace LouiEriksson::Engine::Graphics {
 				
 							for (const auto& renderer : _renderers) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto tr = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto tr = r->GetTransform()       ) {
 								if (const auto ma = r->GetMaterial().lock() ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 								
@@ -302,8 +308,8 @@ namespace LouiEriksson::Engine::Graphics {
 							
 							for (const auto& renderer : _renderers) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto tr = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto tr = r->GetTransform()       ) {
 								if (const auto ma = r->GetMaterial().lock() ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 								
@@ -350,7 +356,7 @@ namespace LouiEriksson::Engine::Graphics {
 								s->Assign(sky_u_Model,      sky_TRS           ); /* MODEL      */
 								
 								// Assign texture:
-								if (const auto sky = Settings::Graphics::Skybox::s_Skybox.lock()) {
+								if (const auto sky = Settings::Graphics::Skybox::s_Skybox) {
 									s->Assign(sky_u_Texture, *sky, 0);
 								}
 								
@@ -358,7 +364,7 @@ namespace LouiEriksson::Engine::Graphics {
 								s->Assign(sky_u_Blur,     Settings::Graphics::Skybox::s_Blur);
 					
 								// Bind VAO.
-								if (const auto c = s_Cube.lock()) {
+								if (const auto c = s_Cube) {
 									Draw(*c);
 								}
 								
@@ -418,8 +424,8 @@ namespace LouiEriksson::Engine::Graphics {
 							
 							for (const auto& renderer : _renderers) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto tr = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto tr = r->GetTransform()       ) {
 								if (const auto ma = r->GetMaterial().lock() ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 								
@@ -486,8 +492,8 @@ namespace LouiEriksson::Engine::Graphics {
 				
 							for (const auto& renderer : _renderers) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto tr = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto tr = r->GetTransform()       ) {
 								if (const auto ma = r->GetMaterial().lock() ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 								
@@ -516,18 +522,21 @@ namespace LouiEriksson::Engine::Graphics {
 		/**
 		 * \brief Deferred-rendering shadow pass.
 		 *
-		 * \param[in] _renderers The list of renderers to perform the geometry pass for.
+		 * \param[in] _casters The list of renderers which may cast shadows from each light, in the same order as _lights.
+		 * \param[in] _lights The list of lights to render shadows for.
 		 */
-		void ShadowPass(const std::vector<std::weak_ptr<Renderer>>& _renderers, const std::vector<std::weak_ptr<Light>>& _lights) const  {
+		void ShadowPass(const std::vector<std::vector<Renderer*>>& _casters, const std::vector<Light*>& _lights) const  {
+			
+			PROFILE_ZONE("Camera::ShadowPass");
 		
 			// Shadow implementation is very heavily modified derivative of implementations by Learn OpenGL:
 	        //  - de Vries, J. (n.d.). LearnOpenGL - Shadow Mapping. [online] learnopengl.com. Available at: https://learnopengl.com/Advanced-Lighting/Shadows/Shadow-Mapping [Accessed 15 Dec. 2023].
 	        //  - de Vries, J. (n.d.). LearnOpenGL - Point Shadows. [online] learnopengl.com. Available at: https://learnopengl.com/Advanced-Lighting/Shadows/Point-Shadows [Accessed 15 Dec. 2023].
 			
 			// Perform these computations for every light in the scene.
-			for (const auto& light : _lights) {
+			for (size_t i = 0U; i < _lights.size(); ++i) {
 		
-				if (const auto l = light.lock()) {
+				if (const auto l = _lights[i]) {
 				
 					// Initialise / reinitialise the buffers used for the shadow map.
 					l->m_Shadow.UpdateShadowMap(l->m_Type);
@@ -560,11 +569,15 @@ namespace LouiEriksson::Engine::Graphics {
 						}
 						
 						// Get the correct shader program for the type of light:
+						static const AssetRef<Shader> depth_cube = "shadowDepthCube"_asset;
+						static const AssetRef<Shader> depth      = "shadowDepth"_asset;
+						static const AssetRef<Shader> depth_spot = "shadowDepthSpot"_asset;
+						
 						std::shared_ptr<Shader> p;
 						switch(l->Type()) {
-							case Light::Parameters::Point:       { p = Resources::Get<Shader>("shadowDepthCube"); break; }
-							case Light::Parameters::Directional: { p = Resources::Get<Shader>("shadowDepth"    ); break; }
-							case Light::Parameters::Spot:        { p = Resources::Get<Shader>("shadowDepthSpot"); break; }
+							case Light::Parameters::Point:       { p = Resources::Get(depth_cube); break; }
+							case Light::Parameters::Directional: { p = Resources::Get(depth     ); break; }
+							case Light::Parameters::Spot:        { p = Resources::Get(depth_spot); break; }
 							default: {
 								Debug::Log("Unknown Light type!", Error);
 							}
@@ -643,10 +656,10 @@ namespace LouiEriksson::Engine::Graphics {
 							}
 							
 							// We need to render the scene from the light's perspective.
-							for (const auto& renderer : _renderers) {
+							for (const auto& renderer : _casters[i]) {
 								
-								if (const auto  r = renderer.lock()         ) {
-								if (const auto  t = r->GetTransform().lock()) {
+								if (const auto  r = renderer                ) {
+								if (const auto  t = r->GetTransform()       ) {
 								if (const auto me = r->GetMesh().lock()     ) {
 									
 									if (r->Shadows() &&
@@ -891,6 +904,8 @@ namespace LouiEriksson::Engine::Graphics {
 		 * compensate for overexposure or underexposure. The calculation is done using a shader program and a mask texture.
 		 */
 		void AutoExposure()  {
+			
+			PROFILE_ZONE("Camera::AutoExposure");
 		
 			using target = Settings::PostProcessing::ToneMapping::AutoExposure;
 			
@@ -973,6 +988,8 @@ namespace LouiEriksson::Engine::Graphics {
 		/** @brief Ambient occlusion post-processing effect using SSAO technique. */
 		void AmbientOcclusion()  {
 			
+			PROFILE_ZONE("Camera::AmbientOcclusion");
+			
 			static const auto as = Resources::Get<Shader>("ao");
 			
 			// Get shader program:
@@ -1056,6 +1073,8 @@ namespace LouiEriksson::Engine::Graphics {
 		
 		/** @brief Physically-based bloom effect using 13-tap sampling method. */
 		void Bloom() {
+			
+			PROFILE_ZONE("Camera::Bloom");
 		
 			using target = Settings::PostProcessing::Bloom;
 			
@@ -1271,7 +1290,7 @@ namespace LouiEriksson::Engine::Graphics {
 				Debug::Log("Couldn't bind passthrough texture!", Error);
 			}
 			
-			if (s_Cube.expired()) {
+			if (s_Cube == nullptr) {
 				s_Cube = Resources::Get<Mesh>("cube");
 			}
 			else {
@@ -1324,8 +1343,12 @@ namespace LouiEriksson::Engine::Graphics {
 		 * \brief Renders each Renderer using the Camera.
 		 * \param[in] _renderers The list of Renderers to be rendered.
 		 * \param[in] _lights The list of Lights to be used during rendering.
+		 * \param[in] _casters The list of Renderers which may cast shadows from each Light, in the same order as _lights.
+		 *
+		 * \see GetFrustum()
+		 * \see ShadowBounds()
 		 */
-		void Render(const std::vector<std::weak_ptr<Renderer>>& _renderers, const std::vector<std::weak_ptr<Light>>& _lights)  {
+		void Render(const std::vector<Renderer*>& _renderers, const std::vector<Light*>& _lights, const std::vector<std::vector<Renderer*>>& _casters)  {
 		
 			if (const auto v = m_Viewport.lock()) {
 				
@@ -1350,7 +1373,7 @@ namespace LouiEriksson::Engine::Graphics {
 				GeometryPass(_renderers);
 			
 				/* SHADOW PASS */
-				ShadowPass(_renderers, _lights);
+				ShadowPass(_casters, _lights);
 	
 				// Reset resolution after shadow pass.
 				auto dimensions = v->Dimensions();
@@ -1416,7 +1439,7 @@ namespace LouiEriksson::Engine::Graphics {
 						}
 						
 						// Assign ambient texture:
-						if (const auto s = Settings::Graphics::Skybox::s_Skybox.lock()) {
+						if (const auto s = Settings::Graphics::Skybox::s_Skybox) {
 							p->Assign(p->AttributeID("u_Ambient"), *s, 98);
 						}
 						
@@ -1427,7 +1450,7 @@ namespace LouiEriksson::Engine::Graphics {
 							
 							using target_light = Settings::Graphics::Material;
 							
-							if (const auto l = light.lock()) {
+							if (const auto l = light) {
 								
 								if (const auto t = l->m_Transform.lock()) {
 								
@@ -1551,6 +1574,8 @@ namespace LouiEriksson::Engine::Graphics {
 		 */
 		void PostRender() {
 			
+			PROFILE_ZONE("Camera::PostRender");
+			
 			glDisable(GL_DEPTH_TEST);
 			
 			/* POST PROCESSING */
@@ -1873,6 +1898,38 @@ namespace LouiEriksson::Engine::Graphics {
 			return m_Projection;
 		}
 		
+		/**
+		 * @brief Get the Camera's view frustum, used to cull Renderers outside of its view.
+		 * @return The frustum of the Camera's view-projection matrix, in world space.
+		 */
+		Frustum GetFrustum() {
+			return Frustum(Projection() * View());
+		}
+		
+		/**
+		 * @brief Get a sphere bounding every Renderer which may cast a shadow from a Light into the Camera's view.
+		 *
+		 * @details Point and spot lights only render shadows within their range. Directional lights render shadows within
+		 *          an orthographic volume (of the size of their range) which follows the Camera. See ShadowPass().
+		 *
+		 * @param[in] _light The Light.
+		 * @return The bounds of the shadow-casting volume, in world space.
+		 */
+		[[nodiscard]] Sphere ShadowBounds(const Light& _light) const {
+			
+			Sphere result { vec3(0.0), std::numeric_limits<scalar_t>::max() };
+			
+			const auto t = _light.Type() == Light::Parameters::Type::Directional ?
+				GetTransform().lock() :
+				_light.m_Transform.lock();
+			
+			if (t != nullptr) {
+				result = { t->Position(), _light.m_Range };
+			}
+			
+			return result;
+		}
+		
 		/**
 		 * @brief Get the Camera's view matrix.
 		 * @return The Camera's view matrix.
@@ -24,15 +24,16 @@ namespace LouiEriksson::Engine::Graphics {
 	private:
 	
 		// Shader the Material points to.
-		std::weak_ptr<Shader> m_Shader;
+		std::shared_ptr<Shader> m_Shader;
 	
-		std::weak_ptr<Texture> m_Albedo_Texture,
-		                       m_AO_Texture,
-		                       m_Displacement_Texture,
-		                       m_Emission_Texture,
-		                       m_Metallic_Texture,
-		                       m_Normal_Texture,
-		                       m_Roughness_Texture;
+		// Textures are owned by the Material, so that they remain resident for as long as it does (see Resources::Evict()).
+		std::shared_ptr<Texture> m_Albedo_Texture,
+		                         m_AO_Texture,
+		                         m_Displacement_Texture,
+		                         m_Emission_Texture,
+		                         m_Metallic_Texture,
+		                         m_Normal_Texture,
+		                         m_Roughness_Texture;
 		
 		vec4 m_Albedo_Color;
 		
@@ -44,14 +45,14 @@ namespace LouiEriksson::Engine::Graphics {
 		        m_Roughness;
 	
 		Material(
-				const std::weak_ptr<Shader >& _shader,
-				const std::weak_ptr<Texture>& _albedoTexture,
-				const std::weak_ptr<Texture>& _aoTexture,
-				const std::weak_ptr<Texture>& _displacementTexture,
-				const std::weak_ptr<Texture>& _emissionTexture,
-				const std::weak_ptr<Texture>& _metallicTexture,
-				const std::weak_ptr<Texture>& _normalTexture,
-				const std::weak_ptr<Texture>& _roughnessTexture,
+				const std::shared_ptr<Shader >& _shader,
+				const std::shared_ptr<Texture>& _albedoTexture,
+				const std::shared_ptr<Texture>& _aoTexture,
+				const std::shared_ptr<Texture>& _displacementTexture,
+				const std::shared_ptr<Texture>& _emissionTexture,
+				const std::shared_ptr<Texture>& _metallicTexture,
+				const std::shared_ptr<Texture>& _normalTexture,
+				const std::shared_ptr<Texture>& _roughnessTexture,
 				const vec4&   _albedoColor,
 				const vec3& _emissionColor,
 				GLfloat _ao,
@@ -81,15 +82,15 @@ namespace LouiEriksson::Engine::Graphics {
 		 *
 		 * \return A weak pointer to the currently assigned Shader.
 		 */
-		[[nodiscard]] constexpr const std::weak_ptr<Shader>& GetShader() const noexcept { return m_Shader; }
+		[[nodiscard]] std::weak_ptr<Shader> GetShader() const noexcept { return m_Shader; }
 		
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetAlbedoTexture()       const noexcept { return m_Albedo_Texture;       }
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetAOTexture()           const noexcept { return m_AO_Texture;           }
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetDisplacementTexture() const noexcept { return m_Displacement_Texture; }
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetEmissionTexture()     const noexcept { return m_Emission_Texture;     }
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetMetallicTexture()     const noexcept { return m_Metallic_Texture;     }
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetNormalTexture()       const noexcept { return m_Normal_Texture;       }
-		[[nodiscard]] constexpr const std::weak_ptr<Texture>& GetRoughnessTexture()    const noexcept { return m_Roughness_Texture;    }
+		[[nodiscard]] std::weak_ptr<Texture> GetAlbedoTexture()       const noexcept { return m_Albedo_Texture;       }
+		[[nodiscard]] std::weak_ptr<Texture> GetAOTexture()           const noexcept { return m_AO_Texture;           }
+		[[nodiscard]] std::weak_ptr<Texture> GetDisplacementTexture() const noexcept { return m_Displacement_Texture; }
+		[[nodiscard]] std::weak_ptr<Texture> GetEmissionTexture()     const noexcept { return m_Emission_Texture;     }
+		[[nodiscard]] std::weak_ptr<Texture> GetMetallicTexture()     const noexcept { return m_Metallic_Texture;     }
+		[[nodiscard]] std::weak_ptr<Texture> GetNormalTexture()       const noexcept { return m_Normal_Texture;       }
+		[[nodiscard]] std::weak_ptr<Texture> GetRoughnessTexture()    const noexcept { return m_Roughness_Texture;    }
 		
 		[[nodiscard]] constexpr const vec4& GetAlbedoColor()   const noexcept { return m_Albedo_Color;   }
 		[[nodiscard]] constexpr const vec3& GetEmissionColor() const noexcept { return m_Emission_Color; }
@@ -2,6 +2,7 @@
 #define FINALYEARPROJECT_MODEL_HPP
 
 #include "../core/Debug.hpp"
+#include "../core/utils/Bounds.hpp"
 #include "../core/utils/Utils.hpp"
 #include "TextureCPU.hpp"
 
@@ -46,6 +47,22 @@ namespace LouiEriksson::Engine::Graphics {
 			       m_VertexCount,
 		            m_IndexCount;
 		
+		/** @brief Bounds of the vertices of the Mesh, in its local space. Invalid if the Mesh has no 3D vertices (e.g. screen-space quads). */
+		AABB m_Bounds;
+		
+		/** @brief Returns the bounds of a set of vertices. */
+		template<typename T, glm::precision Q>
+		static AABB Bound(const std::vector<glm::vec<3, T, Q>>& _vertices) noexcept {
+			
+			AABB result;
+			
+			for (const auto& vertex : _vertices) {
+				result.Encapsulate(vec3(vertex));
+			}
+			
+			return result;
+		}
+		
 		explicit constexpr Mesh(const GLenum& _format) noexcept  :
 			m_Format         (_format),
 			m_IndexFormat    (GL_NONE),
@@ -57,7 +74,8 @@ namespace LouiEriksson::Engine::Graphics {
 			m_TangentVBO_ID  (GL_NONE),
 			m_BitangentVBO_ID(GL_NONE),
 			m_VertexCount(0U),
-			m_IndexCount (0U) {}
+			m_IndexCount (0U),
+			m_Bounds() {}
 		
 	public:
 		
@@ -131,6 +149,7 @@ namespace LouiEriksson::Engine::Graphics {
 						
 						result->m_VertexCount = _vertices.size();
 						result-> m_IndexCount =  _indices.size();
+						result->     m_Bounds = Bound(_vertices);
 						
 						glGenVertexArrays(1, &result->m_VAO_ID);
 						
@@ -700,6 +719,7 @@ namespace LouiEriksson::Engine::Graphics {
 						Debug::Assert(_vertices.size() <= limit32, "Point cloud has too many vertices! Exceeds the 32-bit limit and will be truncated.", Warning);
 						
 						result->m_VertexCount = std::min(_vertices.size(), limit32);
+						result->m_Bounds      = Bound(_vertices);
 						
 						// Buffers to store mesh data:
 						glGenVertexArrays(1, &result->m_VAO_ID);
@@ -775,6 +795,8 @@ namespace LouiEriksson::Engine::Graphics {
 		
 		[[nodiscard]] constexpr const GLuint& VertexCount() const noexcept { return m_VertexCount; }
 		[[nodiscard]] constexpr const GLuint&  IndexCount() const noexcept { return  m_IndexCount; }
+		
+		[[nodiscard]] constexpr const AABB& Bounds() const noexcept { return m_Bounds; }
 	};
 	
 } // LouiEriksson::Engine::Graphics
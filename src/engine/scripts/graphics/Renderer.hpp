@@ -1,11 +1,18 @@
 #ifndef FINALYEARPROJECT_RENDERER_HPP
 #define FINALYEARPROJECT_RENDERER_HPP
 
+#include "../core/AssetHandle.hpp"
+#include "../core/Transform.hpp"
+#include "../core/utils/Bounds.hpp"
 #include "../ecs/GameObject.hpp"
+#include "../ecs/Handle.hpp"
 
 #include "Material.hpp"
 #include "Mesh.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <typeindex>
 
@@ -25,20 +32,55 @@ namespace LouiEriksson::Engine::Graphics {
 namespace LouiEriksson::Engine::Graphics {
 	
 	class Renderer final : public ECS::Component {
+		
+		friend ECS::Scene;
 	
 	private:
 	
 		std::shared_ptr<Mesh>      m_Mesh;      /**< @brief The Mesh of the Renderer. */
-		std::  weak_ptr<Material>  m_Material;  /**< @brief The Material of the Renderer. */
-		std::  weak_ptr<Transform> m_Transform; /**< @brief The Transform of the Renderer. */
+		std::shared_ptr<Material>  m_Material;  /**< @brief The Material of the Renderer. */
+		ECS::Handle<Transform>     m_Transform; /**< @brief The Transform of the Renderer. */
 	
 		/** @brief Whether or not the Renderer casts shadows. */
 		bool m_CastShadows;
 		
+		/** @brief Leaf of the Renderer in the spatial index of its Scene, or the maximum value of size_t if it has none. */
+		size_t m_Leaf;
+		
+		/** @brief Revision of the Transform, and the Mesh, the bounds of the leaf were computed from. */
+		uint64_t m_Revision;
+		const Mesh* m_Bounded;
+		
+		/** @brief Frame in which the Renderer was last indexed by its Scene. */
+		uint64_t m_Seen;
+		
+		AssetHandle<Mesh>     m_PendingMesh;     /**< @brief Mesh which is still streaming, if any. */
+		AssetHandle<Material> m_PendingMaterial; /**< @brief Material which is still streaming, if any. */
+		
+		/** @brief Replaces the placeholder Mesh and Material with the streamed assets once they have finished loading. */
+		void Resolve() noexcept {
+			
+			if (m_PendingMesh.Valid() && !m_PendingMesh.IsPending()) {
+				SetMesh(m_PendingMesh.Get());
+				
+				m_PendingMesh = {};
+			}
+			
+			if (m_PendingMaterial.Valid() && !m_PendingMaterial.IsPending()) {
+				SetMaterial(m_PendingMaterial.Get());
+				
+				m_PendingMaterial = {};
+			}
+		}
+	
 	public:
 	
 		explicit Renderer(const std::weak_ptr<ECS::GameObject>& _parent) noexcept : ECS::Component(_parent),
-			m_CastShadows(true) {}
+			m_CastShadows(true),
+			m_Leaf(std::numeric_limits<size_t>::max()),
+			m_Revision(0U),
+			m_Bounded(nullptr),
+			m_Seen(0U) {}
 		
 		/** @inheritdoc */
 		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Renderer); };
@@ -75,6 +117,25 @@ namespace LouiEriksson::Engine::Graphics {
 			if (const auto m = _mesh.lock()) {
 				m_Mesh = m;
 			}
+			
+			m_PendingMesh = {};
+		}
+		
+		/**
+		 * @brief Set the Mesh of the Renderer to one which is streaming.
+		 *
+		 * The Renderer uses the placeholder of the handle until the Mesh has loaded.
+		 *
+		 * @param[in] _mesh A handle to the streaming Mesh.
+		 * @see Resources::GetAsync()
+		 */
+		void SetMesh(const AssetHandle<Mesh>& _mesh) noexcept {
+			
+			SetMesh(_mesh.Get());
+			
+			if (_mesh.IsPending()) {
+				m_PendingMesh = _mesh;
+			}
 		}
 		
 		/**
@@ -96,7 +157,26 @@ namespace LouiEriksson::Engine::Graphics {
 		 * @param[in] _material A std::weak_ptr to the Material object to set.
 		 */
 		void SetMaterial(const std::weak_ptr<Material>& _material) noexcept {
-			m_Material = _material;
+			m_Material = _material.lock();
+			
+			m_PendingMaterial = {};
+		}
+		
+		/**
+		 * @brief Set the Material of the Renderer to one which is streaming.
+		 *
+		 * The Renderer uses the placeholder of the handle until the Material has loaded.
+		 *
+		 * @param[in] _material A handle to the streaming Material.
+		 * @see Resources::GetAsync()
+		 */
+		void SetMaterial(const AssetHandle<Material>& _material) noexcept {
+			
+			SetMaterial(_material.Get());
+			
+			if (_material.IsPending()) {
+				m_PendingMaterial = _material;
+			}
 		}
 		
 		/**
@@ -106,7 +186,7 @@ namespace LouiEriksson::Engine::Graphics {
 		 *
 		 * @return A weak pointer to the Material object.
 		 */
-		constexpr const std::weak_ptr<Material>& GetMaterial() noexcept {
+		std::weak_ptr<Material> GetMaterial() noexcept {
 			return m_Material;
 		}
 		
@@ -115,19 +195,37 @@ namespace LouiEriksson::Engine::Graphics {
 		 *
 		 * This function sets the Transform of the Renderer to the provided Transform.
 		 *
-		 * @param[in] _transform A std::weak_ptr to the Transform object to set.
+		 * @param[in] _transform A Handle to the Transform object to set.
 		 */
-		void SetTransform(const std::weak_ptr<Transform>& _transform) noexcept {
+		void SetTransform(const ECS::Handle<Transform>& _transform) noexcept {
 			m_Transform = _transform;
 		}
 		
 		/**
 		 * @brief Get the Transform of the Renderer.
 		 *
-		 * @return const std::weak_ptr<Transform>& The weak pointer to the Transform.
+		 * @return Transform* A pointer to the Transform, or nullptr if it has been destroyed.
+		 */
+		[[nodiscard]] Transform* GetTransform() const noexcept {
+			return m_Transform.Get();
+		}
+		
+		/**
+		 * @brief Get the bounds of the Renderer in world space.
+		 * @return The bounds of the Mesh transformed by the World matrix of the Transform, or an invalid AABB if either is missing.
 		 */
-		constexpr const std::weak_ptr<Transform>& GetTransform() noexcept {
-			return m_Transform;
+		[[nodiscard]] AABB Bounds() const {
+			
+			AABB result;
+			
+			if (auto* const t = GetTransform()) {
+				
+				if (m_Mesh != nullptr && m_Mesh->Bounds().Valid()) {
+					result = m_Mesh->Bounds().Transformed(t->World());
+				}
+			}
+			
+			return result;
 		}
 		
 	};
@@ -20,6 +20,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -131,13 +132,16 @@ namespace LouiEriksson::Engine::Graphics {
 					type_string = "UNKNOWN TYPE";
 				}
 				
-				Debug::Log("Compiling Shader \"" + m_Name + "\" (" + type_string + ")... ", Info, true);
+				FYP_LOG("Compiling Shader \"" + m_Name + "\" (" + type_string + ")... ", Info, true);
 			}
 			
-			const auto* const src = _src.data();
+			// The source need not be null-terminated, so pass its length explicitly.
+			// A blank line is appended to the end of the shader (opengl reasons).
+			const std::array<const GLchar*, 2U> src    { _src.data(), "\n" };
+			const std::array<GLint,         2U> length { static_cast<GLint>(_src.size()), 1 };
 	
 			m_SubShaders.emplace_back(glCreateShader(_type));
-			glShaderSource(m_SubShaders.back(), 1, &src, nullptr);
+			glShaderSource(m_SubShaders.back(), static_cast<GLsizei>(src.size()), src.data(), length.data());
 			glCompileShader(m_SubShaders.back());
 			glGetShaderiv(m_SubShaders.back(), GL_COMPILE_STATUS, &success);
 			
@@ -165,7 +169,7 @@ namespace LouiEriksson::Engine::Graphics {
 			}
 		}
 		
-		static Hashmap<GLenum, std::string> ExtractSubshaders(std::stringstream&& _src) {
+		static Hashmap<GLenum, std::string> ExtractSubshaders(const std::string_view& _src) {
 			
 			Hashmap<GLenum, std::string> result;
 			
@@ -177,8 +181,17 @@ namespace LouiEriksson::Engine::Graphics {
 			// context change.
 			auto curr = GL_NONE;
 			
-			std::string line;
-	        while (std::getline(_src, line)) {
+			for (size_t start = 0U; start < _src.size();) {
+				
+				auto end = _src.find('\n', start);
+				
+				if (end == std::string_view::npos) {
+					end = _src.size();
+				}
+				
+				const auto line = _src.substr(start, end - start);
+				
+				start = end + 1U;
 				
 				auto type = curr;
 				
@@ -236,9 +249,9 @@ namespace LouiEriksson::Engine::Graphics {
 				
 				for (const auto& shader: _subShaders) {
 					
-					Debug::Log("Loading Shader Asset \"" + std::string(shader.m_Path) + "\"... ", Info, true);
+					FYP_LOG("Loading Shader Asset \"" + std::string(shader.m_Path) + "\"... ", Info, true);
 					
-					Compile((File::ReadAllText(shader.m_Path) << "\n").str(), shader.m_Type);
+					Compile(File::Map(shader.m_Path).View(), shader.m_Type);
 					
 					Debug::Log("Done.", Info);
 				}
@@ -258,7 +271,7 @@ namespace LouiEriksson::Engine::Graphics {
 			
 			Hashmap<GLenum, std::string> subShaders;
 			
-			subShaders = ExtractSubshaders(File::ReadAllText(_path));
+			subShaders = ExtractSubshaders(File::Map(_path).View());
 			
 			if (!subShaders.empty()) {
 				
@@ -0,0 +1,1001 @@
+#ifndef FINALYEARPROJECT_BLOCKCOMPRESSION_HPP
+#define FINALYEARPROJECT_BLOCKCOMPRESSION_HPP
+
+#include "../../core/utils/JobSystem.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BLOCKCOMPRESSION_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#define BLOCKCOMPRESSION_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace LouiEriksson::Engine::Graphics {
+	
+	/**
+	 * @class BlockCompression
+	 * @brief CPU encoder of the BC1, BC3, BC4, BC5 and BC6H block-compressed texture formats.
+	 *
+	 * @details Each 4x4 block of texels is encoded independently. Endpoints are fitted to the extremes of the texels along their
+	 *          principal axis, and each texel is assigned to the nearest point of the palette by projection onto the endpoints,
+	 *          which is vectorised using SSE2 or NEON where available. Rows of blocks are encoded in parallel on the JobSystem,
+	 *          if it has been started.
+	 *
+	 * @note BC6H is encoded using only its single-region, unsigned mode (mode 11), which stores 10-bit endpoints.
+	 *       Negative values are clamped to zero.
+	 */
+	class BlockCompression final {
+	
+	public:
+		
+		enum Format : unsigned char {
+			BC1,  /**< @brief RGB, 4 bits per texel.                    */
+			BC3,  /**< @brief RGBA, 8 bits per texel.                   */
+			BC4,  /**< @brief R, 4 bits per texel.                      */
+			BC5,  /**< @brief RG, 8 bits per texel.                     */
+			BC6H, /**< @brief Unsigned half-float RGB, 8 bits per texel. */
+		};
+		
+		/**
+		 * @struct Surface
+		 * @brief Uncompressed, tightly-packed and row-major image.
+		 */
+		struct Surface final {
+			
+			const void* m_Pixels; /**< @brief Pixels, as either bytes in [0, 255] or floats. */
+			
+			uint32_t m_Width;
+			uint32_t m_Height;
+			uint32_t m_Channels; /**< @brief Number of channels of each pixel, from 1 to 4. */
+			
+			bool m_Float;
+		};
+		
+		/** @brief The texels of a block, by channel. */
+		using Texels = std::array<std::array<float, 16U>, 4U>;
+		
+		/**
+		 * @brief Returns the name of the given format.
+		 */
+		[[nodiscard]] static constexpr const char* Name(const Format& _format) noexcept {
+			
+			const char* result = "Unknown";
+			
+			switch (_format) {
+				case BC1:  { result = "BC1";  break; }
+				case BC3:  { result = "BC3";  break; }
+				case BC4:  { result = "BC4";  break; }
+				case BC5:  { result = "BC5";  break; }
+				case BC6H: { result = "BC6H"; break; }
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the size of a single block of the given format, in bytes.
+		 */
+		[[nodiscard]] static constexpr size_t BlockSize(const Format& _format) noexcept {
+			return _format == BC1 || _format == BC4 ? 8U : 16U;
+		}
+		
+		/**
+		 * @brief Returns the size of an image of the given format and dimensions, in bytes.
+		 * @note Images are padded to a whole number of blocks.
+		 */
+		[[nodiscard]] static constexpr size_t Size(const Format& _format, const uint32_t& _width, const uint32_t& _height) noexcept {
+			return static_cast<size_t>((_width + 3U) / 4U) * static_cast<size_t>((_height + 3U) / 4U) * BlockSize(_format);
+		}
+		
+		/**
+		 * @brief Encodes an image.
+		 *
+		 * @param[in] _format The format to encode into.
+		 * @param[in] _surface The image. Float images may only be encoded as BC6H, and byte images only as the other formats.
+		 * @param[out] _output Destination of the blocks. Must be at least Size() bytes.
+		 *
+		 * @throws std::invalid_argument If the image cannot be encoded as the format.
+		 */
+		static void Encode(const Format& _format, const Surface& _surface, char* _output) {
+			
+			if (_surface.m_Channels < 1U || _surface.m_Channels > 4U) {
+				throw std::invalid_argument("Images must have between 1 and 4 channels.");
+			}
+			
+			if (_surface.m_Float != (_format == BC6H)) {
+				throw std::invalid_argument("Only float images may be encoded as BC6H.");
+			}
+			
+			const auto columns = (_surface.m_Width  + 3U) / 4U;
+			const auto rows    = (_surface.m_Height + 3U) / 4U;
+			
+			const auto encode = [&_format, &_surface, _output, columns](const uint32_t& _begin, const uint32_t& _end) {
+				
+				Texels texels {};
+				
+				for (auto y = _begin; y < _end; ++y) {
+				for (auto x = 0U; x < columns; ++x) {
+					
+					Gather(_surface, x, y, texels);
+					
+					EncodeBlock(_format, texels, _output + ((static_cast<size_t>(y) * columns) + x) * BlockSize(_format));
+				}}
+			};
+			
+			/*
+			 * Only fan out if the pool has been started, so that encoding never starts it as a side effect. Encode inline on a worker, as its
+			 * caller is already one of many jobs (e.g. cooking a single asset), and so that the time taken by the caller is that of the encoding.
+			 */
+			if (Threading::JobSystem::WorkerCount() > 1U && !Threading::JobSystem::IsWorker() && rows > s_RowsPerJob) {
+				
+				std::vector<Threading::JobSystem::Handle> jobs;
+				jobs.reserve((rows / s_RowsPerJob) + 1U);
+				
+				for (auto begin = 0U; begin < rows; begin += s_RowsPerJob) {
+					
+					jobs.emplace_back(Threading::JobSystem::Schedule([&encode, begin, end = std::min(begin + s_RowsPerJob, rows)]() {
+						encode(begin, end);
+					}));
+				}
+				
+				for (const auto& job : jobs) {
+					Threading::JobSystem::Wait(job);
+				}
+			}
+			else {
+				encode(0U, rows);
+			}
+		}
+		
+		/**
+		 * @brief Encodes a single block.
+		 *
+		 * @param[in] _format The format to encode into.
+		 * @param[in] _texels The texels. Values are in [0, 255], except for BC6H, which takes unsigned floats.
+		 * @param[out] _block Destination of the block. Must be at least BlockSize() bytes.
+		 */
+		static void EncodeBlock(const Format& _format, const Texels& _texels, char* _block) noexcept {
+			
+			switch (_format) {
+				case BC1: {
+					EncodeColour(_texels, _block);
+					
+					break;
+				}
+				case BC3: {
+					EncodeChannel(_texels, 3U, _block);
+					EncodeColour (_texels, _block + 8U);
+					
+					break;
+				}
+				case BC4: {
+					EncodeChannel(_texels, 0U, _block);
+					
+					break;
+				}
+				case BC5: {
+					EncodeChannel(_texels, 0U, _block);
+					EncodeChannel(_texels, 1U, _block + 8U);
+					
+					break;
+				}
+				case BC6H: {
+					EncodeHalf(_texels, _block);
+					
+					break;
+				}
+			}
+		}
+		
+		/**
+		 * @brief Decodes a single block.
+		 *
+		 * @param[in] _format The format of the block.
+		 * @param[in] _block The block.
+		 * @param[out] _texels The decoded texels, on the same scale as the input of EncodeBlock().
+		 *
+		 * @throws std::invalid_argument If the block is BC6H but was not encoded by EncodeBlock().
+		 */
+		static void DecodeBlock(const Format& _format, const char* _block, Texels& _texels) {
+			
+			_texels = {};
+			
+			switch (_format) {
+				case BC1: {
+					DecodeColour(_block, false, _texels);
+					
+					break;
+				}
+				case BC3: {
+					DecodeColour (_block + 8U, true, _texels);
+					DecodeChannel(_block, 3U, _texels);
+					
+					break;
+				}
+				case BC4: {
+					DecodeChannel(_block, 0U, _texels);
+					
+					break;
+				}
+				case BC5: {
+					DecodeChannel(_block, 0U, _texels);
+					DecodeChannel(_block + 8U, 1U, _texels);
+					
+					break;
+				}
+				case BC6H: {
+					DecodeHalf(_block, _texels);
+					
+					break;
+				}
+			}
+		}
+		
+		/**
+		 * @brief Computes the peak signal-to-noise ratio of an encoded image against its source.
+		 *
+		 * @details Only the channels stored by the format are compared. BC6H is compared in log2(1 + x) space,
+		 *          relative to the brightest texel of the source, so that errors in the shadows are not lost.
+		 *
+		 * @param[in] _format The format of the encoded image.
+		 * @param[in] _surface The source image.
+		 * @param[in] _blocks The encoded image.
+		 * @return The PSNR in decibels, or infinity if the images are identical.
+		 */
+		[[nodiscard]] static double PSNR(const Format& _format, const Surface& _surface, const char* _blocks) {
+			
+			const size_t channels = _format == BC3 ? 4U : _format == BC4 ? 1U : _format == BC5 ? 2U : 3U;
+			
+			const auto columns = (_surface.m_Width  + 3U) / 4U;
+			const auto rows    = (_surface.m_Height + 3U) / 4U;
+			
+			double error = 0.0;
+			double peak  = _format == BC6H ? 0.0 : 255.0;
+			
+			Texels source  {};
+			Texels decoded {};
+			
+			for (auto y = 0U; y < rows;    ++y) {
+			for (auto x = 0U; x < columns; ++x) {
+				
+				Gather(_surface, x, y, source);
+				
+				DecodeBlock(_format, _blocks + ((static_cast<size_t>(y) * columns) + x) * BlockSize(_format), decoded);
+				
+				for (auto i = 0U; i < 16U; ++i) {
+					
+					// Skip the texels which pad the block beyond the edge of the image.
+					if ((x * 4U) + (i % 4U) < _surface.m_Width && (y * 4U) + (i / 4U) < _surface.m_Height) {
+						
+						for (size_t c = 0U; c < channels; ++c) {
+							
+							auto a = static_cast<double>(source[c][i]);
+							auto b = static_cast<double>(decoded[c][i]);
+							
+							if (_format == BC6H) {
+								a = std::log2(1.0 + FromHalf(ToHalf(static_cast<float>(a))));
+								b = std::log2(1.0 + b);
+								
+								peak = std::max(peak, a);
+							}
+							
+							error += (a - b) * (a - b);
+						}
+					}
+				}
+			}}
+			
+			error /= static_cast<double>(_surface.m_Width) * static_cast<double>(_surface.m_Height) * static_cast<double>(channels);
+			
+			return error > 0.0 ? 10.0 * std::log10((peak * peak) / error) : std::numeric_limits<double>::infinity();
+		}
+	
+	private:
+		
+		/** @brief Number of rows of blocks encoded by each job. */
+		static constexpr uint32_t s_RowsPerJob = 16U;
+		
+		/** @brief Interpolation weights of BC6H indices, out of 64. */
+		static constexpr std::array<int, 16U> s_HalfWeights { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+		
+		/**
+		 * @brief Reads the texels of a block from an image.
+		 * @note Texels beyond the edge of the image repeat the texel at the edge, so that they do not affect the endpoints.
+		 */
+		static void Gather(const Surface& _surface, const uint32_t& _x, const uint32_t& _y, Texels& _texels) noexcept {
+			
+			const auto* bytes  = static_cast<const uint8_t*>(_surface.m_Pixels);
+			const auto* floats = static_cast<const float*  >(_surface.m_Pixels);
+			
+			for (auto i = 0U; i < 16U; ++i) {
+				
+				const auto x = std::min((_x * 4U) + (i % 4U), _surface.m_Width  - 1U);
+				const auto y = std::min((_y * 4U) + (i / 4U), _surface.m_Height - 1U);
+				
+				const auto index = ((static_cast<size_t>(y) * _surface.m_Width) + x) * _surface.m_Channels;
+				
+				std::array<float, 4U> texel { 0.0F, 0.0F, 0.0F, _surface.m_Float ? 1.0F : 255.0F };
+				
+				for (size_t c = 0U; c < _surface.m_Channels; ++c) {
+					texel[c] = _surface.m_Float ? floats[index + c] : static_cast<float>(bytes[index + c]);
+				}
+				
+				// Single-channel images are greyscale.
+				if (_surface.m_Channels == 1U) {
+					texel[1U] = texel[2U] = texel[0U];
+				}
+				
+				for (size_t c = 0U; c < 4U; ++c) {
+					_texels[c][i] = texel[c];
+				}
+			}
+		}
+		
+		/**
+		 * @brief Projects the texels of a block onto the segment between two endpoints.
+		 *
+		 * @param[in] _texels The texels.
+		 * @param[in] _first The first channel to project.
+		 * @param[in] _count The number of channels to project.
+		 * @param[in] _a The endpoint at the start of the segment.
+		 * @param[in] _b The endpoint at the end of the segment.
+		 * @param[out] _t The position of each texel along the segment, clamped to [0, 1].
+		 */
+		static void Project(const Texels& _texels, const size_t& _first, const size_t& _count, const std::array<float, 4U>& _a, const std::array<float, 4U>& _b, std::array<float, 16U>& _t) noexcept {
+			
+			std::array<float, 4U> axis {};
+			
+			float length2 = 0.0F;
+			
+			for (auto c = _first; c < _first + _count; ++c) {
+				axis[c] = _b[c] - _a[c];
+				
+				length2 += axis[c] * axis[c];
+			}
+			
+			const auto scale = length2 > 0.0F ? 1.0F / length2 : 0.0F;
+
+#if defined(BLOCKCOMPRESSION_SSE2)
+			
+			for (size_t i = 0U; i < 16U; i += 4U) {
+				
+				auto dot = _mm_setzero_ps();
+				
+				for (auto c = _first; c < _first + _count; ++c) {
+					dot = _mm_add_ps(dot, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&_texels[c][i]), _mm_set1_ps(_a[c])), _mm_set1_ps(axis[c])));
+				}
+				
+				_mm_storeu_ps(&_t[i], _mm_min_ps(_mm_max_ps(_mm_mul_ps(dot, _mm_set1_ps(scale)), _mm_setzero_ps()), _mm_set1_ps(1.0F)));
+			}
+
+#elif defined(BLOCKCOMPRESSION_NEON)
+			
+			for (size_t i = 0U; i < 16U; i += 4U) {
+				
+				auto dot = vdupq_n_f32(0.0F);
+				
+				for (auto c = _first; c < _first + _count; ++c) {
+					dot = vmlaq_n_f32(dot, vsubq_f32(vld1q_f32(&_texels[c][i]), vdupq_n_f32(_a[c])), axis[c]);
+				}
+				
+				vst1q_f32(&_t[i], vminq_f32(vmaxq_f32(vmulq_n_f32(dot, scale), vdupq_n_f32(0.0F)), vdupq_n_f32(1.0F)));
+			}
+
+#else
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				
+				float dot = 0.0F;
+				
+				for (auto c = _first; c < _first + _count; ++c) {
+					dot += (_texels[c][i] - _a[c]) * axis[c];
+				}
+				
+				_t[i] = std::clamp(dot * scale, 0.0F, 1.0F);
+			}
+
+#endif
+		}
+		
+		/**
+		 * @brief Fits endpoints to the extremes of the first three channels of a block, along their principal axis.
+		 */
+		static void Fit(const Texels& _texels, std::array<float, 4U>& _a, std::array<float, 4U>& _b) noexcept {
+			
+			std::array<float, 3U> mean {};
+			
+			for (size_t c = 0U; c < 3U; ++c) {
+			for (size_t i = 0U; i < 16U; ++i) {
+				mean[c] += _texels[c][i] / 16.0F;
+			}}
+			
+			std::array<std::array<float, 3U>, 3U> covariance {};
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				
+				const std::array<float, 3U> d { _texels[0U][i] - mean[0U], _texels[1U][i] - mean[1U], _texels[2U][i] - mean[2U] };
+				
+				for (size_t r = 0U; r < 3U; ++r) {
+				for (size_t c = 0U; c < 3U; ++c) {
+					covariance[r][c] += d[r] * d[c];
+				}}
+			}
+			
+			// Find the principal axis by power iteration, starting from the channel of greatest variance.
+			size_t largest = 0U;
+			
+			for (size_t c = 1U; c < 3U; ++c) {
+				
+				if (covariance[c][c] > covariance[largest][largest]) {
+					largest = c;
+				}
+			}
+			
+			auto axis = covariance[largest];
+			
+			for (size_t iteration = 0U; iteration < 8U; ++iteration) {
+				
+				std::array<float, 3U> next {};
+				
+				float length = 0.0F;
+				
+				for (size_t r = 0U; r < 3U; ++r) {
+					next[r] = (covariance[r][0U] * axis[0U]) + (covariance[r][1U] * axis[1U]) + (covariance[r][2U] * axis[2U]);
+					
+					length = std::max(length, std::abs(next[r]));
+				}
+				
+				if (length <= std::numeric_limits<float>::epsilon()) {
+					break;
+				}
+				
+				for (size_t r = 0U; r < 3U; ++r) {
+					axis[r] = next[r] / length;
+				}
+			}
+			
+			const auto length2 = (axis[0U] * axis[0U]) + (axis[1U] * axis[1U]) + (axis[2U] * axis[2U]);
+			
+			auto min = 0.0F;
+			auto max = 0.0F;
+			
+			if (length2 > std::numeric_limits<float>::epsilon()) {
+				
+				min = std::numeric_limits<float>::max();
+				max = std::numeric_limits<float>::lowest();
+				
+				for (size_t i = 0U; i < 16U; ++i) {
+					
+					const auto t = (((_texels[0U][i] - mean[0U]) * axis[0U]) +
+					                ((_texels[1U][i] - mean[1U]) * axis[1U]) +
+					                ((_texels[2U][i] - mean[2U]) * axis[2U])) / length2;
+					
+					min = std::min(min, t);
+					max = std::max(max, t);
+				}
+			}
+			
+			for (size_t c = 0U; c < 3U; ++c) {
+				_a[c] = mean[c] + (axis[c] * min);
+				_b[c] = mean[c] + (axis[c] * max);
+			}
+		}
+		
+		/**
+		 * @brief Fits endpoints to the first three channels of a block by least squares, given the position of each texel between them.
+		 * @return False if the positions do not determine the endpoints (i.e. every texel is at the same position).
+		 */
+		static bool Refit(const Texels& _texels, const std::array<float, 16U>& _weights, std::array<float, 4U>& _a, std::array<float, 4U>& _b) noexcept {
+			
+			float aa = 0.0F;
+			float bb = 0.0F;
+			float ab = 0.0F;
+			
+			std::array<float, 3U> ax {};
+			std::array<float, 3U> bx {};
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				
+				const auto wb = _weights[i];
+				const auto wa = 1.0F - wb;
+				
+				aa += wa * wa;
+				bb += wb * wb;
+				ab += wa * wb;
+				
+				for (size_t c = 0U; c < 3U; ++c) {
+					ax[c] += wa * _texels[c][i];
+					bx[c] += wb * _texels[c][i];
+				}
+			}
+			
+			const auto determinant = (aa * bb) - (ab * ab);
+			
+			const auto result = std::abs(determinant) > std::numeric_limits<float>::epsilon();
+			
+			if (result) {
+				
+				for (size_t c = 0U; c < 3U; ++c) {
+					_a[c] = ((ax[c] * bb) - (bx[c] * ab)) / determinant;
+					_b[c] = ((bx[c] * aa) - (ax[c] * ab)) / determinant;
+				}
+			}
+			
+			return result;
+		}
+		
+		static uint16_t To565(const std::array<float, 4U>& _colour) noexcept {
+			
+			const auto r = static_cast<uint16_t>(std::lround(std::clamp(_colour[0U], 0.0F, 255.0F) * (31.0F / 255.0F)));
+			const auto g = static_cast<uint16_t>(std::lround(std::clamp(_colour[1U], 0.0F, 255.0F) * (63.0F / 255.0F)));
+			const auto b = static_cast<uint16_t>(std::lround(std::clamp(_colour[2U], 0.0F, 255.0F) * (31.0F / 255.0F)));
+			
+			return static_cast<uint16_t>((r << 11U) | (g << 5U) | b);
+		}
+		
+		static std::array<float, 4U> From565(const uint16_t& _colour) noexcept {
+			
+			const auto r = (_colour >> 11U) & 0x1FU;
+			const auto g = (_colour >>  5U) & 0x3FU;
+			const auto b =  _colour         & 0x1FU;
+			
+			return {
+				static_cast<float>((r << 3U) | (r >> 2U)),
+				static_cast<float>((g << 2U) | (g >> 4U)),
+				static_cast<float>((b << 3U) | (b >> 2U)),
+				255.0F
+			};
+		}
+		
+		/**
+		 * @brief Returns the four-colour palette of a BC1 block, indexed by the position along its endpoints.
+		 */
+		static std::array<std::array<float, 4U>, 4U> Palette(const std::array<float, 4U>& _a, const std::array<float, 4U>& _b) noexcept {
+			
+			std::array<std::array<float, 4U>, 4U> result {};
+			
+			for (size_t l = 0U; l < 4U; ++l) {
+			for (size_t c = 0U; c < 4U; ++c) {
+				result[l][c] = ((_a[c] * static_cast<float>(3U - l)) + (_b[c] * static_cast<float>(l))) / 3.0F;
+			}}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Encodes the colour of a BC1 block, or of the colour half of a BC3 block.
+		 * @note Always encodes in four-colour mode, so that the colour of BC3 blocks is decoded the same way.
+		 */
+		static void EncodeColour(const Texels& _texels, char* _block) noexcept {
+			
+			// Index of each position along the endpoints, where the first endpoint is at position 0.
+			static constexpr std::array<uint32_t, 4U> s_Indices { 0U, 2U, 3U, 1U };
+			
+			std::array<float, 4U> a {};
+			std::array<float, 4U> b {};
+			
+			Fit(_texels, a, b);
+			
+			auto best = std::numeric_limits<float>::max();
+			
+			uint16_t c0 = 0U;
+			uint16_t c1 = 0U;
+			
+			uint32_t indices = 0U;
+			
+			// Encode using the principal axis, then refine the endpoints by least squares and keep whichever is better.
+			for (size_t attempt = 0U; attempt < 2U; ++attempt) {
+				
+				auto q0 = To565(a);
+				auto q1 = To565(b);
+				
+				// The first endpoint must be the greater in four-colour mode.
+				if (q0 < q1) {
+					std::swap(q0, q1);
+				}
+				
+				const auto e0 = From565(q0);
+				const auto e1 = From565(q1);
+				
+				std::array<float, 16U> t {};
+				
+				if (q0 != q1) {
+					Project(_texels, 0U, 3U, e0, e1, t);
+				}
+				
+				const auto palette = Palette(e0, e1);
+				
+				float    error = 0.0F;
+				uint32_t bits  = 0U;
+				
+				for (size_t i = 0U; i < 16U; ++i) {
+					
+					const auto l = static_cast<size_t>(std::lround(t[i] * 3.0F));
+					
+					for (size_t c = 0U; c < 3U; ++c) {
+						error += (_texels[c][i] - palette[l][c]) * (_texels[c][i] - palette[l][c]);
+					}
+					
+					bits |= s_Indices[l] << (i * 2U);
+					
+					t[i] = static_cast<float>(l) / 3.0F;
+				}
+				
+				if (error < best) {
+					best = error;
+					
+					c0      = q0;
+					c1      = q1;
+					indices = bits;
+				}
+				
+				if (q0 == q1 || !Refit(_texels, t, a, b)) {
+					break;
+				}
+			}
+			
+			// If the endpoints are equal, every index refers to the first endpoint, which is valid in both three- and four-colour modes.
+			Write(_block,      c0, 2U);
+			Write(_block + 2U, c1, 2U);
+			Write(_block + 4U, indices, 4U);
+		}
+		
+		/**
+		 * @brief Encodes a single channel of a block as a BC4 block.
+		 */
+		static void EncodeChannel(const Texels& _texels, const size_t& _channel, char* _block) noexcept {
+			
+			const auto& values = _texels[_channel];
+			
+			const auto [min, max] = std::minmax_element(values.begin(), values.end());
+			
+			const auto r0 = static_cast<uint8_t>(std::lround(std::clamp(*max, 0.0F, 255.0F)));
+			const auto r1 = static_cast<uint8_t>(std::lround(std::clamp(*min, 0.0F, 255.0F)));
+			
+			uint64_t indices = 0U;
+			
+			// If the endpoints are equal, every index refers to the first endpoint.
+			if (r0 != r1) {
+				
+				std::array<float, 4U> a {};
+				std::array<float, 4U> b {};
+				
+				a[_channel] = static_cast<float>(r0);
+				b[_channel] = static_cast<float>(r1);
+				
+				std::array<float, 16U> t {};
+				
+				Project(_texels, _channel, 1U, a, b, t);
+				
+				for (size_t i = 0U; i < 16U; ++i) {
+					
+					// Positions 0 and 7 are the endpoints (indices 0 and 1), and positions 1 to 6 are interpolated (indices 2 to 7).
+					const auto l = static_cast<uint64_t>(std::lround(t[i] * 7.0F));
+					
+					indices |= (l == 0U ? 0U : l == 7U ? 1U : l + 1U) << (i * 3U);
+				}
+			}
+			
+			_block[0U] = static_cast<char>(r0);
+			_block[1U] = static_cast<char>(r1);
+			
+			Write(_block + 2U, indices, 6U);
+		}
+		
+		/**
+		 * @brief Encodes the colour of a block as a BC6H block, using mode 11.
+		 */
+		static void EncodeHalf(const Texels& _texels, char* _block) noexcept {
+			
+			// Work in the space of the unquantised endpoints, in which the palette is linear.
+			Texels texels {};
+			
+			for (size_t c = 0U; c < 3U; ++c) {
+			for (size_t i = 0U; i < 16U; ++i) {
+				texels[c][i] = static_cast<float>(ToHalf(_texels[c][i])) * (64.0F / 31.0F);
+			}}
+			
+			std::array<float, 4U> a {};
+			std::array<float, 4U> b {};
+			
+			Fit(texels, a, b);
+			
+			std::array<uint32_t, 3U> q0 {};
+			std::array<uint32_t, 3U> q1 {};
+			
+			std::array<float, 4U> e0 {};
+			std::array<float, 4U> e1 {};
+			
+			for (size_t c = 0U; c < 3U; ++c) {
+				q0[c] = Quantise(a[c]);
+				q1[c] = Quantise(b[c]);
+				
+				e0[c] = static_cast<float>(Unquantise(q0[c]));
+				e1[c] = static_cast<float>(Unquantise(q1[c]));
+			}
+			
+			std::array<float, 16U> t {};
+			
+			Project(texels, 0U, 3U, e0, e1, t);
+			
+			std::array<uint32_t, 16U> indices {};
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				
+				// The weights are not evenly spaced, so compare with the neighbours of the nearest even position.
+				const auto w = t[i] * 64.0F;
+				
+				auto index = static_cast<uint32_t>(std::lround(t[i] * 15.0F));
+				
+				if (index > 0U && std::abs(static_cast<float>(s_HalfWeights[index - 1U]) - w) < std::abs(static_cast<float>(s_HalfWeights[index]) - w)) {
+					--index;
+				}
+				else if (index < 15U && std::abs(static_cast<float>(s_HalfWeights[index + 1U]) - w) < std::abs(static_cast<float>(s_HalfWeights[index]) - w)) {
+					++index;
+				}
+				
+				indices[i] = index;
+			}
+			
+			// The most significant bit of the index of the first texel is implicitly zero, so swap the endpoints if it is set.
+			if ((indices[0U] & 8U) != 0U) {
+				
+				std::swap(q0, q1);
+				
+				for (auto& index : indices) {
+					index = 15U - index;
+				}
+			}
+			
+			std::array<uint64_t, 2U> bits {};
+			
+			size_t offset = 0U;
+			
+			Put(bits, offset, 0x03U, 5U);
+			
+			for (const auto& q : q0) { Put(bits, offset, q, 10U); }
+			for (const auto& q : q1) { Put(bits, offset, q, 10U); }
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				Put(bits, offset, indices[i], i == 0U ? 3U : 4U);
+			}
+			
+			Write(_block,      bits[0U], 8U);
+			Write(_block + 8U, bits[1U], 8U);
+		}
+		
+		static void DecodeColour(const char* _block, const bool& _fourColour, Texels& _texels) noexcept {
+			
+			const auto c0 = static_cast<uint16_t>(Read(_block,      2U));
+			const auto c1 = static_cast<uint16_t>(Read(_block + 2U, 2U));
+			
+			const auto indices = Read(_block + 4U, 4U);
+			
+			const auto e0 = From565(c0);
+			const auto e1 = From565(c1);
+			
+			std::array<std::array<float, 4U>, 4U> palette {};
+			
+			if (_fourColour || c0 > c1) {
+				
+				const auto interpolated = Palette(e0, e1);
+				
+				palette = { e0, e1, interpolated[1U], interpolated[2U] };
+			}
+			else {
+				
+				std::array<float, 4U> half {};
+				
+				for (size_t c = 0U; c < 4U; ++c) {
+					half[c] = (e0[c] + e1[c]) / 2.0F;
+				}
+				
+				palette = { e0, e1, half, std::array<float, 4U> { 0.0F, 0.0F, 0.0F, 0.0F } };
+			}
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+			for (size_t c = 0U; c < 4U; ++c) {
+				_texels[c][i] = palette[(indices >> (i * 2U)) & 0x3U][c];
+			}}
+		}
+		
+		static void DecodeChannel(const char* _block, const size_t& _channel, Texels& _texels) noexcept {
+			
+			const auto r0 = static_cast<float>(static_cast<uint8_t>(_block[0U]));
+			const auto r1 = static_cast<float>(static_cast<uint8_t>(_block[1U]));
+			
+			const auto indices = Read(_block + 2U, 6U);
+			
+			std::array<float, 8U> palette { r0, r1, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 255.0F };
+			
+			if (r0 > r1) {
+				
+				for (size_t k = 1U; k < 7U; ++k) {
+					palette[k + 1U] = ((r0 * static_cast<float>(7U - k)) + (r1 * static_cast<float>(k))) / 7.0F;
+				}
+			}
+			else {
+				
+				for (size_t k = 1U; k < 5U; ++k) {
+					palette[k + 1U] = ((r0 * static_cast<float>(5U - k)) + (r1 * static_cast<float>(k))) / 5.0F;
+				}
+			}
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				_texels[_channel][i] = palette[(indices >> (i * 3U)) & 0x7U];
+			}
+		}
+		
+		static void DecodeHalf(const char* _block, Texels& _texels) {
+			
+			const std::array<uint64_t, 2U> bits { Read(_block, 8U), Read(_block + 8U, 8U) };
+			
+			size_t offset = 0U;
+			
+			if (Get(bits, offset, 5U) != 0x03U) {
+				throw std::invalid_argument("Only BC6H mode 11 is supported.");
+			}
+			
+			std::array<uint32_t, 3U> e0 {};
+			std::array<uint32_t, 3U> e1 {};
+			
+			for (auto& e : e0) { e = Unquantise(static_cast<uint32_t>(Get(bits, offset, 10U))); }
+			for (auto& e : e1) { e = Unquantise(static_cast<uint32_t>(Get(bits, offset, 10U))); }
+			
+			for (size_t i = 0U; i < 16U; ++i) {
+				
+				const auto w = static_cast<uint32_t>(s_HalfWeights[Get(bits, offset, i == 0U ? 3U : 4U)]);
+				
+				for (size_t c = 0U; c < 3U; ++c) {
+					
+					const auto interpolated = (((64U - w) * e0[c]) + (w * e1[c]) + 32U) >> 6U;
+					
+					_texels[c][i] = FromHalf(static_cast<uint16_t>((interpolated * 31U) >> 6U));
+				}
+				
+				_texels[3U][i] = 1.0F;
+			}
+		}
+		
+		/** @brief Quantises an unquantised BC6H endpoint to 10 bits. */
+		static uint32_t Quantise(const float& _value) noexcept {
+			return static_cast<uint32_t>(std::clamp(std::lround((_value - 32.0F) / 64.0F), 0L, 1023L));
+		}
+		
+		/** @brief Expands a 10-bit BC6H endpoint to 16 bits. */
+		static uint32_t Unquantise(const uint32_t& _value) noexcept {
+			return _value == 0U ? 0U : _value == 1023U ? 0xFFFFU : (_value << 6U) + 32U;
+		}
+		
+		/**
+		 * @brief Converts a float to an unsigned half-float.
+		 * @note Negative values and NaN become zero, and values too large to represent become the largest finite half-float.
+		 */
+		static uint16_t ToHalf(const float& _value) noexcept {
+			
+			uint16_t result = 0U;
+			
+			if (_value >= 65504.0F) {
+				result = 0x7BFFU;
+			}
+			else if (_value > 0.0F) {
+				
+				int exponent = 0;
+				
+				const auto fraction = std::frexp(_value, &exponent);
+				
+				if (exponent + 14 <= 0) {
+					
+					// Subnormal. Rounding up to 0x400 yields the smallest normal number.
+					result = static_cast<uint16_t>(std::lround(std::ldexp(_value, 24)));
+				}
+				else {
+					
+					auto mantissa = static_cast<uint32_t>(std::lround(((fraction * 2.0F) - 1.0F) * 1024.0F));
+					auto biased   = static_cast<uint32_t>(exponent + 14);
+					
+					if (mantissa == 1024U) {
+						mantissa = 0U;
+						
+						++biased;
+					}
+					
+					result = static_cast<uint16_t>(std::min((biased << 10U) | mantissa, 0x7BFFU));
+				}
+			}
+			
+			return result;
+		}
+		
+		static float FromHalf(const uint16_t& _value) noexcept {
+			
+			const auto exponent = static_cast<int>((_value >> 10U) & 0x1FU);
+			const auto mantissa = static_cast<uint32_t>(_value & 0x3FFU);
+			
+			float result;
+			
+			if (exponent == 0) {
+				result = std::ldexp(static_cast<float>(mantissa), -24);
+			}
+			else if (exponent == 31) {
+				result = mantissa == 0U ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+			}
+			else {
+				result = std::ldexp(static_cast<float>(mantissa | 0x400U), exponent - 25);
+			}
+			
+			return (_value & 0x8000U) != 0U ? -result : result;
+		}
+		
+		/** @brief Appends a field to a 128-bit block, least-significant bit first. */
+		static void Put(std::array<uint64_t, 2U>& _bits, size_t& _offset, const uint64_t& _value, const size_t& _count) noexcept {
+			
+			if (_offset < 64U) {
+				_bits[0U] |= _value << _offset;
+				
+				if (_offset + _count > 64U) {
+					_bits[1U] |= _value >> (64U - _offset);
+				}
+			}
+			else {
+				_bits[1U] |= _value << (_offset - 64U);
+			}
+			
+			_offset += _count;
+		}
+		
+		/** @brief Reads the next field of a 128-bit block, least-significant bit first. */
+		static uint64_t Get(const std::array<uint64_t, 2U>& _bits, size_t& _offset, const size_t& _count) noexcept {
+			
+			uint64_t result;
+			
+			if (_offset < 64U) {
+				result = _bits[0U] >> _offset;
+				
+				if (_offset + _count > 64U) {
+					result |= _bits[1U] << (64U - _offset);
+				}
+			}
+			else {
+				result = _bits[1U] >> (_offset - 64U);
+			}
+			
+			_offset += _count;
+			
+			return result & ((1ULL << _count) - 1U);
+		}
+		
+		/** @brief Writes the lowest bytes of a value in little-endian order. */
+		static void Write(char* _destination, const uint64_t& _value, const size_t& _bytes) noexcept {
+			
+			for (size_t i = 0U; i < _bytes; ++i) {
+				_destination[i] = static_cast<char>((_value >> (i * 8U)) & 0xFFU);
+			}
+		}
+		
+		/** @brief Reads a little-endian value of the given number of bytes. */
+		static uint64_t Read(const char* _source, const size_t& _bytes) noexcept {
+			
+			uint64_t result = 0U;
+			
+			for (size_t i = 0U; i < _bytes; ++i) {
+				result |= static_cast<uint64_t>(static_cast<uint8_t>(_source[i])) << (i * 8U);
+			}
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson::Engine::Graphics
+
+#endif //FINALYEARPROJECT_BLOCKCOMPRESSION_HPP
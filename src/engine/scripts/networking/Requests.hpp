@@ -2,6 +2,8 @@
 #define FINALYEARPROJECT_REQUESTS_HPP
 
 #include "../core/Debug.hpp"
+#include "../core/Profiler.hpp"
+#include "../core/utils/JobSystem.hpp"
 
 #include <curl/curl.h>
 #include <curl/easy.h>
@@ -221,13 +223,17 @@ namespace LouiEriksson::Engine::Networking {
 			/**
 			 * @brief Asynchronously sends an HTTP request and returns a future representing the response.
 			 *
-			 * @return A std::future object representing the response of the HTTP request.
+			 * @note The request is executed as a streaming job on the Threading::JobSystem.
+			 *
+			 * @return A Threading::JobSystem::Task object representing the response of the HTTP request.
 			 */
-			std::future<Requests::Response> SendAsync() {
+			Threading::JobSystem::Task<Requests::Response> SendAsync() {
 				
-				return std::async([this]() {
+				return Threading::JobSystem::Async([this]() {
+					PROFILE_ZONE("Requests::SendAsync");
+					
 					return Send();
-				});
+				}, Threading::JobSystem::Streaming);
 			}
 			
 			void Dispose() noexcept {
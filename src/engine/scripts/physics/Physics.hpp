@@ -17,6 +17,7 @@
 #include <LinearMath/btScalar.h>
 #include <LinearMath/btVector3.h>
 
+#include <algorithm>
 #include <exception>
 #include <memory>
 
@@ -227,6 +228,17 @@ namespace LouiEriksson::Engine::Physics {
 			}
 		}
 		
+		/**
+		 * @brief Get the fraction of the fixed time step which has elapsed since the physics engine was last updated.
+		 * @return The fraction, in the range [0, 1].
+		 */
+		static btScalar Alpha() noexcept {
+			
+			const auto step = Time::FixedUnscaledDeltaTime<btScalar>();
+			
+			return step > 0.0 ? std::clamp(s_LastTick / step, static_cast<btScalar>(0.0), static_cast<btScalar>(1.0)) : static_cast<btScalar>(1.0);
+		}
+		
 		/**
 		 * @brief Set the value of gravity within the simulation.
 		 * @param[in] _value The new value of gravity as a vec3 object.
@@ -10,16 +10,13 @@
 #include "../physics/Collision.hpp"
 #include "Collider.hpp"
 #include "Physics.hpp"
+#include "StateBuffer.hpp"
 
 #include <BulletCollision/CollisionDispatch/btCollisionObject.h>
 #include <BulletDynamics/Dynamics/btRigidBody.h>
 #include <LinearMath/btDefaultMotionState.h>
 #include <LinearMath/btScalar.h>
 
-#include <glm/ext/quaternion_trigonometric.hpp>
-#include <glm/geometric.hpp>
-#include <glm/trigonometric.hpp>
-
 #include <cmath>
 #include <exception>
 #include <memory>
@@ -243,6 +240,9 @@ namespace LouiEriksson::Engine::Physics {
 		/** @brief List of collisions for the current tick of the physics engine. */
 		std::vector<Collision> m_Collisions;
 		
+		/** @brief Slot of the Rigidbody in the latest snapshot of its Scene's StateBuffer. */
+		size_t m_State = StateBuffer::s_None;
+		
 		/**
 		 * @brief Reinitialises the BulletRigidbody component of the Rigidbody.
 		 *
@@ -273,58 +273,19 @@ namespace LouiEriksson::Engine::Physics {
 	
 		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Rigidbody); };
 		
-		/**
-		 * @brief Interpolates the position and rotation of the Rigidbody
-		 *
-		 * @note This function should be called once per frame to keep the transform in sync
-		 * with the physics engine.
-		 */
-		void Interpolate() {
-			
-			if (Physics::s_LastTick > 0.0) {
-				
-				if (const auto transform = m_Transform.lock()) {
-					
-					// Get the transform from the bullet physics engine.
-					auto t = m_Parameters.m_BulletRigidbody->m_Rigidbody->getWorldTransform();
-					
-					// Get the position and rotation of the rigidbody as they exist within bullet.
-					const auto bOrigin   = t.getOrigin();
-					const auto bRotation = t.getRotation().inverse();
-					
-					// Convert to glm types.
-					const auto lastPos = vec3(  bOrigin.x(),   bOrigin.y(),   bOrigin.z());
-					const auto lastRot = glm::quat(bRotation.w(), bRotation.x(), bRotation.y(), bRotation.z());
-				
-					// Compute quaternion from angular velocity.
-					const auto av = AngularVelocity();
-					
-					glm::quat rot;
-					if (glm::length(av) > 0.005) {
-						rot = glm::angleAxis(glm::cos(glm::length(av)) * Time::FixedDeltaTime<scalar_t>(), glm::normalize(av));
-					}
-					else {
-						rot = glm::identity<glm::quat>();
-					}
-					
-					// Apply new values. Linearly interpolate using length of time since last physics update.-
-					transform->Position(lastPos + (Velocity() * Physics::s_LastTick * Time::FixedDeltaTime<scalar_t>()));
-					transform->Rotation(glm::slerp(lastRot, lastRot * rot, std::max(Physics::s_LastTick, static_cast<btScalar>(0.0))));
-				}
-			}
-		}
-		
 		/**
 		 * @brief Syncs the transform of the object with the physics engine.
 		 *
 		 * This function updates the position and orientation of the object's transform
-		 * based on the data obtained from the physics engine. It also retrieves collision
-		 * information and stores it in a list of collision objects.
+		 * based on the data obtained from the physics engine, and writes them into a snapshot
+		 * for interpolation. It also retrieves collision information and stores it in a list of collision objects.
 		 *
-		 * @note This function should be called once per frame to keep the transform in sync
+		 * @param[in] _states Snapshot to write the pose of the Rigidbody into.
+		 *
+		 * @note This function should be called once per physics update to keep the transform in sync
 		 * with the physics engine.
 		 */
-		void Sync() {
+		void Sync(StateBuffer& _states) {
 			
 			try {
 				
@@ -338,9 +299,16 @@ namespace LouiEriksson::Engine::Physics {
 						const auto bOrigin   = t.getOrigin();
 						const auto bRotation = t.getRotation().inverse();
 						
+						const StateBuffer::Pose pose {
+							vec3(bOrigin.x(), bOrigin.y(), bOrigin.z()),
+							glm::quat(bRotation.w(), bRotation.x(), bRotation.y(), bRotation.z())
+						};
+						
 						// Sync the transform from bullet with the transform in-engine.
-						transform->Position(vec3(bOrigin.x(), bOrigin.y(), bOrigin.z()));
-						transform->Rotation(glm::quat(bRotation.w(), bRotation.x(), bRotation.y(), bRotation.z()));
+						transform->Position(pose.m_Position);
+						transform->Rotation(pose.m_Rotation);
+						
+						_states.Write(m_State, *transform, pose);
 					}
 				}
 				
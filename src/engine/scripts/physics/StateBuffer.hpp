@@ -0,0 +1,134 @@
+#ifndef FINALYEARPROJECT_STATEBUFFER_HPP
+#define FINALYEARPROJECT_STATEBUFFER_HPP
+
+#include "../core/Transform.hpp"
+#include "../core/Types.hpp"
+#include "../ecs/Handle.hpp"
+
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/common.hpp>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace LouiEriksson::Engine::Physics {
+	
+	/**
+	 * @class StateBuffer
+	 * @brief Double-buffered snapshots of the simulated poses of the bodies in a Scene.
+	 *
+	 * @details Each fixed update writes the pose of every body into the back buffer, alongside the pose it had in the previous snapshot,
+	 *          and then publishes it with Publish(). Each frame, Interpolate() blends the Transforms of the bodies between the two poses
+	 *          of the latest snapshot. The render side therefore only ever reads snapshots, never the state of the physics engine.
+	 *
+	 * @note Writing and publishing may happen on a different thread to interpolation, provided only one thread writes.
+	 */
+	class StateBuffer final {
+	
+	public:
+		
+		/**
+		 * @struct Pose
+		 * @brief Position and rotation of a body.
+		 */
+		struct Pose final {
+			
+			vec3      m_Position;
+			glm::quat m_Rotation;
+		};
+		
+		/** @brief Slot of a body which has not yet been written. */
+		static constexpr size_t s_None = std::numeric_limits<size_t>::max();
+	
+	private:
+		
+		struct State final {
+			
+			ECS::ComponentHandle<Transform> m_Transform;
+			
+			Pose m_Previous;
+			Pose m_Current;
+		};
+		
+		std::array<std::vector<State>, 2U> m_Buffers;
+		
+		/** @brief Index of the most recently published buffer. */
+		size_t m_Front = 0U;
+		
+		/** @brief Guards the swapping of the buffers against Interpolate(). */
+		mutable std::mutex m_Lock;
+	
+	public:
+		
+		StateBuffer() = default;
+		
+		StateBuffer(const StateBuffer& _other) = delete;
+		StateBuffer& operator = (const StateBuffer& _other) = delete;
+		
+		/**
+		 * @brief Writes the pose of a body into the back buffer.
+		 *
+		 * @param[in,out] _slot Slot of the body in the latest snapshot (or s_None), which is updated to its slot in the next.
+		 * @param[in] _transform Transform of the body.
+		 * @param[in] _pose Pose of the body at the end of the fixed update.
+		 */
+		void Write(size_t& _slot, const Transform& _transform, const Pose& _pose) {
+			
+			const auto& front = m_Buffers[m_Front];
+			      auto& back  = m_Buffers[m_Front ^ 1U];
+			
+			const ECS::ComponentHandle<Transform> transform(_transform);
+			
+			// Bodies without a previous pose (i.e. new bodies) start at rest.
+			const auto& previous = _slot < front.size() && front[_slot].m_Transform == transform ?
+				front[_slot].m_Current :
+				_pose;
+			
+			_slot = back.size();
+			
+			back.push_back({ transform, previous, _pose });
+		}
+		
+		/** @brief Publishes the back buffer as the latest snapshot. */
+		void Publish() {
+			
+			const std::lock_guard<std::mutex> lock(m_Lock);
+			
+			m_Front ^= 1U;
+			
+			m_Buffers[m_Front ^ 1U].clear();
+		}
+		
+		/**
+		 * @brief Blends the Transform of every body in the latest snapshot between its previous and current pose.
+		 * @param[in] _alpha Fraction of the fixed time step which has elapsed since the snapshot, in the range [0, 1].
+		 */
+		void Interpolate(const scalar_t& _alpha) const {
+			
+			const std::lock_guard<std::mutex> lock(m_Lock);
+			
+			for (const auto& state : m_Buffers[m_Front]) {
+				
+				if (auto* const transform = state.m_Transform.Get()) {
+					
+					transform->Position(glm::mix(state.m_Previous.m_Position, state.m_Current.m_Position, _alpha));
+					transform->Rotation(glm::slerp(state.m_Previous.m_Rotation, state.m_Current.m_Rotation, _alpha));
+				}
+			}
+		}
+		
+		/** @brief Returns the number of bodies in the latest snapshot. */
+		[[nodiscard]] size_t size() const {
+			
+			const std::lock_guard<std::mutex> lock(m_Lock);
+			
+			return m_Buffers[m_Front].size();
+		}
+	};
+
+} // LouiEriksson::Engine::Physics
+
+#endif //FINALYEARPROJECT_STATEBUFFER_HPP
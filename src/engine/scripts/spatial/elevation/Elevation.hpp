@@ -2,7 +2,9 @@
 #define FINALYEARPROJECT_ELEVATION_HPP
 
 #include "../../core/Debug.hpp"
+#include "../../core/Profiler.hpp"
 #include "../../core/Types.hpp"
+#include "../../core/utils/JobSystem.hpp"
 #include "../../core/utils/Utils.hpp"
 #include "../../networking/Requests.hpp"
 #include "../maths/Coords.hpp"
@@ -33,9 +35,11 @@ namespace LouiEriksson::Engine::Spatial {
             OpenTopoData  = 1U, /**< @brief <a href="https://www.opentopodata.org/">OpenTopoData</a> */
         };
 		
-		static std::future<void> LoadElevationAsync(const vec4& _bounds, const ElevationProvider& _provider, const ivec2& _dimensions, const std::chrono::system_clock::duration& _timeout, const std::function<void(const std::vector<glm::vec<1, scalar_t>>&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
+		static Threading::JobSystem::Task<void> LoadElevationAsync(const vec4& _bounds, const ElevationProvider& _provider, const ivec2& _dimensions, const std::chrono::system_clock::duration& _timeout, const std::function<void(const std::vector<glm::vec<1, scalar_t>>&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
 	
-			return std::async([_bounds, _provider, _dimensions, _timeout, _callback, &_cancellationToken]() {
+			return Threading::JobSystem::Async([_bounds, _provider, _dimensions, _timeout, _callback, &_cancellationToken]() {
+				
+				PROFILE_ZONE("Elevation::LoadElevation");
 				
 				try {
 					
@@ -56,7 +60,7 @@ namespace LouiEriksson::Engine::Spatial {
 					Debug::Log(e);
 				}
 				
-			});
+			}, Threading::JobSystem::Streaming, &_cancellationToken);
 	    }
 	
 	private:
@@ -120,9 +124,9 @@ namespace LouiEriksson::Engine::Spatial {
 	        }
 	    }
 		
-        static std::future<void> PostRequestOpenElevationAsync(const std::vector<vec2>& _request, const std::chrono::system_clock::duration& _timeout, const std::function<void(const Serialisation::ElevationDeserialiser::OEJSON::Root&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
+        static Threading::JobSystem::Task<void> PostRequestOpenElevationAsync(const std::vector<vec2>& _request, const std::chrono::system_clock::duration& _timeout, const std::function<void(const Serialisation::ElevationDeserialiser::OEJSON::Root&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
 	
-			return std::async([_request, _callback, _timeout, &_cancellationToken]() {
+			return Threading::JobSystem::Async([_request, _callback, _timeout, &_cancellationToken]() {
 				
 				try {
 					
@@ -152,7 +156,7 @@ namespace LouiEriksson::Engine::Spatial {
 		
 			        auto task = message.SendAsync();
 					
-					const auto status = Threading::Utils::Wait(task, _timeout, _cancellationToken);
+					const auto status = Threading::JobSystem::Wait(task, _timeout, _cancellationToken);
 					
 					if (status == std::future_status::ready) {
 						
@@ -172,12 +176,12 @@ namespace LouiEriksson::Engine::Spatial {
 				catch (const std::exception& e) {
 					Debug::Log(e);
 				}
-			});
+			}, Threading::JobSystem::Streaming, &_cancellationToken);
 	    }
 
-        static std::future<void> PostRequestOpenTopoDataAsync(const std::vector<vec2>& _request, const std::chrono::system_clock::duration& _timeout, const std::function<void(const Serialisation::ElevationDeserialiser::OTDJSON::Root&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
+        static Threading::JobSystem::Task<void> PostRequestOpenTopoDataAsync(const std::vector<vec2>& _request, const std::chrono::system_clock::duration& _timeout, const std::function<void(const Serialisation::ElevationDeserialiser::OTDJSON::Root&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
 	    
-			return std::async([_request, _callback, _timeout, &_cancellationToken]() {
+			return Threading::JobSystem::Async([_request, _callback, _timeout, &_cancellationToken]() {
 				
 				try {
 					
@@ -222,9 +226,7 @@ namespace LouiEriksson::Engine::Spatial {
 						
 			            auto task = message.SendAsync();
 					 
-						Threading::Utils::Wait(task, _timeout, _cancellationToken);
-						
-						const auto status = Threading::Utils::Status(task);
+						const auto status = Threading::JobSystem::Wait(task, _timeout, _cancellationToken);
 						
 						if (status == std::future_status::ready) {
 							results.emplace_back(Serialisation::ElevationDeserialiser::Deserialise<Serialisation::ElevationDeserialiser::OTDJSON>(task.get().Content().ToStream()));
@@ -254,7 +256,7 @@ namespace LouiEriksson::Engine::Spatial {
 				catch (const std::exception& e) {
 					Debug::Log(e);
 				}
-			});
+			}, Threading::JobSystem::Streaming, &_cancellationToken);
 	    }
 		
 	};
@@ -162,6 +162,33 @@ namespace LouiEriksson::Engine::Spatial::Maths {
 				});
 			}
 			
+			/**
+			 * @brief Converts a GPS coordinate to a position in world space, relative to an origin.
+			 *
+			 * @param[in] _coord The GPS coordinate (latitude, longitude, altitude).
+			 * @param[in] _origin The GPS coordinate of the world origin.
+			 * @return The position of the coordinate in world space.
+			 */
+			template<typename T = scalar_t, glm::qualifier Q = glm::defaultp>
+			static glm::vec<3, T, Q> GPSToWorld(const glm::vec<3, T, Q>& _coord, const glm::vec<3, T, Q>& _origin) {
+				
+		        const auto delta = _coord - _origin;
+				
+		        const auto pos = GPSToCartesian<T, Q>({
+		            delta.x * WGS84::EquatorialStretchFactor(_coord.x),
+		            static_cast<T>(90.0) + delta.y,
+		            delta.z
+				});
+				
+				const auto offset = glm::vec<3, T, Q>(
+					0,
+					WGS84::EarthRadius(_coord.x) + WGS84::AltitudeCompensation(_coord.x),
+					0
+				);
+				
+		        return pos - offset;
+			}
+			
 			template<typename T = scalar_t, glm::qualifier Q = glm::defaultp>
 			static constexpr glm::vec<2, size_t, Q> GPSToPixel(const glm::vec<2, T, Q>& _coord) {
 		        return {
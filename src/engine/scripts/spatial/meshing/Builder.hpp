@@ -1,12 +1,15 @@
 #ifndef FINALYEARPROJECT_BUILDER_HPP
 #define FINALYEARPROJECT_BUILDER_HPP
 
+#include "../../core/AssetId.hpp"
 #include "../../core/Resources.hpp"
 #include "../../core/Types.hpp"
 #include "../../core/utils/Hashmap.hpp"
 #include "../../core/utils/Random.hpp"
 #include "../../core/utils/Utils.hpp"
 #include "../../ecs/Component.hpp"
+#include "../../ecs/GameObject.hpp"
+#include "../../ecs/Prototype.hpp"
 #include "../../graphics/Renderer.hpp"
 #include "../../graphics/TextureCPU.hpp"
 #include "../maths/Coords.hpp"
@@ -15,6 +18,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -140,7 +144,7 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 				auto renderer = go->AddComponent<Graphics::Renderer>();
 				renderer->SetMesh(mesh);
 				renderer->SetTransform(transform);
-				renderer->SetMaterial(Resources::Get<Graphics::Material>("terrain"));
+				renderer->SetMaterial(Resources::Get<Graphics::Material>("terrain"_asset));
 				
 				result = go;
 			}
@@ -201,9 +205,36 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 	        return result;
 	    }
 		
-	    static std::optional<std::shared_ptr<ECS::GameObject>> TryCreateArea(const Serialisation::OSMDeserialiser::OSMJSON::Root::Element& _element, const std::weak_ptr<ECS::GameObject>& _parent) {
+	    /**
+	     * @brief Returns a Prototype for the GameObjects of the given areas, for use with Scene::SpawnBatch().
+	     * @note The meshes of the areas are generated afterwards, by TryBuildArea().
+	     */
+	    static ECS::Prototype<Transform, Graphics::Renderer> AreaPrototype(const std::vector<std::shared_ptr<Serialisation::OSMDeserialiser::OSMJSON::Root::Element>>& _elements) {
+			
+			ECS::Prototype<Transform, Graphics::Renderer> result;
+			
+			result.m_Name = [_elements](const size_t& _index) {
+				return "Area: " + std::to_string(_elements.at(_index)->id);
+			};
+			
+			result.m_Initialiser = [material = Resources::Get<Graphics::Material>("area"_asset)]([[maybe_unused]] const size_t& _index, [[maybe_unused]] ECS::GameObject& _gameObject, Transform& _transform, Graphics::Renderer& _renderer) {
+				_renderer.SetTransform(_transform);
+				_renderer.SetMaterial(material);
+			};
+			
+			return result;
+		}
+		
+	    /**
+	     * @brief Generates the mesh of an area, spawned using AreaPrototype().
+	     *
+	     * @param[in] _element The area.
+	     * @param[in] _gameObject The GameObject of the area.
+	     * @return True if successful, or false if the area has too few valid vertices.
+	     */
+	    static bool TryBuildArea(const Serialisation::OSMDeserialiser::OSMJSON::Root::Element& _element, ECS::GameObject& _gameObject) {
 	
-	        std::optional<std::shared_ptr<ECS::GameObject>> result = std::nullopt;
+	        bool result = false;
 
 			try {
 
@@ -218,12 +249,7 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 
 					if (coords.size() >= 3U) {
 
-						auto go = _parent.lock()->GetScene()->Create("Area: " + std::to_string(_element.id));
-			            auto transform = go->AddComponent<Transform>();
-
-						const auto renderer = go->AddComponent<Graphics::Renderer>();
-						renderer->SetTransform(transform);
-						renderer->SetMaterial(Resources::Get<Graphics::Material>("area"));
+						const auto renderer = _gameObject.GetComponent<Graphics::Renderer>();
 
 						std::vector<glm::vec<3, vertex_t>> vertices;
 						
@@ -291,7 +317,7 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 							}
 						}
 
-						result = go;
+						result = true;
 					}
 					else {
 						throw std::runtime_error("Area has insufficient unique consecutive vertices to form any polygons.");
@@ -304,15 +330,60 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 			catch(std::exception& e) {
 				Debug::Log(e);
 
-				result = std::nullopt;
+				result = false;
 			}
 			
 	        return result;
 	    }
 	    
-	    static std::optional<std::shared_ptr<ECS::GameObject>> TryCreateBuilding(const Serialisation::OSMDeserialiser::OSMJSON::Root::Element& _element, const std::weak_ptr<ECS::GameObject>& _parent) {
+	    /**
+	     * @brief Returns a Prototype for the GameObjects of the given buildings, for use with Scene::SpawnBatch().
+	     * @note The meshes of the buildings (walls, roof, and floor) are generated afterwards, by TryBuildBuilding().
+	     */
+	    static ECS::Prototype<Transform, Graphics::Renderer, Graphics::Renderer, Graphics::Renderer> BuildingPrototype(const std::vector<std::shared_ptr<Serialisation::OSMDeserialiser::OSMJSON::Root::Element>>& _elements) {
+			
+			ECS::Prototype<Transform, Graphics::Renderer, Graphics::Renderer, Graphics::Renderer> result;
+			
+			result.m_Name = [_elements](const size_t& _index) {
+				return "Building: " + std::to_string(_elements.at(_index)->id);
+			};
+			
+			result.m_Initialiser = [
+				side  = Resources::Get<Graphics::Material>("side"_asset),
+				roof  = Resources::Get<Graphics::Material>("roof"_asset),
+				floor = Resources::Get<Graphics::Material>("floor"_asset)
+			](
+				[[maybe_unused]] const size_t& _index,
+				[[maybe_unused]] ECS::GameObject& _gameObject,
+				Transform& _transform,
+				Graphics::Renderer& _side,
+				Graphics::Renderer& _roof,
+				Graphics::Renderer& _floor
+			) {
+				
+				_side.SetTransform(_transform);
+				_side.SetMaterial(side);
+				
+				_roof.SetTransform(_transform);
+				_roof.SetMaterial(roof);
+				
+				_floor.SetTransform(_transform);
+				_floor.SetMaterial(floor);
+			};
+			
+			return result;
+		}
+		
+	    /**
+	     * @brief Generates the meshes of a building, spawned using BuildingPrototype().
+	     *
+	     * @param[in] _element The building.
+	     * @param[in] _gameObject The GameObject of the building.
+	     * @return True if successful, or false if the building has too few valid vertices.
+	     */
+	    static bool TryBuildBuilding(const Serialisation::OSMDeserialiser::OSMJSON::Root::Element& _element, ECS::GameObject& _gameObject) {
 	        
-	        std::optional<std::shared_ptr<ECS::GameObject>> result = std::nullopt;
+	        bool result = false;
 	
 			try {
 				
@@ -326,22 +397,9 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 					
 					if (coords.size() >= 3U) {
 						
-						/* Instantiate GameObject */
-						auto go = _parent.lock()->GetScene()->Create("Building: " + std::to_string(_element.id));
-			            auto transform = go->AddComponent<Transform>();
-						
-						const auto renderer1 = go->AddComponent<Graphics::Renderer>();
-						const auto renderer2 = go->AddComponent<Graphics::Renderer>();
-						const auto renderer3 = go->AddComponent<Graphics::Renderer>();
-						
-						renderer1->SetTransform(transform);
-						renderer1->SetMaterial(Resources::Get<Graphics::Material>("side"));
-						
-						renderer2->SetTransform(transform);
-						renderer2->SetMaterial(Resources::Get<Graphics::Material>("roof"));
-						
-						renderer3->SetTransform(transform);
-						renderer3->SetMaterial(Resources::Get<Graphics::Material>("floor"));
+						const auto renderer1 = _gameObject.GetComponent<Graphics::Renderer>(0U);
+						const auto renderer2 = _gameObject.GetComponent<Graphics::Renderer>(1U);
+						const auto renderer3 = _gameObject.GetComponent<Graphics::Renderer>(2U);
 						
 			            const auto height = GetBuildingHeight<vertex_t>(_element);
 						
@@ -414,7 +472,7 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 							}
 			            }
 						
-						result = go;
+						result = true;
 					}
 					else {
 						throw std::runtime_error("Building has insufficient unique consecutive vertices to form any polygons.");
@@ -427,7 +485,7 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 	        catch(const std::exception& e) {
 				Debug::Log(e);
 				
-				result = std::nullopt;
+				result = false;
 			}
 	        
 	        return result;
@@ -435,22 +493,7 @@ namespace LouiEriksson::Engine::Spatial::Meshing {
 	    
 		template<typename T>
 	    static glm::vec<3, T> ToWorldSpace(const glm::vec<3, T>& _coord, const glm::vec<3, T>& _origin) {
-         
-	        const auto delta = _coord - _origin;
-			
-	        const auto pos = Maths::Coords::GPS::GPSToCartesian({
-	            delta.x * Maths::Coords::WGS84::EquatorialStretchFactor(_coord.x),
-	            static_cast<T>(90.0) + delta.y,
-	            delta.z
-			});
-	  
-			const auto offset = glm::vec<3, T>(
-				0,
-				Maths::Coords::WGS84::EarthRadius(_coord.x) + Maths::Coords::WGS84::AltitudeCompensation(_coord.x),
-				0
-			);
-			
-	        return pos - offset;
+	        return Maths::Coords::GPS::GPSToWorld(_coord, _origin);
 	    }
 		
 	private:
@@ -1,6 +1,8 @@
 #ifndef FINALYEARPROJECT_OPENSKY_HPP
 #define FINALYEARPROJECT_OPENSKY_HPP
 
+#include "../../core/Profiler.hpp"
+#include "../../core/utils/JobSystem.hpp"
 #include "../../core/utils/ThreadUtils.hpp"
 #include "../../networking/Requests.hpp"
 
@@ -18,11 +20,13 @@ namespace LouiEriksson::Engine::Spatial {
 	public:
 		
 		template <typename T, glm::qualifier Q = glm::defaultp>
-		static std::future<void> QueryBoundingBoxAsync(const glm::vec<4, T, Q>& _bounds, const std::chrono::system_clock::duration& _timeout, const std::function<void(const Serialisation::OpenSkyDeserialiser::OpenSkyJSON::Root&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
+		static Threading::JobSystem::Task<void> QueryBoundingBoxAsync(const glm::vec<4, T, Q>& _bounds, const std::chrono::system_clock::duration& _timeout, const std::function<void(const Serialisation::OpenSkyDeserialiser::OpenSkyJSON::Root&)>& _callback, Threading::Utils::CancellationToken& _cancellationToken) {
 			
 			static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
 			
-			return std::async([_bounds, _callback, _timeout, &_cancellationToken]() {
+			return Threading::JobSystem::Async([_bounds, _callback, _timeout, &_cancellationToken]() {
+				
+				PROFILE_ZONE("OpenSky::QueryBoundingBox");
 				
 				try {
 					
@@ -40,7 +44,7 @@ namespace LouiEriksson::Engine::Spatial {
 					
 					auto task = message.SendAsync();
 					
-					const auto status = Threading::Utils::Wait(task, _timeout, _cancellationToken);
+					const auto status = Threading::JobSystem::Wait(task, _timeout, _cancellationToken);
 					
 					if (status == std::future_status::ready) {
 					
@@ -60,7 +64,7 @@ namespace LouiEriksson::Engine::Spatial {
 				catch (const std::exception& e) {
 					Debug::Log(e);
 				}
-			});
+			}, Threading::JobSystem::Streaming, &_cancellationToken);
 		}
 		
 	};
@@ -1,8 +1,10 @@
 #ifndef FINALYEARPROJECT_OSM_HPP
 #define FINALYEARPROJECT_OSM_HPP
 
-#include "../../core/utils/Utils.hpp"
+#include "../../core/Profiler.hpp"
+#include "../../core/utils/JobSystem.hpp"
 #include "../../core/utils/ThreadUtils.hpp"
+#include "../../core/utils/Utils.hpp"
 #include "../../networking/Requests.hpp"
 #include "../maths/Conversions.hpp"
 
@@ -93,10 +95,10 @@ namespace LouiEriksson::Engine::Spatial {
 		* @param[in] _bounds  The bounding box defining the area of interest.
 		* @param[in] _timeout  The maximum time to wait for the response in seconds.
 		* @param     _callback The callback function that will be called with the response object.
-		* @return A std::future<void> representing the status of the asynchronous operation.
+		* @return A Threading::JobSystem::Task<void> representing the status of the asynchronous operation.
 		*/
 		template<typename T = float, glm::precision Q = glm::defaultp>
-		static std::future<void> QueryOverpassBoundingBoxAsync(const glm::vec<4, T, Q>& _bounds, const std::chrono::system_clock::duration& _timeout, std::function<void(const Networking::Requests::Response&)> _callback, Threading::Utils::CancellationToken& _cancellationToken) { {
+		static Threading::JobSystem::Task<void> QueryOverpassBoundingBoxAsync(const glm::vec<4, T, Q>& _bounds, const std::chrono::system_clock::duration& _timeout, std::function<void(const Networking::Requests::Response&)> _callback, Threading::Utils::CancellationToken& _cancellationToken) { {
 		
 				std::ostringstream message;
 				message <<
@@ -118,11 +120,13 @@ namespace LouiEriksson::Engine::Spatial {
 		* @param[in] _request  The query request string.
 		* @param[in] _timeout  The maximum time to wait for the response in seconds.
 		* @param     _callback The callback function that will be called with the response object.
-		* @return A std::future<void> representing the status of the asynchronous operation.
+		* @return A Threading::JobSystem::Task<void> representing the status of the asynchronous operation.
 		*/
-	    static std::future<void> OverpassQueryAsync(const std::string& _request, const std::chrono::system_clock::duration& _timeout, std::function<void(const Networking::Requests::Response&)> _callback, Threading::Utils::CancellationToken& _cancellationToken) {
+	    static Threading::JobSystem::Task<void> OverpassQueryAsync(const std::string& _request, const std::chrono::system_clock::duration& _timeout, std::function<void(const Networking::Requests::Response&)> _callback, Threading::Utils::CancellationToken& _cancellationToken) {
 			
-			return std::async([_request, _timeout, _callback, &_cancellationToken]() {
+			return Threading::JobSystem::Async([_request, _timeout, _callback, &_cancellationToken]() {
+				
+				PROFILE_ZONE("OSM::OverpassQuery");
 				
 		         try {
 					 
@@ -134,7 +138,7 @@ namespace LouiEriksson::Engine::Spatial {
 		
 			        auto task = message.SendAsync();
 			        
-					const auto status = Threading::Utils::Wait(task, _timeout, _cancellationToken);
+					const auto status = Threading::JobSystem::Wait(task, _timeout, _cancellationToken);
 					
 					Networking::Requests::Response response;
 					if (status == std::future_status::ready) {
@@ -159,7 +163,7 @@ namespace LouiEriksson::Engine::Spatial {
 		                _callback({});
 					}
 		        }
-			});
+			}, Threading::JobSystem::Streaming, &_cancellationToken);
 	    }
 	};
 	
@@ -202,6 +202,9 @@ namespace LouiEriksson::Engine::Spatial {
 			[[maybe_unused]] const std::optional<const std::string> spect_src;
 			
 			[[maybe_unused]] static constexpr size_t s_ElementCount { 34U };
+			
+			/** @brief Indices of the x0, y0, z0 and mag columns, for reading only the position and apparent magnitude of each star. */
+			[[maybe_unused]] static constexpr std::array<size_t, 4U> s_PositionMagnitudeColumns { 16U, 17U, 18U, 20U };
 				
 			template <typename T>
 			explicit V3(const std::array<T, s_ElementCount>& _values) noexcept :
@@ -1,7 +1,11 @@
 #ifndef FINALYEARPROJECT_GUI_HPP
 #define FINALYEARPROJECT_GUI_HPP
 
+#include "../core/Profiler.hpp"
+#include "../core/Resources.hpp"
 #include "../core/Window.hpp"
+#include "../core/utils/ThreadUtils.hpp"
+#include "../ecs/Storage.hpp"
 
 #include <glm/common.hpp>
 
@@ -124,6 +128,32 @@ namespace LouiEriksson::Engine::UI {
 						ImGui::Begin(title.str().c_str(), nullptr);
 					}
 					
+					// Summarise the allocations of the ECS:
+					{
+						const auto statistics = ECS::Storage::GetStatistics();
+						
+						ImGui::Text(
+							"ECS: %zu live / %zu pooled allocations, %zu heap, %.1f MiB in %zu chunks",
+							statistics.m_Live,
+							statistics.m_Allocations,
+							statistics.m_Fallbacks,
+							static_cast<double>(statistics.m_Bytes) / (1024.0 * 1024.0),
+							statistics.m_Chunks
+						);
+					}
+					
+					// Summarise the most recent frame of each main-thread dispatcher:
+					for (const auto& [name, statistics] : Threading::Utils::Dispatcher::Snapshot()) {
+						
+						ImGui::Text(
+							"%s: %zu dispatched in %.2f ms, %zu pending",
+							name.c_str(),
+							statistics.m_Dispatched,
+							std::chrono::duration<double, std::milli>(statistics.m_Elapsed).count(),
+							statistics.m_Pending
+						);
+					}
+					
 					// Perform set up for rendering the plot:
 					const scalar_t plot_vMargin = 15.0;
 				
@@ -348,6 +378,156 @@ namespace LouiEriksson::Engine::UI {
 				}
 			}
 			
+			static void ProfilerWindow(const Window& _window, const bool& _draw) {
+				
+				static bool s_Paused    { false };
+				static bool s_AutoPause { false };
+				
+				static float s_SpikeThreshold { 33.3F }; // Milliseconds.
+				
+				static uint64_t s_FrameStart { 0U };
+				static uint64_t s_FrameEnd   { 0U };
+				
+				static std::vector<Profiler::Event> s_Events;
+				
+				if (_draw) {
+					
+					// Capture the zones of the most recently completed frame:
+					if (!s_Paused) {
+						
+						uint64_t start { 0U };
+						uint64_t end   { 0U };
+						
+						if (Profiler::TryGetFrame(0U, start, end)) {
+							
+							s_FrameStart = start;
+							s_FrameEnd   = end;
+							
+							s_Events = Profiler::Snapshot(s_FrameStart, s_FrameEnd);
+							
+							std::sort(s_Events.begin(), s_Events.end(), [](const Profiler::Event& _a, const Profiler::Event& _b) {
+								return _a.m_ThreadID < _b.m_ThreadID || (_a.m_ThreadID == _b.m_ThreadID && _a.m_Depth < _b.m_Depth);
+							});
+							
+							// Pause on frames exceeding the spike threshold so they can be inspected.
+							if (s_AutoPause && static_cast<double>(s_FrameEnd - s_FrameStart) / 1000000.0 > s_SpikeThreshold) {
+								s_Paused = true;
+							}
+						}
+					}
+					
+					const auto screenSize = vec2(_window.Dimensions());
+					const auto windowSize = ImVec2(600, 300);
+					
+					ImGui::SetNextWindowSize(windowSize, ImGuiCond_Once);
+					ImGui::SetNextWindowPos(ImVec2(screenSize.x - windowSize.x - s_WindowMargin.x, screenSize.y - windowSize.y - s_WindowMargin.y), ImGuiCond_Once);
+					ImGui::SetNextWindowCollapsed(true, ImGuiCond_Once);
+					
+					ImGui::Begin("Profiler", nullptr);
+					
+					const auto frame_duration = std::max(s_FrameEnd - s_FrameStart, static_cast<uint64_t>(1U));
+					
+					ImGui::Text("Frame: %.3f ms", static_cast<double>(frame_duration) / 1000000.0);
+					ImGui::SameLine();
+					ImGui::Checkbox("Paused", &s_Paused);
+					ImGui::SameLine();
+					ImGui::Checkbox("Pause on Spike", &s_AutoPause);
+					ImGui::SameLine();
+					ImGui::SetNextItemWidth(80.0F);
+					ImGui::DragFloat("ms", &s_SpikeThreshold, 0.1F, 1.0F, 1000.0F, "%.1f");
+					ImGui::SameLine();
+					
+					if (ImGui::Button("Export")) {
+						(void)Profiler::ExportChromeTrace("profile.json");
+					}
+					
+					// Draw the flame graph:
+					ImGui::BeginChild("Flame Graph", ImVec2(0.0F, 0.0F), false, ImGuiWindowFlags_HorizontalScrollbar);
+					{
+						static constexpr float s_RowHeight = 18.0F;
+						static constexpr float s_LaneGap   =  6.0F;
+						
+						auto* draw_list = ImGui::GetWindowDrawList();
+						
+						const auto origin = ImGui::GetCursorScreenPos();
+						const auto width  = std::max(ImGui::GetContentRegionAvail().x, 1.0F);
+						const auto mouse  = ImGui::GetMousePos();
+						
+						float lane_top = origin.y;
+						
+						for (size_t i = 0U; i < s_Events.size();) {
+							
+							const auto thread = s_Events[i].m_ThreadID;
+							
+							// Label each thread's lane.
+							{
+								const auto label = "Thread " + std::to_string(thread);
+								
+								draw_list->AddText(ImVec2(origin.x, lane_top), ImGui::GetColorU32(ImGuiCol_Text), label.c_str());
+								
+								lane_top += s_RowHeight;
+							}
+							
+							uint32_t max_depth = 0U;
+							
+							for (; i < s_Events.size() && s_Events[i].m_ThreadID == thread; ++i) {
+								
+								const auto& event = s_Events[i];
+								
+								max_depth = std::max(event.m_Depth, max_depth);
+								
+								const auto start = std::max(event.m_Start, s_FrameStart) - s_FrameStart;
+								const auto end   = std::min(event.m_End,   s_FrameEnd)   - s_FrameStart;
+								
+								const ImVec2 min(
+									origin.x + (width * static_cast<float>(static_cast<double>(start) / static_cast<double>(frame_duration))),
+									lane_top + (static_cast<float>(event.m_Depth) * s_RowHeight)
+								);
+								
+								const ImVec2 max(
+									std::max(origin.x + (width * static_cast<float>(static_cast<double>(end) / static_cast<double>(frame_duration))), min.x + 1.0F),
+									min.y + s_RowHeight - 1.0F
+								);
+								
+								// Derive a stable colour from the zone's name.
+								const auto hash = std::hash<const void*>()(event.m_Name);
+								
+								const auto colour = IM_COL32(
+									96U  + ( hash         % 128U),
+									96U  + ((hash >>  8U) % 128U),
+									96U  + ((hash >> 16U) % 128U),
+									255U
+								);
+								
+								draw_list->AddRectFilled(min, max, colour);
+								
+								if (max.x - min.x > 8.0F) {
+									
+									draw_list->PushClipRect(min, max, true);
+									draw_list->AddText(ImVec2(min.x + 2.0F, min.y + 2.0F), IM_COL32(0U, 0U, 0U, 255U), event.m_Name);
+									draw_list->PopClipRect();
+								}
+								
+								if (ImGui::IsWindowHovered() &&
+								    mouse.x >= min.x && mouse.x < max.x &&
+								    mouse.y >= min.y && mouse.y < max.y
+								) {
+									ImGui::SetTooltip("%s\n%.3f ms", event.m_Name, static_cast<double>(event.m_End - event.m_Start) / 1000000.0);
+								}
+							}
+							
+							lane_top += (static_cast<float>(max_depth + 1U) * s_RowHeight) + s_LaneGap;
+						}
+						
+						// Reserve the space used by the flame graph so the child window scrolls.
+						ImGui::Dummy(ImVec2(width, lane_top - origin.y));
+					}
+					ImGui::EndChild();
+					
+					ImGui::End();
+				}
+			}
+			
 			static void PostProcessingWindow(const Window& _window, const bool& _draw) {
 				
 				if (_draw) {
@@ -710,6 +890,83 @@ namespace LouiEriksson::Engine::UI {
 					ImGui::End();
 				}
 			}
+			
+			/** @brief Draws a row of the residency table for the assets of a single type. */
+			template<typename T>
+			static void ResidencyRow(const char* _name) {
+				
+				const auto residency = Resources::GetResidency<T>();
+				
+				ImGui::TableNextRow();
+				
+				ImGui::TableNextColumn();
+				ImGui::Text("%s", _name);
+				
+				ImGui::TableNextColumn();
+				ImGui::Text("%zu (%zu)", residency.m_Loaded, residency.m_Referenced);
+				
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", static_cast<double>(residency.m_Resident) / 1048576.0);
+				
+				ImGui::TableNextColumn();
+				
+				// Types which are never evicted have no budget to adjust.
+				if (residency.m_Budget == std::numeric_limits<size_t>::max()) {
+					ImGui::Text("-");
+				}
+				else {
+					
+					auto budget = static_cast<int>(residency.m_Budget / 1048576U);
+					
+					ImGui::SetNextItemWidth(80.0F);
+					
+					if (ImGui::DragInt((std::string("##") + _name).c_str(), &budget, 1.0F, 0, 65536)) {
+						Resources::ResidencyBudget<T>(static_cast<size_t>(std::max(budget, 0)) * 1048576U);
+					}
+				}
+				
+				ImGui::TableNextColumn();
+				ImGui::Text("%zu (%.1f)", residency.m_Evictions, static_cast<double>(residency.m_EvictedBytes) / 1048576.0);
+			}
+			
+			static void ResourcesWindow(const Window& _window, const bool& _draw) {
+				
+				if (_draw) {
+					
+					const auto screenSize = vec2(_window.Dimensions());
+					const auto windowSize = ImVec2(460, 200);
+					
+					ImGui::SetNextWindowSize(windowSize, ImGuiCond_Once);
+					ImGui::SetNextWindowPos(ImVec2(s_WindowMargin.x, screenSize.y - windowSize.y - s_WindowMargin.y), ImGuiCond_Once);
+					ImGui::SetNextWindowCollapsed(true, ImGuiCond_Once);
+					
+					/* RESOURCES */
+					ImGui::Begin("Resources", nullptr);
+					
+					ImGui::Text("Pending: %zu", Resources::Pending());
+					
+					if (ImGui::BeginTable("Residency", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+						
+						ImGui::TableSetupColumn("Type");
+						ImGui::TableSetupColumn("Loaded (Referenced)");
+						ImGui::TableSetupColumn("Resident (MiB)");
+						ImGui::TableSetupColumn("Budget (MiB)");
+						ImGui::TableSetupColumn("Evicted (MiB)");
+						ImGui::TableHeadersRow();
+						
+						ResidencyRow<Graphics::Texture  >("Texture");
+						ResidencyRow<Graphics::Cubemap  >("Cubemap");
+						ResidencyRow<Graphics::Mesh     >("Mesh");
+						ResidencyRow<Graphics::Material >("Material");
+						ResidencyRow<Graphics::Shader   >("Shader");
+						ResidencyRow<   Audio::AudioClip>("AudioClip");
+						
+						ImGui::EndTable();
+					}
+					
+					ImGui::End();
+				}
+			}
 		};
 		
 		inline static bool s_DrawDebugWindows { false };
@@ -798,6 +1055,8 @@ namespace LouiEriksson::Engine::UI {
 				GUIWindows:: PostProcessingWindow(*_window, s_DrawDebugWindows);
 				GUIWindows:: RenderSettingsWindow(*_window, s_DrawDebugWindows);
 				GUIWindows::SpatialSettingsWindow(*_window, s_DrawDebugWindows);
+				GUIWindows::       ProfilerWindow(*_window, s_DrawDebugWindows);
+				GUIWindows::      ResourcesWindow(*_window, s_DrawDebugWindows);
 			}
 			
 			/* FINALIZE GUI FRAME */
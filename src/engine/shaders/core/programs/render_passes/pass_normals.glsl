@@ -67,7 +67,10 @@
 
         mediump vec2 uv = Sample2(u_TexCoord_gBuffer, (gl_FragCoord.xy / u_ScreenDimensions));
 
-        mediump vec3 normal = normalize((Sample3(u_Normals, uv) * 2.0) - 1.0);
+        // Reconstruct z from x and y, as block-compressed normal maps (BC5) only store the latter.
+        mediump vec2 xy = (Sample2(u_Normals, uv) * 2.0) - 1.0;
+
+        mediump vec3 normal = normalize(vec3(xy, sqrt(max(0.0, 1.0 - dot(xy, xy)))));
         normal = mix(v_TBN[2], normalize(v_TBN * normal), u_NormalAmount);
 
         gl_FragColor = vec4(normal, 1.0);
@@ -17,6 +17,7 @@
 #include "../../engine/scripts/core/Debug.hpp"
 #include "../../engine/scripts/core/File.hpp"
 #include "../../engine/scripts/core/IViewport.hpp"
+#include "../../engine/scripts/core/Profiler.hpp"
 #include "../../engine/scripts/core/Resources.hpp"
 #include "../../engine/scripts/core/Script.hpp"
 #include "../../engine/scripts/core/Serialisation.hpp"
@@ -24,7 +25,9 @@
 #include "../../engine/scripts/core/Time.hpp"
 #include "../../engine/scripts/core/Transform.hpp"
 #include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/core/utils/CSV.hpp"
 #include "../../engine/scripts/core/utils/Hashmap.hpp"
+#include "../../engine/scripts/core/utils/JobSystem.hpp"
 #include "../../engine/scripts/core/utils/ThreadUtils.hpp"
 #include "../../engine/scripts/core/utils/Utils.hpp"
 #include "../../engine/scripts/core/Window.hpp"
@@ -55,8 +55,8 @@ namespace LouiEriksson::Game::Scripts {
 					
 					// Add Renderer.
 					const auto renderer = p->AddComponent<Graphics::Renderer>();
-					renderer->SetMesh(Resources::Get<Graphics::Mesh>("sphere"));
-					renderer->SetMaterial(Resources::Get<Graphics::Material>("sphere"));
+					renderer->SetMesh(Resources::Get<Graphics::Mesh>("sphere"_asset));
+					renderer->SetMaterial(Resources::Get<Graphics::Material>("sphere"_asset));
 					renderer->SetTransform(t);
 				
 					// Add Collider.
@@ -76,7 +76,7 @@ namespace LouiEriksson::Game::Scripts {
 					
 					// Add AudioSource and Clip.
 					const auto as = p->AddComponent<Audio::AudioSource>();
-					as->Clip(Resources::Get<Audio::AudioClip>("Hollow_Bass"));
+					as->Clip(Resources::Get<Audio::AudioClip>("Hollow_Bass"_asset));
 	
 					m_AudioSource = as;
 				}
@@ -102,6 +102,16 @@ namespace LouiEriksson::Game::Scripts {
 			}}
 		}
 	
+		/** @inheritdoc */
+		[[nodiscard]] ECS::Access Dependencies() const override {
+			
+			// Handles input, so must run on the main thread.
+			return ECS::Access()
+				.MainThread()
+				.Read<Settings::Graphics::Perspective>()
+				.Write<Transform, Graphics::Camera, Audio::AudioSource, Time>();
+		}
+		
 		/** @inheritdoc */
 		void Tick() override {
 			
@@ -17,10 +17,10 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 		
 	private:
 	
-		std::weak_ptr<Stars>       m_Stars;
-		std::weak_ptr<Planetarium> m_Planets;
-		std::weak_ptr<Map>         m_Map;
-		std::weak_ptr<FlyCam>      m_Camera;
+		ECS::Handle<Stars>       m_Stars;
+		ECS::Handle<Planetarium> m_Planets;
+		ECS::Handle<Map>         m_Map;
+		ECS::Handle<FlyCam>      m_Camera;
 		
 	public:
 	
@@ -76,25 +76,25 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			
 			using Distance = Maths::Conversions::Distance;
 			
-			if (const auto camera = m_Camera.lock()) {                                            // null safety-check
-			if (const auto camera_gameobject = camera->Parent()) {                                // null safety-check
-			if (const auto camera_transform = camera_gameobject->GetComponent<Transform>()) {     // null safety-check
+			if (auto* const camera = m_Camera.Get()) {                                                    // null safety-check
+			if (auto* const camera_gameobject = camera->Owner()) {                                        // null safety-check
+			if (auto* const camera_transform = camera_gameobject->FindComponent<Transform>()) {           // null safety-check
 				
-				if (auto planets = m_Planets.lock()) {                                            // null safety-check
-				if (auto planets_gameobject = planets->Parent()) {                                // null safety-check
-				if (auto planets_transform = planets_gameobject->GetComponent<Transform>()) {     // null safety-check
+				if (auto* const planets = m_Planets.Get()) {                                              // null safety-check
+				if (auto* const planets_gameobject = planets->Owner()) {                                  // null safety-check
+				if (auto* const planets_transform = planets_gameobject->FindComponent<Transform>()) {     // null safety-check
 					
-					if (auto stars = m_Stars.lock()) {                                            // null safety-check
-					if (auto stars_gameobject = stars->Parent()) {                                // null safety-check
-					if (auto stars_transform = stars_gameobject->GetComponent<Transform>()) {     // null safety-check
+					if (auto* const stars = m_Stars.Get()) {                                              // null safety-check
+					if (auto* const stars_gameobject = stars->Owner()) {                                  // null safety-check
+					if (auto* const stars_transform = stars_gameobject->FindComponent<Transform>()) {     // null safety-check
 						
-						if (auto earth = planets->m_Planets.Get("Earth")) {                       // null safety-check
-						if (auto earth_gameobject = earth.value().lock()) {                       // null safety-check
-						if (auto earth_transform = earth_gameobject->GetComponent<Transform>()) { // null safety-check
+						if (auto earth = planets->m_Planets.Get("Earth")) {                               // null safety-check
+						if (auto* const earth_gameobject = earth.value().Get()) {                         // null safety-check
+						if (auto* const earth_transform = earth_gameobject->FindComponent<Transform>()) { // null safety-check
 							
-							if (auto sol = planets->m_Planets.Get("Sol")) {                       // null safety-check
-							if (auto sol_gameobject = sol.value().lock()) {                       // null safety-check
-							if (auto sol_transform = sol_gameobject->GetComponent<Transform>()) { // null safety-check
+							if (auto sol = planets->m_Planets.Get("Sol")) {                               // null safety-check
+							if (auto* const sol_gameobject = sol.value().Get()) {                         // null safety-check
+							if (auto* const sol_transform = sol_gameobject->FindComponent<Transform>()) { // null safety-check
 								
 								if (Input::Input::Key::GetDown(SDL_SCANCODE_R)) {
 									Application::ReloadScene();
@@ -20,14 +20,14 @@ namespace LouiEriksson::Game::Scripts::Spatial {
   
 		std::weak_ptr<Transform> m_Transform;
 		
-		Hashmap<std::string_view, std::weak_ptr<ECS::GameObject>> m_Features;
+		Hashmap<std::string_view, ECS::Entity> m_Features;
 		
 		Hashmap<std::string, std::pair<std::weak_ptr<ECS::GameObject>, std::pair<vec3, vec3>>> m_Aircraft;
 		
-		std::future<void> m_BuildTask;
-		std::future<void> m_OpenSkyTask;
+		Threading::JobSystem::Task<void> m_BuildTask;
+		Threading::JobSystem::Task<void> m_OpenSkyTask;
 		
-		Threading::Utils::Dispatcher        m_Dispatcher;
+		Threading::Utils::Dispatcher        m_Dispatcher { "Map" };
 		Threading::Utils::CancellationToken m_CancellationToken;
 		
 		std::chrono::system_clock::time_point m_NextOpenSkyRequest;
@@ -39,7 +39,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 	    float m_GridSizeKm;
 	    float m_RequestDelay;
 	    int m_Subdivisions;
-	    int m_TimeSliceInterval;
+	    std::chrono::microseconds m_TimeSliceBudget; /**< @brief Main-thread time per frame available for building map features. */
 	    
 	    float m_Scale;
 	    
@@ -54,13 +54,17 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			m_GridSizeKm          (  3.0     ),
 		    m_RequestDelay        (  5.0     ),
 		    m_Subdivisions        (  0       ),
-		    m_TimeSliceInterval   (100       ),
+		    m_TimeSliceBudget     (2000      ),
 		    m_Scale               (  0.006278),
 			m_ElevationProvider   (Elevation::ElevationProvider::OpenElevation),
 			m_ElevationResolution (  0.5    ) {}
 			
 		~Map() override {
 			m_CancellationToken.Cancel();
+			
+			// Both tasks reference this script, so must finish before it is destroyed.
+			m_BuildTask.wait();
+			m_OpenSkyTask.wait();
 		}
 		
 		/** @inheritdoc */
@@ -75,9 +79,11 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 				m_Transform = p->AddComponent<Transform>();
 			}
 			
-			m_BuildTask = std::async([this]() {
+			m_BuildTask = Threading::JobSystem::Async([this]() {
+				PROFILE_ZONE("Map::Build");
+				
 				BuildManyAsync(Settings::Spatial::s_Coord, m_GridSizeKm, m_ElevationProvider);
-			});
+			}, Threading::JobSystem::Streaming, &m_CancellationToken);
 	    }
 		
 		/** @inheritdoc */
@@ -85,25 +91,27 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			
 			BuildDynamicAsync(Settings::Spatial::s_Coord, m_GridSizeKm);
 			
-			m_Dispatcher.Dispatch(m_TimeSliceInterval);
+			{
+				PROFILE_ZONE("Map::Dispatch");
+				
+				m_Dispatcher.Dispatch(m_TimeSliceBudget);
+			}
 			
 			// Scale all map features:
-			for (const auto& kvp : m_Features.GetAll()) {
+			for (const auto& kvp : m_Features.View()) {
 			
-				if (auto go = kvp.second.lock()) {
+				if (auto* const go = kvp.second.Get()) {
 					
-					auto transform = go->GetComponent<Transform>();
-					
-					if (const auto& t = transform) {
+					if (auto* const t = go->FindComponent<Transform>()) {
 						t->Scale({m_Scale, m_Scale, m_Scale});
 					}
 				}
 			}
 			
 			// Move and scale all aircraft in realtime:
-			for (const auto& kvp : m_Aircraft.GetAll()) {
+			for (const auto& kvp : m_Aircraft.View()) {
 			
-				auto entry = kvp.second;
+				const auto& entry = kvp.second;
 				
 				if (auto go = entry.first.lock()) {
 					
@@ -259,8 +267,8 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 												auto transform = gameobject->AddComponent<Transform>();
 												
 												auto renderer = gameobject->AddComponent<Graphics::Renderer>();
-												renderer->SetMesh(Resources::Get<Graphics::Mesh>("aircraft"));
-												renderer->SetMaterial(Resources::Get<Graphics::Material>("aircraft"));
+												renderer->SetMesh(Resources::GetAsync<Graphics::Mesh>("aircraft"));
+												renderer->SetMaterial(Resources::GetAsync<Graphics::Material>("aircraft"));
 												renderer->SetTransform(transform);
 											}
 											else {
@@ -339,7 +347,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 									m_Aircraft.Remove(item);
 								}
 							}
-						});
+						}, Threading::Utils::Dispatcher::High);
 					},
 					m_CancellationToken
 				);
@@ -418,7 +426,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 					if (auto go = Meshing::Builder::TryCreateTerrain( { r, r }, { m_GridSizeKm * 1000.0 * stretchFactor, m_GridSizeKm * 1000.0 * stretchFactor }, heightmap, Parent())) {
 						m_Features.Assign(std::move(go.value()->Name()), std::move(*go));
 					}
-				});
+				}, Threading::Utils::Dispatcher::High);
 			}
 			
 	        osm_query.wait();
@@ -440,6 +448,10 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			// Hashset indicating if an element has already been processed or not.
 			std::unordered_set<ulong> processedElements;
 			processedElements.reserve(elements.size());
+			
+			// Buildings and areas are spawned in batches, and their meshes are then generated one at a time.
+			std::vector<std::shared_ptr<OSMDeserialiser::OSMJSON::Root::Element>> buildings;
+			std::vector<std::shared_ptr<OSMDeserialiser::OSMJSON::Root::Element>> areas;
 		 
 			// Build elements:
 	        for (const auto& element : elements) {
@@ -474,14 +486,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 		                    }
 		                }
 		
-		                for (const auto& part : parts) {
-							
-							m_Dispatcher.Schedule([this, part]() {
-								if (auto go = Meshing::Builder::TryCreateBuilding(*part, Parent())) {
-				                    m_Features.Assign(go.value()->Name(), *go);
-								};
-							});
-		                }
+		                buildings.insert(buildings.end(), parts.begin(), parts.end());
 		            }
 		        }
 	        }
@@ -514,29 +519,66 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 	                            (element->tags.ContainsKey("building") || element->tags.ContainsKey("building:part"));
 							
 	                        if (isBuilding) {
-								
-								// Create building:
-								m_Dispatcher.Schedule([this, element]() {
-									if (auto go = Meshing::Builder::TryCreateBuilding(*element, Parent())) {
-										m_Features.Assign(go.value()->Name(), *go);
-									};
-								});
+								buildings.emplace_back(element);
 	                        }
 	                        else {
-								
-								// Create area:
-								m_Dispatcher.Schedule([this, element]() {
-		                            if (auto go = Meshing::Builder::TryCreateArea(*element, Parent())) {
-			                            m_Features.Assign(go.value()->Name(), *go);
-									}
-								});
+								areas.emplace_back(element);
 	                        }
 	                    }
 	                }
 	            }
 	        }
+			
+			// Create buildings and areas:
+			m_Dispatcher.Schedule([this, buildings = std::move(buildings), areas = std::move(areas)]() {
+				
+				if (const auto p = Parent()) {
+					
+					if (const auto s = p->GetScene()) {
+						
+						Spawn(*s, areas,     s->SpawnBatch(areas.size(),     Meshing::Builder::AreaPrototype(areas)),         Meshing::Builder::TryBuildArea,     Threading::Utils::Dispatcher::Normal);
+						Spawn(*s, buildings, s->SpawnBatch(buildings.size(), Meshing::Builder::BuildingPrototype(buildings)), Meshing::Builder::TryBuildBuilding, Threading::Utils::Dispatcher::Low   );
+					}
+				}
+			}, Threading::Utils::Dispatcher::High);
 	    }
 		
+		/**
+		 * @brief Schedules the generation of the meshes of a batch of spawned features.
+		 *
+		 * @details Features which fail to build are removed from the Scene. The rest are added to m_Features.
+		 *
+		 * @param[in] _scene The Scene the features were spawned in.
+		 * @param[in] _elements The elements of the features.
+		 * @param[in] _entities The GameObjects of the features, in the same order as _elements.
+		 * @param[in] _build Function which generates the meshes of a feature.
+		 * @param[in] _priority Priority of the generation of each feature.
+		 */
+		void Spawn(
+			ECS::Scene& _scene,
+			const std::vector<std::shared_ptr<Engine::Spatial::Serialisation::OSMDeserialiser::OSMJSON::Root::Element>>& _elements,
+			const std::vector<ECS::Entity>& _entities,
+			bool (*_build)(const Engine::Spatial::Serialisation::OSMDeserialiser::OSMJSON::Root::Element&, ECS::GameObject&),
+			const Threading::Utils::Dispatcher::Priority& _priority
+		) {
+			
+			for (size_t i = 0U; i < _entities.size(); ++i) {
+				
+				m_Dispatcher.Schedule([this, scene = _scene.weak_from_this(), element = _elements[i], entity = _entities[i], _build]() {
+					
+					if (auto* const go = entity.Get()) {
+						
+						if (_build(*element, *go)) {
+							m_Features.Assign(go->Name(), entity);
+						}
+						else if (const auto s = scene.lock()) {
+							s->Remove(std::string(go->Name()));
+						}
+					}
+				}, _priority);
+			}
+		}
+		
 		void BuildManyAsync(const vec3& _coord, const float& _sizeKm, const Elevation::ElevationProvider& _provider) {
 
 			const auto     bounds = Maths::Coords::GPS::GPSToBounds(_coord, _sizeKm);
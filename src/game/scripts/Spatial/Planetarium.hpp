@@ -30,7 +30,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 		bool m_PlanetShadows = true;
 		
 		/** @brief Hashmap containing references to planet GameObjects. */
-		Hashmap<std::string, std::weak_ptr<ECS::GameObject>> m_Planets;
+		Hashmap<std::string, ECS::Entity> m_Planets;
 		
 		explicit Planetarium(const std::weak_ptr<ECS::GameObject>& _parent) : Script(_parent) {};
 		
@@ -136,12 +136,12 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 						         sol = m_Planets.Get("Sol");
 				               earth && sol
 		        ) {
-				    if (auto earth_gameobject = earth.value().lock(),
-							   sol_gameobject =   sol.value().lock();
+				    if (auto* const earth_gameobject = earth.value().Get(),
+							   sol_gameobject =   sol.value().Get();
 					         earth_gameobject && sol_gameobject
 					) {
-				        if (const auto earth_transform = earth_gameobject->GetComponent<Transform>(),
-				                         sol_transform =   sol_gameobject->GetComponent<Transform>();
+				        if (const auto earth_transform = earth_gameobject->FindComponent<Transform>(),
+				                         sol_transform =   sol_gameobject->FindComponent<Transform>();
 									   earth_transform && sol_transform
 						) {
 				            auto earth_to_sol = glm::normalize(sol_transform->Position() - earth_transform->Position());
@@ -152,7 +152,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 						}
 				    }
 					else {
-						throw std::runtime_error("Failed to lock Earth and Sol GameObjects");
+						throw std::runtime_error("Failed to resolve Earth and Sol GameObjects");
 					}
 				}
 				else {
@@ -402,14 +402,23 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			// Prevent the model of the sun from casting shadows:
 			if (const auto sol = m_Planets.Get("Sol")) {
 				
-				if (const auto go = sol->lock()                           ) {
-				if (const auto t  = go->GetComponent<Transform>()         ) {
-				if (const auto r  = go->GetComponent<Graphics::Renderer>()) {
+				if (const auto go = sol->Get()                             ) {
+				if (const auto t  = go->FindComponent<Transform>()         ) {
+				if (const auto r  = go->FindComponent<Graphics::Renderer>()) {
 					r->Shadows(false);
 				}}}
 			}
 		}
 		
+		/**
+		 * @inheritdoc
+		 * @details Tick() only evaluates the VSOP87 model, which is costly, so runs alongside other Scripts.
+		 *          The planets are moved once it has finished, at the next sync point.
+		 */
+		[[nodiscard]] ECS::Access Dependencies() const override {
+			return {};
+		}
+		
 		/** @inheritdoc */
 		void Tick() override {
 			
@@ -426,16 +435,35 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 				  m_Positions_To.Time(curr);
 			}
 			
-			InterpolatePlanets(m_Positions_From, m_Positions_To, Utils::Remap(curr, m_Positions_From.Time(), m_Positions_To.Time(), static_cast<highp_time>(0.0), static_cast<highp_time>(1.0)));
+			// Transforms may only be written on the main thread, so defer the update of the planets.
+			if (const auto p = Parent()) {
+			if (const auto s = p->GetScene()) {
+				
+				s->Commands().Run([planetarium = ECS::Handle<Planetarium>(*this), curr]([[maybe_unused]] ECS::Scene& _scene) {
+					
+					if (auto* const self = planetarium.Get()) {
+						self->Apply(curr);
+					}
+				});
+			}}
+		}
+		
+		/**
+		 * @brief Moves the planets to their positions at the given time, and positions the light of the sun.
+		 * @param[in] _time The time, in Julian centuries since the J2000 epoch.
+		 */
+		void Apply(const highp_time& _time) {
+			
+			InterpolatePlanets(m_Positions_From, m_Positions_To, Utils::Remap(_time, m_Positions_From.Time(), m_Positions_To.Time(), static_cast<highp_time>(0.0), static_cast<highp_time>(1.0)));
 			
 			// Add a light to the sun.
 			if (m_SunLight) {
 				
 				if (const auto sol = m_Planets.Get("Sol")) {
 					
-					if (const auto go = sol->lock()                           ) {
-					if (const auto t  = go->GetComponent<Transform>()         ) {
-					if (const auto r  = go->GetComponent<Graphics::Renderer>()) {
+					if (const auto go = sol->Get()                             ) {
+					if (const auto t  = go->FindComponent<Transform>()         ) {
+					if (const auto r  = go->FindComponent<Graphics::Renderer>()) {
 						
 						using Material = Settings::Graphics::Material;
 						using Distance = Maths::Conversions::Distance;
@@ -501,9 +529,9 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 				
 				if (const auto item = m_Planets.Get(name)) {
 					
-					if (const auto go = item.value().lock()) {
+					if (auto* const go = item.value().Get()) {
 					
-						if (const auto t = go->template GetComponent<Transform>()) {
+						if (auto* const t = go->template FindComponent<Transform>()) {
 							
 							auto interpolated = Planets<T, Q>::Transform::InterpolateTransform(from, to, _t);
 
@@ -19,10 +19,10 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 	
 	private:
 		
-		Threading::Utils::Dispatcher        m_Dispatcher;
+		Threading::Utils::Dispatcher        m_Dispatcher { "Stars" };
 		Threading::Utils::CancellationToken m_CancellationToken;
 		
-		std::future<void> m_Task;
+		Threading::JobSystem::Task<void> m_Task;
 		
 	public:
 	
@@ -30,6 +30,9 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 		
 		~Stars() {
 			m_CancellationToken.Cancel();
+			
+			// The task references this script, so must finish before it is destroyed.
+			m_Task.wait();
 		}
 		
 		/** @inheritdoc */
@@ -52,7 +55,9 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			Settings::Graphics::Skybox::s_Exposure = 0.0;
 			
 			// Parse files and build star mesh:
-			m_Task = std::async([this]() {
+			m_Task = Threading::JobSystem::Async([this]() {
+				
+				PROFILE_ZONE("Stars::Build");
 				
 				const auto stars = LoadStars<GLfloat>({
 					"resources/ATHYG-Database-main/data/athyg_v31-1.csv",
@@ -108,7 +113,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 						}
 					});
 				}
-			});
+			}, Threading::JobSystem::Streaming, &m_CancellationToken);
 		}
 	
 		/** @inheritdoc */
@@ -127,13 +132,15 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 			std::vector<glm::vec<3, T, Q>> result;
 			
 			// List of parallel tasks.
-			std::vector<std::future<std::vector<glm::vec<3, T, Q>>>> m_Tasks;
+			std::vector<Threading::JobSystem::Task<std::vector<glm::vec<3, T, Q>>>> m_Tasks;
 			
 			// Load and parse each file in parallel:
 			for (const auto& path : _athyg_paths) {
 				
-				m_Tasks.emplace_back(std::async([&path, &_threshold_magnitude, &_cancellationToken]() {
-				
+				m_Tasks.emplace_back(Threading::JobSystem::Async([&path, &_threshold_magnitude, &_cancellationToken]() {
+					
+					PROFILE_ZONE("Stars::Parse");
+					
 					std::vector<glm::vec<3, T, Q>> parsed;
 					
 					try {
@@ -142,46 +149,41 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 					
 						if (exists(path)) {
 							
-							auto csv = File::ReadAllText(path);
+							// Parse the file in place.
+							const auto csv = File::Map(path, File::Sequential);
 							
-							std::string line;
+							CSV::Reader reader(csv.View());
 							
 							// Skip the header (first line) of the CSV.
-							std::getline(csv, line);
+							reader.SkipRow();
+							
+							// Only the position and magnitude of each star are tokenised and parsed.
+							std::array<std::string_view, ATHYG_VERSION::s_PositionMagnitudeColumns.size()> fields;
 							
 							// Process CSV elements:
-						    while (std::getline(csv, line)) {
+							while (reader.Next(ATHYG_VERSION::s_PositionMagnitudeColumns, fields)) {
 								
 								if (_cancellationToken.IsCancellationRequested()) { break; }
 								
-								auto elements = Utils::Split(line, ',', ATHYG_VERSION::s_ElementCount);
-								
-								// Discard elements beyond the count used by this ATHYG version.
-								if (elements.size() > ATHYG_VERSION::s_ElementCount) {
-									elements.resize(ATHYG_VERSION::s_ElementCount);
-								}
+								const auto mag = Utils::TryParse<double>(fields[3U]);
 								
-								// Validate number of elements matches the count expected by the ATHYG version.
-								if (elements.size() == ATHYG_VERSION::s_ElementCount) {
+								/*
+								 * Insert stars under a certain apparent magnitude into the result.
+								 * Stellar magnitude is inverse-logarithmic, meaning that lower values are brighter.
+								 * As a rule of thumb, magnitudes below 6 are visible to the naked eye.
+								 */
+								if (mag.has_value() && *mag <= _threshold_magnitude) {
 									
-									// Deserialise the star.
-									const auto star = ATHYG_VERSION((Utils::ToArray<std::string_view, ATHYG_VERSION::s_ElementCount>(std::move(elements))));
+									const auto x0 = Utils::TryParse<double>(fields[0U]);
+									const auto y0 = Utils::TryParse<double>(fields[1U]);
+									const auto z0 = Utils::TryParse<double>(fields[2U]);
 									
-									/*
-									 * Insert stars under a certain apparent magnitude into the result.
-									 * Stellar magnitude is inverse-logarithmic, meaning that lower values are brighter.
-									 * As a rule of thumb, magnitudes below 6 are visible to the naked eye.
-									 */
-									if (*star.mag <= _threshold_magnitude) {
-										
-										// Insert the star's coordinates in a format compliant with the coordinate system of the engine.
-										// See version info on these coordinates here: https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md
-										parsed.emplace_back(*star.x0, *star.y0, *star.z0);
+									// Insert the star's coordinates in a format compliant with the coordinate system of the engine.
+									// See version info on these coordinates here: https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md
+									if (x0.has_value() && y0.has_value() && z0.has_value()) {
+										parsed.emplace_back(*x0, *y0, *z0);
 									}
 								}
-								else {
-									throw std::runtime_error("Number of elements not consistent with ATHYG version!");
-								}
 							}
 						}
 						else {
@@ -194,7 +196,7 @@ namespace LouiEriksson::Game::Scripts::Spatial {
 					
 					return parsed;
 					
-				}));
+				}, Threading::JobSystem::Streaming));
 			}
 			
 			if (_cancellationToken.IsCancellationRequested()) { return result; }
@@ -0,0 +1,333 @@
+#include "../engine/scripts/core/AssetImporter.hpp"
+#include "../engine/scripts/core/AssetManifest.hpp"
+#include "../engine/scripts/core/CookedAsset.hpp"
+#include "../engine/scripts/core/File.hpp"
+#include "../engine/scripts/core/utils/JobSystem.hpp"
+#include "../engine/scripts/graphics/textures/BlockCompression.hpp"
+
+#include <GL/glew.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file AssetCooker.cpp
+ * @brief Offline cooker of source assets into their engine-native binary formats (see CookedAsset).
+ *
+ * @details Every Mesh, Material and Texture beneath the assets directory is cooked into the cooked directory, unless its cooked file
+ *          is already up to date. Meshes are stored with their tangents computed, and Textures with their full mip chain,
+ *          block-compressed (see BlockCompression). Resources loads the cooked files in preference to the source assets.
+ *
+ *          For each asset cooked, the time taken to decode the source asset as Resources would is compared with the time
+ *          taken to read its cooked file. Both are measured on the CPU, with the files in the page cache. For each Texture,
+ *          the quality of its compression (PSNR of the first level against the source) and the video memory it saves are reported.
+ *
+ * @par Usage
+ * fyp_cook [assets/] [cooked/]
+ */
+namespace {
+	
+	using namespace LouiEriksson::Engine;
+	
+	struct Result final {
+		
+		enum Status : unsigned char {
+			Cooked,
+			Current,
+			Failed
+		};
+		
+		std::filesystem::path m_Path;
+		
+		Status m_Status;
+		
+		std::string m_Error;
+		
+		double m_Source; /**< @brief Time taken to decode the source asset, in milliseconds. */
+		double m_Cooked; /**< @brief Time taken to read the cooked asset, in milliseconds.   */
+		
+		uintmax_t m_Bytes;
+		
+		/** @brief Compression of a cooked Texture. */
+		struct Compression final {
+			
+			Graphics::BlockCompression::Format m_Format;
+			
+			double m_PSNR;   /**< @brief Peak signal-to-noise ratio of the first level, in decibels. */
+			double m_Encode; /**< @brief Time taken to encode every level, in milliseconds.          */
+			
+			size_t m_Uncompressed; /**< @brief Video memory of the Texture without compression, in bytes. */
+			size_t m_Compressed;   /**< @brief Video memory of the Texture with compression, in bytes.    */
+		};
+		
+		std::optional<Compression> m_Compression;
+	};
+	
+	/**
+	 * @brief Returns the size of a texel of an uncompressed internal format in video memory.
+	 * @note Three-channel formats are assumed to be padded to four channels, as most drivers do.
+	 */
+	size_t TexelSize(const GLenum& _pixelFormat) {
+		
+		size_t result;
+		
+		switch (_pixelFormat) {
+			case GL_RGB32F:
+			case GL_RGBA32F: { result = 16U; break; }
+			case GL_RGB16F:
+			case GL_RGBA16F:
+			case GL_RG32F:   { result =  8U; break; }
+			case GL_RG16F:
+			case GL_R32F:    { result =  4U; break; }
+			case GL_R16F:
+			case GL_RG8:     { result =  2U; break; }
+			case GL_R8:      { result =  1U; break; }
+			default:         { result =  4U; break; }
+		}
+		
+		return result;
+	}
+	
+	template <typename F>
+	double Time(F&& _function) {
+		
+		const auto start = std::chrono::steady_clock::now();
+		
+		_function();
+		
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+	
+	/** @brief Cooks a single asset, if its cooked file is missing or out of date. */
+	Result Cook(const std::filesystem::path& _source, const std::filesystem::path& _assets, const std::filesystem::path& _cooked) {
+		
+		Result result { _source.lexically_relative(_assets), Result::Failed, {}, 0.0, 0.0, 0U, std::nullopt };
+		
+		try {
+			
+			const auto path = CookedAsset::PathOf(_source, _assets, _cooked);
+			const auto hash = AssetManifest::Hash(File::Map(_source, File::Sequential).View());
+			
+			if (exists(path) && CookedAsset::SourceOf(path) == hash) {
+				result.m_Status = Result::Current;
+			}
+			else {
+				
+				uint64_t source = 0U;
+				
+				switch (CookedAsset::KindOf(_source).value()) {
+					case CookedAsset::Mesh: {
+						
+						CookedAsset::MeshData mesh;
+						
+						result.m_Source = Time([&]() { mesh = AssetImporter::ImportMesh(_source); });
+						
+						CookedAsset::Write(path, hash, mesh);
+						
+						result.m_Cooked = Time([&]() { (void)CookedAsset::Read<CookedAsset::MeshData>(path, source); });
+						
+						break;
+					}
+					case CookedAsset::Texture: {
+						
+						// Determine the format of the Texture from the path it has at runtime.
+						const auto format = AssetImporter::TextureFormat(std::filesystem::path("assets") / result.m_Path);
+						
+						CookedAsset::TextureData texture;
+						
+						result.m_Source = Time([&]() { texture = AssetImporter::ImportTexture(_source, format); });
+						
+						AssetImporter::GenerateMips(texture);
+						
+						/* COMPRESS */
+						const auto uncompressed = texture;
+						
+						Result::Compression compression {};
+						compression.m_Format = AssetImporter::CompressionOf(_source, uncompressed);
+						compression.m_Encode = Time([&]() { AssetImporter::Compress(texture, compression.m_Format); });
+						compression.m_PSNR   = Graphics::BlockCompression::PSNR(compression.m_Format, AssetImporter::SurfaceOf(uncompressed, 0U), texture.m_Pixels);
+						
+						for (const auto& level : uncompressed.m_Levels) {
+							compression.m_Uncompressed += static_cast<size_t>(level.m_Width) * level.m_Height * TexelSize(format);
+						}
+						
+						compression.m_Compressed = texture.m_Size;
+						
+						result.m_Compression = compression;
+						
+						CookedAsset::Write(path, hash, texture);
+						
+						result.m_Cooked = Time([&]() {
+							
+							const auto cooked = CookedAsset::Read<CookedAsset::TextureData>(path, source);
+							
+							// The pixels are mapped rather than read, so touch each page of them.
+							volatile char sum = 0;
+							
+							for (size_t i = 0U; i < cooked.m_Size; i += 4096U) {
+								sum += cooked.m_Pixels[i];
+							}
+						});
+						
+						break;
+					}
+					case CookedAsset::Material: {
+						
+						CookedAsset::MaterialData material;
+						
+						result.m_Source = Time([&]() { material = AssetImporter::ImportMaterial(_source); });
+						
+						CookedAsset::Write(path, hash, material);
+						
+						result.m_Cooked = Time([&]() { (void)CookedAsset::Read<CookedAsset::MaterialData>(path, source); });
+						
+						break;
+					}
+					default: {
+						throw std::runtime_error("Not implemented!");
+					}
+				}
+				
+				result.m_Status = Result::Cooked;
+				result.m_Bytes  = std::filesystem::file_size(path);
+			}
+		}
+		catch (const std::exception& e) {
+			result.m_Error = e.what();
+		}
+		
+		return result;
+	}
+
+} // namespace
+
+int main(int _argc, char* _argv[]) {
+	
+	int result = 0;
+	
+	if (_argc > 3) {
+		std::cerr << "Usage: " << _argv[0] << " [assets/] [cooked/]\n";
+		
+		result = 1;
+	}
+	else {
+		
+		const std::filesystem::path assets = _argc > 1 ? _argv[1] : "assets";
+		const std::filesystem::path cooked = _argc > 2 ? _argv[2] : "cooked";
+		
+		try {
+			
+			if (!is_directory(assets)) {
+				throw std::runtime_error("\"" + assets.string() + "\" is not a directory.");
+			}
+			
+			std::vector<std::filesystem::path> sources;
+			
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(assets)) {
+				
+				if (entry.is_regular_file() && CookedAsset::KindOf(entry.path()).has_value()) {
+					sources.emplace_back(entry.path());
+				}
+			}
+			
+			/* COOK */
+			Threading::JobSystem::Init();
+			
+			std::vector<Threading::JobSystem::Task<Result>> tasks;
+			tasks.reserve(sources.size());
+			
+			for (const auto& source : sources) {
+				
+				tasks.emplace_back(Threading::JobSystem::Async([&source, &assets, &cooked]() {
+					return Cook(source, assets, cooked);
+				}));
+			}
+			
+			/* REPORT */
+			size_t counts[3U] { 0U, 0U, 0U };
+			
+			double source_total = 0.0;
+			double cooked_total = 0.0;
+			double encode_total = 0.0;
+			
+			size_t textures           = 0U;
+			size_t uncompressed_total = 0U;
+			size_t compressed_total   = 0U;
+			
+			std::cout << std::fixed << std::setprecision(2);
+			
+			for (auto& task : tasks) {
+				
+				const auto item = task.get();
+				
+				++counts[item.m_Status];
+				
+				switch (item.m_Status) {
+					case Result::Cooked: {
+						
+						std::cout << "Cooked  " << item.m_Path.generic_string() << ": " << item.m_Source << "ms -> " << item.m_Cooked << "ms (" <<
+							(static_cast<double>(item.m_Bytes) / 1048576.0) << " MiB)\n";
+						
+						if (const auto& compression = item.m_Compression) {
+							
+							std::cout << "        " << Graphics::BlockCompression::Name(compression->m_Format) << " in " << compression->m_Encode << "ms, PSNR " <<
+								compression->m_PSNR << "dB, VRAM " << (static_cast<double>(compression->m_Uncompressed) / 1048576.0) << " MiB -> " <<
+								(static_cast<double>(compression->m_Compressed) / 1048576.0) << " MiB\n";
+							
+							encode_total       += compression->m_Encode;
+							uncompressed_total += compression->m_Uncompressed;
+							compressed_total   += compression->m_Compressed;
+							
+							++textures;
+						}
+						
+						source_total += item.m_Source;
+						cooked_total += item.m_Cooked;
+						
+						break;
+					}
+					case Result::Current: {
+						break;
+					}
+					case Result::Failed:
+					default: {
+						std::cerr << "Failed  " << item.m_Path.generic_string() << ": " << item.m_Error << '\n';
+						
+						result = 1;
+						
+						break;
+					}
+				}
+			}
+			
+			std::cout << "Cooked (" << counts[Result::Cooked] << ") asset(s), (" << counts[Result::Current] << ") up to date, (" << counts[Result::Failed] << ") failed.\n";
+			
+			if (counts[Result::Cooked] > 0U) {
+				std::cout << "Decoding the source assets took " << source_total << "ms. Reading the cooked assets took " << cooked_total << "ms.\n";
+			}
+			
+			if (textures > 0U) {
+				std::cout << "Compressing (" << textures << ") texture(s) took " << encode_total << "ms, reducing their video memory from " <<
+					(static_cast<double>(uncompressed_total) / 1048576.0) << " MiB to " << (static_cast<double>(compressed_total) / 1048576.0) << " MiB.\n";
+			}
+			
+			Threading::JobSystem::Dispose();
+		}
+		catch (const std::exception& e) {
+			std::cerr << e.what() << '\n';
+			
+			result = 1;
+		}
+	}
+	
+	return result;
+}
@@ -0,0 +1,55 @@
+#include "../engine/scripts/core/Debug.hpp"
+
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+/**
+ * @file LogDecoder.cpp
+ * @brief Offline decoder for binary logs written by Debug::BinaryLog.
+ *
+ * @par Usage
+ * fyp_logdecode <input.bin> [output.txt]
+ */
+int main(int _argc, char* _argv[]) {
+	
+	int result = 0;
+	
+	if (_argc < 2 || _argc > 3) {
+		std::cerr << "Usage: " << _argv[0] << " <input.bin> [output.txt]\n";
+		
+		result = 1;
+	}
+	else {
+		
+		try {
+			
+			std::ifstream input(_argv[1], std::ios::in | std::ios::binary);
+			
+			if (!input.is_open()) {
+				throw std::runtime_error("Failed to open \"" + std::string(_argv[1]) + "\"!");
+			}
+			
+			if (_argc == 3) {
+				
+				std::ofstream output(_argv[2], std::ios::out | std::ios::trunc);
+				
+				if (!output.is_open()) {
+					throw std::runtime_error("Failed to open \"" + std::string(_argv[2]) + "\"!");
+				}
+				
+				(void)Debug::BinaryLog::Decode(input, output);
+			}
+			else {
+				(void)Debug::BinaryLog::Decode(input, std::cout);
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << e.what() << '\n';
+			
+			result = 1;
+		}
+	}
+	
+	return result;
+}
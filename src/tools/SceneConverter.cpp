@@ -0,0 +1,47 @@
+#include "../engine/scripts/ecs/SceneFile.hpp"
+
+#include <exception>
+#include <iostream>
+#include <string>
+
+/**
+ * @file SceneConverter.cpp
+ * @brief Offline converter between XML and binary Scene files (see ECS::SceneFile).
+ *
+ * @details Files in the XML format are converted to the binary format, and vice versa.
+ *          Component types are identified by the names GCC and Clang give them, as in the files in "levels/".
+ *
+ * @par Usage
+ * fyp_sceneconvert <input.scene> <output.scene>
+ */
+int main(int _argc, char* _argv[]) {
+	
+	using namespace LouiEriksson::Engine::ECS;
+	
+	int result = 0;
+	
+	if (_argc != 3) {
+		std::cerr << "Usage: " << _argv[0] << " <input.scene> <output.scene>\n";
+		
+		result = 1;
+	}
+	else {
+		
+		try {
+			
+			if (SceneFile::IsBinary(_argv[1])) {
+				SceneFile::Read(_argv[1]).ToXML(_argv[2]);
+			}
+			else {
+				SceneFile::FromXML(_argv[1]).Write(_argv[2]);
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << e.what() << '\n';
+			
+			result = 1;
+		}
+	}
+	
+	return result;
+}
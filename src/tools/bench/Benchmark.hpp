@@ -0,0 +1,435 @@
+#ifndef FINALYEARPROJECT_BENCHMARK_HPP
+#define FINALYEARPROJECT_BENCHMARK_HPP
+
+#include <json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __linux__ && __GLIBC__
+	#include <malloc.h>
+#endif
+
+#define FYP_BENCHMARK_CONCAT_INNER(_a, _b) _a##_b
+#define FYP_BENCHMARK_CONCAT(_a, _b) FYP_BENCHMARK_CONCAT_INNER(_a, _b)
+
+/**
+ * @def BENCHMARK
+ * @brief Registers a benchmark with the suite.
+ *
+ * @param[in] _name Unique name of the benchmark.
+ * @param[in] ... Callable accepting a Bench::State&, which iterates over the state to perform the timed work.
+ */
+#define BENCHMARK(_name, ...) static const bool FYP_BENCHMARK_CONCAT(_fyp_benchmark_, __LINE__) = LouiEriksson::Bench::Registry::Add(_name, __VA_ARGS__)
+
+namespace LouiEriksson::Bench {
+	
+	/**
+	 * @struct Memory
+	 * @brief Queries the resident memory of the benchmark process.
+	 *
+	 * @note Only implemented on Linux. Elsewhere, every query returns zero.
+	 */
+	struct Memory final {
+	
+	private:
+		
+		/** @brief Reads a field of /proc/self/status, in bytes. */
+		static size_t Status([[maybe_unused]] const std::string_view& _field) {
+			
+			size_t result = 0U;
+
+#if __linux__
+			std::ifstream status("/proc/self/status");
+			
+			std::string line;
+			
+			while (std::getline(status, line)) {
+				
+				if (line.compare(0U, _field.size(), _field) == 0) {
+					result = std::stoull(line.substr(_field.size())) * 1024U;
+					
+					break;
+				}
+			}
+#endif
+			
+			return result;
+		}
+	
+	public:
+		
+		/** @brief Returns the resident memory of the process, in bytes. */
+		static size_t Resident() { return Status("VmRSS:"); }
+		
+		/** @brief Returns the peak resident memory of the process since the last call to ResetPeak(), in bytes. */
+		static size_t Peak() { return Status("VmHWM:"); }
+		
+		/**
+		 * @brief Resets the peak resident memory of the process to its current resident memory.
+		 * @details Freed memory retained by the allocator is released first, so that it does not mask later allocations.
+		 */
+		static void ResetPeak() {
+
+#if __linux__
+	#if __GLIBC__
+			malloc_trim(0U);
+	#endif
+			std::ofstream("/proc/self/clear_refs") << '5';
+#endif
+		
+		}
+	};
+	
+	/**
+	 * @brief Prevents the compiler from optimising away the computation of a value.
+	 *
+	 * @param[in] _value The value to keep.
+	 */
+	template<typename T>
+	inline void DoNotOptimise(const T& _value) noexcept {
+
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(_value) : "memory");
+#else
+		static volatile const void* s_Sink;
+		s_Sink = static_cast<const void*>(&_value);
+#endif
+		
+	}
+	
+	/**
+	 * @class State
+	 * @brief Controls a single timed run of a benchmark.
+	 *
+	 * @details Iterating over the state runs the body of the loop a fixed number of times, and times only the loop.
+	 *          Any set-up performed before the loop is therefore excluded from the measurement.
+	 */
+	class State final {
+	
+	private:
+		
+		using clock = std::chrono::steady_clock;
+		
+		size_t m_Iterations;
+		size_t m_Items;
+		
+		std::map<std::string, double> m_Counters;
+		
+		clock::time_point m_Start;
+		clock::time_point m_End;
+	
+	public:
+		
+		class Iterator final {
+			
+			friend State;
+		
+		private:
+			
+			State* m_State;
+			
+			size_t m_Remaining;
+			
+			constexpr Iterator(State* _state, const size_t& _remaining) noexcept :
+				m_State(_state),
+				m_Remaining(_remaining) {}
+		
+		public:
+			
+			constexpr size_t operator *() const noexcept { return m_Remaining; }
+			
+			constexpr Iterator& operator ++() noexcept {
+				--m_Remaining;
+				
+				return *this;
+			}
+			
+			bool operator !=(const Iterator& _other) const noexcept {
+				
+				const auto result = m_Remaining != _other.m_Remaining;
+				
+				if (!result) {
+					m_State->m_End = clock::now();
+				}
+				
+				return result;
+			}
+		};
+		
+		explicit State(const size_t& _iterations) noexcept :
+			m_Iterations(_iterations),
+			m_Items(0U) {}
+		
+		/** @brief Returns the number of iterations the loop will run for. */
+		[[nodiscard]] constexpr const size_t& Iterations() const noexcept { return m_Iterations; }
+		
+		/**
+		 * @brief Sets the number of items processed by each iteration, which is used to report throughput.
+		 *
+		 * @param[in] _items Number of items processed per iteration.
+		 */
+		constexpr void ItemsPerIteration(const size_t& _items) noexcept { m_Items = _items; }
+		
+		/** @brief Returns the number of items processed by each iteration. */
+		[[nodiscard]] constexpr const size_t& ItemsPerIteration() const noexcept { return m_Items; }
+		
+		/**
+		 * @brief Reports an additional measurement of the run, such as memory usage.
+		 *
+		 * @param[in] _name Name of the measurement.
+		 * @param[in] _value Value of the measurement.
+		 */
+		void Counter(const std::string& _name, const double& _value) { m_Counters[_name] = _value; }
+		
+		/** @brief Returns the additional measurements of the run. */
+		[[nodiscard]] constexpr const std::map<std::string, double>& Counters() const noexcept { return m_Counters; }
+		
+		/** @brief Returns the time taken by the loop. */
+		[[nodiscard]] std::chrono::nanoseconds Elapsed() const noexcept {
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(m_End - m_Start);
+		}
+		
+		Iterator begin() noexcept {
+			
+			m_Start = clock::now();
+			m_End   = m_Start;
+			
+			return { this, m_Iterations };
+		}
+		
+		Iterator end() noexcept {
+			return { this, 0U };
+		}
+	};
+	
+	/**
+	 * @class Registry
+	 * @brief Holds, runs and reports every benchmark in the suite.
+	 */
+	class Registry final {
+	
+	public:
+		
+		using function_t = std::function<void(State&)>;
+		
+		/**
+		 * @brief Parameters controlling how benchmarks are run.
+		 */
+		struct Options final {
+			
+			/** @brief Only benchmarks whose name contains this string are run. */
+			std::string m_Filter;
+			
+			/** @brief Minimum duration of each timed sample. */
+			std::chrono::nanoseconds m_MinTime { std::chrono::milliseconds(100) };
+			
+			/** @brief Number of timed samples taken per benchmark. */
+			size_t m_Repetitions { 5U };
+		};
+		
+		/**
+		 * @brief Result of a benchmark.
+		 */
+		struct Result final {
+			
+			std::string m_Name;
+			
+			size_t m_Iterations;
+			
+			double m_Min;    /**< @brief Fastest sample, in nanoseconds per iteration. */
+			double m_Median; /**< @brief Median sample, in nanoseconds per iteration. */
+			double m_Mean;   /**< @brief Mean sample, in nanoseconds per iteration. */
+			
+			/** @brief Items processed per second, based on the median. Zero if not reported. */
+			double m_ItemsPerSecond;
+			
+			/** @brief Additional measurements reported by the final sample. */
+			std::map<std::string, double> m_Counters;
+		};
+	
+	private:
+		
+		struct Entry final {
+			
+			std::string m_Name;
+			
+			function_t m_Function;
+		};
+		
+		static std::vector<Entry>& Entries() {
+			
+			static std::vector<Entry> s_Entries;
+			
+			return s_Entries;
+		}
+		
+		static Result Run(const Entry& _entry, const Options& _options) {
+			
+			// Calibrate the number of iterations so that each sample takes at least the minimum time:
+			size_t iterations = 1U;
+			
+			for (;;) {
+				
+				State state(iterations);
+				_entry.m_Function(state);
+				
+				const auto elapsed = state.Elapsed();
+				
+				if (elapsed >= _options.m_MinTime || iterations >= (static_cast<size_t>(1U) << 30U)) {
+					break;
+				}
+				
+				// Estimate the required iterations, growing by at most 10x per step to guard against noisy samples.
+				const auto estimate = elapsed.count() > 0 ?
+					static_cast<size_t>(static_cast<double>(iterations) * 1.4 * (static_cast<double>(_options.m_MinTime.count()) / static_cast<double>(elapsed.count()))) :
+					iterations * 10U;
+				
+				iterations = std::clamp(estimate, iterations + 1U, iterations * 10U);
+			}
+			
+			// Take timed samples:
+			std::vector<double> samples;
+			samples.reserve(_options.m_Repetitions);
+			
+			size_t items = 0U;
+			
+			std::map<std::string, double> counters;
+			
+			for (size_t i = 0U; i < std::max(_options.m_Repetitions, static_cast<size_t>(1U)); ++i) {
+				
+				State state(iterations);
+				_entry.m_Function(state);
+				
+				samples.emplace_back(static_cast<double>(state.Elapsed().count()) / static_cast<double>(iterations));
+				
+				   items = state.ItemsPerIteration();
+				counters = state.Counters();
+			}
+			
+			std::sort(samples.begin(), samples.end());
+			
+			const auto median = samples[samples.size() / 2U];
+			
+			return {
+				_entry.m_Name,
+				iterations,
+				samples.front(),
+				median,
+				std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size()),
+				items > 0U && median > 0.0 ? (static_cast<double>(items) * 1.0e9) / median : 0.0,
+				std::move(counters)
+			};
+		}
+	
+	public:
+		
+		/**
+		 * @brief Registers a benchmark.
+		 * @see BENCHMARK
+		 */
+		static bool Add(std::string _name, function_t _function) {
+			
+			Entries().push_back({ std::move(_name), std::move(_function) });
+			
+			return true;
+		}
+		
+		/**
+		 * @brief Runs every registered benchmark matching the filter, in order of name.
+		 *
+		 * @param[in] _options Parameters controlling how benchmarks are run.
+		 * @param[in,out] _log Stream to which progress is reported.
+		 * @return The results of each benchmark run.
+		 */
+		static std::vector<Result> RunAll(const Options& _options, std::ostream& _log) {
+			
+			std::vector<Result> result;
+			
+			auto entries = Entries();
+			
+			std::sort(entries.begin(), entries.end(), [](const Entry& _a, const Entry& _b) {
+				return _a.m_Name < _b.m_Name;
+			});
+			
+			for (const auto& entry : entries) {
+				
+				if (entry.m_Name.find(_options.m_Filter) != std::string::npos) {
+					
+					result.emplace_back(Run(entry, _options));
+					
+					const auto& item = result.back();
+					
+					_log << std::left << std::setw(48) << item.m_Name << std::right << std::fixed << std::setprecision(1)
+					     << std::setw(14) << item.m_Median << " ns/op"
+					     << std::setw(12) << item.m_Iterations << " iters";
+					
+					if (item.m_ItemsPerSecond > 0.0) {
+						_log << std::setw(14) << std::setprecision(2) << item.m_ItemsPerSecond / 1.0e6 << " M items/s";
+					}
+					
+					for (const auto& counter : item.m_Counters) {
+						_log << "  " << counter.first << '=' << std::setprecision(0) << counter.second;
+					}
+					
+					_log << std::endl;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Serialises results to JSON, so that they can be compared between runs.
+		 *
+		 * @param[in] _results Results to serialise.
+		 * @return A JSON object containing the context of the run and its results.
+		 */
+		static nlohmann::json ToJSON(const std::vector<Result>& _results) {
+			
+			nlohmann::json benchmarks = nlohmann::json::array();
+			
+			for (const auto& item : _results) {
+				
+				benchmarks.push_back({
+					{ "name",             item.m_Name           },
+					{ "iterations",       item.m_Iterations     },
+					{ "ns_per_op_min",    item.m_Min            },
+					{ "ns_per_op_median", item.m_Median         },
+					{ "ns_per_op_mean",   item.m_Mean           },
+					{ "items_per_second", item.m_ItemsPerSecond },
+					{ "counters",         item.m_Counters       }
+				});
+			}
+			
+			return {
+				{ "context", {
+					{ "timestamp", std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count() },
+					{ "hardware_concurrency", std::thread::hardware_concurrency() },
+#if defined(NDEBUG)
+					{ "build", "release" },
+#else
+					{ "build", "debug" },
+#endif
+				}},
+				{ "benchmarks", benchmarks }
+			};
+		}
+	};
+
+} // LouiEriksson::Bench
+
+#endif //FINALYEARPROJECT_BENCHMARK_HPP
@@ -0,0 +1,537 @@
+#include "Benchmark.hpp"
+
+#include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/core/AssetManifest.hpp"
+#include "../../engine/scripts/core/File.hpp"
+#include "../../engine/scripts/core/utils/Bounds.hpp"
+#include "../../engine/scripts/core/utils/BVH.hpp"
+#include "../../engine/scripts/core/utils/Hashmap.hpp"
+#include "../../engine/scripts/core/utils/JobSystem.hpp"
+#include "../../engine/scripts/core/utils/Utils.hpp"
+
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/trigonometric.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Bench;
+	using namespace LouiEriksson::Engine;
+	
+	/* HASHMAP */
+	
+	constexpr size_t s_HashmapCount = 10000U;
+	
+	BENCHMARK("Hashmap::Add", [](State& _state) {
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			Hashmap<size_t, size_t> map;
+			
+			for (size_t j = 0U; j < s_HashmapCount; ++j) {
+				map.Add(j, j);
+			}
+			
+			DoNotOptimise(map);
+		}
+		
+		_state.ItemsPerIteration(s_HashmapCount);
+	});
+	
+	BENCHMARK("Hashmap::Get", [](State& _state) {
+		
+		Hashmap<size_t, size_t> map;
+		
+		for (size_t j = 0U; j < s_HashmapCount; ++j) {
+			map.Add(j, j);
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			size_t sum = 0U;
+			
+			for (size_t j = 0U; j < s_HashmapCount; ++j) {
+				
+				if (const auto item = map.Get(j)) {
+					sum += *item;
+				}
+			}
+			
+			DoNotOptimise(sum);
+		}
+		
+		_state.ItemsPerIteration(s_HashmapCount);
+	});
+	
+	BENCHMARK("Hashmap::Get (string)", [](State& _state) {
+		
+		Hashmap<std::string, size_t> map;
+		
+		std::vector<std::string> keys;
+		keys.reserve(s_HashmapCount);
+		
+		for (size_t j = 0U; j < s_HashmapCount; ++j) {
+			map.Add(keys.emplace_back("key_" + std::to_string(j)), j);
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			size_t sum = 0U;
+			
+			for (const auto& key : keys) {
+				
+				if (const auto item = map.Get(key)) {
+					sum += *item;
+				}
+			}
+			
+			DoNotOptimise(sum);
+		}
+		
+		_state.ItemsPerIteration(s_HashmapCount);
+	});
+	
+	BENCHMARK("Hashmap::Remove", [](State& _state) {
+		
+		Hashmap<size_t, size_t> source;
+		
+		for (size_t j = 0U; j < s_HashmapCount; ++j) {
+			source.Add(j, j);
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			auto map = source;
+			
+			for (size_t j = 0U; j < s_HashmapCount; ++j) {
+				map.Remove(j);
+			}
+			
+			DoNotOptimise(map);
+		}
+		
+		_state.ItemsPerIteration(s_HashmapCount);
+	});
+	
+	BENCHMARK("Hashmap::View", [](State& _state) {
+		
+		Hashmap<size_t, size_t> map;
+		
+		for (size_t j = 0U; j < s_HashmapCount; ++j) {
+			map.Add(j, j);
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			size_t sum = 0U;
+			
+			for (const auto& kvp : map.View()) {
+				sum += kvp.second;
+			}
+			
+			DoNotOptimise(sum);
+		}
+		
+		_state.ItemsPerIteration(s_HashmapCount);
+	});
+	
+	/* UTILS */
+	
+	constexpr std::string_view s_CSVLine = "4,,,1,1,224700,,,,,Psc,,0.00091185,1.08901332,H,219.7802,219.6622,0.0035,4.1976,H,9.1,2.390,0.482,H,,,-5.8,-1.69,H,,,,F5,H";
+	
+	BENCHMARK("Utils::Split", [](State& _state) {
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(Utils::Split(s_CSVLine, ',', 34U));
+		}
+		
+		_state.ItemsPerIteration(s_CSVLine.size());
+	});
+	
+	BENCHMARK("Utils::TryParse<double>", [](State& _state) {
+		
+		const std::vector<std::string_view> values { "219.7802", "-5.8", "0.00091185", "1.08901332", "", "F5" };
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& value : values) {
+				DoNotOptimise(Utils::TryParse<double>(value));
+			}
+		}
+		
+		_state.ItemsPerIteration(values.size());
+	});
+	
+	BENCHMARK("Utils::TryParse<size_t>", [](State& _state) {
+		
+		const std::vector<std::string_view> values { "4", "224700", "1", "", "Psc", "118322" };
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& value : values) {
+				DoNotOptimise(Utils::TryParse<size_t>(value));
+			}
+		}
+		
+		_state.ItemsPerIteration(values.size());
+	});
+	
+	BENCHMARK("Utils::Parse<double>", [](State& _state) {
+		
+		const std::vector<std::string_view> values { "219.7802", "-5.8", "0.00091185", "1.08901332" };
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& value : values) {
+				DoNotOptimise(Utils::Parse<double>(value));
+			}
+		}
+		
+		_state.ItemsPerIteration(values.size());
+	});
+	
+	/* ASSETS */
+	
+	/**
+	 * @brief Returns the path of a temporary directory tree resembling the "assets/" directory.
+	 * @note The tree is written on first use and deleted on exit.
+	 */
+	const std::filesystem::path& AssetTree() {
+		
+		struct TemporaryTree final {
+			
+			std::filesystem::path m_Path;
+			
+			TemporaryTree() : m_Path(std::filesystem::temp_directory_path() / "fyp_bench_assets") {
+				
+				constexpr std::array<std::string_view, 4U> s_Extensions { ".png", ".obj", ".frag", ".inc" };
+				
+				const std::string contents(4096U, 'x');
+				
+				for (size_t i = 0U; i < 32U; ++i) {
+					
+					const auto directory = m_Path / ("directory_" + std::to_string(i / 8U)) / ("subdirectory_" + std::to_string(i));
+					
+					std::filesystem::create_directories(directory);
+					
+					for (size_t j = 0U; j < 32U; ++j) {
+						std::ofstream(directory / ("asset_" + std::to_string(j) + std::string(s_Extensions[j % s_Extensions.size()]))) << contents;
+					}
+				}
+			}
+			
+			~TemporaryTree() {
+				
+				std::error_code ec;
+				std::filesystem::remove_all(m_Path, ec);
+			}
+		};
+		
+		static const TemporaryTree s_Tree;
+		
+		return s_Tree.m_Path;
+	}
+	
+	std::string Classify(const std::filesystem::path& _path) {
+		return _path.extension().string();
+	}
+	
+	BENCHMARK("File::Directory::GetEntriesRecursive", [](State& _state) {
+		
+		const auto& root = AssetTree();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(File::Directory::GetEntriesRecursive(root, File::Directory::EntryType::FILE));
+		}
+		
+		_state.ItemsPerIteration(1024U);
+	});
+	
+	// Startup with no cached manifest: every directory is listed and every file hashed.
+	BENCHMARK("AssetManifest::Refresh (cold)", [](State& _state) {
+		
+		const auto& root = AssetTree();
+		
+		const auto cache = root.parent_path() / "fyp_bench_assets.json";
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			std::filesystem::remove(cache);
+			
+			DoNotOptimise(AssetManifest::Refresh(root, cache, Classify));
+		}
+		
+		std::filesystem::remove(cache);
+		
+		_state.ItemsPerIteration(1024U);
+	});
+	
+	// Startup with an up-to-date cached manifest: only modification times are checked.
+	BENCHMARK("AssetManifest::Refresh (warm)", [](State& _state) {
+		
+		const auto& root = AssetTree();
+		
+		const auto cache = root.parent_path() / "fyp_bench_assets.json";
+		
+		AssetManifest::Refresh(root, cache, Classify);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(AssetManifest::Refresh(root, cache, Classify));
+		}
+		
+		std::filesystem::remove(cache);
+		
+		_state.ItemsPerIteration(1024U);
+	});
+	
+	/* BVH */
+	
+	/** @brief Generates unit boxes scattered pseudo-randomly through a cube, whose volume grows with their number. */
+	std::vector<AABB> GenerateBounds(const size_t& _count) {
+		
+		std::vector<AABB> result;
+		result.reserve(_count);
+		
+		const auto extent = static_cast<scalar_t>(std::cbrt(static_cast<double>(_count)) * 4.0);
+		
+		uint32_t seed = 1U;
+		
+		const auto next = [&seed, &extent]() {
+			seed = (seed * 1664525U) + 1013904223U;
+			
+			return ((static_cast<scalar_t>(seed >> 8U) / static_cast<scalar_t>(1U << 24U)) - static_cast<scalar_t>(0.5)) * extent;
+		};
+		
+		for (size_t i = 0U; i < _count; ++i) {
+			
+			const vec3 centre(next(), next(), next());
+			
+			result.emplace_back(centre - vec3(0.5), centre + vec3(0.5));
+		}
+		
+		return result;
+	}
+	
+	/** @brief Frustum of a camera at the origin with a 60 degree field of view and a 100 unit draw distance, looking along -z. */
+	Frustum GenerateFrustum() {
+		return Frustum(glm::perspective<scalar_t>(glm::radians(60.0), 16.0 / 9.0, 0.1, 100.0));
+	}
+	
+	/*
+	 * Compare culling against a frustum using the BVH (as Scene::Draw does) against testing the bounds of every object,
+	 * along with the cost of building and updating the BVH, for scenes of different sizes.
+	 */
+	const bool s_BVHBenchmarks = []() {
+		
+		for (const size_t count : { 10000U, 100000U, 1000000U }) {
+			
+			const auto suffix = " (" + std::to_string(count) + ")";
+			
+			Registry::Add("BVH::Insert" + suffix, [count](State& _state) {
+				
+				const auto bounds = GenerateBounds(count);
+				
+				for ([[maybe_unused]] const auto& i : _state) {
+					
+					BVH<size_t> bvh;
+					
+					for (size_t j = 0U; j < bounds.size(); ++j) {
+						bvh.Insert(bounds[j], j);
+					}
+					
+					DoNotOptimise(bvh.Height());
+				}
+				
+				_state.ItemsPerIteration(count);
+			});
+			
+			// Moves 1% of the objects by a distance within the margin of the BVH each iteration, so most updates are free.
+			Registry::Add("BVH::Update (1% moving)" + suffix, [count](State& _state) {
+				
+				auto bounds = GenerateBounds(count);
+				
+				BVH<size_t> bvh;
+				
+				std::vector<size_t> leaves;
+				leaves.reserve(bounds.size());
+				
+				for (size_t j = 0U; j < bounds.size(); ++j) {
+					leaves.emplace_back(bvh.Insert(bounds[j], j));
+				}
+				
+				const auto step = vec3(0.05);
+				
+				for ([[maybe_unused]] const auto& i : _state) {
+					
+					for (size_t j = 0U; j < bounds.size(); j += 100U) {
+						
+						bounds[j].m_Min += step;
+						bounds[j].m_Max += step;
+						
+						DoNotOptimise(bvh.Update(leaves[j], bounds[j]));
+					}
+				}
+				
+				_state.ItemsPerIteration(count / 100U);
+			});
+			
+			Registry::Add("BVH::Query (frustum)" + suffix, [count](State& _state) {
+				
+				const auto bounds  = GenerateBounds(count);
+				const auto frustum = GenerateFrustum();
+				
+				BVH<size_t> bvh;
+				
+				for (size_t j = 0U; j < bounds.size(); ++j) {
+					bvh.Insert(bounds[j], j);
+				}
+				
+				std::vector<size_t> visible;
+				visible.reserve(count);
+				
+				for ([[maybe_unused]] const auto& i : _state) {
+					
+					visible.clear();
+					
+					bvh.Query(frustum, [&visible](const size_t& _item) { visible.emplace_back(_item); });
+					
+					DoNotOptimise(visible);
+				}
+				
+				_state.ItemsPerIteration(count);
+				_state.Counter("visible", static_cast<double>(visible.size()));
+			});
+			
+			Registry::Add("Frustum::Overlaps (every object)" + suffix, [count](State& _state) {
+				
+				const auto bounds  = GenerateBounds(count);
+				const auto frustum = GenerateFrustum();
+				
+				std::vector<size_t> visible;
+				visible.reserve(count);
+				
+				for ([[maybe_unused]] const auto& i : _state) {
+					
+					visible.clear();
+					
+					for (size_t j = 0U; j < bounds.size(); ++j) {
+						
+						if (frustum.Overlaps(bounds[j])) {
+							visible.emplace_back(j);
+						}
+					}
+					
+					DoNotOptimise(visible);
+				}
+				
+				_state.ItemsPerIteration(count);
+				_state.Counter("visible", static_cast<double>(visible.size()));
+			});
+		}
+		
+		return true;
+	}();
+	
+	/* JOBSYSTEM */
+	
+	constexpr size_t s_JobCount = 1024U;
+	
+	/** @brief Small, fixed amount of work performed by each job. */
+	inline void Work(std::atomic<size_t>& _counter) {
+		
+		size_t value = 0U;
+		
+		for (size_t i = 0U; i < 256U; ++i) {
+			value += i * i;
+			
+			DoNotOptimise(value);
+		}
+		
+		_counter.fetch_add(1U, std::memory_order_relaxed);
+	}
+	
+	/*
+	 * Compare the throughput of the JobSystem with different numbers of workers against std::async,
+	 * which the JobSystem replaced.
+	 */
+	const bool s_JobSystemBenchmarks = []() {
+		
+		std::vector<size_t> worker_counts { 1U, 2U, 4U };
+		
+		const auto hardware = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 2U)) - 1U;
+		
+		if (std::find(worker_counts.begin(), worker_counts.end(), hardware) == worker_counts.end()) {
+			worker_counts.emplace_back(hardware);
+		}
+		
+		for (const auto& workers : worker_counts) {
+			
+			Registry::Add("JobSystem::Schedule (" + std::to_string(workers) + " workers)", [workers](State& _state) {
+				
+				Threading::JobSystem::Init(workers);
+				
+				std::atomic<size_t> counter { 0U };
+				
+				std::vector<Threading::JobSystem::Handle> jobs;
+				jobs.reserve(s_JobCount);
+				
+				for ([[maybe_unused]] const auto& i : _state) {
+					
+					for (size_t j = 0U; j < s_JobCount; ++j) {
+						jobs.emplace_back(Threading::JobSystem::Schedule([&counter]() { Work(counter); }, Threading::JobSystem::Gameplay));
+					}
+					
+					for (const auto& job : jobs) {
+						Threading::JobSystem::Wait(job);
+					}
+					
+					jobs.clear();
+				}
+				
+				Threading::JobSystem::Dispose();
+				
+				_state.ItemsPerIteration(s_JobCount);
+			});
+		}
+		
+		Registry::Add("std::async", [](State& _state) {
+			
+			std::atomic<size_t> counter { 0U };
+			
+			std::vector<std::future<void>> tasks;
+			tasks.reserve(s_JobCount);
+			
+			for ([[maybe_unused]] const auto& i : _state) {
+				
+				for (size_t j = 0U; j < s_JobCount; ++j) {
+					tasks.emplace_back(std::async(std::launch::async, [&counter]() { Work(counter); }));
+				}
+				
+				for (auto& task : tasks) {
+					task.wait();
+				}
+				
+				tasks.clear();
+			}
+			
+			_state.ItemsPerIteration(s_JobCount);
+		});
+		
+		return true;
+	}();
+
+} // namespace
@@ -0,0 +1,508 @@
+#include "Benchmark.hpp"
+
+#include "../../engine/scripts/core/Transform.hpp"
+#include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/core/utils/Hashmap.hpp"
+#include "../../engine/scripts/ecs/Component.hpp"
+#include "../../engine/scripts/ecs/GameObject.hpp"
+#include "../../engine/scripts/ecs/Handle.hpp"
+#include "../../engine/scripts/ecs/Prototype.hpp"
+#include "../../engine/scripts/ecs/SceneFile.hpp"
+#include "../../engine/scripts/ecs/Storage.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Bench;
+	using namespace LouiEriksson::Engine;
+	
+	/* ECS */
+	
+	constexpr size_t s_EntityCount = 100000U;
+	
+	/** @brief Every s_EmitterInterval-th entity has an Emitter, as a stand-in for sparse types such as Light. */
+	constexpr size_t s_EmitterInterval = 10U;
+	
+	/** @brief Stand-in for a Component updated every frame (e.g. Rigidbody). */
+	struct Body final : ECS::Component {
+		
+		glm::vec3 m_Position { 0.0f };
+		glm::vec3 m_Velocity { 1.0f };
+		
+		explicit Body(const std::weak_ptr<ECS::GameObject>& _parent) noexcept : ECS::Component(_parent) {}
+		
+		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Body); }
+		
+		void Integrate(const float& _delta) noexcept {
+			m_Position += m_Velocity * _delta;
+		}
+	};
+	
+	/** @brief Stand-in for a Component held by few entities (e.g. Light). */
+	struct Emitter final : ECS::Component {
+		
+		float m_Intensity = 1.0f;
+		
+		explicit Emitter(const std::weak_ptr<ECS::GameObject>& _parent) noexcept : ECS::Component(_parent) {}
+		
+		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Emitter); }
+	};
+	
+	/**
+	 * @brief Returns a set of entities resembling a populated Scene.
+	 * @note The entities are created on first use.
+	 */
+	const auto& World() {
+		
+		struct Entities final {
+			
+			std::shared_ptr<ECS::Storage> m_Storage;
+			
+			Hashmap<std::string, std::shared_ptr<ECS::GameObject>> m_Entities;
+			
+			Entities() : m_Storage(std::make_shared<ECS::Storage>()) {
+				
+				for (size_t i = 0U; i < s_EntityCount; ++i) {
+					
+					const auto name = "Entity_" + std::to_string(i);
+					
+					auto entity = m_Storage->Create({}, name);
+					entity->AddComponent<Body>();
+					
+					if (i % s_EmitterInterval == 0U) {
+						entity->AddComponent<Emitter>();
+					}
+					
+					m_Entities.Add(name, entity);
+				}
+			}
+		};
+		
+		static const Entities s_Entities;
+		
+		return s_Entities;
+	}
+	
+	/** @brief Visits every entity and looks up its Components by type, as Scene::Tick did previously. */
+	template<typename T, typename F>
+	void ForEachByEntity(const Hashmap<std::string, std::shared_ptr<ECS::GameObject>>& _entities, F&& _function) {
+		
+		for (const auto& kvp : _entities.View()) {
+			
+			if (const auto& entity = kvp.second; entity->Active()) {
+				
+				if (const auto& components = entity->Components().Get(typeid(T))) {
+					for (const auto& item : *components) {
+						_function(*static_cast<T*>(item.get()));
+					}
+				}
+			}
+		}
+	}
+	
+	BENCHMARK("ECS::GameObject::Components (dense)", [](State& _state) {
+		
+		const auto& world = World();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			ForEachByEntity<Body>(world.m_Entities, [](Body& _body) { _body.Integrate(0.016f); });
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount);
+	});
+	
+	BENCHMARK("ECS::Storage::View (dense)", [](State& _state) {
+		
+		const auto& world = World();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& [body, entity] : world.m_Storage->View<Body>()) {
+				
+				if (entity.Active()) {
+					body.Integrate(0.016f);
+				}
+			}
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount);
+	});
+	
+	BENCHMARK("ECS::Storage::Query (dense)", [](State& _state) {
+		
+		const auto& world = World();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& [body, entity] : world.m_Storage->Query<Body>()) {
+				body.Integrate(0.016f);
+			}
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount);
+	});
+	
+	BENCHMARK("ECS::GameObject::Components (sparse)", [](State& _state) {
+		
+		const auto& world = World();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			float sum = 0.0f;
+			
+			ForEachByEntity<Emitter>(world.m_Entities, [&sum](const Emitter& _emitter) { sum += _emitter.m_Intensity; });
+			
+			DoNotOptimise(sum);
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount / s_EmitterInterval);
+	});
+	
+	BENCHMARK("ECS::Storage::View (sparse)", [](State& _state) {
+		
+		const auto& world = World();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			float sum = 0.0f;
+			
+			for (const auto& [emitter, entity] : world.m_Storage->View<Emitter>()) {
+				
+				if (entity.Active()) {
+					sum += emitter.m_Intensity;
+				}
+			}
+			
+			DoNotOptimise(sum);
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount / s_EmitterInterval);
+	});
+	
+	BENCHMARK("ECS::Storage::Query (sparse)", [](State& _state) {
+		
+		const auto& world = World();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			float sum = 0.0f;
+			
+			for (const auto& [emitter, body, entity] : world.m_Storage->Query<Emitter, Body>()) {
+				sum += emitter.m_Intensity * body.m_Position.x;
+			}
+			
+			DoNotOptimise(sum);
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount / s_EmitterInterval);
+	});
+	
+	/* SPAWNING */
+	
+	constexpr size_t s_SpawnCount = 10000U;
+	
+	/** @brief Creates GameObjects one at a time, as Map::Build did previously for each feature. */
+	BENCHMARK("ECS::Storage::Create (per entity)", [](State& _state) {
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			const auto storage = std::make_shared<ECS::Storage>();
+			
+			std::vector<std::shared_ptr<ECS::GameObject>> entities;
+			
+			for (size_t j = 0U; j < s_SpawnCount; ++j) {
+				
+				auto entity = storage->Create({}, "Entity_" + std::to_string(j));
+				entity->AddComponent<Transform>();
+				entity->AddComponent<Body>();
+				entity->AddComponent<Emitter>();
+				
+				entities.emplace_back(std::move(entity));
+			}
+			
+			DoNotOptimise(entities);
+		}
+		
+		_state.ItemsPerIteration(s_SpawnCount);
+	});
+	
+	BENCHMARK("ECS::Storage::Create (batch)", [](State& _state) {
+		
+		ECS::Prototype<Transform, Body, Emitter> prototype;
+		prototype.m_Name = [](const size_t& _index) { return "Entity_" + std::to_string(_index); };
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			const auto storage = std::make_shared<ECS::Storage>();
+			
+			DoNotOptimise(storage->Create({}, s_SpawnCount, prototype));
+		}
+		
+		_state.ItemsPerIteration(s_SpawnCount);
+	});
+	
+	/* HANDLES */
+	
+	BENCHMARK("std::weak_ptr::lock", [](State& _state) {
+		
+		const auto& world = World();
+		
+		std::vector<std::weak_ptr<Body>> references;
+		references.reserve(s_EntityCount);
+		
+		for (const auto& kvp : world.m_Entities) {
+			references.emplace_back(kvp.second->GetComponent<Body>());
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& reference : references) {
+				
+				if (const auto body = reference.lock()) {
+					body->Integrate(0.016f);
+				}
+			}
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount);
+	});
+	
+	BENCHMARK("ECS::Handle::Get", [](State& _state) {
+		
+		const auto& world = World();
+		
+		std::vector<ECS::Handle<Body>> references;
+		references.reserve(s_EntityCount);
+		
+		for (const auto& kvp : world.m_Entities) {
+			references.emplace_back(kvp.second->GetComponent<Body>());
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& reference : references) {
+				
+				if (auto* const body = reference.Get()) {
+					body->Integrate(0.016f);
+				}
+			}
+		}
+		
+		_state.ItemsPerIteration(s_EntityCount);
+	});
+	
+	/* TRANSFORMS */
+	
+	constexpr size_t s_HierarchyCount = 10000U;
+	
+	/** @brief Depth of each chain of Transforms, as a stand-in for e.g. planets parented to the Planetarium. */
+	constexpr size_t s_HierarchyDepth = 4U;
+	
+	/** @brief Number of times each World matrix is read per frame (the geometry pass, plus one shadow pass per light). */
+	constexpr size_t s_WorldReads = 7U;
+	
+	/** @brief Returns a set of Transforms in chains of s_HierarchyDepth, whose roots move every frame. */
+	const auto& Hierarchy() {
+		
+		struct Transforms final {
+			
+			std::shared_ptr<ECS::Storage> m_Storage;
+			
+			std::vector<std::shared_ptr<ECS::GameObject>> m_Entities;
+			
+			std::vector<std::shared_ptr<Transform>> m_Roots;
+			std::vector<std::shared_ptr<Transform>> m_Transforms;
+			
+			Transforms() : m_Storage(std::make_shared<ECS::Storage>()) {
+				
+				std::shared_ptr<Transform> parent;
+				
+				for (size_t i = 0U; i < s_HierarchyCount; ++i) {
+					
+					auto entity = m_Storage->Create({}, "Transform_" + std::to_string(i));
+					
+					auto transform = entity->AddComponent<Transform>();
+					transform->Position({ 1.0, 2.0, 3.0 });
+					transform->Rotation(glm::angleAxis(0.1f, glm::vec3(0.0, 1.0, 0.0)));
+					
+					if (i % s_HierarchyDepth == 0U) {
+						m_Roots.emplace_back(transform);
+					}
+					else {
+						transform->ParentTransform(parent);
+					}
+					
+					parent = transform;
+					
+					m_Transforms.emplace_back(transform);
+					m_Entities.emplace_back(std::move(entity));
+				}
+			}
+		};
+		
+		static const Transforms s_Transforms;
+		
+		return s_Transforms;
+	}
+	
+	/** @brief Computes the World matrix of a Transform by recursing up the hierarchy, as Transform::World() did previously. */
+	mat4 RecursiveWorld(Transform& _transform) {
+		
+		auto* const parent = _transform.ParentTransform();
+		
+		return parent != nullptr ?
+			RecursiveWorld(*parent) * _transform.Local() :
+			_transform.Local();
+	}
+	
+	BENCHMARK("Transform::World (recursive)", [](State& _state) {
+		
+		const auto& hierarchy = Hierarchy();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& root : hierarchy.m_Roots) {
+				root->Position(root->Position() + glm::vec3(0.001));
+			}
+			
+			for (size_t j = 0U; j < s_WorldReads; ++j) {
+				
+				for (const auto& transform : hierarchy.m_Transforms) {
+					DoNotOptimise(RecursiveWorld(*transform));
+				}
+			}
+		}
+		
+		_state.ItemsPerIteration(s_HierarchyCount);
+	});
+	
+	BENCHMARK("Transform::Hierarchy::Update", [](State& _state) {
+		
+		const auto& hierarchy = Hierarchy();
+		
+		Transform::Hierarchy flattened;
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& root : hierarchy.m_Roots) {
+				root->Position(root->Position() + glm::vec3(0.001));
+			}
+			
+			flattened.Update(hierarchy.m_Storage->View<Transform>(), hierarchy.m_Storage->Revision<Transform>());
+			
+			for (size_t j = 0U; j < s_WorldReads; ++j) {
+				
+				for (const auto& transform : hierarchy.m_Transforms) {
+					DoNotOptimise(transform->World());
+				}
+			}
+		}
+		
+		_state.ItemsPerIteration(s_HierarchyCount);
+	});
+	
+	/* SCENES */
+	
+	constexpr size_t s_SceneEntityCount = 10000U;
+	
+	/** @brief Every s_SceneRigidbodyInterval-th entity in the generated Scene has a Rigidbody. */
+	constexpr size_t s_SceneRigidbodyInterval = 4U;
+	
+	/**
+	 * @brief Returns the paths of a large generated Scene, in the XML and binary formats.
+	 * @note The files are written on first use and deleted on exit.
+	 */
+	const auto& SceneFiles() {
+		
+		struct TemporaryScene final {
+			
+			std::filesystem::path m_XML;
+			std::filesystem::path m_Binary;
+			
+			TemporaryScene() :
+				m_XML   (std::filesystem::temp_directory_path() / "fyp_bench.scene"),
+				m_Binary(std::filesystem::temp_directory_path() / "fyp_bench.scene.bin")
+			{
+				ECS::SceneFile scene;
+				
+				const auto script = scene.Intern("St10shared_ptrIN12LouiEriksson4Game7Scripts4BallEE");
+				
+				for (size_t i = 0U; i < s_SceneEntityCount; ++i) {
+					
+					const auto entity = scene.AddEntity("Entity_" + std::to_string(i));
+					
+					const auto f = static_cast<float>(i);
+					
+					auto& transforms = scene.m_Transforms;
+					transforms.m_Entities.emplace_back(entity);
+					transforms.m_Positions.emplace_back(f, f * 0.5f, -f);
+					transforms.m_Rotations.emplace_back(0.0f, 0.0f, 0.0f, 1.0f);
+					transforms.m_Scales.emplace_back(1.0f);
+					
+					if (i % s_SceneRigidbodyInterval == 0U) {
+						
+						auto& rigidbodies = scene.m_Rigidbodies;
+						rigidbodies.m_Entities.emplace_back(entity);
+						rigidbodies.m_Velocities.emplace_back(0.0f, -1.0f, 0.0f);
+						rigidbodies.m_AngularVelocities.emplace_back(0.0f);
+						rigidbodies.m_Masses.emplace_back(1.0f);
+						rigidbodies.m_Drags.emplace_back(0.0f);
+						rigidbodies.m_AngularDrags.emplace_back(0.005f);
+						
+						scene.m_Renderers.emplace_back(entity);
+					}
+					
+					scene.m_Scripts.m_Entities.emplace_back(entity);
+					scene.m_Scripts.m_Types.emplace_back(script);
+				}
+				
+				scene.ToXML(m_XML);
+				scene.Write(m_Binary);
+			}
+			
+			~TemporaryScene() {
+				
+				std::error_code ec;
+				std::filesystem::remove(m_XML,    ec);
+				std::filesystem::remove(m_Binary, ec);
+			}
+		};
+		
+		static const TemporaryScene s_Scene;
+		
+		return s_Scene;
+	}
+	
+	BENCHMARK("ECS::SceneFile::FromXML", [](State& _state) {
+		
+		const auto& files = SceneFiles();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(ECS::SceneFile::FromXML(files.m_XML));
+		}
+		
+		_state.ItemsPerIteration(s_SceneEntityCount);
+	});
+	
+	BENCHMARK("ECS::SceneFile::Read", [](State& _state) {
+		
+		const auto& files = SceneFiles();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(ECS::SceneFile::Read(files.m_Binary));
+		}
+		
+		_state.ItemsPerIteration(s_SceneEntityCount);
+	});
+
+} // namespace
@@ -0,0 +1,159 @@
+#include "Benchmark.hpp"
+
+#include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/graphics/Mesh.hpp"
+#include "../../engine/scripts/graphics/textures/BlockCompression.hpp"
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Bench;
+	using namespace LouiEriksson::Engine;
+	
+	/**
+	 * @brief Vertex data of a triangulated grid, matching the layout of Mesh::Primitives::Grid.
+	 */
+	struct GridData final {
+		
+		std::vector<glm::vec3> m_Vertices;
+		std::vector<glm::vec2> m_UVs;
+		std::vector<GLuint>    m_Indices;
+	};
+	
+	GridData GenerateGrid(const size_t& _resolution) {
+		
+		GridData result;
+		
+		result.m_Vertices.reserve(_resolution * _resolution);
+		result.m_UVs.reserve(_resolution * _resolution);
+		
+		for (size_t i = 0U; i < _resolution; ++i) {
+		for (size_t j = 0U; j < _resolution; ++j) {
+			
+			const glm::vec2 uv(
+				static_cast<float>(j) / static_cast<float>(_resolution - 1U),
+				static_cast<float>(i) / static_cast<float>(_resolution - 1U)
+			);
+			
+			result.m_UVs.emplace_back(uv);
+			result.m_Vertices.emplace_back(uv.x - 0.5F, std::sin(uv.x * 10.0F) * std::cos(uv.y * 10.0F) * 0.1F, uv.y - 0.5F);
+		}}
+		
+		result.m_Indices.reserve((_resolution - 1U) * (_resolution - 1U) * 6U);
+		
+		for (size_t i = 0U; i < _resolution - 1U; ++i) {
+		for (size_t j = 0U; j < _resolution - 1U; ++j) {
+			
+			const auto a = static_cast<GLuint>((i * _resolution) + j);
+			const auto b = static_cast<GLuint>(a + 1U);
+			const auto c = static_cast<GLuint>(a + _resolution);
+			const auto d = static_cast<GLuint>(c + 1U);
+			
+			result.m_Indices.insert(result.m_Indices.end(), { a, c, b, b, c, d });
+		}}
+		
+		return result;
+	}
+	
+	constexpr size_t s_GridResolution = 128U;
+	
+	BENCHMARK("Mesh::GenerateNormals", [](State& _state) {
+		
+		const auto grid = GenerateGrid(s_GridResolution);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(Graphics::Mesh::GenerateNormals<float>(grid.m_Vertices, grid.m_Indices));
+		}
+		
+		_state.ItemsPerIteration(grid.m_Indices.size() / 3U);
+	});
+	
+	BENCHMARK("Mesh::GenerateTangents", [](State& _state) {
+		
+		const auto grid = GenerateGrid(s_GridResolution);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(Graphics::Mesh::GenerateTangents<float>(grid.m_Vertices, grid.m_UVs, grid.m_Indices));
+		}
+		
+		_state.ItemsPerIteration(grid.m_Indices.size() / 3U);
+	});
+	
+	BENCHMARK("Mesh::Earcut::TriangulateXZ", [](State& _state) {
+		
+		// A star-shaped polygon, similar in complexity to a detailed building footprint.
+		constexpr size_t s_PointCount = 512U;
+		
+		std::vector<glm::vec3> polyline;
+		polyline.reserve(s_PointCount);
+		
+		for (size_t i = 0U; i < s_PointCount; ++i) {
+			
+			const auto theta  = (static_cast<float>(i) / static_cast<float>(s_PointCount)) * 6.28318530718F;
+			const auto radius = (i % 2U) == 0U ? 1.0F : 0.6F;
+			
+			polyline.emplace_back(std::cos(theta) * radius, 0.0F, std::sin(theta) * radius);
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(Graphics::Mesh::Earcut::TriangulateXZ<float, GLuint>(polyline));
+		}
+		
+		_state.ItemsPerIteration(s_PointCount);
+	});
+	
+	constexpr uint32_t s_ImageResolution = 256U;
+	
+	BENCHMARK("BlockCompression::Encode (BC1)", [](State& _state) {
+		
+		// A colour gradient with fine detail, similar to a photographic albedo map.
+		std::vector<unsigned char> pixels(static_cast<size_t>(s_ImageResolution) * s_ImageResolution * 4U);
+		
+		for (size_t i = 0U; i < pixels.size(); ++i) {
+			pixels[i] = (i % 4U) == 3U ? 255U : static_cast<unsigned char>(((i / 4U) * (i % 4U + 1U) + (i * 7U % 13U)) & 0xFFU);
+		}
+		
+		const Graphics::BlockCompression::Surface surface { pixels.data(), s_ImageResolution, s_ImageResolution, 4U, false };
+		
+		std::vector<char> output(Graphics::BlockCompression::Size(Graphics::BlockCompression::BC1, s_ImageResolution, s_ImageResolution));
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			Graphics::BlockCompression::Encode(Graphics::BlockCompression::BC1, surface, output.data());
+			
+			DoNotOptimise(output.data());
+		}
+		
+		_state.ItemsPerIteration(static_cast<size_t>(s_ImageResolution) * s_ImageResolution);
+	});
+	
+	BENCHMARK("BlockCompression::Encode (BC6H)", [](State& _state) {
+		
+		// A high dynamic range gradient, similar to an environment map.
+		std::vector<float> pixels(static_cast<size_t>(s_ImageResolution) * s_ImageResolution * 3U);
+		
+		for (size_t i = 0U; i < pixels.size(); ++i) {
+			pixels[i] = std::exp2((static_cast<float>((i / 3U) % s_ImageResolution) / static_cast<float>(s_ImageResolution) * 16.0F) - 6.0F) * static_cast<float>(i % 3U + 1U);
+		}
+		
+		const Graphics::BlockCompression::Surface surface { pixels.data(), s_ImageResolution, s_ImageResolution, 3U, true };
+		
+		std::vector<char> output(Graphics::BlockCompression::Size(Graphics::BlockCompression::BC6H, s_ImageResolution, s_ImageResolution));
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			Graphics::BlockCompression::Encode(Graphics::BlockCompression::BC6H, surface, output.data());
+			
+			DoNotOptimise(output.data());
+		}
+		
+		_state.ItemsPerIteration(static_cast<size_t>(s_ImageResolution) * s_ImageResolution);
+	});
+
+} // namespace
@@ -0,0 +1,70 @@
+#include "Benchmark.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @file Main.cpp
+ * @brief Headless micro-benchmarks of the engine's CPU hot paths.
+ *
+ * @par Usage
+ * fyp_bench [--filter <substring>] [--out <results.json>] [--min-time <ms>] [--repetitions <n>]
+ */
+int main(int _argc, char* _argv[]) {
+	
+	int result = 0;
+	
+	try {
+		
+		LouiEriksson::Bench::Registry::Options options;
+		
+		std::string output = "fyp_bench.json";
+		
+		// Parse arguments:
+		for (int i = 1; i < _argc; ++i) {
+			
+			const std::string_view arg(_argv[i]);
+			
+			if (i + 1 >= _argc) {
+				throw std::invalid_argument("Missing value for argument \"" + std::string(arg) + "\"!");
+			}
+			
+			const std::string value(_argv[++i]);
+			
+			     if (arg == "--filter"     ) { options.m_Filter      = value; }
+			else if (arg == "--out"        ) { output                = value; }
+			else if (arg == "--min-time"   ) { options.m_MinTime     = std::chrono::milliseconds(std::stoul(value)); }
+			else if (arg == "--repetitions") { options.m_Repetitions = static_cast<size_t>(std::stoul(value)); }
+			else {
+				throw std::invalid_argument("Unknown argument \"" + std::string(arg) + "\"!");
+			}
+		}
+		
+		const auto results = LouiEriksson::Bench::Registry::RunAll(options, std::cout);
+		
+		std::ofstream file(output, std::ios::out | std::ios::trunc);
+		
+		if (!file.is_open()) {
+			throw std::runtime_error("Failed to open \"" + output + "\"!");
+		}
+		
+		file << LouiEriksson::Bench::Registry::ToJSON(results).dump(4) << '\n';
+		
+		std::cout << "Wrote (" << results.size() << ") result(s) to \"" << output << "\"." << std::endl;
+	}
+	catch (const std::exception& e) {
+		std::cerr << e.what() << '\n';
+		
+		std::cerr << "Usage: " << _argv[0] << " [--filter <substring>] [--out <results.json>] [--min-time <ms>] [--repetitions <n>]\n";
+		
+		result = 1;
+	}
+	
+	return result;
+}
@@ -0,0 +1,374 @@
+#include "Benchmark.hpp"
+
+#include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/core/File.hpp"
+#include "../../engine/scripts/core/utils/CSV.hpp"
+#include "../../engine/scripts/core/utils/Utils.hpp"
+#include "../../engine/scripts/spatial/atmosphere/ISA.hpp"
+#include "../../engine/scripts/spatial/maths/Coords.hpp"
+#include "../../engine/scripts/spatial/planets/VSOP.hpp"
+#include "../../engine/scripts/spatial/planets/WGCCRE.hpp"
+#include "../../engine/scripts/spatial/stars/ATHYG.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Bench;
+	using namespace LouiEriksson::Engine;
+	using namespace LouiEriksson::Engine::Spatial;
+	
+	/* ATHYG */
+	
+	constexpr size_t s_StarCount = 1024U;
+	
+	/** @brief Generates rows resembling those of the ATHYG (v3) catalogue. */
+	std::vector<std::string> GenerateATHYGRows(const size_t& _count) {
+		
+		std::vector<std::string> result;
+		result.reserve(_count);
+		
+		for (size_t i = 0U; i < _count; ++i) {
+			
+			const auto f = static_cast<double>(i);
+			
+			result.emplace_back(
+				std::to_string(i) + ",,," + std::to_string(i + 1U) + "," + std::to_string(i * 3U) + "," + std::to_string(i * 7U) +
+				",,,,,Psc,," + std::to_string(f * 0.001) + "," + std::to_string(f * -0.002) + ",H," + std::to_string(100.0 + f) + "," +
+				std::to_string(f * 0.5) + "," + std::to_string(f * -0.25) + "," + std::to_string(f * 0.125) + ",H," +
+				std::to_string(std::fmod(f, 12.0)) + ",2.390,0.482,H,,," + std::to_string(f * -0.1) + ",-1.69,H,,,,F5,H"
+			);
+		}
+		
+		return result;
+	}
+	
+	BENCHMARK("ATHYG::V3 (parse)", [](State& _state) {
+		
+		using ATHYG_VERSION = ATHYG::V3;
+		
+		const auto rows = GenerateATHYGRows(s_StarCount);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			std::vector<glm::vec3> parsed;
+			parsed.reserve(rows.size());
+			
+			for (const auto& row : rows) {
+				
+				auto elements = Utils::Split(row, ',', ATHYG_VERSION::s_ElementCount);
+				
+				if (elements.size() > ATHYG_VERSION::s_ElementCount) {
+					elements.resize(ATHYG_VERSION::s_ElementCount);
+				}
+				
+				if (elements.size() == ATHYG_VERSION::s_ElementCount) {
+					
+					const auto star = ATHYG_VERSION((Utils::ToArray<std::string_view, ATHYG_VERSION::s_ElementCount>(std::move(elements))));
+					
+					if (star.mag.has_value() && *star.mag <= 6.0) {
+						parsed.emplace_back(star.x0.value_or(0.0), star.y0.value_or(0.0), star.z0.value_or(0.0));
+					}
+				}
+			}
+			
+			DoNotOptimise(parsed);
+		}
+		
+		_state.ItemsPerIteration(s_StarCount);
+	});
+	
+	// Implementation of Stars::LoadStars. Throughput is reported in bytes per second.
+	BENCHMARK("CSV::Reader (ATHYG projection)", [](State& _state) {
+		
+		using ATHYG_VERSION = ATHYG::V3;
+		
+		std::string text;
+		
+		for (const auto& row : GenerateATHYGRows(s_StarCount)) {
+			text += row;
+			text += '\n';
+		}
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			std::vector<glm::vec3> parsed;
+			parsed.reserve(s_StarCount);
+			
+			CSV::Reader reader(text);
+			
+			std::array<std::string_view, ATHYG_VERSION::s_PositionMagnitudeColumns.size()> fields;
+			
+			while (reader.Next(ATHYG_VERSION::s_PositionMagnitudeColumns, fields)) {
+				
+				const auto mag = Utils::TryParse<double>(fields[3U]);
+				
+				if (mag.has_value() && *mag <= 6.0) {
+					
+					parsed.emplace_back(
+						Utils::TryParse<double>(fields[0U]).value_or(0.0),
+						Utils::TryParse<double>(fields[1U]).value_or(0.0),
+						Utils::TryParse<double>(fields[2U]).value_or(0.0)
+					);
+				}
+			}
+			
+			DoNotOptimise(parsed);
+		}
+		
+		_state.ItemsPerIteration(text.size());
+	});
+	
+	/** @brief Number of rows in the file used to compare methods of loading the catalogue, which is roughly 20 MB. */
+	constexpr size_t s_StarFileCount = 131072U;
+	
+	/**
+	 * @brief Returns the path of a temporary file resembling an ATHYG (v3) catalogue file.
+	 * @note The file is written on first use and deleted on exit.
+	 */
+	const std::filesystem::path& ATHYGFile() {
+		
+		struct TemporaryFile final {
+			
+			std::filesystem::path m_Path;
+			
+			TemporaryFile() : m_Path(std::filesystem::temp_directory_path() / "fyp_bench_athyg.csv") {
+				
+				std::ofstream file(m_Path, std::ios::out | std::ios::trunc | std::ios::binary);
+				
+				file << "id,tyc,gaia,hyg,hip,hd,hr,gl,bayer,flam,con,proper,ra,dec,pos_src,dist,x0,y0,z0,dist_src,mag,absmag,ci,mag_src,rv,rv_src,pm_ra,pm_dec,pm_src,vx,vy,vz,spect,spect_src\n";
+				
+				for (const auto& row : GenerateATHYGRows(s_StarFileCount)) {
+					file << row << '\n';
+				}
+			}
+			
+			~TemporaryFile() {
+				
+				std::error_code ec;
+				std::filesystem::remove(m_Path, ec);
+			}
+		};
+		
+		static const TemporaryFile s_File;
+		
+		return s_File.m_Path;
+	}
+	
+	/** @brief Parses the position of each star in an ATHYG (v3) catalogue held in memory. */
+	size_t ParseATHYG(const std::string_view& _text) {
+		
+		using ATHYG_VERSION = ATHYG::V3;
+		
+		size_t result = 0U;
+		
+		CSV::Reader reader(_text);
+		reader.SkipRow();
+		
+		std::array<std::string_view, ATHYG_VERSION::s_PositionMagnitudeColumns.size()> fields;
+		
+		while (reader.Next(ATHYG_VERSION::s_PositionMagnitudeColumns, fields)) {
+			
+			const auto mag = Utils::TryParse<double>(fields[3U]);
+			
+			if (mag.has_value() && *mag <= 6.0) {
+				result += Utils::TryParse<double>(fields[0U]).has_value() ? 1U : 0U;
+			}
+		}
+		
+		return result;
+	}
+	
+	/*
+	 * Compare loading the catalogue with File::ReadAllText, which copies the file into a std::stringstream,
+	 * against File::Map, which parses it in place. The increase in peak resident memory is reported alongside.
+	 */
+	BENCHMARK("File::ReadAllText (ATHYG load)", [](State& _state) {
+		
+		const auto& path = ATHYGFile();
+		
+		Memory::ResetPeak();
+		
+		const auto baseline = Memory::Resident();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(ParseATHYG(File::ReadAllText(path).str()));
+		}
+		
+		_state.ItemsPerIteration(std::filesystem::file_size(path));
+		_state.Counter("peak_rss_delta_bytes", static_cast<double>(Memory::Peak() - std::min(baseline, Memory::Peak())));
+	});
+	
+	BENCHMARK("File::Map (ATHYG load)", [](State& _state) {
+		
+		const auto& path = ATHYGFile();
+		
+		Memory::ResetPeak();
+		
+		const auto baseline = Memory::Resident();
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			DoNotOptimise(ParseATHYG(File::Map(path, File::Sequential).View()));
+		}
+		
+		_state.ItemsPerIteration(std::filesystem::file_size(path));
+		_state.Counter("peak_rss_delta_bytes", static_cast<double>(Memory::Peak() - std::min(baseline, Memory::Peak())));
+	});
+	
+	/* PLANETS */
+	
+	constexpr std::array<std::string_view, 10U> s_Planets {
+		"Sol", "Mercury", "Venus", "Earth", "Moon", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune"
+	};
+	
+	BENCHMARK("VSOP87::A (all planets)", [](State& _state) {
+		
+		using V87 = VSOP<double, glm::defaultp>::V87::A;
+		
+		double time = 0.0;
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			const auto earth = V87::GetEarth(time);
+			const auto emb   = V87::GetEMB  (time);
+			
+			DoNotOptimise(V87::GetMercury(time));
+			DoNotOptimise(V87::GetVenus  (time));
+			DoNotOptimise(V87::GetMoon   (earth, emb));
+			DoNotOptimise(V87::GetMars   (time));
+			DoNotOptimise(V87::GetJupiter(time));
+			DoNotOptimise(V87::GetSaturn (time));
+			DoNotOptimise(V87::GetUranus (time));
+			DoNotOptimise(V87::GetNeptune(time));
+			
+			time += 0.0001;
+		}
+		
+		_state.ItemsPerIteration(10U);
+	});
+	
+	BENCHMARK("WGCCRE::GetOrientationVSOP87", [](State& _state) {
+		
+		double time = 0.0;
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& planet : s_Planets) {
+				DoNotOptimise(WGCCRE::GetOrientationVSOP87<double>(planet, time));
+			}
+			
+			time += 0.01;
+		}
+		
+		_state.ItemsPerIteration(s_Planets.size());
+	});
+	
+	/* ATMOSPHERE */
+	
+	BENCHMARK("ISA::TrySolve", [](State& _state) {
+		
+		constexpr size_t s_Samples = 128U;
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (size_t j = 0U; j < s_Samples; ++j) {
+				DoNotOptimise(Atmosphere::ISA<double>::TrySolve(static_cast<double>(j) * 600.0));
+			}
+		}
+		
+		_state.ItemsPerIteration(s_Samples);
+	});
+	
+	/* COORDINATES */
+	
+	constexpr size_t s_CoordCount = 1024U;
+	
+	/** @brief Generates GPS coordinates scattered around an origin. */
+	std::vector<glm::vec<3, scalar_t>> GenerateCoords(const glm::vec<3, scalar_t>& _origin, const size_t& _count) {
+		
+		std::vector<glm::vec<3, scalar_t>> result;
+		result.reserve(_count);
+		
+		for (size_t i = 0U; i < _count; ++i) {
+			
+			const auto f = static_cast<scalar_t>(i) / static_cast<scalar_t>(_count);
+			
+			result.emplace_back(_origin + glm::vec<3, scalar_t>(f * 0.01, f * -0.01, f * 50.0));
+		}
+		
+		return result;
+	}
+	
+	const glm::vec<3, scalar_t> s_Origin { 50.72, -1.88, 0.0 };
+	
+	BENCHMARK("Coords::GPS::GPSToCartesian", [](State& _state) {
+		
+		const auto coords = GenerateCoords(s_Origin, s_CoordCount);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& coord : coords) {
+				DoNotOptimise(Maths::Coords::GPS::GPSToCartesian(coord));
+			}
+		}
+		
+		_state.ItemsPerIteration(s_CoordCount);
+	});
+	
+	BENCHMARK("Coords::GPS::GPSToBounds", [](State& _state) {
+		
+		const auto coords = GenerateCoords(s_Origin, s_CoordCount);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& coord : coords) {
+				DoNotOptimise(Maths::Coords::GPS::GPSToBounds(coord, static_cast<scalar_t>(1.0)));
+			}
+		}
+		
+		_state.ItemsPerIteration(s_CoordCount);
+	});
+	
+	BENCHMARK("Coords::GPS::GPSToUV", [](State& _state) {
+		
+		const auto coords = GenerateCoords(s_Origin, s_CoordCount);
+		
+		const auto bounds = Maths::Coords::GPS::GPSToBounds(s_Origin, static_cast<scalar_t>(1.0));
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& coord : coords) {
+				DoNotOptimise(Maths::Coords::GPS::GPSToUV(glm::vec<2, scalar_t>(coord), bounds));
+			}
+		}
+		
+		_state.ItemsPerIteration(s_CoordCount);
+	});
+	
+	// Implementation of Meshing::Builder::ToWorldSpace.
+	BENCHMARK("Coords::GPS::GPSToWorld", [](State& _state) {
+		
+		const auto coords = GenerateCoords(s_Origin, s_CoordCount);
+		
+		for ([[maybe_unused]] const auto& i : _state) {
+			
+			for (const auto& coord : coords) {
+				DoNotOptimise(Maths::Coords::GPS::GPSToWorld(coord, s_Origin));
+			}
+		}
+		
+		_state.ItemsPerIteration(s_CoordCount);
+	});
+
+} // namespace
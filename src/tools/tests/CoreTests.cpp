@@ -0,0 +1,265 @@
+#include "Test.hpp"
+
+#include "../../engine/scripts/core/utils/Hashmap.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Tests;
+	using namespace LouiEriksson::Engine;
+	
+	/* HASHMAP */
+	
+	using map_t     = Hashmap<int32_t, int32_t>;
+	using model_t   = std::unordered_map<int32_t, int32_t>;
+	using entries_t = std::vector<std::pair<int32_t, int32_t>>;
+	
+	/** @brief Range of the keys used by the tests, kept small so that keys are frequently reused. */
+	constexpr int32_t s_KeyRange = 96;
+	
+	/** @brief Maximum number of views open at once. */
+	constexpr size_t s_MaxDepth = 4U;
+	
+	template<typename T>
+	entries_t Sorted(const T& _entries) {
+		
+		entries_t result;
+		
+		for (const auto& entry : _entries) {
+			result.emplace_back(entry.first, entry.second);
+		}
+		
+		std::sort(result.begin(), result.end());
+		
+		return result;
+	}
+	
+	/** @brief Compares every lookup of the Hashmap against the model. */
+	void ExpectMatchesModel(Context& _context, const map_t& _map, const model_t& _model) {
+		
+		const auto expected = Sorted(_model);
+		
+		EXPECT(_context, _map.size()  == _model.size());
+		EXPECT(_context, _map.empty() == _model.empty());
+		
+		EXPECT(_context, Sorted(_map.GetAll()) == expected);
+		EXPECT(_context, _map.Keys().size()    == expected.size());
+		EXPECT(_context, _map.Values().size()  == expected.size());
+		
+		for (int32_t key = 0; key < s_KeyRange; ++key) {
+			
+			const auto item  = _model.find(key);
+			const auto value = _map.Get(key);
+			
+			EXPECT(_context, _map.ContainsKey(key) == (item != _model.end()));
+			EXPECT(_context, value.has_value()     == (item != _model.end()));
+			
+			if (value.has_value() && item != _model.end()) {
+				EXPECT(_context, value.value() == item->second);
+			}
+		}
+	}
+	
+	/** @brief Builds a Hashmap and its model from a few random entries. */
+	std::pair<map_t, model_t> RandomMap(std::mt19937& _rng) {
+		
+		std::pair<map_t, model_t> result;
+		
+		for (auto i = _rng() % 16U; i > 0U; --i) {
+			
+			const auto key   = static_cast<int32_t>(_rng() % s_KeyRange);
+			const auto value = static_cast<int32_t>(_rng());
+			
+			result.first.Assign(key, value);
+			result.second[key] = value;
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Applies random operations to the Hashmap and the model, opening nested views as it goes.
+	 *
+	 * @details Every view opened while another is open visits the same entries as the outermost view, as entries are only
+	 *          added to storage once the last view closes. Each view is checked against that snapshot after the operations
+	 *          made while it was open.
+	 */
+	void Exercise(Context& _context, std::mt19937& _rng, map_t& _map, model_t& _model, const entries_t* _snapshot, const size_t& _depth) {
+		
+		for (auto i = 8U + (_rng() % 32U); i > 0U; --i) {
+			
+			const auto operation = _rng() % 64U;
+			
+			const auto key   = static_cast<int32_t>(_rng() % s_KeyRange);
+			const auto value = static_cast<int32_t>(_rng());
+			
+			if (operation < 16U) {
+				EXPECT(_context, _map.Add(key, value) == _model.emplace(key, value).second);
+			}
+			else if (operation < 32U) {
+				_map.Assign(key, value);
+				_model[key] = value;
+			}
+			else if (operation < 48U) {
+				EXPECT(_context, _map.Remove(key) == (_model.erase(key) != 0U));
+			}
+			else if (operation < 50U) {
+				_map.Clear();
+				_model.clear();
+			}
+			else if (operation < 52U) {
+				_map.Reserve(_rng() % 256U);
+			}
+			else if (operation < 54U) {
+				_map.Trim();
+			}
+			else if (operation < 56U) {
+				
+				// Copy or move from the Hashmap, which must be left unchanged if a view is open.
+				map_t copy(_map);
+				ExpectMatchesModel(_context, copy, _model);
+				
+				map_t moved(std::move(copy));
+				ExpectMatchesModel(_context, moved, _model);
+				
+				map_t target(std::move(_map));
+				ExpectMatchesModel(_context, target, _model);
+				
+				// Without a view, the entries were moved, so restore them before moving again.
+				if (_depth == 0U) {
+					_map = std::move(target);
+				}
+				
+				auto other = RandomMap(_rng).first;
+				other = std::move(_map);
+				ExpectMatchesModel(_context, other, _model);
+				
+				if (_depth == 0U) {
+					_map = std::move(other);
+				}
+			}
+			else if (operation < 58U) {
+				
+				// Replace the entries of the Hashmap, which any open views must not observe.
+				auto [other, model] = RandomMap(_rng);
+				
+				if (operation == 56U) {
+					_map = other;
+				}
+				else {
+					_map = std::move(other);
+				}
+				
+				_model = std::move(model);
+			}
+			else if (operation < 62U && _depth < s_MaxDepth) {
+				
+				const auto snapshot = _snapshot != nullptr ? *_snapshot : Sorted(_model);
+				
+				{
+					const auto view = _map.View();
+					
+					EXPECT(_context, view.size() == snapshot.size());
+					EXPECT(_context, Sorted(view) == snapshot);
+					
+					Exercise(_context, _rng, _map, _model, &snapshot, _depth + 1U);
+					
+					EXPECT(_context, view.size() == snapshot.size());
+					EXPECT(_context, Sorted(view) == snapshot);
+				}
+				
+				// Changes deferred by the view are flushed once the last one closes.
+				if (_depth == 0U) {
+					EXPECT(_context, Sorted(_map.View()) == Sorted(_model));
+				}
+			}
+			
+			ExpectMatchesModel(_context, _map, _model);
+		}
+	}
+	
+	TEST("Hashmap (random operations and nested views against std::unordered_map)", [](Context& _context) {
+		
+		std::mt19937 rng(4321U);
+		
+		map_t   map;
+		model_t model;
+		
+		for (size_t i = 0U; i < 400U; ++i) {
+			Exercise(_context, rng, map, model, nullptr, 0U);
+		}
+		
+		ExpectMatchesModel(_context, map, model);
+	});
+	
+	TEST("Hashmap (views while other threads modify)", [](Context& _context) {
+		
+		// Values are always derived from their key, so any torn or stale entry visited by a view is detectable.
+		const auto value_of = [](const int32_t& _key) { return _key * 7; };
+		
+		map_t map;
+		
+		std::atomic<bool> done(false);
+		
+		std::vector<std::thread> writers;
+		
+		for (uint32_t i = 0U; i < 2U; ++i) {
+			
+			writers.emplace_back([&map, &done, &value_of, i]() {
+				
+				std::mt19937 rng(i);
+				
+				while (!done) {
+					
+					const auto key = static_cast<int32_t>(rng() % s_KeyRange);
+					
+					switch (rng() % 4U) {
+						case 0U:  { map.Add(key, value_of(key));    break; }
+						case 1U:  { map.Assign(key, value_of(key)); break; }
+						case 2U:  { map.Remove(key);                break; }
+						default:  {
+							if (rng() % 64U == 0U) {
+								map.Clear();
+							}
+							break;
+						}
+					}
+				}
+			});
+		}
+		
+		for (size_t i = 0U; i < 2000U; ++i) {
+			
+			const auto view = map.View();
+			
+			std::vector<int32_t> keys;
+			
+			for (const auto& [key, value] : view) {
+				EXPECT(_context, value == value_of(key));
+				
+				keys.emplace_back(key);
+			}
+			
+			std::sort(keys.begin(), keys.end());
+			
+			EXPECT(_context, keys.size() == view.size());
+			EXPECT(_context, std::adjacent_find(keys.begin(), keys.end()) == keys.end());
+		}
+		
+		done = true;
+		
+		for (auto& writer : writers) {
+			writer.join();
+		}
+	});
+	
+} // namespace
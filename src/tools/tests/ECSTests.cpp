@@ -0,0 +1,129 @@
+#include "Test.hpp"
+
+#include "../../engine/scripts/core/Script.hpp"
+#include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/ecs/Component.hpp"
+#include "../../engine/scripts/ecs/GameObject.hpp"
+#include "../../engine/scripts/ecs/Storage.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Tests;
+	using namespace LouiEriksson::Engine;
+	
+	/* ECS */
+	
+	/** @brief Stand-in for a Script. */
+	struct Spawner final : Script {
+		
+		explicit Spawner(const std::weak_ptr<ECS::GameObject>& _parent) noexcept : Script(_parent) {}
+		
+		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Spawner); }
+	};
+	
+	/** @brief Stand-in for a Component required by a Query. */
+	struct Tag final : ECS::Component {
+		
+		explicit Tag(const std::weak_ptr<ECS::GameObject>& _parent) noexcept : ECS::Component(_parent) {}
+		
+		[[nodiscard]] std::type_index TypeID() const noexcept override { return typeid(Tag); }
+	};
+	
+	/** @brief Returns the Components visited by a Range, in order. */
+	template<typename R>
+	std::vector<const ECS::Component*> Visit(R&& _range) {
+		
+		std::vector<const ECS::Component*> result;
+		
+		for (const auto& match : _range) {
+			result.emplace_back(&std::get<0>(match));
+		}
+		
+		return result;
+	}
+	
+	TEST("ECS (Components added and removed during an open Range)", [](Context& _context) {
+		
+		constexpr size_t s_Objects = 8U;
+		constexpr size_t s_Scripts = 3U;
+		
+		const auto storage = std::make_shared<ECS::Storage>();
+		
+		std::vector<std::shared_ptr<ECS::GameObject>> objects;
+		
+		std::vector<const ECS::Component*> expected;
+		
+		for (size_t i = 0U; i < s_Objects; ++i) {
+			
+			const auto& object = objects.emplace_back(storage->Create({}, std::to_string(i)));
+			
+			for (size_t j = 0U; j < s_Scripts; ++j) {
+				expected.emplace_back(object->AddComponent<Spawner>().get());
+			}
+			
+			object->AddComponent<Tag>();
+		}
+		
+		EXPECT(_context, Visit(storage->Query<Script>()) == expected);
+		EXPECT(_context, Visit(storage->Query<Script, Tag>()) == expected);
+		
+		// Add a Script to each GameObject while visiting its first, as Script::Begin() may during Scene::Tick().
+		std::vector<const ECS::Component*> visited;
+		std::vector<const ECS::Component*> added;
+		
+		for (const auto& [script, owner] : storage->Query<Script>()) {
+			
+			if (visited.size() % s_Scripts == 0U) {
+				added.emplace_back(owner.AddComponent<Spawner>().get());
+			}
+			
+			visited.emplace_back(&script);
+		}
+		
+		// Every match which existed when the Range was opened is visited, and the new matches are not.
+		EXPECT(_context, visited == expected);
+		
+		// The order of existing matches is unchanged, and new matches follow them.
+		auto appended = expected;
+		appended.insert(appended.end(), added.begin(), added.end());
+		
+		EXPECT(_context, Visit(storage->Query<Script>()) == appended);
+		
+		// Replacing a required Component keeps the matches in place, while removing the last removes them.
+		visited.clear();
+		
+		for (const auto& [script, tag, owner] : storage->Query<Script, Tag>()) {
+			
+			EXPECT(_context, &tag == owner.GetComponent<Tag>().get());
+			
+			if (visited.empty()) {
+				owner.AddComponent<Tag>();
+				owner.RemoveComponent<Tag>();
+			}
+			else if (visited.size() == s_Scripts) {
+				objects[2U]->RemoveComponent<Tag>();
+			}
+			
+			visited.emplace_back(&script);
+		}
+		
+		std::vector<const ECS::Component*> remaining;
+		
+		for (const auto* component : appended) {
+			
+			if (component->Parent() != objects[2U]) {
+				remaining.emplace_back(component);
+			}
+		}
+		
+		EXPECT(_context, visited == remaining);
+		EXPECT(_context, Visit(storage->Query<Script, Tag>()) == remaining);
+	});
+	
+} // namespace
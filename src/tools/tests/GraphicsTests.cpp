@@ -0,0 +1,157 @@
+#include "Test.hpp"
+
+#include "../../engine/scripts/graphics/textures/BlockCompression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+	
+	using namespace LouiEriksson::Tests;
+	using namespace LouiEriksson::Engine::Graphics;
+	
+	/* BLOCK COMPRESSION */
+	
+	/*
+	 * Reference blocks are assembled by hand from the block layouts of the Direct3D 11 specification, and their texels are decoded
+	 * by its rules, independently of BlockCompression.
+	 */
+	
+	/** @brief Decodes a half-precision float, independently of BlockCompression. */
+	float FromHalf(const uint16_t& _value) {
+		
+		const auto exponent = static_cast<int>((_value >> 10U) & 0x1FU);
+		const auto mantissa = static_cast<float>(_value & 0x3FFU);
+		
+		return exponent == 0 ?
+			std::ldexp(mantissa, -24) :
+			std::ldexp(1.0F + (mantissa / 1024.0F), exponent - 15);
+	}
+	
+	/** @brief Returns the largest absolute difference between two sets of texels, over the given channels. */
+	float MaxError(const BlockCompression::Texels& _a, const BlockCompression::Texels& _b, const size_t& _channels) {
+		
+		float result = 0.0F;
+		
+		for (size_t c = 0U; c < _channels; ++c) {
+		for (size_t i = 0U; i < 16U;       ++i) {
+			result = std::max(result, std::abs(_a[c][i] - _b[c][i]));
+		}}
+		
+		return result;
+	}
+	
+	/** @brief Encodes texels as a block, and returns the decoded block. */
+	BlockCompression::Texels RoundTrip(const BlockCompression::Format& _format, const BlockCompression::Texels& _texels) {
+		
+		std::array<char, 16U> block {};
+		BlockCompression::EncodeBlock(_format, _texels, block.data());
+		
+		BlockCompression::Texels result {};
+		BlockCompression::DecodeBlock(_format, block.data(), result);
+		
+		return result;
+	}
+	
+	TEST("BlockCompression (BC1 reference block)", [](Context& _context) {
+		
+		// Four-colour mode (colour0 > colour1), with endpoints (31, 32, 0) and (0, 63, 31), and texel i using index i % 4.
+		const std::array<unsigned char, 8U> reference { 0x00, 0xFC, 0xFF, 0x07, 0xE4, 0xE4, 0xE4, 0xE4 };
+		
+		// The endpoints expanded to 8 bits, and the colours interpolated at 1/3 and 2/3.
+		const std::array<std::array<float, 3U>, 4U> palette {{
+			{ 255.0F, 130.0F,   0.0F },
+			{   0.0F, 255.0F, 255.0F },
+			{ 170.0F, 515.0F / 3.0F,  85.0F },
+			{  85.0F, 640.0F / 3.0F, 170.0F }
+		}};
+		
+		BlockCompression::Texels expected {};
+		
+		for (size_t i = 0U; i < 16U; ++i) {
+			
+			for (size_t c = 0U; c < 3U; ++c) {
+				expected[c][i] = palette[i % 4U][c];
+			}
+			
+			expected[3U][i] = 255.0F;
+		}
+		
+		BlockCompression::Texels decoded {};
+		BlockCompression::DecodeBlock(BlockCompression::BC1, reinterpret_cast<const char*>(reference.data()), decoded);
+		
+		// Decoders may round the interpolated colours.
+		EXPECT(_context, MaxError(decoded, expected, 3U) <= 1.0F);
+		
+		// The texels lie on a line, so encoding them must recover the endpoints.
+		EXPECT(_context, MaxError(RoundTrip(BlockCompression::BC1, expected), expected, 3U) <= 1.0F);
+	});
+	
+	TEST("BlockCompression (BC4 reference block)", [](Context& _context) {
+		
+		// Eight-value mode (red0 > red1), with endpoints 200 and 20, and texel i using index i % 8.
+		const std::array<unsigned char, 8U> reference { 0xC8, 0x14, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA };
+		
+		BlockCompression::Texels expected {};
+		
+		for (size_t i = 0U; i < 16U; ++i) {
+			
+			const auto index = i % 8U;
+			
+			     if (index == 0U) { expected[0U][i] = 200.0F; }
+			else if (index == 1U) { expected[0U][i] =  20.0F; }
+			else {
+				expected[0U][i] = ((200.0F * static_cast<float>(8U - index)) + (20.0F * static_cast<float>(index - 1U))) / 7.0F;
+			}
+		}
+		
+		BlockCompression::Texels decoded {};
+		BlockCompression::DecodeBlock(BlockCompression::BC4, reinterpret_cast<const char*>(reference.data()), decoded);
+		
+		EXPECT(_context, MaxError(decoded, expected, 1U) <= 0.5F);
+		EXPECT(_context, MaxError(RoundTrip(BlockCompression::BC4, expected), expected, 1U) <= 0.5F);
+	});
+	
+	TEST("BlockCompression (BC6H mode 11 reference block)", [](Context& _context) {
+		
+		/*
+		 * Mode 11 (0b00011), with 10-bit endpoints (100, 300, 500) and (900, 600, 50), and texel i using index i. The index of the
+		 * first texel is stored in 3 bits, as its most significant bit is implicitly zero.
+		 */
+		const std::array<unsigned char, 16U> reference {
+			0x83, 0x0C, 0x96, 0xE8, 0x23, 0x1C, 0x4B, 0x19, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE
+		};
+		
+		// Each endpoint is unquantised to 16 bits, interpolated by the weight of the index, and then scaled by 31/64 to a half.
+		const std::array<std::array<uint16_t, 3U>, 16U> halves {{
+			{  3115U,  9315U, 15515U }, {  4665U,  9896U, 14643U }, {  6603U, 10623U, 13553U }, {  8153U, 11204U, 12681U },
+			{  9703U, 11785U, 11810U }, { 11253U, 12367U, 10938U }, { 13190U, 13093U,  9848U }, { 14740U, 13674U,  8976U },
+			{ 16290U, 14256U,  8104U }, { 17840U, 14837U,  7232U }, { 19778U, 15563U,  6142U }, { 21328U, 16145U,  5270U },
+			{ 22878U, 16726U,  4399U }, { 24428U, 17307U,  3527U }, { 26365U, 18034U,  2437U }, { 27915U, 18615U,  1565U }
+		}};
+		
+		BlockCompression::Texels expected {};
+		
+		for (size_t i = 0U; i < 16U; ++i) {
+			
+			for (size_t c = 0U; c < 3U; ++c) {
+				expected[c][i] = FromHalf(halves[i][c]);
+			}
+			
+			expected[3U][i] = 1.0F;
+		}
+		
+		BlockCompression::Texels decoded {};
+		BlockCompression::DecodeBlock(BlockCompression::BC6H, reinterpret_cast<const char*>(reference.data()), decoded);
+		
+		// Decoding is exact, as every step is specified in integers.
+		EXPECT(_context, MaxError(decoded, expected, 4U) == 0.0F);
+		
+		// Both endpoints are among the texels, so encoding them must recover the endpoints and indices exactly.
+		EXPECT(_context, MaxError(RoundTrip(BlockCompression::BC6H, expected), expected, 4U) == 0.0F);
+	});
+	
+} // namespace
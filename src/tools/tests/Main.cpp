@@ -0,0 +1,60 @@
+#include "Test.hpp"
+
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @file Main.cpp
+ * @brief Headless tests of the engine's CPU-side utilities.
+ *
+ * @par Usage
+ * fyp_tests [--filter <substring>]
+ *
+ * @return Zero if every test passed.
+ */
+int main(int _argc, char* _argv[]) {
+	
+	int result = 0;
+	
+	try {
+		
+		std::string filter;
+		
+		// Parse arguments:
+		for (int i = 1; i < _argc; ++i) {
+			
+			const std::string_view arg(_argv[i]);
+			
+			if (i + 1 >= _argc) {
+				throw std::invalid_argument("Missing value for argument \"" + std::string(arg) + "\"!");
+			}
+			
+			const std::string value(_argv[++i]);
+			
+			if (arg == "--filter") { filter = value; }
+			else {
+				throw std::invalid_argument("Unknown argument \"" + std::string(arg) + "\"!");
+			}
+		}
+		
+		const auto failed = LouiEriksson::Tests::Registry::RunAll(filter, std::cout);
+		
+		if (failed > 0U) {
+			std::cout << failed << " test(s) failed." << std::endl;
+			
+			result = 1;
+		}
+	}
+	catch (const std::exception& e) {
+		std::cerr << e.what() << '\n';
+		
+		std::cerr << "Usage: " << _argv[0] << " [--filter <substring>]\n";
+		
+		result = 2;
+	}
+	
+	return result;
+}
@@ -0,0 +1,185 @@
+#include "Test.hpp"
+
+#include "../../engine/scripts/core/Types.hpp"
+#include "../../engine/scripts/core/utils/Bounds.hpp"
+#include "../../engine/scripts/core/utils/BVH.hpp"
+
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+	
+	using namespace LouiEriksson::Tests;
+	using namespace LouiEriksson::Engine;
+	
+	/* BVH */
+	
+	/**
+	 * @brief Compares the items found by a query of the BVH against a linear scan of every live item.
+	 *
+	 * @details The BVH tests the enlarged bounds of each leaf, so the scan must match those exactly. Every item whose exact bounds
+	 *          pass the test must also be found, as the enlarged bounds contain them.
+	 */
+	template<typename Query, typename Test>
+	void ExpectMatchesScan(Context& _context, const BVH<size_t>& _bvh, const std::vector<AABB>& _bounds, const std::vector<size_t>& _leaves, const Query& _query, const Test& _test) {
+		
+		std::vector<size_t> found;
+		_query([&found](const size_t& _item) { found.emplace_back(_item); });
+		
+		std::sort(found.begin(), found.end());
+		
+		EXPECT(_context, std::adjacent_find(found.begin(), found.end()) == found.end());
+		
+		std::vector<size_t> expected;
+		
+		for (size_t i = 0U; i < _leaves.size(); ++i) {
+			
+			if (_leaves[i] != BVH<size_t>::s_None) {
+				
+				if (_test(_bvh.Bounds(_leaves[i]))) {
+					expected.emplace_back(i);
+				}
+				else {
+					EXPECT(_context, !_test(_bounds[i]));
+				}
+			}
+		}
+		
+		EXPECT(_context, found == expected);
+	}
+	
+	TEST("BVH (random insert, update and remove against linear scan)", [](Context& _context) {
+		
+		std::mt19937 rng(1234U);
+		
+		std::uniform_real_distribution<scalar_t> position(-50.0, 50.0);
+		std::uniform_real_distribution<scalar_t>   extent(  0.1,  3.0);
+		std::uniform_real_distribution<scalar_t>     step( -1.0,  1.0);
+		
+		const auto random_vec3 = [&rng](auto& _distribution) {
+			return vec3(_distribution(rng), _distribution(rng), _distribution(rng));
+		};
+		
+		const auto random_aabb = [&]() {
+			
+			const auto centre = random_vec3(position);
+			const auto size   = random_vec3(extent);
+			
+			return AABB(centre - size, centre + size);
+		};
+		
+		BVH<size_t> bvh;
+		
+		// Bounds of each item, and the leaf holding it (or s_None once removed).
+		std::vector<AABB>   bounds;
+		std::vector<size_t> leaves;
+		
+		size_t live = 0U;
+		
+		for (size_t i = 0U; i < 20000U; ++i) {
+			
+			const auto operation = rng() % 8U;
+			
+			if (operation < 3U || live == 0U) {
+				
+				bounds.emplace_back(random_aabb());
+				leaves.emplace_back(bvh.Insert(bounds.back(), bounds.size() - 1U));
+				
+				++live;
+			}
+			else {
+				
+				const auto item = static_cast<size_t>(rng() % bounds.size());
+				
+				if (leaves[item] != BVH<size_t>::s_None) {
+					
+					if (operation < 6U) {
+						
+						// Small moves stay within the enlarged bounds, while teleports force a reinsertion.
+						const auto offset = operation < 5U ? random_vec3(step) : random_vec3(position);
+						
+						bounds[item] = AABB(bounds[item].m_Min + offset, bounds[item].m_Max + offset);
+						
+						bvh.Update(leaves[item], bounds[item]);
+						
+						EXPECT(_context, bvh.Bounds(leaves[item]).Contains(bounds[item]));
+					}
+					else if (operation == 6U) {
+						bvh.Remove(leaves[item]);
+					}
+					else {
+						bvh.RemoveIf([item](const size_t& _item) { return _item == item; });
+					}
+					
+					if (operation >= 6U) {
+						leaves[item] = BVH<size_t>::s_None;
+						
+						--live;
+					}
+				}
+			}
+			
+			if (i % 250U == 0U) {
+				
+				EXPECT(_context, bvh.size() == live);
+				
+				const Sphere sphere { random_vec3(position), extent(rng) * static_cast<scalar_t>(8.0) };
+				
+				ExpectMatchesScan(_context, bvh, bounds, leaves,
+					[&](const auto& _visit) { bvh.Query(sphere, _visit); },
+					[&](const AABB& _aabb) { return sphere.Overlaps(_aabb); }
+				);
+				
+				const auto region = random_aabb().Expanded(static_cast<scalar_t>(10.0));
+				
+				ExpectMatchesScan(_context, bvh, bounds, leaves,
+					[&](const auto& _visit) { bvh.Query(region, _visit); },
+					[&](const AABB& _aabb) { return region.Overlaps(_aabb); }
+				);
+				
+				const Frustum frustum(
+					glm::perspective(glm::radians(static_cast<scalar_t>(60.0)), static_cast<scalar_t>(1.5), static_cast<scalar_t>(0.1), static_cast<scalar_t>(60.0)) *
+					glm::lookAt(random_vec3(position), random_vec3(position), vec3(0.0, 1.0, 0.0))
+				);
+				
+				ExpectMatchesScan(_context, bvh, bounds, leaves,
+					[&](const auto& _visit) { bvh.Query(frustum, _visit); },
+					[&](const AABB& _aabb) { return frustum.Overlaps(_aabb); }
+				);
+				
+				const Ray ray { random_vec3(position), glm::normalize(random_vec3(step)), static_cast<scalar_t>(150.0) };
+				
+				ExpectMatchesScan(_context, bvh, bounds, leaves,
+					[&](const auto& _visit) {
+						
+						bvh.Raycast(ray, [&](const size_t& _item, const scalar_t& _distance) {
+							
+							scalar_t distance = 0.0;
+							
+							EXPECT(_context, ray.Intersects(bvh.Bounds(leaves[_item]), distance) && distance == _distance);
+							
+							_visit(_item);
+						});
+					},
+					[&](const AABB& _aabb) {
+						
+						scalar_t distance = 0.0;
+						
+						return ray.Intersects(_aabb, distance);
+					}
+				);
+			}
+		}
+		
+		// The tree must stay shallow, regardless of the order of modifications.
+		EXPECT(_context, bvh.Height() <= 4 * static_cast<int32_t>(std::log2(std::max(live, static_cast<size_t>(2U)))));
+	});
+	
+} // namespace
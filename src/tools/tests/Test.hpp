@@ -0,0 +1,185 @@
+#ifndef FINALYEARPROJECT_TEST_HPP
+#define FINALYEARPROJECT_TEST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define FYP_TEST_CONCAT_INNER(_a, _b) _a##_b
+#define FYP_TEST_CONCAT(_a, _b) FYP_TEST_CONCAT_INNER(_a, _b)
+
+/**
+ * @def TEST
+ * @brief Registers a test with the suite.
+ *
+ * @param[in] _name Unique name of the test.
+ * @param[in] ... Callable accepting a Tests::Context&, through which the test reports its expectations.
+ */
+#define TEST(_name, ...) static const bool FYP_TEST_CONCAT(_fyp_test_, __LINE__) = LouiEriksson::Tests::Registry::Add(_name, __VA_ARGS__)
+
+/**
+ * @def EXPECT
+ * @brief Records a failure of the running test if a condition does not hold.
+ *
+ * @param[in] _context The Tests::Context of the running test.
+ * @param[in] _condition The condition expected to hold.
+ */
+#define EXPECT(_context, _condition) (_context).Expect(static_cast<bool>(_condition), #_condition, __FILE__, __LINE__)
+
+namespace LouiEriksson::Tests {
+	
+	/**
+	 * @class Context
+	 * @brief Collects the failed expectations of a single test.
+	 */
+	class Context final {
+	
+	private:
+		
+		/** @brief Maximum number of failures reported per test, so that a broken loop does not flood the log. */
+		static constexpr size_t s_MaxReported = 8U;
+		
+		size_t m_Checks;
+		
+		std::vector<std::string> m_Failures;
+	
+	public:
+		
+		Context() noexcept :
+			m_Checks(0U) {}
+		
+		/**
+		 * @brief Records the outcome of an expectation.
+		 * @see EXPECT
+		 */
+		void Expect(const bool& _condition, const char* _expression, const char* _file, const int& _line) {
+			
+			++m_Checks;
+			
+			if (!_condition) {
+				m_Failures.emplace_back(std::string(_file) + ':' + std::to_string(_line) + ": " + _expression);
+			}
+		}
+		
+		/** @brief Returns the number of expectations checked. */
+		[[nodiscard]] constexpr const size_t& Checks() const noexcept { return m_Checks; }
+		
+		/** @brief Returns a description of each failed expectation. */
+		[[nodiscard]] constexpr const std::vector<std::string>& Failures() const noexcept { return m_Failures; }
+		
+		/** @brief Writes the failed expectations to a stream. */
+		void Report(std::ostream& _log) const {
+			
+			for (size_t i = 0U; i < std::min(m_Failures.size(), s_MaxReported); ++i) {
+				_log << "    " << m_Failures[i] << '\n';
+			}
+			
+			if (m_Failures.size() > s_MaxReported) {
+				_log << "    (" << m_Failures.size() - s_MaxReported << " more)\n";
+			}
+		}
+	};
+	
+	/**
+	 * @class Registry
+	 * @brief Holds, runs and reports every test in the suite.
+	 */
+	class Registry final {
+	
+	public:
+		
+		using function_t = std::function<void(Context&)>;
+	
+	private:
+		
+		struct Entry final {
+			
+			std::string m_Name;
+			
+			function_t m_Function;
+		};
+		
+		static std::vector<Entry>& Entries() {
+			
+			static std::vector<Entry> s_Entries;
+			
+			return s_Entries;
+		}
+	
+	public:
+		
+		/**
+		 * @brief Registers a test.
+		 * @see TEST
+		 */
+		static bool Add(std::string _name, function_t _function) {
+			
+			Entries().push_back({ std::move(_name), std::move(_function) });
+			
+			return true;
+		}
+		
+		/**
+		 * @brief Runs every registered test matching the filter, in order of name.
+		 *
+		 * @details A test fails if any of its expectations fail, or if it throws.
+		 *
+		 * @param[in] _filter Only tests whose name contains this string are run.
+		 * @param[in,out] _log Stream to which progress is reported.
+		 * @return The number of tests which failed.
+		 */
+		static size_t RunAll(const std::string& _filter, std::ostream& _log) {
+			
+			size_t result = 0U;
+			
+			auto entries = Entries();
+			
+			std::sort(entries.begin(), entries.end(), [](const Entry& _a, const Entry& _b) {
+				return _a.m_Name < _b.m_Name;
+			});
+			
+			for (const auto& entry : entries) {
+				
+				if (entry.m_Name.find(_filter) != std::string::npos) {
+					
+					Context context;
+					
+					std::string error;
+					
+					try {
+						entry.m_Function(context);
+					}
+					catch (const std::exception& e) {
+						error = e.what();
+					}
+					
+					const auto passed = context.Failures().empty() && error.empty();
+					
+					_log << (passed ? "[PASS] " : "[FAIL] ") << entry.m_Name << " (" << context.Checks() << " checks)\n";
+					
+					context.Report(_log);
+					
+					if (!error.empty()) {
+						_log << "    threw: " << error << '\n';
+					}
+					
+					if (!passed) {
+						++result;
+					}
+				}
+			}
+			
+			_log.flush();
+			
+			return result;
+		}
+	};
+	
+} // LouiEriksson::Tests
+
+#endif //FINALYEARPROJECT_TEST_HPP